@@ -112,6 +112,55 @@ void JSContextGroupClearExecutionTimeLimit(JSContextGroupRef group)
         vm.watchdog()->setTimeLimit(Watchdog::noTimeLimit);
 }
 
+void JSContextGroupSetHeapLimit(JSContextGroupRef group, size_t limit, JSHeapLimitExceededCallback callback, void* callbackData)
+{
+    VM& vm = *toJS(group);
+    JSLockHolder locker(&vm);
+    if (!callback) {
+        vm.heap.setHardHeapLimit(limit);
+        return;
+    }
+    vm.heap.setHardHeapLimit(limit, [group, callback, callbackData] (size_t heapSize, size_t heapLimit) {
+        callback(group, heapSize, heapLimit, callbackData);
+    });
+}
+
+void JSContextGroupClearHeapLimit(JSContextGroupRef group)
+{
+    VM& vm = *toJS(group);
+    JSLockHolder locker(&vm);
+    vm.heap.setHardHeapLimit(0);
+}
+
+size_t JSContextGroupCopyGarbageCollectionEvents(JSContextGroupRef group, JSGarbageCollectionEvent* events, size_t maxCount)
+{
+    VM& vm = *toJS(group);
+    Vector<GCEvent> gcEvents = vm.heap.gcEventLog().events();
+    size_t count = std::min<size_t>(gcEvents.size(), maxCount);
+    size_t first = gcEvents.size() - count;
+    for (size_t i = 0; i < count; ++i) {
+        const GCEvent& gcEvent = gcEvents[first + i];
+        JSGarbageCollectionEvent& event = events[i];
+        event.sequenceNumber = gcEvent.sequenceNumber;
+        event.isFullCollection = gcEvent.scope == CollectionScope::Full;
+        event.startTime = gcEvent.wallClockStartTime.secondsSinceEpoch().seconds();
+        event.duration = (gcEvent.endTime - gcEvent.startTime).seconds();
+        event.bytesBefore = gcEvent.bytesBefore;
+        event.bytesAfter = gcEvent.bytesAfter;
+        event.numberOfPauses = gcEvent.numberOfPauses;
+        event.totalPauseTime = gcEvent.totalPauseTime.seconds();
+        event.maxPauseTime = gcEvent.maxPauseTime.seconds();
+        event.mutatorBlockedTime = gcEvent.mutatorBlockedTime.seconds();
+        event.constraintSolvingTime = gcEvent.constraintSolvingTime.seconds();
+        event.beginPhaseTime = gcEvent.timeInPhase(CollectorPhase::Begin).seconds();
+        event.fixpointPhaseTime = gcEvent.timeInPhase(CollectorPhase::Fixpoint).seconds();
+        event.concurrentPhaseTime = gcEvent.timeInPhase(CollectorPhase::Concurrent).seconds();
+        event.reloopPhaseTime = gcEvent.timeInPhase(CollectorPhase::Reloop).seconds();
+        event.endPhaseTime = gcEvent.timeInPhase(CollectorPhase::End).seconds();
+    }
+    return count;
+}
+
 // From the API's perspective, a global context remains alive iff it has been JSGlobalContextRetained.
 
 JSGlobalContextRef JSGlobalContextCreate(JSClassRef globalObjectClass)
@@ -29,6 +29,7 @@
 #include <JavaScriptCore/JSObjectRef.h>
 #include <JavaScriptCore/JSValueRef.h>
 #include <JavaScriptCore/WebKitAvailability.h>
+#include <stdint.h>
 
 #ifndef __cplusplus
 #include <stdbool.h>
@@ -94,6 +95,106 @@ JS_EXPORT void JSContextGroupSetExecutionTimeLimit(JSContextGroupRef group, doub
 */
 JS_EXPORT void JSContextGroupClearExecutionTimeLimit(JSContextGroupRef group) CF_AVAILABLE(10_6, 7_0);
 
+/*!
+@typedef JSHeapLimitExceededCallback
+@abstract The callback invoked when the heap is still over the hard limit
+ previously specified via JSContextGroupSetHeapLimit after the garbage collector
+ has done everything it can to get back under it.
+@param group The JavaScript context group whose heap is over the limit.
+@param heapSize The size of the heap in bytes after the last full collection.
+@param heapLimit The hard heap limit in bytes.
+@param context User specified context data previously passed to
+ JSContextGroupSetHeapLimit.
+@discussion The callback is invoked on the thread that holds the JavaScript lock,
+ at the end of a garbage collection. Within this callback function, you may call
+ JSContextGroupSetHeapLimit to raise the limit, JSContextGroupClearHeapLimit to
+ remove it, or arrange for the scripts running in the group to be terminated.
+*/
+typedef void
+(*JSHeapLimitExceededCallback) (JSContextGroupRef group, size_t heapSize, size_t heapLimit, void* context);
+
+/*!
+@function
+@abstract Sets a hard limit on the size of the JavaScript heap.
+@param group The JavaScript context group that this limit applies to.
+@param limit The limit in bytes, counting both garbage collected objects and the
+ memory they report as being kept alive outside of the heap.
+@param callback The callback function that will be invoked when the limit cannot
+ be honored. May be NULL.
+@param context User data that you can provide to be passed back to you
+ in your callback.
+@discussion As the heap approaches the limit, the garbage collector collects more
+ often, then does full collections only, and finally throws away all compiled
+ code. Allocation is never refused: if the heap is still over the limit after all
+ of that, the callback is invoked so that you can decide what to do.
+*/
+JS_EXPORT void JSContextGroupSetHeapLimit(JSContextGroupRef group, size_t limit, JSHeapLimitExceededCallback callback, void* context);
+
+/*!
+@function
+@abstract Clears the hard limit on the size of the JavaScript heap.
+@param group The JavaScript context group that the limit is cleared on.
+*/
+JS_EXPORT void JSContextGroupClearHeapLimit(JSContextGroupRef group);
+
+/*!
+@struct JSGarbageCollectionEvent
+@abstract A record of one garbage collection cycle. All times are in seconds.
+@field sequenceNumber The number of this cycle in the context group, starting at 1.
+ Gaps in the sequence numbers mean that records were dropped.
+@field isFullCollection true if the whole heap was collected, false if only
+ objects allocated since the last collection were.
+@field startTime When the cycle started, on the wall clock, in seconds since
+ January 1, 1970 UTC. Durations are measured on a monotonic clock, so they are
+ not affected if the wall clock is changed during a cycle.
+@field duration The time from the start to the end of the cycle, including the
+ time the collector ran concurrently with JavaScript.
+@field bytesBefore The size of the heap when the cycle started.
+@field bytesAfter The size of the heap when the cycle ended.
+@field numberOfPauses How many times JavaScript execution was stopped.
+@field totalPauseTime The total time JavaScript execution was stopped.
+@field maxPauseTime The longest single time JavaScript execution was stopped.
+@field mutatorBlockedTime The time the thread running JavaScript spent waiting
+ for the collector.
+@field constraintSolvingTime The time spent executing marking constraints.
+@field beginPhaseTime The time spent setting up the cycle.
+@field fixpointPhaseTime The time spent marking with JavaScript stopped.
+@field concurrentPhaseTime The time spent marking concurrently with JavaScript.
+@field reloopPhaseTime The time spent between concurrent and stopped marking.
+@field endPhaseTime The time spent finishing the cycle.
+*/
+typedef struct {
+    uint64_t sequenceNumber;
+    bool isFullCollection;
+    double startTime;
+    double duration;
+    size_t bytesBefore;
+    size_t bytesAfter;
+    unsigned numberOfPauses;
+    double totalPauseTime;
+    double maxPauseTime;
+    double mutatorBlockedTime;
+    double constraintSolvingTime;
+    double beginPhaseTime;
+    double fixpointPhaseTime;
+    double concurrentPhaseTime;
+    double reloopPhaseTime;
+    double endPhaseTime;
+} JSGarbageCollectionEvent;
+
+/*!
+@function
+@abstract Copies the records of the most recent garbage collection cycles.
+@param group The JavaScript context group whose collections you want to inspect.
+@param events The array to copy the records to, oldest first. May be NULL if
+ maxCount is 0.
+@param maxCount The number of records that fit in events.
+@result The number of records copied.
+@discussion Each context group keeps a fixed number of records, set by the
+ gcEventLogSize option. Records are kept whether or not anybody asks for them.
+*/
+JS_EXPORT size_t JSContextGroupCopyGarbageCollectionEvents(JSContextGroupRef group, JSGarbageCollectionEvent* events, size_t maxCount);
+
 /*!
 @function
 @abstract Gets a whether or not remote inspection is enabled on the context.
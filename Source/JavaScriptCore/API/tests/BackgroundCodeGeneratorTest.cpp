@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "BackgroundCodeGeneratorTest.h"
+
+#include "BackgroundCodeGenerator.h"
+#include "Completion.h"
+#include "Exception.h"
+#include "InitializeThreading.h"
+#include "JSCInlines.h"
+#include "JSGlobalObject.h"
+#include "Options.h"
+#include "VM.h"
+#include <stdio.h>
+#include <wtf/Lock.h>
+#include <wtf/threads/BinarySemaphore.h>
+
+using namespace JSC;
+
+static const char* programSource =
+    "function sum(values) { var result = 0; for (var i = 0; i < values.length; ++i) result += values[i]; return result; }" "\n"
+    "class Counter { constructor() { this.count = 0; } increment() { return ++this.count; } }" "\n"
+    "var counter = new Counter();" "\n"
+    "counter.increment();" "\n"
+    "sum([1, 2, 3, 4]) + counter.increment();";
+static const int32_t programResult = 12;
+
+static RefPtr<PrecompiledProgram> generateAndWait(const char* source, BackgroundCodeGenerator::Priority priority = BackgroundCodeGenerator::Priority::Normal)
+{
+    BinarySemaphore semaphore;
+    RefPtr<PrecompiledProgram> program;
+    BackgroundCodeGenerator::singleton().generate(String(source), ASCIILiteral("background-code-generator-test.js"), TextPosition(), priority, [&] (Ref<PrecompiledProgram>&& result) {
+        program = WTFMove(result);
+        semaphore.signal();
+    });
+    semaphore.wait(WallTime::infinity());
+    return program;
+}
+
+// Installs the program in a fresh VM and runs it. Returns whether it was installed.
+static bool installAndRun(const char* source, PrecompiledProgram& program, JSValue& result, bool& threwSyntaxError)
+{
+    bool didInstall;
+    RefPtr<VM> vm = VM::create();
+    {
+        JSLockHolder locker(vm.get());
+        JSGlobalObject* globalObject = JSGlobalObject::create(*vm, JSGlobalObject::createStructure(*vm, jsNull()));
+        SourceCode sourceCode = makeSource(String(source), SourceOrigin(), ASCIILiteral("background-code-generator-test.js"));
+        didInstall = BackgroundCodeGenerator::install(*vm, sourceCode, program);
+
+        NakedPtr<Exception> exception;
+        result = evaluate(globalObject->globalExec(), sourceCode, JSValue(), exception);
+        threwSyntaxError = exception && exception->value().isObject()
+            && exception->value().toWTFString(globalObject->globalExec()).startsWith("SyntaxError");
+        if (!result.isInt32())
+            result = JSValue();
+    }
+    vm = nullptr;
+    return didInstall;
+}
+
+int testBackgroundCodeGenerator()
+{
+    bool failed = false;
+    auto check = [&] (bool condition, const char* description) {
+        if (!condition) {
+            printf("FAIL: background code generator: %s.\n", description);
+            failed = true;
+        }
+    };
+
+    JSC::initializeThreading();
+    Options::initialize(); // Ensure options is initialized first.
+
+    // The generator is created the first time it is used, so this gives it a single thread,
+    // which makes the order of the jobs observable. Idle VMs are destroyed almost right away.
+    unsigned oldNumberOfThreads = Options::numberOfBackgroundCodeGenerationThreads();
+    double oldIdleTime = Options::backgroundCodeGenerationIdleTime();
+    Options::numberOfBackgroundCodeGenerationThreads() = 1;
+    Options::backgroundCodeGenerationIdleTime() = 0.1;
+    BackgroundCodeGenerator& generator = BackgroundCodeGenerator::singleton();
+
+    JSValue result;
+    bool threwSyntaxError;
+
+    RefPtr<PrecompiledProgram> program = generateAndWait(programSource);
+    check(program && program->didSucceed(), "the program was not generated");
+    if (program && program->didSucceed()) {
+        check(program->encodedSize(), "the generated program is empty");
+        check(installAndRun(programSource, *program, result, threwSyntaxError), "the generated program was not installed");
+        check(result.isInt32() && result.asInt32() == programResult, "the installed program did not give the expected result");
+    }
+
+    // A VM with a profiler needs instrumented bytecode, so it compiles the program itself.
+    if (program && program->didSucceed()) {
+        for (bool* useProfiler : { &Options::useTypeProfiler(), &Options::useControlFlowProfiler() }) {
+            bool oldUseProfiler = *useProfiler;
+            *useProfiler = true;
+            check(!installAndRun(programSource, *program, result, threwSyntaxError), "the generated program was installed in a VM with a profiler");
+            check(result.isInt32() && result.asInt32() == programResult, "the program did not give the expected result in a VM with a profiler");
+            *useProfiler = oldUseProfiler;
+        }
+    }
+
+    static const char* invalidSource = "var x = ;";
+    program = generateAndWait(invalidSource);
+    check(program && !program->didSucceed(), "a program with a syntax error was generated");
+    if (program) {
+        check(!installAndRun(invalidSource, *program, result, threwSyntaxError), "a program with a syntax error was installed");
+        check(threwSyntaxError, "the syntax error was not reported when the program ran");
+    }
+
+    // Hold the generator thread in the completion handler of a first job, queue normal and
+    // high priority jobs behind it, then check that the high priority job ran first.
+    Lock completionOrderLock;
+    Vector<unsigned> completionOrder;
+    BinarySemaphore blockerStarted;
+    BinarySemaphore releaseBlocker;
+    BinarySemaphore allDone;
+    unsigned remainingJobs = 4;
+    auto queueJob = [&] (unsigned identifier, BackgroundCodeGenerator::Priority priority) {
+        generator.generate(String(programSource), ASCIILiteral("background-code-generator-test.js"), TextPosition(), priority, [&, identifier] (Ref<PrecompiledProgram>&&) {
+            if (!identifier) {
+                blockerStarted.signal();
+                releaseBlocker.wait(WallTime::infinity());
+            }
+            LockHolder locker(completionOrderLock);
+            completionOrder.append(identifier);
+            if (!--remainingJobs)
+                allDone.signal();
+        });
+    };
+    queueJob(0, BackgroundCodeGenerator::Priority::Normal);
+    blockerStarted.wait(WallTime::infinity());
+    queueJob(1, BackgroundCodeGenerator::Priority::Normal);
+    queueJob(2, BackgroundCodeGenerator::Priority::Normal);
+    queueJob(3, BackgroundCodeGenerator::Priority::High);
+    releaseBlocker.signal();
+    allDone.wait(WallTime::infinity());
+    check(completionOrder == Vector<unsigned>({ 0, 3, 1, 2 }), "the high priority program was not generated first");
+
+    // The completion handler runs before the idle timer starts, so the VM is still alive here.
+    unsigned liveVMCountAfterJob = 0;
+    program = nullptr;
+    {
+        BinarySemaphore semaphore;
+        generator.generate(String(programSource), ASCIILiteral("background-code-generator-test.js"), TextPosition(), BackgroundCodeGenerator::Priority::Normal, [&] (Ref<PrecompiledProgram>&&) {
+            liveVMCountAfterJob = generator.liveVMCount();
+            semaphore.signal();
+        });
+        semaphore.wait(WallTime::infinity());
+    }
+    check(liveVMCountAfterJob == 1, "the generator thread had no VM while generating");
+    for (unsigned i = 0; i < 100 && generator.liveVMCount(); ++i)
+        WTF::sleep(Seconds::fromMilliseconds(50));
+    check(!generator.liveVMCount(), "the VM of the idle generator thread was not destroyed");
+
+    program = generateAndWait(programSource);
+    check(program && program->didSucceed(), "the program was not generated after the VM was destroyed");
+
+    Options::numberOfBackgroundCodeGenerationThreads() = oldNumberOfThreads;
+    Options::backgroundCodeGenerationIdleTime() = oldIdleTime;
+
+    printf("%s: background code generator tests.\n", failed ? "FAIL" : "PASS");
+    return failed;
+}
@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "BytecodeCacheTest.h"
+
+#include "BytecodeCache.h"
+#include "CodeCache.h"
+#include "Completion.h"
+#include "InitializeThreading.h"
+#include "JSCInlines.h"
+#include "JSGlobalObject.h"
+#include "Options.h"
+#include "VM.h"
+#include <stdio.h>
+#include <wtf/text/CString.h>
+
+#if OS(UNIX)
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace JSC;
+
+#if OS(UNIX)
+
+static const char* programSource =
+    "function double(x) { return x * 2; }" "\n"
+    "function Point(x, y) { this.x = x; this.y = y; }" "\n"
+    "var result = 0;" "\n"
+    "for (var i = 0; i < 10; ++i)" "\n"
+    "    result += double(i) + new Point(i, 1).y;" "\n"
+    "result;";
+static const int32_t programResult = 100;
+
+static SourceCode makeProgramSource(const char* source)
+{
+    return makeSource(String(source), SourceOrigin(), ASCIILiteral("bytecode-cache-test.js"));
+}
+
+static SourceCodeKey makeProgramKey(const SourceCode& source)
+{
+    return SourceCodeKey(
+        source, String(), SourceCodeType::ProgramType, JSParserStrictMode::NotStrict, JSParserScriptMode::Classic,
+        DerivedContextType::None, EvalContextType::None, false, DebuggerOff, TypeProfilerEnabled::No, ControlFlowProfilerEnabled::No);
+}
+
+// Runs the programs in a fresh VM and destroys it, which writes their bytecode cache entries.
+static bool runPrograms(const Vector<const char*>& sources, const Vector<int32_t>& expectedResults)
+{
+    bool succeeded = true;
+    RefPtr<VM> vm = VM::create();
+    {
+        JSLockHolder locker(vm.get());
+        JSGlobalObject* globalObject = JSGlobalObject::create(*vm, JSGlobalObject::createStructure(*vm, jsNull()));
+        for (size_t i = 0; i < sources.size(); ++i) {
+            NakedPtr<Exception> exception;
+            JSValue result = evaluate(globalObject->globalExec(), makeProgramSource(sources[i]), JSValue(), exception);
+            succeeded = succeeded && !exception && result.isInt32() && result.asInt32() == expectedResults[i];
+        }
+    }
+    vm = nullptr;
+    return succeeded;
+}
+
+static Vector<String> cacheFiles(const char* directory)
+{
+    Vector<String> files;
+    DIR* dir = opendir(directory);
+    if (!dir)
+        return files;
+    while (struct dirent* entry = readdir(dir)) {
+        size_t length = strlen(entry->d_name);
+        if (length > 5 && !strcmp(entry->d_name + length - 5, ".jscb"))
+            files.append(makeString(directory, '/', entry->d_name));
+    }
+    closedir(dir);
+    return files;
+}
+
+static bool readFile(const String& path, Vector<uint8_t>& data)
+{
+    FILE* file = fopen(path.utf8().data(), "rb");
+    if (!file)
+        return false;
+    uint8_t buffer[4096];
+    while (size_t count = fread(buffer, 1, sizeof(buffer), file))
+        data.append(buffer, count);
+    fclose(file);
+    return !data.isEmpty();
+}
+
+static bool writeFile(const String& path, const uint8_t* data, size_t size)
+{
+    FILE* file = fopen(path.utf8().data(), "wb");
+    if (!file)
+        return false;
+    bool succeeded = fwrite(data, 1, size, file) == size;
+    fclose(file);
+    return succeeded;
+}
+
+// Decodes the bytes the way a VM loading the cache does.
+static bool decodesFromFile(const String& path, const Vector<uint8_t>& data)
+{
+    if (!writeFile(path, data.data(), data.size()))
+        return false;
+
+    bool decoded = false;
+    RefPtr<VM> vm = VM::create();
+    {
+        JSLockHolder locker(vm.get());
+        SourceCode source = makeProgramSource(programSource);
+        if (RefPtr<CachedBytecode> cachedBytecode = CachedBytecode::create(path))
+            decoded = !!BytecodeCache::decodeProgram(*vm, source, makeProgramKey(source), *cachedBytecode);
+    }
+    vm = nullptr;
+    return decoded;
+}
+
+// Decodes the bytes the way the bytecode generated on a background thread is installed.
+static bool decodesFromMemory(const Vector<uint8_t>& data)
+{
+    bool decoded = false;
+    RefPtr<VM> vm = VM::create();
+    {
+        JSLockHolder locker(vm.get());
+        SourceCode source = makeProgramSource(programSource);
+        Vector<uint8_t> buffer = data;
+        Ref<CachedBytecode> cachedBytecode = CachedBytecode::create(WTFMove(buffer));
+        decoded = !!BytecodeCache::decodeProgram(*vm, source, makeProgramKey(source), cachedBytecode.get());
+    }
+    vm = nullptr;
+    return decoded;
+}
+
+static bool runsFromCachedBytecode(const String& path)
+{
+    bool succeeded = false;
+    RefPtr<VM> vm = VM::create();
+    {
+        JSLockHolder locker(vm.get());
+        JSGlobalObject* globalObject = JSGlobalObject::create(*vm, JSGlobalObject::createStructure(*vm, jsNull()));
+        SourceCode source = makeProgramSource(programSource);
+        RefPtr<CachedBytecode> cachedBytecode = CachedBytecode::create(path);
+        if (cachedBytecode && vm->codeCache()->addPrecompiledProgram(*vm, source, *cachedBytecode)) {
+            NakedPtr<Exception> exception;
+            JSValue result = evaluate(globalObject->globalExec(), source, JSValue(), exception);
+            succeeded = !exception && result.isInt32() && result.asInt32() == programResult;
+        }
+    }
+    vm = nullptr;
+    return succeeded;
+}
+
+static void removeDirectory(const char* directory)
+{
+    for (auto& file : cacheFiles(directory))
+        unlink(file.utf8().data());
+    rmdir(directory);
+}
+
+#endif // OS(UNIX)
+
+int testBytecodeCache()
+{
+#if OS(UNIX)
+    bool failed = false;
+    auto check = [&] (bool condition, const char* description) {
+        if (!condition) {
+            printf("FAIL: bytecode cache: %s.\n", description);
+            failed = true;
+        }
+    };
+
+    JSC::initializeThreading();
+    Options::initialize(); // Ensure options is initialized first.
+
+    const char* oldBytecodeCachePath = Options::bytecodeCachePath();
+    unsigned oldMinimumBytecodeCacheSourceLength = Options::minimumBytecodeCacheSourceLength();
+    double oldBytecodeCacheWriteDelay = Options::bytecodeCacheWriteDelay();
+    unsigned oldBytecodeCacheMaximumSize = Options::bytecodeCacheMaximumSize();
+
+    char directoryTemplate[] = "/tmp/testapi-bytecode-cache.XXXXXX";
+    const char* directory = mkdtemp(directoryTemplate);
+    if (!directory) {
+        printf("FAIL: bytecode cache: could not create a cache directory.\n");
+        return 1;
+    }
+
+    Options::bytecodeCachePath() = directory;
+    Options::minimumBytecodeCacheSourceLength() = 0;
+    // Entries are only written when the VM is destroyed.
+    Options::bytecodeCacheWriteDelay() = 1000;
+
+    check(runPrograms({ programSource }, { programResult }), "the program did not run");
+    Vector<String> files = cacheFiles(directory);
+    check(files.size() == 1, "the program was not written to the cache");
+
+    Vector<uint8_t> data;
+    if (files.size() == 1 && readFile(files[0], data)) {
+        String path = files[0];
+        check(decodesFromFile(path, data), "the cache entry did not decode");
+        check(decodesFromMemory(data), "the cache entry did not decode from memory");
+        check(runsFromCachedBytecode(path), "the decoded program did not give the same result");
+        check(runPrograms({ programSource }, { programResult }), "the program did not run from the cache");
+
+        for (size_t size : { data.size() - 1, data.size() / 2, static_cast<size_t>(10) }) {
+            Vector<uint8_t> truncated = data;
+            truncated.shrink(size);
+            check(!decodesFromFile(path, truncated), "a truncated entry was decoded");
+            check(!decodesFromMemory(truncated), "a truncated entry was decoded from memory");
+        }
+
+        // Only files carry a digest. A flipped byte may decode to different but valid bytecode,
+        // so the in-memory format is not expected to reject it.
+        Vector<uint8_t> corrupt = data;
+        corrupt[data.size() / 2] ^= 0x55;
+        check(!decodesFromFile(path, corrupt), "a corrupt entry was decoded");
+
+        Vector<uint8_t> otherVersion = data;
+        otherVersion[sizeof(uint32_t)]++;
+        check(!decodesFromFile(path, otherVersion), "an entry with another format version was decoded");
+        check(!decodesFromMemory(otherVersion), "an entry with another format version was decoded from memory");
+
+        check(decodesFromFile(path, data), "the cache entry did not decode after being restored");
+    }
+
+    // With a limit smaller than any entry, each write evicts every other entry.
+    Options::bytecodeCacheMaximumSize() = 1;
+    check(runPrograms({ "var a = 1; function f() { return a + 1; } f();", "var b = 2; function g() { return b + 2; } g();" }, { 2, 4 }), "the programs did not run");
+    check(cacheFiles(directory).size() == 1, "the cache was not trimmed to its maximum size");
+
+    removeDirectory(directory);
+
+    Options::bytecodeCachePath() = oldBytecodeCachePath;
+    Options::minimumBytecodeCacheSourceLength() = oldMinimumBytecodeCacheSourceLength;
+    Options::bytecodeCacheWriteDelay() = oldBytecodeCacheWriteDelay;
+    Options::bytecodeCacheMaximumSize() = oldBytecodeCacheMaximumSize;
+
+    printf("%s: bytecode cache tests.\n", failed ? "FAIL" : "PASS");
+    return failed;
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "ConcurrentSweepingTest.h"
+
+#include "Completion.h"
+#include "Exception.h"
+#include "IncrementalSweeper.h"
+#include "InitializeThreading.h"
+#include "JSCInlines.h"
+#include "JSGlobalObject.h"
+#include "Options.h"
+#include "VM.h"
+#include <stdio.h>
+
+using namespace JSC;
+
+// Leaves one object in three alive, so their blocks are fragmented and get armed for a
+// concurrent presweep at the end of the next collection.
+static const char* fragmentHeapSource =
+    "var keep = [];" "\n"
+    "for (var i = 0; i < 60000; ++i) {" "\n"
+    "    var object = { value: i, next: null };" "\n"
+    "    if (!(i % 3))" "\n"
+    "        keep.push(object);" "\n"
+    "}" "\n"
+    "keep.length;";
+
+// Allocates objects of the same size class, into the cells the sweep freed, and checks that
+// none of them landed on a live object.
+static const char* allocateAndCheckSource =
+    "var garbage = [];" "\n"
+    "for (var i = 0; i < 60000; ++i)" "\n"
+    "    garbage.push({ value: -1, next: garbage.length ? garbage[garbage.length - 1] : null });" "\n"
+    "var intact = 0;" "\n"
+    "for (var i = 0; i < keep.length; ++i) {" "\n"
+    "    if (keep[i].value === i * 3 && keep[i].next === null)" "\n"
+    "        ++intact;" "\n"
+    "}" "\n"
+    "for (var i = 0; i < garbage.length; i += 1000) {" "\n"
+    "    if (garbage[i].value !== -1)" "\n"
+    "        intact = -1;" "\n"
+    "}" "\n"
+    "garbage = null;" "\n"
+    "intact;";
+
+int testConcurrentSweeping()
+{
+    bool failed = false;
+    auto check = [&] (bool condition, const char* description) {
+        if (!condition) {
+            printf("FAIL: concurrent sweeping: %s.\n", description);
+            failed = true;
+        }
+    };
+
+    JSC::initializeThreading();
+    Options::initialize(); // Ensure options is initialized first.
+
+    bool oldUseConcurrentSweeping = Options::useConcurrentSweeping();
+    Options::useConcurrentSweeping() = true;
+
+    RefPtr<VM> vm = VM::create(LargeHeap);
+    {
+        JSLockHolder locker(vm.get());
+        JSGlobalObject* globalObject = JSGlobalObject::create(*vm, JSGlobalObject::createStructure(*vm, jsNull()));
+        ExecState* exec = globalObject->globalExec();
+        IncrementalSweeper& sweeper = vm->heap.sweeper();
+
+        auto run = [&] (const char* source) -> int32_t {
+            NakedPtr<Exception> exception;
+            JSValue result = evaluate(exec, makeSource(String(source), SourceOrigin(), ASCIILiteral("concurrent-sweeping-test.js")), JSValue(), exception);
+            if (exception || !result.isInt32())
+                return -1;
+            return result.asInt32();
+        };
+
+        int32_t keptCount = run(fragmentHeapSource);
+        check(keptCount == 20000, "the heap was not fragmented");
+
+        // Let the helpers build every free list before the mutator allocates.
+        vm->heap.collectNow(Sync, CollectionScope::Full);
+        check(sweeper.blocksToSweepConcurrently(), "no block was armed for a concurrent presweep");
+        sweeper.finishConcurrentSweeping();
+        check(sweeper.blocksSweptConcurrently() == sweeper.blocksToSweepConcurrently(), "an armed block was not preswept");
+        check(run(allocateAndCheckSource) == keptCount, "allocating from preswept free lists overwrote a live object");
+        check(sweeper.presweptFreeListsTaken(), "the mutator did not take any preswept free list");
+
+        // Allocate right away, racing with the helpers, and collect again while they may still be
+        // sweeping, which stops them and drops the free lists the mutator did not take.
+        for (unsigned i = 0; i < 5; ++i) {
+            vm->heap.collectNow(Sync, i % 2 ? CollectionScope::Eden : CollectionScope::Full);
+            check(run(allocateAndCheckSource) == keptCount, "allocating while helpers sweep overwrote a live object");
+            check(sweeper.presweptFreeListsTaken() <= sweeper.blocksSweptConcurrently(), "the mutator took more free lists than were preswept");
+        }
+
+        // Free lists that were built but not taken must not survive into the next cycle.
+        vm->heap.collectNow(Sync, CollectionScope::Full);
+        sweeper.finishConcurrentSweeping();
+        vm->heap.collectNow(Sync, CollectionScope::Full);
+        check(run(allocateAndCheckSource) == keptCount, "a stale preswept free list was used");
+
+        // The same allocations without concurrent sweeping give the same result.
+        Options::useConcurrentSweeping() = false;
+        vm->heap.collectNow(Sync, CollectionScope::Full);
+        check(!sweeper.blocksToSweepConcurrently(), "blocks were armed with concurrent sweeping disabled");
+        check(run(allocateAndCheckSource) == keptCount, "allocating without concurrent sweeping overwrote a live object");
+    }
+    vm = nullptr;
+
+    Options::useConcurrentSweeping() = oldUseConcurrentSweeping;
+
+    if (!failed)
+        printf("PASS: concurrent sweeping.\n");
+    return failed;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "HeapLimitTest.h"
+
+#include "JavaScript.h"
+
+struct HeapLimitTestData {
+    unsigned callbackCount { 0 };
+    size_t lastHeapSize { 0 };
+    size_t lastHeapLimit { 0 };
+};
+
+static void heapLimitExceededCallback(JSContextGroupRef, size_t heapSize, size_t heapLimit, void* context)
+{
+    HeapLimitTestData* data = static_cast<HeapLimitTestData*>(context);
+    data->callbackCount++;
+    data->lastHeapSize = heapSize;
+    data->lastHeapLimit = heapLimit;
+}
+
+static bool evaluate(JSGlobalContextRef context, const char* source)
+{
+    JSStringRef script = JSStringCreateWithUTF8CString(source);
+    JSValueRef exception = nullptr;
+    JSEvaluateScript(context, script, nullptr, nullptr, 1, &exception);
+    JSStringRelease(script);
+    return !exception;
+}
+
+int testHeapLimit()
+{
+    bool failed = false;
+    static const size_t heapLimit = 4 * 1024 * 1024;
+
+    JSGlobalContextRef context = JSGlobalContextCreateInGroup(nullptr, nullptr);
+    JSContextGroupRef group = JSContextGetGroup(context);
+    HeapLimitTestData data;
+    JSContextGroupSetHeapLimit(group, heapLimit, heapLimitExceededCallback, &data);
+
+    /* Garbage that dies young should be collected well before we reach the limit. */
+    if (!evaluate(context, "for (var i = 0; i < 200000; ++i) { var o = { a: i, b: [i, i + 1, i + 2] }; }")) {
+        printf("FAIL: Script allocating short-lived garbage under a heap limit threw an exception.\n");
+        failed = true;
+    } else if (data.callbackCount) {
+        printf("FAIL: Heap limit callback was called for a heap that only held garbage.\n");
+        failed = true;
+    } else
+        printf("PASS: Short-lived garbage stayed within the heap limit.\n");
+
+    /* A heap that retains more than the limit can't be helped; the embedder has to be told. */
+    if (!evaluate(context, "var retained = []; for (var i = 0; i < 400000; ++i) retained.push({ a: i, b: [i, i + 1, i + 2] });")) {
+        printf("FAIL: Script retaining objects over the heap limit threw an exception.\n");
+        failed = true;
+    } else if (!data.callbackCount) {
+        printf("FAIL: Heap limit callback was not called for a heap retaining more than the limit.\n");
+        failed = true;
+    } else if (data.lastHeapLimit != heapLimit || data.lastHeapSize <= heapLimit) {
+        printf("FAIL: Heap limit callback was called with heapSize = %zu, heapLimit = %zu.\n", data.lastHeapSize, data.lastHeapLimit);
+        failed = true;
+    } else
+        printf("PASS: Heap limit callback was called for a heap retaining more than the limit.\n");
+
+    /* Once the limit is cleared, the callback must not be called anymore. */
+    JSContextGroupClearHeapLimit(group);
+    unsigned callbackCountBeforeClearing = data.callbackCount;
+    if (!evaluate(context, "for (var i = 0; i < 400000; ++i) retained.push({ a: i, b: [i, i + 1, i + 2] }); retained = null;")) {
+        printf("FAIL: Script retaining objects after clearing the heap limit threw an exception.\n");
+        failed = true;
+    } else if (data.callbackCount != callbackCountBeforeClearing) {
+        printf("FAIL: Heap limit callback was called after the heap limit was cleared.\n");
+        failed = true;
+    } else
+        printf("PASS: Heap limit callback was not called after the heap limit was cleared.\n");
+
+    JSGlobalContextRelease(context);
+    return failed;
+}
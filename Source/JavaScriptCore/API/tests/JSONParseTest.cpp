@@ -31,9 +31,118 @@
 #include "JSONObject.h"
 #include "VM.h"
 #include <wtf/RefPtr.h>
+#include <wtf/text/StringBuilder.h>
 
 using namespace JSC;
 
+static const UChar snowmanCharacter = 0x2603;
+
+static bool parsesTo(ExecState* exec, const String& json, const String& expected)
+{
+    JSValue value = JSONParse(exec, json);
+    if (!value)
+        return false;
+    return JSONStringify(exec, value, 0) == expected;
+}
+
+static JSObject* parsedElement(ExecState* exec, JSValue array, unsigned index)
+{
+    return asObject(asObject(array)->get(exec, index));
+}
+
+// JSON.parse replays the structure transitions of earlier objects with the same first key.
+// Objects it builds that way must be indistinguishable from objects built property by property.
+static bool testJSONParseObjectShapeCache(ExecState* exec)
+{
+    bool failed = false;
+    VM& vm = exec->vm();
+    auto check = [&] (bool condition, const char* description) {
+        if (!condition) {
+            printf("FAIL: JSONParse object shape cache: %s.\n", description);
+            failed = true;
+        }
+    };
+
+    // Cache hits: later records reuse the first record's transitions, and end up with the
+    // structure the transitions would have given them without the cache.
+    JSValue records = JSONParse(exec, "[{\"id\":1,\"name\":\"a\",\"tags\":[1]},{\"id\":2,\"name\":\"b\",\"tags\":[]},{\"id\":3.5,\"name\":null,\"tags\":{}}]");
+    JSValue single = JSONParse(exec, "{\"id\":0,\"name\":\"\",\"tags\":0}");
+    check(records && single, "records parse");
+    if (records && single) {
+        Structure* structure = parsedElement(exec, records, 0)->structure(vm);
+        check(parsedElement(exec, records, 1)->structure(vm) == structure, "records share a structure");
+        check(parsedElement(exec, records, 2)->structure(vm) == structure, "records with other value types share a structure");
+        check(asObject(single)->structure(vm) == structure, "cached records get the uncached structure");
+        check(JSONStringify(exec, records, 0) == "[{\"id\":1,\"name\":\"a\",\"tags\":[1]},{\"id\":2,\"name\":\"b\",\"tags\":[]},{\"id\":3.5,\"name\":null,\"tags\":{}}]", "records keep their values");
+
+        bool useJSONObjectShapeCache = Options::useJSONObjectShapeCache();
+        Options::useJSONObjectShapeCache() = false;
+        JSValue uncachedRecords = JSONParse(exec, "[{\"id\":1,\"name\":\"a\",\"tags\":[1]},{\"id\":2,\"name\":\"b\",\"tags\":[]}]");
+        Options::useJSONObjectShapeCache() = useJSONObjectShapeCache;
+        check(uncachedRecords && parsedElement(exec, uncachedRecords, 1)->structure(vm) == structure, "records get the same structure without the cache");
+    }
+
+    // Enough properties to need out-of-line storage.
+    StringBuilder wide;
+    wide.append('[');
+    for (unsigned i = 0; i < 3; ++i) {
+        if (i)
+            wide.append(',');
+        wide.append('{');
+        for (unsigned j = 0; j < 20; ++j) {
+            if (j)
+                wide.append(',');
+            wide.appendLiteral("\"p");
+            wide.appendNumber(j);
+            wide.appendLiteral("\":");
+            wide.appendNumber(i * 100 + j);
+        }
+        wide.append('}');
+    }
+    wide.append(']');
+    JSValue wideRecords = JSONParse(exec, wide.toString());
+    check(wideRecords && JSONStringify(exec, wideRecords, 0) == wide.toString(), "records with out-of-line properties keep their values");
+
+    // Shape mismatches: a different second key, fewer keys, more keys, and keys in another order.
+    check(parsesTo(exec, "[{\"a\":1,\"b\":2},{\"a\":3,\"c\":4},{\"a\":5},{\"a\":6,\"b\":7,\"c\":8},{\"b\":9,\"a\":10},{\"a\":11,\"b\":12}]",
+        "[{\"a\":1,\"b\":2},{\"a\":3,\"c\":4},{\"a\":5},{\"a\":6,\"b\":7,\"c\":8},{\"b\":9,\"a\":10},{\"a\":11,\"b\":12}]"), "objects whose keys diverge from a cached shape");
+    check(parsesTo(exec, "[{\"a\":{\"a\":{\"a\":1}}},{\"a\":{\"a\":{\"b\":2}}}]", "[{\"a\":{\"a\":{\"a\":1}}},{\"a\":{\"a\":{\"b\":2}}}]"), "nested objects with the same first key");
+
+    // Duplicate keys: the last value wins, whether or not the first key hit the cache.
+    check(parsesTo(exec, "[{\"a\":1,\"b\":2},{\"a\":3,\"a\":4},{\"a\":5,\"b\":6,\"b\":7},{\"a\":8,\"b\":9}]", "[{\"a\":1,\"b\":2},{\"a\":4},{\"a\":5,\"b\":7},{\"a\":8,\"b\":9}]"), "duplicate keys");
+
+    // Index keys are not cached.
+    check(parsesTo(exec, "[{\"0\":1,\"a\":2},{\"0\":3,\"a\":4}]", "[{\"0\":1,\"a\":2},{\"0\":3,\"a\":4}]"), "index keys");
+
+    // In JSON.parse, __proto__ is an ordinary own property and never sets the prototype.
+    JSValue protoRecords = JSONParse(exec, "[{\"__proto__\":1,\"a\":2},{\"__proto__\":{\"x\":3},\"a\":4},{\"a\":5,\"__proto__\":null}]");
+    check(protoRecords && JSONStringify(exec, protoRecords, 0) == "[{\"__proto__\":1,\"a\":2},{\"__proto__\":{\"x\":3},\"a\":4},{\"a\":5,\"__proto__\":null}]", "__proto__ keys are own properties");
+    if (protoRecords) {
+        for (unsigned i = 0; i < 3; ++i)
+            check(parsedElement(exec, protoRecords, i)->getPrototypeDirect() == exec->lexicalGlobalObject()->objectPrototype(), "__proto__ keys leave the prototype alone");
+    }
+
+    // Strings and whitespace are scanned eight characters at a time in 8-bit sources. Put the
+    // escape and the terminator at every position of a word, in 8-bit and 16-bit sources.
+    for (unsigned i = 0; i < 9; ++i) {
+        StringBuilder padding;
+        for (unsigned j = 0; j < i; ++j)
+            padding.append('x');
+        StringBuilder spaces;
+        for (unsigned j = 0; j < i + 8; ++j)
+            spaces.append(' ');
+        String expected = makeString("[\"", padding.toString(), "\\n\",\"", padding.toString(), "\"]");
+        check(parsesTo(exec, makeString(spaces.toString(), expected, spaces.toString()), expected), "8-bit strings and whitespace");
+
+        String snowman(&snowmanCharacter, 1);
+        String expected16 = makeString("[\"", padding.toString(), "\\n\",\"", padding.toString(), snowman, "\"]");
+        check(parsesTo(exec, makeString(spaces.toString(), expected16, spaces.toString()), expected16), "16-bit strings and whitespace");
+    }
+    check(!JSONParse(exec, "[\"abcdefg\x01\"]"), "control characters in strings are rejected");
+
+    return failed;
+}
+
 int testJSONParse()
 {
     bool failed = false;
@@ -58,12 +167,17 @@ int testJSONParse()
     failed = failed || (v3 != v4);
     failed = failed || (v4 == v5);
 
-    vm = nullptr;
-
     if (failed)
         printf("FAIL: JSONParse String test.\n");
     else
         printf("PASS: JSONParse String test.\n");
 
+    if (testJSONParseObjectShapeCache(exec))
+        failed = true;
+    else
+        printf("PASS: JSONParse object shape cache test.\n");
+
+    vm = nullptr;
+
     return failed;
 }
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "UnlinkedInstructionStreamTest.h"
+
+#include "UnlinkedInstructionStream.h"
+#include <stdio.h>
+
+using namespace JSC;
+
+// Values on both sides of each boundary between the packed value formats.
+static const unsigned boundaryValues[] = {
+    1, 31, 32, 0xffffffff, 0xffffffe0, 0xffffffdf, 8191, 8192, 0xffffe000, 0xffffdfff,
+    0x40000000, 0x4000001f, 0x40000020, 0x40001fff, 0x40002000, 0x7fffffff, 0x80000000
+};
+
+enum class OperandPattern { AllZero, AlternatingZero, LeadingZeroRun, TrailingZeroRun, BoundaryValues };
+
+static unsigned operandValue(OperandPattern pattern, unsigned operandIndex, unsigned operandCount, unsigned seed)
+{
+    unsigned boundaryValue = boundaryValues[(operandIndex + seed) % WTF_ARRAY_LENGTH(boundaryValues)];
+    switch (pattern) {
+    case OperandPattern::AllZero:
+        return 0;
+    case OperandPattern::AlternatingZero:
+        return operandIndex % 2 ? boundaryValue : 0;
+    case OperandPattern::LeadingZeroRun:
+        return operandIndex < operandCount / 2 ? 0 : boundaryValue;
+    case OperandPattern::TrailingZeroRun:
+        return operandIndex < operandCount / 2 ? boundaryValue : 0;
+    case OperandPattern::BoundaryValues:
+        return boundaryValue;
+    }
+    return 0;
+}
+
+static bool roundTrips(OperandPattern pattern, size_t& packedSize)
+{
+    Vector<UnlinkedInstruction, 0, UnsafeVectorOverflow> instructions;
+    for (unsigned i = 0; i < static_cast<unsigned>(numOpcodeIDs); ++i) {
+        OpcodeID opcodeID = static_cast<OpcodeID>(i);
+        unsigned operandCount = opcodeLength(opcodeID) - 1;
+        instructions.append(UnlinkedInstruction(opcodeID));
+        for (unsigned j = 0; j < operandCount; ++j) {
+            UnlinkedInstruction operand;
+            operand.u.unsignedValue = operandValue(pattern, j, operandCount, i);
+            instructions.append(operand);
+        }
+    }
+
+    UnlinkedInstructionStream stream(instructions);
+    packedSize = stream.sizeInBytes();
+    if (stream.count() != instructions.size())
+        return false;
+
+    UnlinkedInstructionStream::Reader reader(stream);
+    for (unsigned i = 0; i < instructions.size();) {
+        if (reader.atEnd())
+            return false;
+        const UnlinkedInstruction* pc = reader.next();
+        if (pc[0].u.opcode != instructions[i].u.opcode)
+            return false;
+        unsigned length = opcodeLength(pc[0].u.opcode);
+        for (unsigned j = 1; j < length; ++j) {
+            if (pc[j].u.unsignedValue != instructions[i + j].u.unsignedValue)
+                return false;
+        }
+        i += length;
+    }
+    return reader.atEnd();
+}
+
+int testUnlinkedInstructionStream()
+{
+    bool failed = false;
+    size_t packedSize;
+
+    static const struct {
+        OperandPattern pattern;
+        const char* name;
+    } patterns[] = {
+        { OperandPattern::AllZero, "all zero operands" },
+        { OperandPattern::AlternatingZero, "alternating zero operands" },
+        { OperandPattern::LeadingZeroRun, "leading zero runs" },
+        { OperandPattern::TrailingZeroRun, "trailing zero runs" },
+        { OperandPattern::BoundaryValues, "boundary values" },
+    };
+    for (auto& entry : patterns) {
+        if (!roundTrips(entry.pattern, packedSize)) {
+            printf("FAIL: unlinked instruction stream did not round trip with %s.\n", entry.name);
+            failed = true;
+        }
+    }
+
+    // Every instruction with all zero operands packs to its opcode, plus a single zero run
+    // when it has at least two operands.
+    size_t expectedSize = 0;
+    for (unsigned i = 0; i < static_cast<unsigned>(numOpcodeIDs); ++i) {
+        unsigned operandCount = opcodeLength(static_cast<OpcodeID>(i)) - 1;
+        expectedSize += 1 + std::min(operandCount, 1u);
+    }
+    roundTrips(OperandPattern::AllZero, packedSize);
+    if (packedSize != expectedSize) {
+        printf("FAIL: unlinked instruction stream packed zero operands in %zu bytes instead of %zu.\n", packedSize, expectedSize);
+        failed = true;
+    }
+
+    printf("%s: unlinked instruction stream tests.\n", failed ? "FAIL" : "PASS");
+    return failed;
+}
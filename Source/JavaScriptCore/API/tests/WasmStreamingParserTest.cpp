@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "WasmStreamingParserTest.h"
+
+#include "InitializeThreading.h"
+#include "WasmStreamingParser.h"
+#include <stdio.h>
+
+#if ENABLE(WEBASSEMBLY)
+
+using namespace JSC;
+using namespace JSC::Wasm;
+
+namespace {
+
+struct TestModule {
+    Vector<uint8_t> bytes;
+    // Offsets of interesting places in the module, each one the first byte after a split.
+    size_t typeSectionSizeOffset;
+    size_t functionSectionEnd;
+    size_t codeSectionSizeSecondByteOffset;
+    size_t firstFunctionSizeSecondByteOffset;
+    Vector<FunctionLocationInBinary> functionLocations;
+};
+
+void appendVarUInt32(Vector<uint8_t>& bytes, uint32_t value)
+{
+    do {
+        uint8_t byte = value & 0x7f;
+        value >>= 7;
+        if (value)
+            byte |= 0x80;
+        bytes.append(byte);
+    } while (value);
+}
+
+// A module with a custom section and two functions returning an i32. The first function is
+// long enough that its size, and the size of the Code section, take two bytes of LEB128.
+TestModule makeTestModule()
+{
+    TestModule module;
+    Vector<uint8_t>& bytes = module.bytes;
+    bytes.appendVector(Vector<uint8_t>({ 0x00, 'a', 's', 'm', 0x01, 0x00, 0x00, 0x00 }));
+
+    // Type section: one signature, () -> i32.
+    bytes.append(0x01);
+    module.typeSectionSizeOffset = bytes.size();
+    bytes.appendVector(Vector<uint8_t>({ 0x05, 0x01, 0x60, 0x00, 0x01, 0x7f }));
+
+    // Function section: two functions of signature 0.
+    bytes.appendVector(Vector<uint8_t>({ 0x03, 0x03, 0x02, 0x00, 0x00 }));
+    module.functionSectionEnd = bytes.size();
+
+    // A custom section named "x".
+    bytes.appendVector(Vector<uint8_t>({ 0x00, 0x04, 0x01, 'x', 0xca, 0xfe }));
+
+    Vector<uint8_t> firstBody;
+    firstBody.append(0x00); // No locals.
+    for (unsigned i = 0; i < 200; ++i)
+        firstBody.append(0x01); // nop
+    firstBody.appendVector(Vector<uint8_t>({ 0x41, 0x2a, 0x0b })); // i32.const 42, end
+    Vector<uint8_t> secondBody({ 0x00, 0x41, 0x07, 0x0b }); // i32.const 7, end
+
+    Vector<uint8_t> codePayload;
+    codePayload.append(0x02);
+    size_t firstFunctionSizeOffset = codePayload.size();
+    appendVarUInt32(codePayload, firstBody.size());
+    size_t firstBodyOffset = codePayload.size();
+    codePayload.appendVector(firstBody);
+    appendVarUInt32(codePayload, secondBody.size());
+    size_t secondBodyOffset = codePayload.size();
+    codePayload.appendVector(secondBody);
+
+    bytes.append(0x0a);
+    module.codeSectionSizeSecondByteOffset = bytes.size() + 1;
+    appendVarUInt32(bytes, codePayload.size());
+    size_t codePayloadOffset = bytes.size();
+    bytes.appendVector(codePayload);
+
+    module.firstFunctionSizeSecondByteOffset = codePayloadOffset + firstFunctionSizeOffset + 1;
+    module.functionLocations.append({ codePayloadOffset + firstBodyOffset, codePayloadOffset + firstBodyOffset + firstBody.size() });
+    module.functionLocations.append({ codePayloadOffset + secondBodyOffset, codePayloadOffset + secondBodyOffset + secondBody.size() });
+    return module;
+}
+
+// Feeds the module in chunks ending at the given offsets, then the rest, and checks that it
+// parses to the same function locations as a module fed in a single chunk.
+bool parsesInChunks(const TestModule& module, const Vector<size_t>& splitOffsets, const char* description)
+{
+    Ref<ModuleInformation> info = adoptRef(*new ModuleInformation(Vector<uint8_t>()));
+    StreamingParser parser(info.get());
+
+    size_t offset = 0;
+    uint32_t completedFunctionCount = 0;
+    auto addBytesUntil = [&] (size_t end) {
+        if (parser.addBytes(module.bytes.data() + offset, end - offset) == StreamingParser::State::FatalError)
+            return false;
+        offset = end;
+        // Function bodies are only reported once they are complete, and never go back.
+        if (parser.completedFunctionCount() < completedFunctionCount)
+            return false;
+        completedFunctionCount = parser.completedFunctionCount();
+        for (uint32_t i = 0; i < completedFunctionCount; ++i) {
+            if (info->functionLocationInBinary[i].end > offset)
+                return false;
+        }
+        return true;
+    };
+
+    bool succeeded = true;
+    for (size_t splitOffset : splitOffsets)
+        succeeded = succeeded && addBytesUntil(splitOffset);
+    succeeded = succeeded && addBytesUntil(module.bytes.size());
+    succeeded = succeeded && parser.finalize() == StreamingParser::State::Finished;
+    succeeded = succeeded && parser.completedFunctionCount() == module.functionLocations.size();
+    if (succeeded) {
+        for (size_t i = 0; i < module.functionLocations.size(); ++i) {
+            succeeded = succeeded && info->functionLocationInBinary[i].start == module.functionLocations[i].start
+                && info->functionLocationInBinary[i].end == module.functionLocations[i].end;
+        }
+        succeeded = succeeded && parser.bytes() == module.bytes;
+    }
+
+    if (!succeeded)
+        printf("FAIL: WebAssembly streaming parser: %s: %s.\n", description, parser.errorMessage().utf8().data());
+    return succeeded;
+}
+
+StreamingParser::State parseTruncated(const Vector<uint8_t>& bytes, size_t size)
+{
+    Ref<ModuleInformation> info = adoptRef(*new ModuleInformation(Vector<uint8_t>()));
+    StreamingParser parser(info.get());
+    if (parser.addBytes(bytes.data(), size) == StreamingParser::State::FatalError)
+        return StreamingParser::State::FatalError;
+    return parser.finalize();
+}
+
+} // anonymous namespace
+
+#endif // ENABLE(WEBASSEMBLY)
+
+int testWasmStreamingParser()
+{
+#if ENABLE(WEBASSEMBLY)
+    bool failed = false;
+
+    JSC::initializeThreading();
+
+    TestModule module = makeTestModule();
+    failed |= !parsesInChunks(module, { }, "a single chunk");
+
+    Vector<size_t> everyByte;
+    for (size_t i = 1; i < module.bytes.size(); ++i)
+        everyByte.append(i);
+    failed |= !parsesInChunks(module, everyByte, "one byte at a time");
+
+    failed |= !parsesInChunks(module, { 4 }, "a split inside the module header");
+    failed |= !parsesInChunks(module, { module.typeSectionSizeOffset }, "a split between a section's id and its size");
+    failed |= !parsesInChunks(module, { module.codeSectionSizeSecondByteOffset }, "a split inside the LEB128 size of the Code section");
+    failed |= !parsesInChunks(module, { module.firstFunctionSizeSecondByteOffset }, "a split inside the LEB128 size of a function");
+    failed |= !parsesInChunks(module, { module.functionLocations[0].start + 10 }, "a split inside a function body");
+
+    for (size_t i = 1; i < module.bytes.size(); ++i) {
+        if (!parsesInChunks(module, { i }, "two chunks")) {
+            printf("FAIL: WebAssembly streaming parser: the module was split at byte %zu.\n", i);
+            failed = true;
+            break;
+        }
+    }
+
+    // Truncating the module before the Function section leaves a valid module with no functions;
+    // every other truncation must be rejected.
+    for (size_t size = 0; size < module.bytes.size(); ++size) {
+        if (size >= 8 && size < module.functionSectionEnd)
+            continue;
+        if (parseTruncated(module.bytes, size) != StreamingParser::State::FatalError) {
+            printf("FAIL: WebAssembly streaming parser: a module truncated to %zu bytes was accepted.\n", size);
+            failed = true;
+            break;
+        }
+    }
+
+    // A section size that is not terminated within five bytes is malformed, not incomplete.
+    Vector<uint8_t> malformed({ 0x00, 'a', 's', 'm', 0x01, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 });
+    {
+        Ref<ModuleInformation> info = adoptRef(*new ModuleInformation(Vector<uint8_t>()));
+        StreamingParser parser(info.get());
+        StreamingParser::State state = StreamingParser::State::ModuleHeader;
+        for (uint8_t byte : malformed)
+            state = parser.addBytes(&byte, 1);
+        if (state != StreamingParser::State::FatalError) {
+            printf("FAIL: WebAssembly streaming parser: an unterminated LEB128 section size was accepted.\n");
+            failed = true;
+        }
+    }
+
+    printf("%s: WebAssembly streaming parser tests.\n", failed ? "FAIL" : "PASS");
+    return failed;
+#else
+    return 0;
+#endif
+}
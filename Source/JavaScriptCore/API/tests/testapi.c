@@ -51,16 +51,22 @@
 #include <windows.h>
 #endif
 
+#include "BackgroundCodeGeneratorTest.h"
+#include "BytecodeCacheTest.h"
 #include "CompareAndSwapTest.h"
+#include "ConcurrentSweepingTest.h"
 #include "CustomGlobalObjectClassTest.h"
 #include "ExecutionTimeLimitTest.h"
 #include "FunctionOverridesTest.h"
 #include "GlobalContextWithFinalizerTest.h"
+#include "HeapLimitTest.h"
 #include "JSONParseTest.h"
 #include "JSObjectGetProxyTargetTest.h"
 #include "MultithreadedMultiVMExecutionTest.h"
 #include "PingPongStackOverflowTest.h"
 #include "TypedArrayCTest.h"
+#include "UnlinkedInstructionStreamTest.h"
+#include "WasmStreamingParserTest.h"
 
 #if JSC_OBJC_API_ENABLED
 void testObjectiveCAPI(void);
@@ -1236,6 +1242,39 @@ static void testMarkingConstraintsAndHeapFinalizers(void)
     printf("PASS: Marking Constraints and Heap Finalizers.\n");
 }
 
+static void testGarbageCollectionEvents(void)
+{
+    JSContextGroupRef group;
+    JSGlobalContextRef context;
+    JSGarbageCollectionEvent events[2];
+    size_t count;
+
+    printf("Testing Garbage Collection Events.\n");
+
+    group = JSContextGroupCreate();
+    context = JSGlobalContextCreateInGroup(group, NULL);
+
+    JSSynchronousGarbageCollectForDebugging(context);
+    JSSynchronousGarbageCollectForDebugging(context);
+
+    count = JSContextGroupCopyGarbageCollectionEvents(group, events, 2);
+    assertTrue(count == 2, "Recorded the last two collections");
+    assertTrue(events[0].sequenceNumber + 1 == events[1].sequenceNumber, "Events are in order");
+    assertTrue(events[1].isFullCollection, "Synchronous collection for debugging is a full collection");
+    assertTrue(events[1].duration >= 0, "Collection has a duration");
+    assertTrue(events[1].numberOfPauses >= 1, "Collection stopped the world at least once");
+    assertTrue(events[1].maxPauseTime <= events[1].totalPauseTime, "Longest pause is part of the total");
+    assertTrue(events[1].bytesAfter > 0, "Heap is not empty after collection");
+    assertTrue(!JSContextGroupCopyGarbageCollectionEvents(group, NULL, 0), "Copied nothing into an empty array");
+    assertTrue(events[1].startTime > 1e9, "Start time is on the wall clock");
+    assertTrue(events[0].startTime <= events[1].startTime, "Collections started in order");
+
+    JSGlobalContextRelease(context);
+    JSContextGroupRelease(group);
+
+    printf("PASS: Garbage Collection Events.\n");
+}
+
 #if USE(CF)
 static void testCFStrings(void)
 {
@@ -1366,6 +1405,7 @@ int main(int argc, char* argv[])
     ASSERT(Base_didFinalize);
 
     testMarkingConstraintsAndHeapFinalizers();
+    testGarbageCollectionEvents();
 
 #if USE(CF)
     testCFStrings();
@@ -2033,9 +2073,15 @@ int main(int argc, char* argv[])
     failed = testExecutionTimeLimit() || failed;
     failed = testFunctionOverrides() || failed;
     failed = testGlobalContextWithFinalizer() || failed;
+    failed = testHeapLimit() || failed;
     failed = testPingPongStackOverflow() || failed;
     failed = testJSONParse() || failed;
     failed = testJSObjectGetProxyTarget() || failed;
+    failed = testBytecodeCache() || failed;
+    failed = testBackgroundCodeGenerator() || failed;
+    failed = testUnlinkedInstructionStream() || failed;
+    failed = testWasmStreamingParser() || failed;
+    failed = testConcurrentSweeping() || failed;
 
     // Clear out local variables pointing at JSObjectRefs to allow their values to be collected
     function = NULL;
@@ -242,6 +242,12 @@ public:
     void setNeedsUsedRegisters(bool value) { m_needsUsedRegisters = value; }
     bool needsUsedRegisters() const { return m_needsUsedRegisters; }
 
+    // You can turn off the late Air phases that only make the generated code faster, like block
+    // ordering and partial register stall fixing. This is for clients that compile code they expect
+    // to replace with better code if it gets hot.
+    void setNeedsLateAirOptimizations(bool value) { m_needsLateAirOptimizations = value; }
+    bool needsLateAirOptimizations() const { return m_needsLateAirOptimizations; }
+
     JS_EXPORT_PRIVATE unsigned frameSize() const;
     JS_EXPORT_PRIVATE RegisterAtOffsetList calleeSaveRegisterAtOffsetList() const;
 
@@ -281,6 +287,7 @@ private:
     PCToOriginMap m_pcToOriginMap;
     unsigned m_optLevel { defaultOptLevel() };
     bool m_needsUsedRegisters { true };
+    bool m_needsLateAirOptimizations { true };
     bool m_hasQuirks { false };
 };
 
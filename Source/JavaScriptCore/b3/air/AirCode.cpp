@@ -113,6 +113,11 @@ bool Code::needsUsedRegisters() const
     return m_proc.needsUsedRegisters();
 }
 
+bool Code::needsLateOptimizations() const
+{
+    return m_proc.needsLateAirOptimizations();
+}
+
 BasicBlock* Code::addBlock(double frequency)
 {
     std::unique_ptr<BasicBlock> block(new BasicBlock(m_blocks.size(), frequency));
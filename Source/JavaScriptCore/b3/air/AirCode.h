@@ -92,6 +92,7 @@ public:
     unsigned optLevel() const { return m_optLevel; }
     
     bool needsUsedRegisters() const;
+    bool needsLateOptimizations() const;
 
     JS_EXPORT_PRIVATE BasicBlock* addBlock(double frequency = 1);
 
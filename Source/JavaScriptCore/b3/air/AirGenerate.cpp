@@ -139,7 +139,8 @@ void prepareForGeneration(Code& code)
     // This must be executed as late as possible as it depends on the instructions order and register
     // use. We _must_ run this after reportUsedRegisters(), since that kills variable assignments
     // that seem dead. Luckily, this phase does not change register liveness, so that's OK.
-    fixPartialRegisterStalls(code);
+    if (code.needsLateOptimizations())
+        fixPartialRegisterStalls(code);
     
     // Actually create entrypoints.
     lowerEntrySwitch(code);
@@ -148,8 +149,10 @@ void prepareForGeneration(Code& code)
     simplifyCFG(code);
 
     // This sorts the basic blocks in Code to achieve an ordering that maximizes the likelihood that a high
-    // frequency successor is also the fall-through target.
-    optimizeBlockOrder(code);
+    // frequency successor is also the fall-through target. Clients that skip it keep the order
+    // they were given, which is still correct since the root block stays first.
+    if (code.needsLateOptimizations())
+        optimizeBlockOrder(code);
 
     if (shouldValidateIR())
         validate(code);
@@ -394,6 +394,8 @@ protected:
     }
 
 private:
+    friend class BytecodeCacheDecoder;
+    friend class BytecodeCacheEncoder;
     friend class BytecodeRewriter;
     void applyModification(BytecodeRewriter&);
 
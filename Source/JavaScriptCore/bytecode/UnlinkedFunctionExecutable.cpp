@@ -26,6 +26,7 @@
 #include "config.h"
 #include "UnlinkedFunctionExecutable.h"
 
+#include "BytecodeCache.h"
 #include "BytecodeGenerator.h"
 #include "ClassInfo.h"
 #include "CodeCache.h"
@@ -116,6 +117,33 @@ UnlinkedFunctionExecutable::UnlinkedFunctionExecutable(VM* vm, Structure* struct
     m_parentScopeTDZVariables.swap(parentScopeTDZVariables);
 }
 
+UnlinkedFunctionExecutable::UnlinkedFunctionExecutable(VM* vm, Structure* structure)
+    : Base(*vm, structure)
+    , m_firstLineOffset(0)
+    , m_lineCount(0)
+    , m_unlinkedFunctionNameStart(0)
+    , m_unlinkedBodyStartColumn(0)
+    , m_unlinkedBodyEndColumn(0)
+    , m_startOffset(0)
+    , m_sourceLength(0)
+    , m_parametersStartOffset(0)
+    , m_typeProfilingStartOffset(0)
+    , m_typeProfilingEndOffset(0)
+    , m_parameterCount(0)
+    , m_features(0)
+    , m_sourceParseMode(SourceParseMode::NormalFunctionMode)
+    , m_isInStrictContext(false)
+    , m_hasCapturedVariables(false)
+    , m_isBuiltinFunction(false)
+    , m_constructAbility(0)
+    , m_constructorKind(0)
+    , m_functionMode(0)
+    , m_scriptMode(0)
+    , m_superBinding(0)
+    , m_derivedContextType(0)
+{
+}
+
 void UnlinkedFunctionExecutable::destroy(JSCell* cell)
 {
     static_cast<UnlinkedFunctionExecutable*>(cell)->~UnlinkedFunctionExecutable();
@@ -206,13 +234,19 @@ UnlinkedFunctionCodeBlock* UnlinkedFunctionExecutable::unlinkedCodeBlockFor(
         break;
     }
 
-    UnlinkedFunctionCodeBlock* result = generateUnlinkedFunctionCodeBlock(
-        vm, this, source, specializationKind, debuggerMode, 
-        isBuiltinFunction() ? UnlinkedBuiltinFunction : UnlinkedNormalFunction, 
-        error, parseMode);
-    
-    if (error.isValid())
-        return nullptr;
+    UnlinkedFunctionCodeBlock* result = nullptr;
+    if (m_cachedBytecode)
+        result = BytecodeCache::decodeFunctionCodeBlock(vm, *this, source, specializationKind, debuggerMode, parseMode);
+
+    if (!result) {
+        result = generateUnlinkedFunctionCodeBlock(
+            vm, this, source, specializationKind, debuggerMode, 
+            isBuiltinFunction() ? UnlinkedBuiltinFunction : UnlinkedNormalFunction, 
+            error, parseMode);
+
+        if (error.isValid())
+            return nullptr;
+    }
 
     switch (specializationKind) {
     case CodeForCall:
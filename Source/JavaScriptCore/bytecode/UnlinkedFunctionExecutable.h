@@ -44,6 +44,7 @@
 
 namespace JSC {
 
+class CachedBytecode;
 class FunctionMetadataNode;
 class FunctionExecutable;
 class ParserError;
@@ -145,7 +146,11 @@ public:
     void setSourceMappingURLDirective(const String& sourceMappingURL) { m_sourceMappingURLDirective = sourceMappingURL; }
 
 private:
+    friend class BytecodeCacheDecoder;
+    friend class BytecodeCacheEncoder;
+
     UnlinkedFunctionExecutable(VM*, Structure*, const SourceCode&, SourceCode&& parentSourceOverride, FunctionMetadataNode*, UnlinkedFunctionKind, ConstructAbility, JSParserScriptMode, VariableEnvironment&,  JSC::DerivedContextType);
+    UnlinkedFunctionExecutable(VM*, Structure*);
 
     unsigned m_firstLineOffset;
     unsigned m_lineCount;
@@ -184,6 +189,12 @@ private:
 
     VariableEnvironment m_parentScopeTDZVariables;
 
+    // Set when this executable was decoded from the bytecode cache. The offsets locate the
+    // code blocks that were cached for it, which are only decoded when first needed.
+    RefPtr<CachedBytecode> m_cachedBytecode;
+    unsigned m_cachedCodeBlockForCallOffset { 0 };
+    unsigned m_cachedCodeBlockForConstructOffset { 0 };
+
 protected:
     static void visitChildren(JSCell*, SlotVisitor&);
 
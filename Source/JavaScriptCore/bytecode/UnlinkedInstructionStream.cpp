@@ -26,15 +26,30 @@
 #include "config.h"
 #include "UnlinkedInstructionStream.h"
 
+#include "Instruction.h"
 #include "Opcode.h"
+#include "Options.h"
+#include <atomic>
+#include <wtf/DataLog.h>
 
 namespace JSC {
 
+static std::atomic<uint64_t> totalStreamCount;
+static std::atomic<uint64_t> totalInstructionSlotCount;
+static std::atomic<uint64_t> totalPackedSize;
+static std::atomic<uint64_t> totalZeroRunSavings;
+
 static void append8(unsigned char*& ptr, unsigned char value)
 {
     *(ptr++) = value;
 }
 
+static void appendZeroRun(unsigned char*& ptr, unsigned runLength)
+{
+    ASSERT(runLength >= 2 && runLength <= 0x1f);
+    *(ptr++) = (ZeroRun << 5) | runLength;
+}
+
 static void append32(unsigned char*& ptr, unsigned value)
 {
     if (!(value & 0xffffffe0)) {
@@ -86,6 +101,9 @@ UnlinkedInstructionStream::UnlinkedInstructionStream(const Vector<UnlinkedInstru
     buffer.resizeToFit(m_instructionCount * 5);
     unsigned char* ptr = buffer.data();
 
+    // Without zero runs, each zero operand takes one byte.
+    size_t zeroRunSavings = 0;
+
     const UnlinkedInstruction* instructionsData = instructions.data();
     for (unsigned i = 0; i < m_instructionCount;) {
         const UnlinkedInstruction* pc = &instructionsData[i];
@@ -94,14 +112,39 @@ UnlinkedInstructionStream::UnlinkedInstructionStream(const Vector<UnlinkedInstru
 
         unsigned opLength = opcodeLength(opcode);
 
-        for (unsigned j = 1; j < opLength; ++j)
-            append32(ptr, pc[j].u.unsignedValue);
+        for (unsigned j = 1; j < opLength;) {
+            unsigned runLength = 0;
+            while (j + runLength < opLength && !pc[j + runLength].u.unsignedValue && runLength < 0x1f)
+                ++runLength;
+            if (runLength >= 2) {
+                appendZeroRun(ptr, runLength);
+                zeroRunSavings += runLength - 1;
+                j += runLength;
+                continue;
+            }
+            append32(ptr, pc[j++].u.unsignedValue);
+        }
 
         i += opLength;
     }
 
     buffer.shrink(ptr - buffer.data());
     m_data = RefCountedArray<unsigned char>(buffer);
+
+    if (Options::reportInstructionStreamSizes()) {
+        totalStreamCount++;
+        totalInstructionSlotCount += m_instructionCount;
+        totalPackedSize += buffer.size();
+        totalZeroRunSavings += zeroRunSavings;
+    }
+}
+
+UnlinkedInstructionStream::UnlinkedInstructionStream(const unsigned char* packedData, size_t packedDataSize, unsigned instructionCount)
+    : m_data(packedDataSize)
+    , m_instructionCount(instructionCount)
+{
+    if (packedDataSize)
+        memcpy(m_data.data(), packedData, packedDataSize);
 }
 
 size_t UnlinkedInstructionStream::sizeInBytes() const
@@ -109,6 +152,25 @@ size_t UnlinkedInstructionStream::sizeInBytes() const
     return m_data.size() * sizeof(unsigned char);
 }
 
+void UnlinkedInstructionStream::dumpSizeStatistics()
+{
+    uint64_t slotCount = totalInstructionSlotCount;
+    uint64_t packedSize = totalPackedSize;
+    uint64_t zeroRunSavings = totalZeroRunSavings;
+    auto bytesPerSlot = [&] (uint64_t size) {
+        return slotCount ? static_cast<double>(size) / slotCount : 0;
+    };
+
+    dataLogF("Unlinked instruction streams: %llu streams, %llu opcode and operand slots.\n",
+        static_cast<unsigned long long>(totalStreamCount.load()), static_cast<unsigned long long>(slotCount));
+    dataLogF("    Packed: %llu bytes (%.2f bytes per slot).\n",
+        static_cast<unsigned long long>(packedSize), bytesPerSlot(packedSize));
+    dataLogF("    Packed without zero runs: %llu bytes (%.2f bytes per slot).\n",
+        static_cast<unsigned long long>(packedSize + zeroRunSavings), bytesPerSlot(packedSize + zeroRunSavings));
+    dataLogF("    Linked, if every code block were linked: %llu bytes (%zu bytes per slot).\n",
+        static_cast<unsigned long long>(slotCount * sizeof(Instruction)), sizeof(Instruction));
+}
+
 #ifndef NDEBUG
 const RefCountedArray<UnlinkedInstruction>& UnlinkedInstructionStream::unpackForDebugging() const
 {
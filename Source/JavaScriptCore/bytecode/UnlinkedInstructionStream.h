@@ -35,10 +35,13 @@ namespace JSC {
 class UnlinkedInstructionStream {
     WTF_MAKE_FAST_ALLOCATED;
 public:
-    explicit UnlinkedInstructionStream(const Vector<UnlinkedInstruction, 0, UnsafeVectorOverflow>&);
+    JS_EXPORT_PRIVATE explicit UnlinkedInstructionStream(const Vector<UnlinkedInstruction, 0, UnsafeVectorOverflow>&);
 
     unsigned count() const { return m_instructionCount; }
-    size_t sizeInBytes() const;
+    JS_EXPORT_PRIVATE size_t sizeInBytes() const;
+
+    // Totals over every stream packed while Options::reportInstructionStreamSizes() was set.
+    JS_EXPORT_PRIVATE static void dumpSizeStatistics();
 
     class Reader {
     public:
@@ -61,8 +64,12 @@ public:
 #endif
 
 private:
+    friend class BytecodeCacheDecoder;
+    friend class BytecodeCacheEncoder;
     friend class Reader;
 
+    UnlinkedInstructionStream(const unsigned char* packedData, size_t packedDataSize, unsigned instructionCount);
+
 #ifndef NDEBUG
     mutable RefCountedArray<UnlinkedInstruction> m_unpackedInstructionsForDebugging;
 #endif
@@ -84,6 +91,18 @@ private:
 //     5-bit constant register index, based at 0x40000000 (1 byte total)
 //     13-bit constant register index, based at 0x40000000 (2 bytes total)
 //     32-bit raw value (5 bytes total)
+//     run of up to 31 zero arguments (1 byte total)
+//
+// Zero runs never extend past the end of an instruction. They mostly cover the slots that
+// BytecodeGenerator reserves for metadata (inline caches, profiles) which are only filled
+// in when the CodeBlock is linked.
+//
+// Only the unlinked stream is packed. Linking still expands every opcode and operand into a
+// pointer-sized Instruction, with the metadata stored in the operand slots, because that is
+// the layout the LLInt, the baseline JIT and the DFG bytecode parser read.
+// FIXME: A narrow linked format with wide prefixes and a metadata side table would need all
+// three of them to change together. Options::reportInstructionStreamSizes() gives the sizes
+// that would make it worth doing.
 
 enum PackedValueType {
     Positive5Bit = 0,
@@ -92,7 +111,8 @@ enum PackedValueType {
     Negative13Bit,
     ConstantRegister5Bit,
     ConstantRegister13Bit,
-    Full32Bit
+    Full32Bit,
+    ZeroRun
 };
 
 ALWAYS_INLINE UnlinkedInstructionStream::Reader::Reader(const UnlinkedInstructionStream& stream)
@@ -141,8 +161,18 @@ ALWAYS_INLINE const UnlinkedInstruction* UnlinkedInstructionStream::Reader::next
 {
     m_unpackedBuffer[0].u.opcode = static_cast<OpcodeID>(read8());
     unsigned opLength = opcodeLength(m_unpackedBuffer[0].u.opcode);
-    for (unsigned i = 1; i < opLength; ++i)
-        m_unpackedBuffer[i].u.unsignedValue = read32();
+    for (unsigned i = 1; i < opLength;) {
+        unsigned char firstByte = m_stream.m_data.data()[m_index];
+        if ((firstByte >> 5) == ZeroRun) {
+            m_index++;
+            unsigned runLength = firstByte & 0x1F;
+            ASSERT(runLength >= 2 && i + runLength <= opLength);
+            for (unsigned j = 0; j < runLength; ++j)
+                m_unpackedBuffer[i++].u.unsignedValue = 0;
+            continue;
+        }
+        m_unpackedBuffer[i++].u.unsignedValue = read32();
+    }
     return m_unpackedBuffer;
 }
 
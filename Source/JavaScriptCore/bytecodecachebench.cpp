@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include "BackgroundCodeGenerator.h"
+#include "Completion.h"
+#include "Exception.h"
+#include "InitializeThreading.h"
+#include "JSCInlines.h"
+#include "JSGlobalObject.h"
+#include "JSLock.h"
+#include "SourceCode.h"
+#include "VM.h"
+#include <stdlib.h>
+#include <wtf/MainThread.h>
+#include <wtf/text/StringBuilder.h>
+#include <wtf/threads/BinarySemaphore.h>
+
+using namespace JSC;
+
+namespace {
+
+StaticLock crashLock;
+
+#define CHECK(x) do {                                                   \
+        if (!!(x))                                                      \
+            break;                                                      \
+        crashLock.lock();                                               \
+        WTFReportAssertionFailure(__FILE__, __LINE__, WTF_PRETTY_FUNCTION, #x); \
+        CRASH();                                                        \
+    } while (false)
+
+// Builds something that looks like a bundler's output: a large number of small modules
+// registered in a table, most of which are called once during startup.
+String makeBundle(unsigned moduleCount)
+{
+    StringBuilder builder;
+    builder.appendLiteral("var modules = [];\n");
+    for (unsigned i = 0; i < moduleCount; ++i) {
+        builder.appendLiteral("modules.push(function module");
+        builder.appendNumber(i);
+        builder.appendLiteral("(exports, require) {\n");
+        builder.appendLiteral("    var table = { name: \"module");
+        builder.appendNumber(i);
+        builder.appendLiteral("\", values: [");
+        for (unsigned j = 0; j < 8; ++j) {
+            builder.appendNumber(i * 8 + j);
+            builder.appendLiteral(", ");
+        }
+        builder.appendLiteral("] };\n");
+        builder.appendLiteral("    function helper(x) { return typeof x === \"number\" ? x * 2 : String(x).length; }\n");
+        builder.appendLiteral("    var sum = 0;\n");
+        builder.appendLiteral("    for (var k = 0; k < table.values.length; ++k)\n");
+        builder.appendLiteral("        sum += helper(table.values[k]);\n");
+        builder.appendLiteral("    exports.value = sum + (i => i + 1)(table.name.length);\n");
+        builder.appendLiteral("    exports.describe = function() { return table.name + \":\" + exports.value; };\n");
+        builder.appendLiteral("});\n");
+    }
+    builder.appendLiteral("var result = 0;\n");
+    builder.appendLiteral("for (var i = 0; i < modules.length; i += 2) {\n");
+    builder.appendLiteral("    var exports = {};\n");
+    builder.appendLiteral("    modules[i](exports, null);\n");
+    builder.appendLiteral("    result = (result + exports.value) | 0;\n");
+    builder.appendLiteral("}\n");
+    builder.appendLiteral("result;\n");
+    return builder.toString();
+}
+
+// Evaluates the bundle in a fresh VM and tears the VM down afterwards, which flushes any
+// pending bytecode cache entries to disk.
+int32_t runStartup(const char* name, const String& bundle)
+{
+    VM* vm = &VM::create(LargeHeap).leakRef();
+    int32_t result;
+    {
+        JSLockHolder locker(vm);
+        JSGlobalObject* globalObject = JSGlobalObject::create(*vm, JSGlobalObject::createStructure(*vm, jsNull()));
+        ExecState* exec = globalObject->globalExec();
+
+        double before = monotonicallyIncreasingTimeMS();
+        NakedPtr<Exception> exception;
+        JSValue value = evaluate(exec, makeSource(bundle, SourceOrigin(), ASCIILiteral("bundle.js")), JSValue(), exception);
+        double after = monotonicallyIncreasingTimeMS();
+
+        CHECK(!exception);
+        CHECK(value.isInt32());
+        result = value.asInt32();
+        dataLog(name, ": ", after - before, " ms.\n");
+
+        vm->deref();
+    }
+    return result;
+}
+
+// Generates the bytecode of the bundle with BackgroundCodeGenerator, then runs it in a fresh VM.
+// Only installing the result and running the program happen on the main thread, which is what
+// is timed, so it compares with the cold startup.
+int32_t runStartupWithBackgroundCodeGeneration(const String& bundle)
+{
+    BinarySemaphore semaphore;
+    RefPtr<PrecompiledProgram> program;
+    BackgroundCodeGenerator::singleton().generate(String(bundle), ASCIILiteral("bundle.js"), TextPosition(), BackgroundCodeGenerator::Priority::Normal, [&] (Ref<PrecompiledProgram>&& result) {
+        program = WTFMove(result);
+        semaphore.signal();
+    });
+    semaphore.wait(WallTime::infinity());
+    CHECK(program->didSucceed());
+    dataLog("Background code generation: generated in ", program->generationTime().milliseconds(), " ms, encoded in ", program->encodingTime().milliseconds(), " ms (", program->encodedSize(), " bytes) off the main thread.\n");
+
+    VM* vm = &VM::create(LargeHeap).leakRef();
+    int32_t result;
+    {
+        JSLockHolder locker(vm);
+        JSGlobalObject* globalObject = JSGlobalObject::create(*vm, JSGlobalObject::createStructure(*vm, jsNull()));
+        ExecState* exec = globalObject->globalExec();
+        SourceCode source = makeSource(bundle, SourceOrigin(), ASCIILiteral("bundle.js"));
+
+        double before = monotonicallyIncreasingTimeMS();
+        CHECK(BackgroundCodeGenerator::install(*vm, source, *program));
+        double afterInstall = monotonicallyIncreasingTimeMS();
+        NakedPtr<Exception> exception;
+        JSValue value = evaluate(exec, source, JSValue(), exception);
+        double after = monotonicallyIncreasingTimeMS();
+
+        CHECK(!exception);
+        CHECK(value.isInt32());
+        result = value.asInt32();
+        dataLog("Startup with background code generation: ", after - before, " ms on the main thread (", afterInstall - before, " ms to install).\n");
+
+        vm->deref();
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    const char* cacheDirectory = nullptr;
+    unsigned moduleCount = 5000;
+    if (argc >= 2) {
+        if (argv[1][0] == '-') {
+            dataLog("Usage: bytecodecachebench [<cache directory> [<module count>]]\n");
+            return 1;
+        }
+        cacheDirectory = argv[1];
+        if (argc >= 3) {
+            if (sscanf(argv[2], "%u", &moduleCount) != 1) {
+                dataLog("Could not parse module count ", argv[2], "\n");
+                return 1;
+            }
+        }
+    }
+
+    char directoryTemplate[] = "/tmp/bytecodecachebench.XXXXXX";
+    if (!cacheDirectory) {
+        cacheDirectory = mkdtemp(directoryTemplate);
+        CHECK(cacheDirectory);
+    }
+
+    Options::initialize();
+    CString pathOption = makeString("bytecodeCachePath=", cacheDirectory).utf8();
+    CHECK(Options::setOption(pathOption.data()));
+    // Keep the cache from being written behind our back; tearing down the VM writes it.
+    CHECK(Options::setOption("bytecodeCacheWriteDelay=1000"));
+
+    WTF::initializeMainThread();
+    JSC::initializeThreading();
+
+    String bundle = makeBundle(moduleCount);
+    dataLog("Bundle size: ", bundle.length(), " characters, cache directory: ", cacheDirectory, "\n");
+
+    int32_t coldResult = runStartup("Cold startup", bundle);
+    CHECK(coldResult == runStartupWithBackgroundCodeGeneration(bundle));
+    int32_t warmResult = runStartup("Warm startup", bundle);
+    int32_t secondWarmResult = runStartup("Warm startup (all functions cached)", bundle);
+    CHECK(coldResult == warmResult);
+    CHECK(coldResult == secondWarmResult);
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "GCEventLog.h"
+
+namespace JSC {
+
+void GCEvent::didPause(Seconds pauseTime)
+{
+    numberOfPauses++;
+    totalPauseTime += pauseTime;
+    maxPauseTime = std::max(maxPauseTime, pauseTime);
+}
+
+void GCEvent::dump(PrintStream& out) const
+{
+    out.print("#", sequenceNumber, " ", scope, " ", bytesBefore / 1024, "kb => ", bytesAfter / 1024, "kb in ", (endTime - startTime).milliseconds(), "ms");
+    out.print(", ", numberOfPauses, " pauses (total ", totalPauseTime.milliseconds(), "ms, max ", maxPauseTime.milliseconds(), "ms)");
+    out.print(", mutator blocked ", mutatorBlockedTime.milliseconds(), "ms");
+    out.print(", constraints ", constraintSolvingTime.milliseconds(), "ms");
+    for (unsigned i = static_cast<unsigned>(CollectorPhase::Begin); i < numberOfPhases; ++i)
+        out.print(", ", static_cast<CollectorPhase>(i), " ", phaseTimes[i].milliseconds(), "ms");
+}
+
+GCEventLog::GCEventLog(unsigned capacity)
+{
+    m_events.resize(capacity);
+}
+
+void GCEventLog::append(GCEvent& event)
+{
+    if (m_events.isEmpty())
+        return;
+
+    auto locker = holdLock(m_lock);
+    event.sequenceNumber = ++m_numberOfEvents;
+    m_events[(event.sequenceNumber - 1) % m_events.size()] = event;
+}
+
+Vector<GCEvent> GCEventLog::events() const
+{
+    auto locker = holdLock(m_lock);
+    uint64_t size = std::min<uint64_t>(m_numberOfEvents, m_events.size());
+    Vector<GCEvent> result;
+    result.reserveInitialCapacity(size);
+    for (uint64_t sequenceNumber = m_numberOfEvents - size + 1; sequenceNumber <= m_numberOfEvents; ++sequenceNumber)
+        result.uncheckedAppend(m_events[(sequenceNumber - 1) % m_events.size()]);
+    return result;
+}
+
+} // namespace JSC
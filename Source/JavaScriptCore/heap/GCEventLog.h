@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "CollectionScope.h"
+#include "CollectorPhase.h"
+#include <array>
+#include <wtf/Lock.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/PrintStream.h>
+#include <wtf/Seconds.h>
+#include <wtf/Vector.h>
+#include <wtf/WallTime.h>
+
+namespace JSC {
+
+// Everything we know about one collection cycle. Filled in by whoever has the conn while the
+// collector runs, and appended to the GCEventLog by the mutator when it finalizes the cycle.
+struct GCEvent {
+    static const unsigned numberOfPhases = static_cast<unsigned>(CollectorPhase::End) + 1;
+
+    Seconds& timeInPhase(CollectorPhase phase) { return phaseTimes[static_cast<unsigned>(phase)]; }
+    Seconds timeInPhase(CollectorPhase phase) const { return phaseTimes[static_cast<unsigned>(phase)]; }
+
+    void didPause(Seconds);
+
+    void dump(PrintStream&) const;
+
+    uint64_t sequenceNumber { 0 };
+    CollectionScope scope { CollectionScope::Eden };
+    MonotonicTime startTime;
+    MonotonicTime endTime;
+    // For clients that need to relate the cycle to events in other processes or logs.
+    WallTime wallClockStartTime;
+    size_t bytesBefore { 0 };
+    size_t bytesAfter { 0 };
+    unsigned numberOfPauses { 0 };
+    Seconds totalPauseTime;
+    Seconds maxPauseTime;
+    Seconds mutatorBlockedTime;
+    Seconds constraintSolvingTime;
+    std::array<Seconds, numberOfPhases> phaseTimes { };
+};
+
+// A fixed-size ring buffer of the most recent collection cycles of one heap. Appending never
+// allocates, so this is cheap enough to leave on. Readers may be on any thread.
+class GCEventLog {
+    WTF_MAKE_NONCOPYABLE(GCEventLog);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    explicit GCEventLog(unsigned capacity);
+
+    unsigned capacity() const { return m_events.size(); }
+
+    void append(GCEvent&);
+
+    // Oldest first.
+    JS_EXPORT_PRIVATE Vector<GCEvent> events() const;
+
+private:
+    mutable Lock m_lock;
+    Vector<GCEvent> m_events;
+    uint64_t m_numberOfEvents { 0 };
+};
+
+} // namespace JSC
@@ -429,6 +429,7 @@ void Heap::lastChanceToFinalize()
     if (Options::logGC())
         dataLog("5 ");
     
+    m_sweeper->stopConcurrentSweeping();
     m_arrayBuffers.lastChanceToFinalize();
     m_codeBlocks->lastChanceToFinalize(*m_vm);
     m_objectSpace.stopAllocating();
@@ -1184,6 +1185,15 @@ NEVER_INLINE bool Heap::runBeginPhase(GCConductor conn)
     }
     
     willStartCollection();
+
+    m_currentGCEvent = GCEvent();
+    m_currentGCEvent.scope = *m_collectionScope;
+    m_currentGCEvent.startTime = m_beforeGC;
+    m_currentGCEvent.wallClockStartTime = WallTime::now();
+    m_currentGCEvent.bytesBefore = m_sizeAfterLastCollect + m_bytesAllocatedThisCycle;
+    
+    // Free lists built concurrently since the last collection are about to be invalidated.
+    m_sweeper->stopConcurrentSweeping();
         
     if (UNLIKELY(m_verifier)) {
         // Verify that live objects from the last GC cycle haven't been corrupted by
@@ -1318,8 +1328,10 @@ NEVER_INLINE bool Heap::runFixpointPhase(GCConductor conn)
             
         // Wondering what this does? Look at Heap::addCoreConstraints(). The DOM and others can also
         // add their own using Heap::addMarkingConstraint().
+        MonotonicTime constraintSolvingStartTime = MonotonicTime::now();
         bool converged =
             m_constraintSet->executeConvergence(slotVisitor, MonotonicTime::infinity());
+        m_currentGCEvent.constraintSolvingTime += MonotonicTime::now() - constraintSolvingStartTime;
         if (converged && slotVisitor.isEmpty()) {
             assertSharedMarkStacksEmpty();
             return changePhase(conn, CollectorPhase::End);
@@ -1451,6 +1463,9 @@ NEVER_INLINE bool Heap::runEndPhase(GCConductor conn)
     }
 
     didFinishCollection();
+
+    m_currentGCEvent.endTime = m_afterGC;
+    m_currentGCEvent.bytesAfter = m_sizeAfterLastCollect;
     
     if (m_currentRequest.didFinishEndPhase)
         m_currentRequest.didFinishEndPhase->run();
@@ -1502,6 +1517,11 @@ NEVER_INLINE bool Heap::finishChangingPhase(GCConductor conn)
 
     if (false)
         dataLog(conn, ": Going to phase: ", m_nextPhase, " (from ", m_currentPhase, ")\n");
+
+    MonotonicTime now = MonotonicTime::now();
+    if (m_currentPhase != CollectorPhase::NotRunning)
+        m_currentGCEvent.timeInPhase(m_currentPhase) += now - m_currentPhaseStartTime;
+    m_currentPhaseStartTime = now;
     
     bool suspendedBefore = worldShouldBeSuspended(m_currentPhase);
     bool suspendedAfter = worldShouldBeSuspended(m_nextPhase);
@@ -1587,6 +1607,8 @@ NEVER_INLINE void Heap::resumeThePeriphery()
     m_objectSpace.resumeAllocating();
     
     m_barriersExecuted = 0;
+
+    m_currentGCEvent.didPause(MonotonicTime::now() - m_stopTime);
     
     if (!m_collectorBelievesThatTheWorldIsStopped) {
         dataLog("Fatal: collector does not believe that the world is stopped.\n");
@@ -1799,7 +1821,9 @@ void Heap::waitForCollector(const Func& func)
         }
         
         // If mutatorWaitingBit is still set then we want to wait.
+        MonotonicTime parkTime = MonotonicTime::now();
         ParkingLot::compareAndPark(&m_worldState, oldState | mutatorWaitingBit);
+        m_mutatorBlockedTimeThisCycle += MonotonicTime::now() - parkTime;
     }
 }
 
@@ -1815,7 +1839,9 @@ void Heap::acquireAccessSlow()
                 WTFReportBacktrace();
             }
             // Wait until we're not stopped anymore.
+            MonotonicTime parkTime = MonotonicTime::now();
             ParkingLot::compareAndPark(&m_worldState, oldState);
+            m_mutatorBlockedTimeThisCycle += MonotonicTime::now() - parkTime;
             continue;
         }
         
@@ -2010,12 +2036,21 @@ void Heap::finalize()
     for (const HeapFinalizerCallback& callback : m_heapFinalizerCallbacks)
         callback.run(*vm());
     
+    if (m_hardHeapLimit)
+        enforceHardHeapLimit();
+
+    m_currentGCEvent.mutatorBlockedTime = m_mutatorBlockedTimeThisCycle;
+    m_mutatorBlockedTimeThisCycle = Seconds();
+    m_gcEventLog.append(m_currentGCEvent);
+
     if (Options::sweepSynchronously())
         sweepSynchronously();
 
     if (Options::logGC()) {
         MonotonicTime after = MonotonicTime::now();
         dataLog((after - before).milliseconds(), "ms]\n");
+        if (Options::logGC() == GCLogging::Verbose)
+            dataLog("[GC<", RawPointer(this), ">: ", m_currentGCEvent, "]\n");
     }
 }
 
@@ -2235,6 +2270,9 @@ void Heap::updateAllocationLimits()
         }
     }
 
+    if (m_hardHeapLimit)
+        updateAllocationLimitsForHardHeapLimit(currentHeapSize);
+
 #if PLATFORM(IOS)
     // Get critical memory threshold for next cycle.
     overCriticalMemoryThreshold(MemoryThresholdCallType::Direct);
@@ -2250,6 +2288,61 @@ void Heap::updateAllocationLimits()
         dataLog("=> ", currentHeapSize / 1024, "kb, ");
 }
 
+void Heap::updateAllocationLimitsForHardHeapLimit(size_t currentHeapSize)
+{
+    // Never plan to grow past the cap, but always leave some room for eden so that a heap that
+    // sits at the cap doesn't collect on every allocation slow path.
+    size_t minEdenSize = m_hardHeapLimit / 16;
+    size_t roomUntilLimit = currentHeapSize < m_hardHeapLimit ? m_hardHeapLimit - currentHeapSize : 0;
+    m_maxEdenSize = std::max(minEdenSize, std::min(m_maxEdenSize, roomUntilLimit));
+    m_maxHeapSize = currentHeapSize + m_maxEdenSize;
+
+    if (!m_collectionScope)
+        return;
+
+    double pressure = static_cast<double>(currentHeapSize) / static_cast<double>(m_hardHeapLimit);
+    if (pressure >= Options::hardHeapLimitFullCollectionRatio())
+        m_shouldDoFullCollection = true;
+
+    if (*m_collectionScope != CollectionScope::Full)
+        return;
+
+    if (pressure < Options::hardHeapLimitDeleteAllCodeRatio()) {
+        m_didDeleteAllCodeForHardHeapLimit = false;
+        return;
+    }
+
+    // A full collection didn't bring us far enough below the cap. First try throwing away
+    // compiled code. If we already did that before this collection and we are still over the
+    // cap, there is nothing left for us to do, so tell the embedder.
+    if (m_didDeleteAllCodeForHardHeapLimit && currentHeapSize > m_hardHeapLimit)
+        m_shouldNotifyHardHeapLimitExceeded = true;
+    else if (!m_didDeleteAllCodeForHardHeapLimit)
+        m_shouldDeleteAllCodeForHardHeapLimit = true;
+
+    if (Options::logGC())
+        dataLog("[hard heap limit: ", currentHeapSize / 1024, "kb of ", m_hardHeapLimit / 1024, "kb] ");
+}
+
+void Heap::enforceHardHeapLimit()
+{
+    if (m_shouldDeleteAllCodeForHardHeapLimit) {
+        m_shouldDeleteAllCodeForHardHeapLimit = false;
+        m_didDeleteAllCodeForHardHeapLimit = true;
+        // This runs as soon as the VM is idle and reports the abandoned code, which makes the
+        // next collection a full one.
+        m_vm->deleteAllCode(DeleteAllCodeIfNotCollecting);
+        m_shouldDoFullCollection = true;
+    }
+
+    if (m_shouldNotifyHardHeapLimitExceeded) {
+        m_shouldNotifyHardHeapLimitExceeded = false;
+        m_didDeleteAllCodeForHardHeapLimit = false;
+        if (m_hardHeapLimitCallback)
+            m_hardHeapLimitCallback(m_sizeAfterLastCollect, m_hardHeapLimit);
+    }
+}
+
 void Heap::didFinishCollection()
 {
     m_afterGC = MonotonicTime::now();
@@ -2873,4 +2966,15 @@ void Heap::removeHeapFinalizerCallback(const HeapFinalizerCallback& callback)
     m_heapFinalizerCallbacks.removeFirst(callback);
 }
 
+void Heap::setHardHeapLimit(size_t limit, HardHeapLimitCallback&& callback)
+{
+    m_hardHeapLimit = limit;
+    m_hardHeapLimitCallback = WTFMove(callback);
+    m_shouldDeleteAllCodeForHardHeapLimit = false;
+    m_didDeleteAllCodeForHardHeapLimit = false;
+    m_shouldNotifyHardHeapLimitExceeded = false;
+    if (m_hardHeapLimit)
+        updateAllocationLimitsForHardHeapLimit(m_sizeAfterLastCollect);
+}
+
 } // namespace JSC
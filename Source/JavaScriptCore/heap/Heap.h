@@ -26,6 +26,7 @@
 #include "CollectionScope.h"
 #include "CollectorPhase.h"
 #include "DeleteAllCodeEffort.h"
+#include "GCEventLog.h"
 #include "GCConductor.h"
 #include "GCIncomingRefCountedSet.h"
 #include "GCRequest.h"
@@ -49,6 +50,7 @@
 #include "WriteBarrierSupport.h"
 #include <wtf/AutomaticThread.h>
 #include <wtf/Deque.h>
+#include <wtf/Function.h>
 #include <wtf/HashCountedSet.h>
 #include <wtf/HashSet.h>
 #include <wtf/ParallelHelperPool.h>
@@ -379,6 +381,15 @@ public:
     void addHeapFinalizerCallback(const HeapFinalizerCallback&);
     void removeHeapFinalizerCallback(const HeapFinalizerCallback&);
 
+    // Caps size() at the given number of bytes (0 means no cap). As the heap approaches the cap,
+    // collections escalate from eden to full, and then to throwing away all compiled code. If the
+    // heap is still over the cap after that, the callback is invoked on the mutator thread.
+    typedef WTF::Function<void(size_t heapSize, size_t heapLimit)> HardHeapLimitCallback;
+    JS_EXPORT_PRIVATE void setHardHeapLimit(size_t, HardHeapLimitCallback&& = nullptr);
+    size_t hardHeapLimit() const { return m_hardHeapLimit; }
+
+    const GCEventLog& gcEventLog() const { return m_gcEventLog; }
+
 private:
     friend class AllocatingScope;
     friend class CodeBlock;
@@ -547,6 +558,9 @@ private:
     
     void assertSharedMarkStacksEmpty();
 
+    void updateAllocationLimitsForHardHeapLimit(size_t currentHeapSize);
+    void enforceHardHeapLimit();
+
     const HeapType m_heapType;
     const size_t m_ramSize;
     const size_t m_minBytesPerCycle;
@@ -634,6 +648,12 @@ private:
     Vector<HeapObserver*> m_observers;
     
     Vector<HeapFinalizerCallback> m_heapFinalizerCallbacks;
+
+    size_t m_hardHeapLimit { Options::gcHardHeapLimit() };
+    HardHeapLimitCallback m_hardHeapLimitCallback;
+    bool m_shouldDeleteAllCodeForHardHeapLimit { false };
+    bool m_didDeleteAllCodeForHardHeapLimit { false };
+    bool m_shouldNotifyHardHeapLimitExceeded { false };
     
     unsigned m_deferralDepth;
     bool m_didDeferGCWork { false };
@@ -686,6 +706,11 @@ private:
     MonotonicTime m_beforeGC;
     MonotonicTime m_afterGC;
     MonotonicTime m_stopTime;
+
+    GCEventLog m_gcEventLog { Options::gcEventLogSize() };
+    GCEvent m_currentGCEvent;
+    MonotonicTime m_currentPhaseStartTime;
+    Seconds m_mutatorBlockedTimeThisCycle;
     
     Deque<GCRequest> m_requests;
     GCRequest m_currentRequest;
@@ -27,8 +27,10 @@
 #include "IncrementalSweeper.h"
 
 #include "Heap.h"
+#include "HeapHelperPool.h"
 #include "JSObject.h"
 #include "JSString.h"
+#include "MarkedAllocatorInlines.h"
 #include "MarkedBlock.h"
 #include "JSCInlines.h"
 #include <wtf/CurrentTime.h>
@@ -47,6 +49,7 @@ void IncrementalSweeper::scheduleTimer()
 IncrementalSweeper::IncrementalSweeper(Heap* heap)
     : Base(heap->vm())
     , m_currentAllocator(nullptr)
+    , m_helperClient(&heapHelperPool())
 {
 }
 
@@ -99,6 +102,8 @@ void IncrementalSweeper::startSweeping()
 {
     scheduleTimer();
     m_currentAllocator = m_vm->heap.objectSpace().firstAllocator();
+    if (Options::useConcurrentSweeping())
+        startConcurrentSweeping();
 }
 
 void IncrementalSweeper::stopSweeping()
@@ -108,4 +113,93 @@ void IncrementalSweeper::stopSweeping()
         cancelTimer();
 }
 
+void IncrementalSweeper::startConcurrentSweeping()
+{
+    // We only get here with the world stopped at the end of a collection, so the allocators'
+    // block lists and bits are stable while we pick the blocks. Helpers only ever see this
+    // snapshot. None of these blocks can be freed before the next collection, since only blocks
+    // with the empty bit set get freed and nothing sets that bit on these blocks until then.
+    ASSERT(m_blocksToSweepConcurrently.isEmpty());
+    m_vm->heap.objectSpace().forEachAllocator(
+        [&] (MarkedAllocator& allocator) -> IterationStatus {
+            if (allocator.needsDestruction())
+                return IterationStatus::Continue;
+            allocator.forEachBlock(
+                [&] (MarkedBlock::Handle* block) {
+                    if (!block->canPresweepConcurrently())
+                        return;
+                    block->armConcurrentPresweep();
+                    m_blocksToSweepConcurrently.append(block);
+                });
+            return IterationStatus::Continue;
+        });
+
+    m_nextBlockToSweepConcurrently.store(0);
+    m_blocksSweptConcurrently.store(0);
+    m_concurrentSweepNanoseconds.store(0);
+    m_presweptFreeListsTaken.store(0);
+    m_presweepWaitNanoseconds.store(0);
+    m_shouldStopSweepingConcurrently.store(false);
+
+    if (m_blocksToSweepConcurrently.isEmpty())
+        return;
+
+    m_helperClient.setFunction(
+        [this] () {
+            MonotonicTime before = MonotonicTime::now();
+            size_t blocksSwept = 0;
+            while (!m_shouldStopSweepingConcurrently.load()) {
+                size_t index = m_nextBlockToSweepConcurrently.exchangeAdd(1);
+                if (index >= m_blocksToSweepConcurrently.size())
+                    break;
+                if (m_blocksToSweepConcurrently[index]->presweepConcurrently())
+                    blocksSwept++;
+            }
+            m_blocksSweptConcurrently.exchangeAdd(blocksSwept);
+            m_concurrentSweepNanoseconds.exchangeAdd((MonotonicTime::now() - before).nanosecondsAs<uint64_t>());
+        });
+}
+
+void IncrementalSweeper::stopConcurrentSweeping()
+{
+    if (m_blocksToSweepConcurrently.isEmpty())
+        return;
+
+    m_shouldStopSweepingConcurrently.store(true);
+    m_helperClient.finish();
+
+    // Free lists that the mutator did not claim are built from marks that are about to go stale.
+    for (MarkedBlock::Handle* block : m_blocksToSweepConcurrently)
+        block->disarmConcurrentPresweep();
+
+    if (Options::logGC()) {
+        // What matters is the sweeping the main thread did not have to do: the helpers' average
+        // time per block for each free list the mutator took, less the time it spent waiting
+        // for helpers. Free lists that were never taken saved nothing.
+        size_t blocksSwept = m_blocksSweptConcurrently.load();
+        size_t freeListsTaken = m_presweptFreeListsTaken.load();
+        Seconds helperTime = Seconds::fromNanoseconds(m_concurrentSweepNanoseconds.load());
+        Seconds waitTime = Seconds::fromNanoseconds(m_presweepWaitNanoseconds.load());
+        Seconds savedTime = blocksSwept ? helperTime * (static_cast<double>(freeListsTaken) / blocksSwept) - waitTime : Seconds();
+        dataLog("[concurrent sweep: ", freeListsTaken, "/", blocksSwept, "/", m_blocksToSweepConcurrently.size(), " blocks taken/swept/armed, ",
+            savedTime.milliseconds(), "ms of main thread sweeping saved, ", waitTime.milliseconds(), "ms waiting] ");
+    }
+    m_blocksToSweepConcurrently.clear();
+}
+
+void IncrementalSweeper::finishConcurrentSweeping()
+{
+    if (m_blocksToSweepConcurrently.isEmpty())
+        return;
+    m_helperClient.doSomeHelping();
+    m_helperClient.finish();
+}
+
+void IncrementalSweeper::didTakePresweptFreeList(Seconds waitTime)
+{
+    m_presweptFreeListsTaken.exchangeAdd(1);
+    if (waitTime)
+        m_presweepWaitNanoseconds.exchangeAdd(waitTime.nanosecondsAs<uint64_t>());
+}
+
 } // namespace JSC
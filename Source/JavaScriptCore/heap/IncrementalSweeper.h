@@ -26,6 +26,9 @@
 #pragma once
 
 #include "JSRunLoopTimer.h"
+#include "MarkedBlock.h"
+#include <wtf/Atomics.h>
+#include <wtf/ParallelHelperPool.h>
 #include <wtf/Vector.h>
 
 namespace JSC {
@@ -45,12 +48,37 @@ public:
     bool sweepNextBlock();
     JS_EXPORT_PRIVATE void stopSweeping();
 
+    // Must be called with the world stopped, before anything changes the mark bits.
+    void stopConcurrentSweeping();
+
+    // Helps the GC helper threads until every armed block has been swept, then waits for them.
+    JS_EXPORT_PRIVATE void finishConcurrentSweeping();
+
+    // Called by MarkedBlock::Handle::sweep() when the mutator takes a free list built by a helper,
+    // with the time it spent waiting for the helper to finish building it.
+    void didTakePresweptFreeList(Seconds waitTime);
+
+    // These describe the concurrent sweep started by the last collection.
+    size_t blocksToSweepConcurrently() const { return m_blocksToSweepConcurrently.size(); }
+    size_t blocksSweptConcurrently() const { return m_blocksSweptConcurrently.load(); }
+    size_t presweptFreeListsTaken() const { return m_presweptFreeListsTaken.load(); }
+
 private:
     void doSweep(MonotonicTime startTime);
     void scheduleTimer();
+    void startConcurrentSweeping();
     
     MarkedAllocator* m_currentAllocator;
     bool m_shouldFreeFastMallocMemoryAfterSweeping { false };
+
+    ParallelHelperClient m_helperClient;
+    Vector<MarkedBlock::Handle*> m_blocksToSweepConcurrently;
+    Atomic<size_t> m_nextBlockToSweepConcurrently { 0 };
+    Atomic<size_t> m_blocksSweptConcurrently { 0 };
+    Atomic<uint64_t> m_concurrentSweepNanoseconds { 0 };
+    Atomic<size_t> m_presweptFreeListsTaken { 0 };
+    Atomic<uint64_t> m_presweepWaitNanoseconds { 0 };
+    Atomic<bool> m_shouldStopSweepingConcurrently { false };
 };
 
 } // namespace JSC
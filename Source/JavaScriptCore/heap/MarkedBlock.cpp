@@ -26,12 +26,14 @@
 #include "config.h"
 #include "MarkedBlock.h"
 
+#include "IncrementalSweeper.h"
 #include "JSCell.h"
 #include "JSDestructibleObject.h"
 #include "JSCInlines.h"
 #include "MarkedBlockInlines.h"
 #include "SuperSampler.h"
 #include "SweepingScope.h"
+#include <thread>
 
 namespace JSC {
 
@@ -407,6 +409,68 @@ Subspace* MarkedBlock::Handle::subspace() const
     return allocator()->subspace();
 }
 
+bool MarkedBlock::Handle::canPresweepConcurrently()
+{
+    // This is the case that sweep() handles with the NotEmpty, BlockHasNoDestructors,
+    // DoesNotHaveNewlyAllocated, MarksNotStale specialization. Empty blocks are bump allocated,
+    // so they are cheap enough to sweep on the mutator.
+    return m_attributes.destruction == DoesNotNeedDestruction
+        && !m_isFreeListed
+        && m_allocator->isCanAllocateButNotEmpty(NoLockingNecessary, this)
+        && emptyMode() == NotEmpty
+        && scribbleMode() == DontScribble
+        && newlyAllocatedMode() == DoesNotHaveNewlyAllocated
+        && marksMode() == MarksNotStale;
+}
+
+bool MarkedBlock::Handle::presweepConcurrently()
+{
+    if (m_presweepState.compareExchangeStrong(PresweepState::Idle, PresweepState::Sweeping) != PresweepState::Idle)
+        return false;
+    
+    // Nothing else touches the dead cells of this block until the mutator claims it, and the
+    // marks cannot change until the IncrementalSweeper disarms us before the next collection.
+    MarkedBlock& block = this->block();
+    FreeCell* head = nullptr;
+    size_t count = 0;
+    for (size_t i = firstAtom(); i < m_endAtom; i += m_atomsPerCell) {
+        if (block.m_marks.get(i))
+            continue;
+        FreeCell* freeCell = reinterpret_cast_ptr<FreeCell*>(&block.atoms()[i]);
+        freeCell->next = head;
+        head = freeCell;
+        ++count;
+    }
+    m_presweptFreeList = FreeList::list(head, count * cellSize());
+    m_presweepState.store(PresweepState::Swept);
+    return true;
+}
+
+std::optional<FreeList> MarkedBlock::Handle::takePresweptFreeList()
+{
+    MonotonicTime waitStartTime;
+    for (;;) {
+        PresweepState state = m_presweepState.load();
+        switch (state) {
+        case PresweepState::Taken:
+            return std::nullopt;
+        case PresweepState::Sweeping:
+            if (!waitStartTime)
+                waitStartTime = MonotonicTime::now();
+            std::this_thread::yield();
+            continue;
+        case PresweepState::Idle:
+        case PresweepState::Swept:
+            if (!m_presweepState.compareExchangeWeak(state, PresweepState::Taken))
+                continue;
+            if (state == PresweepState::Idle)
+                return std::nullopt;
+            heap()->sweeper().didTakePresweptFreeList(waitStartTime ? MonotonicTime::now() - waitStartTime : Seconds());
+            return m_presweptFreeList;
+        }
+    }
+}
+
 FreeList MarkedBlock::Handle::sweep(SweepMode sweepMode)
 {
     SweepingScope sweepingScope(*heap());
@@ -425,6 +489,15 @@ FreeList MarkedBlock::Handle::sweep(SweepMode sweepMode)
     
     ASSERT(!m_allocator->isAllocated(NoLockingNecessary, this));
     
+    if (m_attributes.destruction == DoesNotNeedDestruction) {
+        if (std::optional<FreeList> presweptFreeList = takePresweptFreeList()) {
+            ASSERT(sweepMode == SweepToFreeList);
+            ASSERT(!space()->isMarking());
+            setIsFreeListed();
+            return *presweptFreeList;
+        }
+    }
+    
     if (space()->isMarking())
         block().m_lock.lock();
     
@@ -32,6 +32,7 @@
 #include <wtf/DataLog.h>
 #include <wtf/DoublyLinkedList.h>
 #include <wtf/HashFunctions.h>
+#include <wtf/Optional.h>
 #include <wtf/StdLibExtras.h>
 
 namespace JSC {
@@ -135,6 +136,15 @@ public:
         
         void unsweepWithNoNewlyAllocated();
         
+        // Blocks that don't need destruction may have their free list built ahead of time on a
+        // GC helper thread. The IncrementalSweeper arms eligible blocks at the end of a collection
+        // and disarms them before the next one starts. sweep() claims the block first, waiting if
+        // a helper is in the middle of building its free list.
+        bool canPresweepConcurrently();
+        void armConcurrentPresweep() { m_presweepState.store(PresweepState::Idle); }
+        void disarmConcurrentPresweep() { m_presweepState.store(PresweepState::Taken); }
+        bool presweepConcurrently();
+        
         void zap(const FreeList&);
         
         void shrink();
@@ -220,6 +230,9 @@ public:
         
         void setIsFreeListed();
         
+        enum class PresweepState : uint8_t { Idle, Sweeping, Swept, Taken };
+        std::optional<FreeList> takePresweptFreeList();
+        
         MarkedBlock::Handle* m_prev;
         MarkedBlock::Handle* m_next;
             
@@ -236,6 +249,9 @@ public:
         WeakSet m_weakSet;
         
         HeapVersion m_newlyAllocatedVersion;
+        
+        Atomic<PresweepState> m_presweepState { PresweepState::Taken };
+        FreeList m_presweptFreeList;
             
         MarkedBlock* m_block { nullptr };
     };
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include "Completion.h"
+#include "Exception.h"
+#include "InitializeThreading.h"
+#include "JSCInlines.h"
+#include "JSGlobalObject.h"
+#include "JSLock.h"
+#include "SourceCode.h"
+#include "VM.h"
+#include <wtf/CurrentTime.h>
+#include <wtf/MainThread.h>
+#include <wtf/text/StringBuilder.h>
+
+using namespace JSC;
+
+namespace {
+
+StaticLock crashLock;
+
+#define CHECK(x) do {                                                   \
+        if (!!(x))                                                      \
+            break;                                                      \
+        crashLock.lock();                                               \
+        WTFReportAssertionFailure(__FILE__, __LINE__, WTF_PRETTY_FUNCTION, #x); \
+        CRASH();                                                        \
+    } while (false)
+
+struct Benchmark {
+    const char* name;
+    const char* body;
+};
+
+// Each body runs once per iteration with |i| set, and its result is folded into a checksum so that
+// the runs with and without the formatter cache can be compared.
+const Benchmark benchmarks[] = {
+    { "Date.prototype.toLocaleString()", "new Date(1500000000000 + i * 60000).toLocaleString()" },
+    { "Date.prototype.toLocaleTimeString(locale, options)", "new Date(1500000000000 + i * 60000).toLocaleTimeString(\"en-US\", { hour: \"2-digit\", minute: \"2-digit\" })" },
+    { "Date.prototype.toLocaleDateString(locale, options)", "new Date(1500000000000 + i * 86400000).toLocaleDateString(\"de-DE\", { weekday: \"short\", day: \"numeric\", month: \"short\" })" },
+    { "Number.prototype.toLocaleString(locale, options)", "(i * 1.25).toLocaleString(\"en-US\", { style: \"currency\", currency: \"EUR\" })" },
+    { "String.prototype.localeCompare(that, locale)", "(\"channel \" + i).localeCompare(\"channel \" + (i >> 1), \"sv\") + \"\"" },
+};
+
+String makeScript(const Benchmark& benchmark, unsigned iterations)
+{
+    StringBuilder builder;
+    builder.appendLiteral("var checksum = 0;\n");
+    builder.appendLiteral("for (var i = 0; i < ");
+    builder.appendNumber(iterations);
+    builder.appendLiteral("; ++i) {\n");
+    builder.appendLiteral("    var result = ");
+    builder.append(benchmark.body);
+    builder.appendLiteral(";\n");
+    builder.appendLiteral("    checksum = (checksum * 31 + result.length + result.charCodeAt(result.length - 1)) | 0;\n");
+    builder.appendLiteral("}\n");
+    builder.appendLiteral("checksum;\n");
+    return builder.toString();
+}
+
+int32_t run(VM& vm, const Benchmark& benchmark, const String& script, bool useCache)
+{
+    CHECK(Options::setOption(useCache ? "useIntlFormatterCache=true" : "useIntlFormatterCache=false"));
+
+    JSLockHolder locker(vm);
+    JSGlobalObject* globalObject = JSGlobalObject::create(vm, JSGlobalObject::createStructure(vm, jsNull()));
+    ExecState* exec = globalObject->globalExec();
+
+    double before = monotonicallyIncreasingTimeMS();
+    NakedPtr<Exception> exception;
+    JSValue value = evaluate(exec, makeSource(script, SourceOrigin(), ASCIILiteral("intlformatbench.js")), JSValue(), exception);
+    double after = monotonicallyIncreasingTimeMS();
+
+    CHECK(!exception);
+    CHECK(value.isInt32());
+    dataLog(benchmark.name, useCache ? " with cache: " : " without cache: ", after - before, " ms.\n");
+    return value.asInt32();
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    unsigned iterations = 2000;
+    if (argc >= 2) {
+        if (sscanf(argv[1], "%u", &iterations) != 1) {
+            dataLog("Usage: intlformatbench [<iterations>]\n");
+            return 1;
+        }
+    }
+
+    Options::initialize();
+    WTF::initializeMainThread();
+    JSC::initializeThreading();
+
+    VM& vm = VM::create(LargeHeap).leakRef();
+    for (const Benchmark& benchmark : benchmarks) {
+        String script = makeScript(benchmark, iterations);
+        int32_t uncachedResult = run(vm, benchmark, script, false);
+        int32_t cachedResult = run(vm, benchmark, script, true);
+        CHECK(uncachedResult == cachedResult);
+    }
+
+    return 0;
+}
@@ -74,6 +74,7 @@
 #include "SuperSampler.h"
 #include "TestRunnerUtils.h"
 #include "TypeProfilerLog.h"
+#include "UnlinkedInstructionStream.h"
 #include "WasmBBQPlanInlines.h"
 #include "WasmCallee.h"
 #include "WasmContext.h"
@@ -1072,6 +1073,8 @@ static EncodedJSValue JSC_HOST_CALL functionFullGC(ExecState*);
 static EncodedJSValue JSC_HOST_CALL functionEdenGC(ExecState*);
 static EncodedJSValue JSC_HOST_CALL functionForceGCSlowPaths(ExecState*);
 static EncodedJSValue JSC_HOST_CALL functionHeapSize(ExecState*);
+static EncodedJSValue JSC_HOST_CALL functionSetHardHeapLimit(ExecState*);
+static EncodedJSValue JSC_HOST_CALL functionHardHeapLimitExceededCount(ExecState*);
 static EncodedJSValue JSC_HOST_CALL functionAddressOf(ExecState*);
 static EncodedJSValue JSC_HOST_CALL functionGetGetterSetter(ExecState*);
 #ifndef NDEBUG
@@ -1301,6 +1304,8 @@ protected:
         addFunction(vm, "edenGC", functionEdenGC, 0);
         addFunction(vm, "forceGCSlowPaths", functionForceGCSlowPaths, 0);
         addFunction(vm, "gcHeapSize", functionHeapSize, 0);
+        addFunction(vm, "setHardHeapLimit", functionSetHardHeapLimit, 1);
+        addFunction(vm, "hardHeapLimitExceededCount", functionHardHeapLimitExceededCount, 0);
         addFunction(vm, "addressOf", functionAddressOf, 1);
         addFunction(vm, "getGetterSetter", functionGetGetterSetter, 2);
 #ifndef NDEBUG
@@ -1487,6 +1492,7 @@ const GlobalObjectMethodTable GlobalObject::s_globalObjectMethodTable = {
     nullptr, // moduleLoaderEvaluate
     nullptr, // promiseRejectionTracker
     nullptr, // defaultLanguage
+    nullptr, // streamWebAssemblySource
 };
 
 GlobalObject::GlobalObject(VM& vm, Structure* structure)
@@ -2112,6 +2118,31 @@ EncodedJSValue JSC_HOST_CALL functionHeapSize(ExecState* exec)
     return JSValue::encode(jsNumber(exec->heap()->size()));
 }
 
+static unsigned hardHeapLimitExceededCount;
+
+EncodedJSValue JSC_HOST_CALL functionSetHardHeapLimit(ExecState* exec)
+{
+    VM& vm = exec->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+    JSLockHolder lock(exec);
+
+    double limit = exec->argument(0).toNumber(exec);
+    RETURN_IF_EXCEPTION(scope, encodedJSValue());
+    if (!(limit >= 0))
+        return throwVMRangeError(exec, scope, ASCIILiteral("setHardHeapLimit() expects a non-negative number of bytes"));
+
+    hardHeapLimitExceededCount = 0;
+    vm.heap.setHardHeapLimit(static_cast<size_t>(limit), [] (size_t, size_t) {
+        hardHeapLimitExceededCount++;
+    });
+    return JSValue::encode(jsUndefined());
+}
+
+EncodedJSValue JSC_HOST_CALL functionHardHeapLimitExceededCount(ExecState*)
+{
+    return JSValue::encode(jsNumber(hardHeapLimitExceededCount));
+}
+
 // This function is not generally very helpful in 64-bit code as the tag and payload
 // share a register. But in 32-bit JITed code the tag may not be checked if an
 // optimization removes type checking requirements, such as in ===.
@@ -3910,6 +3941,9 @@ int runJSC(CommandLine options, const Func& func)
     }
 #endif
 
+    if (Options::reportInstructionStreamSizes())
+        UnlinkedInstructionStream::dumpSizeStatistics();
+
     if (Options::gcAtEnd()) {
         // We need to hold the API lock to do a GC.
         JSLockHolder locker(&vm);
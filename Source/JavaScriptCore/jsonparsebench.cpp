@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include "Completion.h"
+#include "Exception.h"
+#include "InitializeThreading.h"
+#include "JSCInlines.h"
+#include "JSGlobalObject.h"
+#include "JSLock.h"
+#include "SourceCode.h"
+#include "VM.h"
+#include <wtf/CurrentTime.h>
+#include <wtf/MainThread.h>
+#include <wtf/text/StringBuilder.h>
+
+using namespace JSC;
+
+namespace {
+
+StaticLock crashLock;
+
+#define CHECK(x) do {                                                   \
+        if (!!(x))                                                      \
+            break;                                                      \
+        crashLock.lock();                                               \
+        WTFReportAssertionFailure(__FILE__, __LINE__, WTF_PRETTY_FUNCTION, #x); \
+        CRASH();                                                        \
+    } while (false)
+
+// The corpus is shaped like typical API responses: arrays of records with the same keys in the
+// same order, nested objects, short strings, and a few non-ASCII ones.
+const char* corpusScript =
+    "function makeRecords(count, text) {\n"
+    "    var records = [];\n"
+    "    for (var i = 0; i < count; ++i) {\n"
+    "        records.push({\n"
+    "            id: i,\n"
+    "            type: ['article', 'video', 'gallery'][i % 3],\n"
+    "            title: text + ' number ' + i,\n"
+    "            url: 'https://www.example.com/items/' + i + '?ref=feed',\n"
+    "            score: i * 1.5,\n"
+    "            published: i % 5 != 0,\n"
+    "            author: { id: i % 17, name: 'author' + (i % 17), avatar: null },\n"
+    "            tags: ['tag' + (i % 4), 'tag' + (i % 9)],\n"
+    "            comments: i % 4 ? [] : [{ id: i, text: text, likes: i % 11 }],\n"
+    "        });\n"
+    "    }\n"
+    "    return { status: 'ok', count: count, records: records };\n"
+    "}\n";
+
+struct Corpus {
+    const char* name;
+    const char* text;
+    unsigned indent;
+};
+
+const Corpus corpora[] = {
+    { "minified", "'Lorem ipsum dolor sit amet'", 0 },
+    { "pretty printed", "'Lorem ipsum dolor sit amet'", 4 },
+    { "16-bit minified", "'Lorem ipsum \\u00e9\\u2603 dolor sit amet'", 0 },
+};
+
+String makeScript(const Corpus& corpus, unsigned recordCount, unsigned iterations)
+{
+    StringBuilder builder;
+    builder.append(corpusScript);
+    builder.appendLiteral("var json = JSON.stringify(makeRecords(");
+    builder.appendNumber(recordCount);
+    builder.appendLiteral(", ");
+    builder.append(corpus.text);
+    builder.appendLiteral("), null, ");
+    builder.appendNumber(corpus.indent);
+    builder.appendLiteral(");\n");
+    builder.appendLiteral("var checksum = 0;\n");
+    builder.appendLiteral("for (var i = 0; i < ");
+    builder.appendNumber(iterations);
+    builder.appendLiteral("; ++i) {\n");
+    builder.appendLiteral("    var result = JSON.parse(json);\n");
+    builder.appendLiteral("    var last = result.records[result.records.length - 1];\n");
+    builder.appendLiteral("    checksum = (checksum * 31 + result.count + last.id + last.author.id + last.title.length) | 0;\n");
+    builder.appendLiteral("}\n");
+    builder.appendLiteral("checksum;\n");
+    return builder.toString();
+}
+
+// Generating the corpus is part of the script, so it is timed separately from parsing it by
+// running the script once with no iterations.
+double evaluateScript(ExecState* exec, const String& script, int32_t& result)
+{
+    double before = monotonicallyIncreasingTimeMS();
+    NakedPtr<Exception> exception;
+    JSValue value = evaluate(exec, makeSource(script, SourceOrigin(), ASCIILiteral("jsonparsebench.js")), JSValue(), exception);
+    double after = monotonicallyIncreasingTimeMS();
+    CHECK(!exception);
+    CHECK(value.isInt32());
+    result = value.asInt32();
+    return after - before;
+}
+
+int32_t run(const Corpus& corpus, unsigned recordCount, unsigned iterations, bool useShapeCache)
+{
+    CHECK(Options::setOption(useShapeCache ? "useJSONObjectShapeCache=true" : "useJSONObjectShapeCache=false"));
+
+    VM* vm = &VM::create(LargeHeap).leakRef();
+    int32_t result;
+    {
+        JSLockHolder locker(vm);
+        JSGlobalObject* globalObject = JSGlobalObject::create(*vm, JSGlobalObject::createStructure(*vm, jsNull()));
+        ExecState* exec = globalObject->globalExec();
+
+        int32_t unused;
+        double setupTime = evaluateScript(exec, makeScript(corpus, recordCount, 0), unused);
+        double totalTime = evaluateScript(exec, makeScript(corpus, recordCount, iterations), result);
+        dataLog(corpus.name, useShapeCache ? " with shape cache: " : " without shape cache: ", (totalTime - setupTime) / iterations, " ms per parse.\n");
+
+        vm->deref();
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    unsigned recordCount = 2000;
+    unsigned iterations = 50;
+    if (argc >= 2) {
+        if (argc != 3 || sscanf(argv[1], "%u", &recordCount) != 1 || sscanf(argv[2], "%u", &iterations) != 1 || !iterations) {
+            dataLog("Usage: jsonparsebench [<record count> <iterations>]\n");
+            return 1;
+        }
+    }
+
+    Options::initialize();
+    WTF::initializeMainThread();
+    JSC::initializeThreading();
+
+    for (const Corpus& corpus : corpora) {
+        int32_t expected = run(corpus, recordCount, iterations, false);
+        CHECK(run(corpus, recordCount, iterations, true) == expected);
+    }
+
+    return 0;
+}
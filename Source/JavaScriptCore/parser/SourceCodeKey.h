@@ -63,7 +63,7 @@ public:
         return m_flags == rhs.m_flags;
     }
 
-    unsigned bits() { return m_flags; }
+    unsigned bits() const { return m_flags; }
 
 private:
     unsigned m_flags { 0 };
@@ -99,6 +99,9 @@ public:
 
     bool isNull() const { return m_sourceCode.isNull(); }
 
+    const String& name() const { return m_name; }
+    SourceCodeFlags flags() const { return m_flags; }
+
     // To save memory, we compute our string on demand. It's expected that source
     // providers cache their strings to make this efficient.
     StringView string() const { return m_sourceCode.view(); }
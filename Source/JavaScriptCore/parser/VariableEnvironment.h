@@ -57,6 +57,9 @@ public:
     ALWAYS_INLINE void clearIsVar() { m_bits &= ~IsVar; }
 
 private:
+    friend class BytecodeCacheDecoder;
+    friend class BytecodeCacheEncoder;
+
     enum Traits : uint16_t {
         IsCaptured = 1 << 0,
         IsConst = 1 << 1,
@@ -110,6 +113,9 @@ public:
     void markVariableAsExported(const RefPtr<UniquedStringImpl>& identifier);
 
 private:
+    friend class BytecodeCacheDecoder;
+    friend class BytecodeCacheEncoder;
+
     Map m_map;
     bool m_isEverythingCaptured { false };
 };
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include "Completion.h"
+#include "Exception.h"
+#include "InitializeThreading.h"
+#include "JSCInlines.h"
+#include "JSGlobalObject.h"
+#include "JSLock.h"
+#include "SourceCode.h"
+#include "VM.h"
+#include <wtf/CurrentTime.h>
+#include <wtf/MainThread.h>
+#include <wtf/text/StringBuilder.h>
+
+using namespace JSC;
+
+namespace {
+
+StaticLock crashLock;
+
+#define CHECK(x) do {                                                   \
+        if (!!(x))                                                      \
+            break;                                                      \
+        crashLock.lock();                                               \
+        WTFReportAssertionFailure(__FILE__, __LINE__, WTF_PRETTY_FUNCTION, #x); \
+        CRASH();                                                        \
+    } while (false)
+
+// Pages saved from real sites, given on the command line, make the most representative corpus.
+// Without them, the corpus is a page of markup shaped like a typical news or shopping listing:
+// mostly text and attributes, with the interesting tokens sparse.
+const char* corpusScript =
+    "var parts = [];\n"
+    "for (var i = 0; i < 500; ++i) {\n"
+    "    parts.push('<div class=\"card card-' + (i % 7) + '\" data-index=\"' + i + '\">'\n"
+    "        + '<a href=\"https://www.example.com/articles/' + i + '?utm_source=home&amp;ref=feed\" title=\"Article ' + i + '\">'\n"
+    "        + '<img src=\"/static/img/thumb-' + i + '.jpg\" alt=\"\" loading=\"lazy\"></a>'\n"
+    "        + '<span class=\"byline\">Posted 2017-05-' + (10 + i % 20) + ' by editor' + (i % 13) + '</span>'\n"
+    "        + '<p>Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore '\n"
+    "        + 'et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut '\n"
+    "        + (i % 25 ? '' : 'foo' + i + ' ') + 'aliquip ex ea commodo consequat.</p></div>\\n');\n"
+    "}\n"
+    "var page = parts.join('');\n";
+
+struct Benchmark {
+    const char* name;
+    const char* regExp;
+};
+
+// Each RegExp must be global and must not match the empty string.
+const Benchmark benchmarks[] = {
+    { "literal prefix", "/<div class=/g" },
+    { "literal then digits", "/foo\\d+/g" },
+    { "rare literal", "/utm_campaign=\\w+/g" },
+    { "case-insensitive tag", "/<SPAN\\b[^>]*>/gi" },
+    { "alternation", "/(?:src|href)=\"([^\"]*)\"/g" },
+    { "date", "/\\d{4}-\\d\\d-\\d\\d/g" },
+    { "word boundary", "/\\bconsequat\\b/g" },
+    { "character class", "/[&<>]/g" },
+};
+
+bool appendContentsOfFile(const char* fileName, Vector<char>& buffer)
+{
+    FILE* file = fopen(fileName, "rb");
+    if (!file)
+        return false;
+
+    size_t initialSize = buffer.size();
+    fseek(file, 0, SEEK_END);
+    size_t fileSize = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    buffer.resize(initialSize + fileSize);
+    size_t readSize = fread(buffer.data() + initialSize, 1, fileSize, file);
+    fclose(file);
+    return readSize == fileSize;
+}
+
+String makeScript(const Benchmark& benchmark, unsigned iterations, bool generateCorpus)
+{
+    StringBuilder builder;
+    if (generateCorpus)
+        builder.append(corpusScript);
+    builder.appendLiteral("var regExp = ");
+    builder.append(benchmark.regExp);
+    builder.appendLiteral(";\n");
+    builder.appendLiteral("var checksum = 0;\n");
+    builder.appendLiteral("for (var i = 0; i < ");
+    builder.appendNumber(iterations);
+    builder.appendLiteral("; ++i) {\n");
+    builder.appendLiteral("    regExp.lastIndex = 0;\n");
+    builder.appendLiteral("    var match;\n");
+    builder.appendLiteral("    while ((match = regExp.exec(page)))\n");
+    builder.appendLiteral("        checksum = (checksum * 31 + match.index + match[0].length) | 0;\n");
+    builder.appendLiteral("}\n");
+    builder.appendLiteral("checksum;\n");
+    return builder.toString();
+}
+
+// Runs in a fresh VM, since compiled RegExps are cached per VM and whether the VM may use
+// the RegExp JIT is decided when it is created.
+// A null corpus means the script generates its own.
+int32_t run(const Benchmark& benchmark, const String& script, const String& corpus, bool useJIT, bool useScan)
+{
+    CHECK(Options::setOption(useJIT ? "useRegExpJIT=true" : "useRegExpJIT=false"));
+    CHECK(Options::setOption(useScan ? "useRegExpLeadingCharacterScan=true" : "useRegExpLeadingCharacterScan=false"));
+
+    VM* vm = &VM::create(LargeHeap).leakRef();
+    int32_t result;
+    {
+        JSLockHolder locker(vm);
+        JSGlobalObject* globalObject = JSGlobalObject::create(*vm, JSGlobalObject::createStructure(*vm, jsNull()));
+        ExecState* exec = globalObject->globalExec();
+        if (!corpus.isNull())
+            globalObject->putDirect(*vm, Identifier::fromString(vm, "page"), jsString(vm, corpus));
+
+        double before = monotonicallyIncreasingTimeMS();
+        NakedPtr<Exception> exception;
+        JSValue value = evaluate(exec, makeSource(script, SourceOrigin(), ASCIILiteral("regexpscanbench.js")), JSValue(), exception);
+        double after = monotonicallyIncreasingTimeMS();
+
+        CHECK(!exception);
+        CHECK(value.isInt32());
+        result = value.asInt32();
+        dataLog(benchmark.name, " ", benchmark.regExp, useJIT ? " JIT" : " interpreter", useScan ? " with scan: " : " without scan: ", after - before, " ms.\n");
+
+        vm->deref();
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    unsigned iterations = 200;
+    if (argc >= 2) {
+        if (sscanf(argv[1], "%u", &iterations) != 1) {
+            dataLog("Usage: regexpscanbench [<iterations> [<saved page>...]]\n");
+            return 1;
+        }
+    }
+
+    Vector<char> pages;
+    for (int i = 2; i < argc; ++i) {
+        if (!appendContentsOfFile(argv[i], pages)) {
+            dataLog("Could not read ", argv[i], "\n");
+            return 1;
+        }
+    }
+    String corpus;
+    if (argc > 2)
+        corpus = String::fromUTF8WithLatin1Fallback(pages.data(), pages.size());
+
+    Options::initialize();
+    WTF::initializeMainThread();
+    JSC::initializeThreading();
+
+    for (const Benchmark& benchmark : benchmarks) {
+        String script = makeScript(benchmark, iterations, corpus.isNull());
+        int32_t expected = run(benchmark, script, corpus, true, false);
+        CHECK(run(benchmark, script, corpus, true, true) == expected);
+        CHECK(run(benchmark, script, corpus, false, false) == expected);
+        CHECK(run(benchmark, script, corpus, false, true) == expected);
+    }
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "BackgroundCodeGenerator.h"
+
+#include "BytecodeCache.h"
+#include "CodeCache.h"
+#include "JSCInlines.h"
+#include "JSGlobalObject.h"
+#include "JSLock.h"
+#include "ProgramExecutable.h"
+#include "SourceCode.h"
+#include "Strong.h"
+#include "StrongInlines.h"
+#include <wtf/DataLog.h>
+#include <wtf/WorkQueue.h>
+
+namespace JSC {
+
+PrecompiledProgram::~PrecompiledProgram()
+{
+}
+
+size_t PrecompiledProgram::encodedSize() const
+{
+    return m_bytecode ? m_bytecode->size() : 0;
+}
+
+class BackgroundCodeGenerator::GeneratorThread {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    GeneratorThread()
+        : queue(WorkQueue::create("jsc.backgroundcodegenerator.queue", WorkQueue::Type::Serial, WorkQueue::QOS::UserInitiated))
+    {
+    }
+
+    Ref<WorkQueue> queue;
+
+    // Guarded by BackgroundCodeGenerator::m_lock.
+    unsigned pendingJobCount { 0 };
+
+    // Only used on the queue.
+    VM* vm { nullptr };
+    Strong<JSGlobalObject> globalObject;
+    unsigned completedJobCount { 0 };
+};
+
+BackgroundCodeGenerator& BackgroundCodeGenerator::singleton()
+{
+    static NeverDestroyed<BackgroundCodeGenerator> generator;
+    return generator;
+}
+
+BackgroundCodeGenerator::BackgroundCodeGenerator()
+{
+    unsigned threadCount = std::max(1u, Options::numberOfBackgroundCodeGenerationThreads());
+    for (unsigned i = 0; i < threadCount; ++i)
+        m_threads.append(std::make_unique<GeneratorThread>());
+}
+
+BackgroundCodeGenerator::~BackgroundCodeGenerator()
+{
+}
+
+bool BackgroundCodeGenerator::shouldGenerate(unsigned sourceLength)
+{
+    return Options::useBackgroundCodeGeneration()
+        && Options::useCodeCache()
+        && sourceLength >= Options::minimumBackgroundCodeGenerationSourceLength();
+}
+
+void BackgroundCodeGenerator::generate(String&& source, const String& url, const TextPosition& startPosition, Priority priority, CompletionHandler&& completionHandler)
+{
+    // Callers hand over a string of their own, which can move to the generator thread as is.
+    Job job { WTFMove(source).isolatedCopy(), url.isolatedCopy(), startPosition, MonotonicTime::now(), WTFMove(completionHandler) };
+
+    GeneratorThread* leastBusyThread;
+    {
+        LockHolder locker(m_lock);
+        if (priority == Priority::High)
+            m_highPriorityJobs.append(WTFMove(job));
+        else
+            m_jobs.append(WTFMove(job));
+
+        leastBusyThread = m_threads[0].get();
+        for (auto& thread : m_threads) {
+            if (thread->pendingJobCount < leastBusyThread->pendingJobCount)
+                leastBusyThread = thread.get();
+        }
+        leastBusyThread->pendingJobCount++;
+    }
+
+    // Each dispatch runs whichever job comes next when it starts, not necessarily the one
+    // queued here, so that high priority jobs overtake the ones still waiting.
+    leastBusyThread->queue->dispatch([this, leastBusyThread] {
+        runNextJob(*leastBusyThread);
+    });
+}
+
+void BackgroundCodeGenerator::runNextJob(GeneratorThread& thread)
+{
+    Job job;
+    {
+        LockHolder locker(m_lock);
+        thread.pendingJobCount--;
+        job = m_highPriorityJobs.isEmpty() ? m_jobs.takeFirst() : m_highPriorityJobs.takeFirst();
+    }
+
+    Ref<PrecompiledProgram> program = adoptRef(*new PrecompiledProgram);
+    program->m_queueTime = MonotonicTime::now() - job.queueStartTime;
+    generateOnGeneratorThread(thread, job, program.get());
+    job.source = String();
+    job.completionHandler(WTFMove(program));
+
+    scheduleVMDestruction(thread);
+}
+
+void BackgroundCodeGenerator::scheduleVMDestruction(GeneratorThread& thread)
+{
+    unsigned completedJobCount = ++thread.completedJobCount;
+    thread.queue->dispatchAfter(Seconds(Options::backgroundCodeGenerationIdleTime()), [this, &thread, completedJobCount] {
+        if (thread.completedJobCount == completedJobCount)
+            destroyVM(thread);
+    });
+}
+
+void BackgroundCodeGenerator::destroyVM(GeneratorThread& thread)
+{
+    if (!thread.vm)
+        return;
+
+    VM* vm = std::exchange(thread.vm, nullptr);
+    {
+        JSLockHolder locker(vm);
+        thread.globalObject.clear();
+        vm->deref();
+    }
+    m_liveVMCount--;
+    dataLogLnIf(Options::verboseBackgroundCodeGeneration(), "Background code generation: destroyed an idle VM");
+}
+
+void BackgroundCodeGenerator::generateOnGeneratorThread(GeneratorThread& thread, const Job& job, PrecompiledProgram& program)
+{
+    if (!thread.vm) {
+        thread.vm = &VM::create(SmallHeap).leakRef();
+        JSLockHolder locker(thread.vm);
+        thread.globalObject.set(*thread.vm, JSGlobalObject::create(*thread.vm, JSGlobalObject::createStructure(*thread.vm, jsNull())));
+        m_liveVMCount++;
+    }
+
+    VM& vm = *thread.vm;
+    JSLockHolder locker(vm);
+
+    MonotonicTime generationStartTime = MonotonicTime::now();
+    SourceCode sourceCode = makeSource(job.source, SourceOrigin(), job.url, job.startPosition);
+    ProgramExecutable* executable = ProgramExecutable::create(thread.globalObject->globalExec(), sourceCode);
+
+    // Bypass this VM's CodeCache: the program is only run by the VM the result is installed in.
+    ParserError error;
+    VariableEnvironment variablesUnderTDZ;
+    UnlinkedProgramCodeBlock* codeBlock = generateUnlinkedCodeBlock<UnlinkedProgramCodeBlock>(
+        vm, executable, sourceCode, JSParserStrictMode::NotStrict, JSParserScriptMode::Classic, DebuggerOff, error, EvalContextType::None, &variablesUnderTDZ);
+    program.m_generationTime = MonotonicTime::now() - generationStartTime;
+    if (!codeBlock) {
+        dataLogLnIf(Options::verboseBackgroundCodeGeneration(), "Background code generation: could not compile ", job.url);
+        return;
+    }
+
+    MonotonicTime encodingStartTime = MonotonicTime::now();
+    SourceCodeKey key(
+        sourceCode, String(), SourceCodeType::ProgramType, JSParserStrictMode::NotStrict, JSParserScriptMode::Classic,
+        DerivedContextType::None, EvalContextType::None, false, DebuggerOff, TypeProfilerEnabled::No, ControlFlowProfilerEnabled::No);
+    program.m_bytecode = BytecodeCache::encodeProgram(vm, key, *codeBlock);
+    program.m_encodingTime = MonotonicTime::now() - encodingStartTime;
+
+    dataLogLnIf(Options::verboseBackgroundCodeGeneration(), "Background code generation: ", job.url, " (", job.source.length(), " characters) waited ", program.m_queueTime.milliseconds(), " ms, generated in ", program.m_generationTime.milliseconds(), " ms, encoded in ", program.m_encodingTime.milliseconds(), " ms (", program.encodedSize(), " bytes)");
+}
+
+bool BackgroundCodeGenerator::install(VM& vm, const SourceCode& source, PrecompiledProgram& program)
+{
+    ASSERT(vm.currentThreadIsHoldingAPILock());
+    if (!program.m_bytecode)
+        return false;
+
+    MonotonicTime installStartTime = MonotonicTime::now();
+    bool didInstall = vm.codeCache()->addPrecompiledProgram(vm, source, *program.m_bytecode);
+    dataLogLnIf(Options::verboseBackgroundCodeGeneration(), "Background code generation: ", didInstall ? "installed " : "could not install ", source.provider()->url(), " in ", (MonotonicTime::now() - installStartTime).milliseconds(), " ms");
+
+    // The decoded code blocks reference the bytecode for their functions, so the program does
+    // not need to keep it alive any longer.
+    program.m_bytecode = nullptr;
+    return didInstall;
+}
+
+} // namespace JSC
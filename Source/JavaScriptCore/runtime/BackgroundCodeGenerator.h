@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <wtf/Deque.h>
+#include <wtf/Function.h>
+#include <wtf/Lock.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Seconds.h>
+#include <wtf/ThreadSafeRefCounted.h>
+#include <wtf/Vector.h>
+#include <wtf/text/TextPosition.h>
+#include <wtf/text/WTFString.h>
+
+namespace JSC {
+
+class CachedBytecode;
+class SourceCode;
+class VM;
+
+// The result of generating the bytecode of a program off the main thread. It is produced by
+// BackgroundCodeGenerator and installed in the CodeCache of the VM that will run the program.
+class PrecompiledProgram : public ThreadSafeRefCounted<PrecompiledProgram> {
+public:
+    JS_EXPORT_PRIVATE ~PrecompiledProgram();
+
+    bool didSucceed() const { return !!m_bytecode; }
+    size_t encodedSize() const;
+
+    // Per-script timing, for instrumentation.
+    Seconds queueTime() const { return m_queueTime; }
+    Seconds generationTime() const { return m_generationTime; }
+    Seconds encodingTime() const { return m_encodingTime; }
+
+private:
+    friend class BackgroundCodeGenerator;
+
+    PrecompiledProgram() = default;
+
+    RefPtr<CachedBytecode> m_bytecode;
+    Seconds m_queueTime;
+    Seconds m_generationTime;
+    Seconds m_encodingTime;
+};
+
+// Parses top-level programs and generates their unlinked bytecode on background threads, so
+// that by the time an embedder runs such a program, for instance an async or deferred <script>,
+// only decoding and linking are left on the main thread. bytecodecachebench compares the main
+// thread time of both.
+//
+// JSCells cannot be handed from one VM to another, so each generator thread works in a VM of
+// its own and the result is transferred in the bytecode cache format. That VM is destroyed once
+// the thread has been idle for Options::backgroundCodeGenerationIdleTime() seconds.
+class BackgroundCodeGenerator {
+    WTF_MAKE_NONCOPYABLE(BackgroundCodeGenerator);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    JS_EXPORT_PRIVATE static BackgroundCodeGenerator& singleton();
+
+    // Whether a program of the given length is worth generating in the background.
+    JS_EXPORT_PRIVATE static bool shouldGenerate(unsigned sourceLength);
+
+    // High priority programs are generated before any normal priority ones that have not
+    // started yet. Embedders use it for programs that something else is waiting for, such as
+    // deferred scripts, which hold back DOMContentLoaded.
+    enum class Priority { Normal, High };
+
+    // The completion handler is called on a generator thread, including when the program
+    // could not be compiled, in which case the main thread will report the error as usual.
+    using CompletionHandler = Function<void (Ref<PrecompiledProgram>&&)>;
+    JS_EXPORT_PRIVATE void generate(String&& source, const String& url, const TextPosition& startPosition, Priority, CompletionHandler&&);
+
+    // Adds the program to the VM's CodeCache. The caller must hold the API lock. Returns false
+    // if the result cannot be used for this source in this VM.
+    JS_EXPORT_PRIVATE static bool install(VM&, const SourceCode&, PrecompiledProgram&);
+
+    // The number of generator threads that currently have a VM, for testing.
+    unsigned liveVMCount() const { return m_liveVMCount; }
+
+private:
+    friend class NeverDestroyed<BackgroundCodeGenerator>;
+    BackgroundCodeGenerator();
+    ~BackgroundCodeGenerator();
+
+    class GeneratorThread;
+    struct Job {
+        String source;
+        String url;
+        TextPosition startPosition;
+        MonotonicTime queueStartTime;
+        CompletionHandler completionHandler;
+    };
+
+    void runNextJob(GeneratorThread&);
+    void generateOnGeneratorThread(GeneratorThread&, const Job&, PrecompiledProgram&);
+    void scheduleVMDestruction(GeneratorThread&);
+    void destroyVM(GeneratorThread&);
+
+    Vector<std::unique_ptr<GeneratorThread>> m_threads;
+    std::atomic<unsigned> m_liveVMCount { 0 };
+
+    Lock m_lock;
+    Deque<Job> m_highPriorityJobs;
+    Deque<Job> m_jobs;
+};
+
+} // namespace JSC
@@ -0,0 +1,1481 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "BytecodeCache.h"
+
+#include "BuiltinNames.h"
+#include "DeferGC.h"
+#include "JSCInlines.h"
+#include "JSTemplateRegistryKey.h"
+#include "Opcode.h"
+#include "RegExp.h"
+#include "ScopedArgumentsTable.h"
+#include "SymbolTable.h"
+#include "TemplateRegistryKeyTable.h"
+#include "UnlinkedFunctionCodeBlock.h"
+#include "UnlinkedFunctionExecutable.h"
+#include "UnlinkedInstructionStream.h"
+#include "UnlinkedProgramCodeBlock.h"
+#include <atomic>
+#include <wtf/DataLog.h>
+#include <wtf/SHA1.h>
+#include <wtf/text/CString.h>
+
+#if OS(UNIX)
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+namespace JSC {
+
+static const uint32_t bytecodeCacheMagic = 0x4243534a; // "JSCB"
+
+// Bump this whenever the encoding below, or the meaning of bytecode operands, changes.
+static const uint32_t bytecodeCacheFormatVersion = 3;
+
+// Every entry starts with the magic number, the format version and a SHA-1 digest of the rest of
+// the entry. The digest is only filled in for entries written to disk, and is checked when they
+// are loaded, so that truncated or corrupt files are rejected before anything is decoded.
+static const size_t bytecodeCacheDigestOffset = 2 * sizeof(uint32_t);
+static const size_t bytecodeCacheDigestEnd = bytecodeCacheDigestOffset + SHA1::hashSize;
+
+enum class IdentifierTag : uint8_t { Null, String, PrivateName, WellKnownSymbol };
+enum class ConstantTag : uint8_t { Value, String, SymbolTable, TemplateRegistryKey };
+enum class ConstantBufferValueTag : uint8_t { Value, ConstantRegister };
+
+static uint32_t buildStamp()
+{
+    // Cache files are only valid for the build that wrote them. The opcode table is the part of
+    // the build most likely to change the bytecode format, so it is folded into the stamp.
+    static const uint32_t stamp = [] {
+        SHA1 sha1;
+        auto addUnsigned = [&] (uint32_t value) {
+            sha1.addBytes(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+        };
+        addUnsigned(bytecodeCacheFormatVersion);
+        addUnsigned(sizeof(void*));
+        addUnsigned(numOpcodeIDs);
+        for (int i = 0; i < numOpcodeIDs; ++i) {
+            OpcodeID opcodeID = static_cast<OpcodeID>(i);
+            sha1.addBytes(CString(opcodeNames[opcodeID]));
+            addUnsigned(opcodeLength(opcodeID));
+        }
+        SHA1::Digest digest;
+        sha1.computeHash(digest);
+        uint32_t result;
+        memcpy(&result, digest.data(), sizeof(result));
+        return result;
+    }();
+    return stamp;
+}
+
+static const Identifier CommonIdentifiers::* const wellKnownSymbolMembers[] = {
+#define BYTECODE_CACHE_WELL_KNOWN_SYMBOL(name) &CommonIdentifiers::name##Symbol,
+    JSC_COMMON_PRIVATE_IDENTIFIERS_EACH_WELL_KNOWN_SYMBOL(BYTECODE_CACHE_WELL_KNOWN_SYMBOL)
+#undef BYTECODE_CACHE_WELL_KNOWN_SYMBOL
+};
+
+static std::optional<uint8_t> wellKnownSymbolIndex(VM& vm, UniquedStringImpl* uid)
+{
+    for (unsigned i = 0; i < WTF_ARRAY_LENGTH(wellKnownSymbolMembers); ++i) {
+        if ((vm.propertyNames->*wellKnownSymbolMembers[i]).impl() == uid)
+            return static_cast<uint8_t>(i);
+    }
+    return std::nullopt;
+}
+
+static const Identifier* wellKnownSymbolAt(VM& vm, unsigned index)
+{
+    if (index >= WTF_ARRAY_LENGTH(wellKnownSymbolMembers))
+        return nullptr;
+    return &(vm.propertyNames->*wellKnownSymbolMembers[index]);
+}
+
+class BytecodeCacheEncoder {
+public:
+    BytecodeCacheEncoder(VM& vm)
+        : m_vm(vm)
+    {
+    }
+
+    bool encodeProgram(const SourceCodeKey& key, UnlinkedProgramCodeBlock& codeBlock)
+    {
+        encode32(bytecodeCacheMagic);
+        encode32(bytecodeCacheFormatVersion);
+        ASSERT(m_data.size() == bytecodeCacheDigestOffset);
+        m_data.grow(bytecodeCacheDigestEnd);
+        memset(m_data.data() + bytecodeCacheDigestOffset, 0, SHA1::hashSize);
+        encode32(buildStamp());
+        encode32(key.flags().bits());
+        encode32(key.length());
+        size_t functionCodeBlockCountOffset = m_data.size();
+        encode32(0);
+
+        encodeCodeBlock(codeBlock);
+        encode(codeBlock.variableDeclarations());
+        encode(codeBlock.lexicalDeclarations());
+
+        memcpy(m_data.data() + functionCodeBlockCountOffset, &m_functionCodeBlockCount, sizeof(uint32_t));
+        return !m_failed;
+    }
+
+    unsigned functionCodeBlockCount() const { return m_functionCodeBlockCount; }
+    Vector<uint8_t> takeData() { return WTFMove(m_data); }
+
+private:
+    void fail() { m_failed = true; }
+
+    void encodeBytes(const void* bytes, size_t length)
+    {
+        m_data.append(static_cast<const uint8_t*>(bytes), length);
+    }
+
+    void encode8(uint8_t value) { m_data.append(value); }
+    void encode32(uint32_t value) { encodeBytes(&value, sizeof(value)); }
+    void encode64(uint64_t value) { encodeBytes(&value, sizeof(value)); }
+
+    template<typename T>
+    void encodeVector(const Vector<T>& vector)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable vectors are encoded as raw bytes");
+        encode32(vector.size());
+        encodeBytes(vector.data(), vector.size() * sizeof(T));
+    }
+
+    void encode(const String& string)
+    {
+        if (string.isNull()) {
+            encode32(UINT_MAX);
+            return;
+        }
+        encode32(string.length());
+        encode8(string.is8Bit());
+        if (string.is8Bit())
+            encodeBytes(string.characters8(), string.length() * sizeof(LChar));
+        else
+            encodeBytes(string.characters16(), string.length() * sizeof(UChar));
+    }
+
+    void encodeUid(UniquedStringImpl* uid)
+    {
+        if (!uid) {
+            encode8(static_cast<uint8_t>(IdentifierTag::Null));
+            return;
+        }
+
+        if (!uid->isSymbol()) {
+            encode8(static_cast<uint8_t>(IdentifierTag::String));
+            encode(String(uid));
+            return;
+        }
+
+        if (m_vm.propertyNames->isPrivateName(*uid)) {
+            encode8(static_cast<uint8_t>(IdentifierTag::PrivateName));
+            encode(m_vm.propertyNames->lookUpPublicName(Identifier::fromUid(&m_vm, uid)).string());
+            return;
+        }
+
+        if (auto index = wellKnownSymbolIndex(m_vm, uid)) {
+            encode8(static_cast<uint8_t>(IdentifierTag::WellKnownSymbol));
+            encode8(*index);
+            return;
+        }
+
+        // Other symbols are unique to the VM that created them.
+        fail();
+    }
+
+    void encode(const Identifier& identifier) { encodeUid(identifier.impl()); }
+
+    void encode(const VariableEnvironment& environment)
+    {
+        encode32(environment.size());
+        for (auto& entry : environment) {
+            encodeUid(entry.key.get());
+            encodeBytes(&entry.value.m_bits, sizeof(entry.value.m_bits));
+        }
+        encode8(environment.m_isEverythingCaptured);
+    }
+
+    void encode(const BitVector& bitVector)
+    {
+        encode32(bitVector.size());
+        uint8_t byte = 0;
+        for (size_t i = 0; i < bitVector.size(); ++i) {
+            if (bitVector.quickGet(i))
+                byte |= 1 << (i % 8);
+            if (i % 8 == 7) {
+                encode8(byte);
+                byte = 0;
+            }
+        }
+        if (bitVector.size() % 8)
+            encode8(byte);
+    }
+
+    void encode(SymbolTable& symbolTable)
+    {
+        if (symbolTable.m_rareData) {
+            // Only type profiling creates rare data, and it is never cached.
+            fail();
+            return;
+        }
+
+        ConcurrentJSLocker locker(symbolTable.m_lock);
+        encode32(symbolTable.m_map.size());
+        for (auto& entry : symbolTable.m_map) {
+            encodeUid(entry.key.get());
+            VarOffset offset = entry.value.varOffset();
+            encode8(static_cast<uint8_t>(offset.kind()));
+            encode32(offset.rawOffset());
+            encode8(entry.value.getAttributes());
+            encode8(entry.value.isWatchable());
+        }
+        encode32(symbolTable.m_maxScopeOffset.offsetUnchecked());
+        encode8(symbolTable.m_usesNonStrictEval);
+        encode8(symbolTable.m_nestedLexicalScope);
+        encode8(symbolTable.m_scopeType);
+
+        encode8(!!symbolTable.m_arguments);
+        if (symbolTable.m_arguments) {
+            uint32_t length = symbolTable.m_arguments->length();
+            encode32(length);
+            for (uint32_t i = 0; i < length; ++i)
+                encode32(symbolTable.m_arguments->get(i).offsetUnchecked());
+        }
+    }
+
+    void encode(const TemplateRegistryKey& key)
+    {
+        encode32(key.rawStrings().size());
+        for (auto& string : key.rawStrings())
+            encode(string);
+        encode32(key.cookedStrings().size());
+        for (auto& string : key.cookedStrings()) {
+            encode8(!!string);
+            if (string)
+                encode(*string);
+        }
+    }
+
+    void encodeConstant(JSValue value)
+    {
+        if (!value.isCell()) {
+            encode8(static_cast<uint8_t>(ConstantTag::Value));
+            encode64(JSValue::encode(value));
+            return;
+        }
+
+        JSCell* cell = value.asCell();
+        if (cell->isString()) {
+            const String& string = asString(value)->tryGetValue();
+            if (string.isNull()) {
+                fail();
+                return;
+            }
+            encode8(static_cast<uint8_t>(ConstantTag::String));
+            encode(string);
+            return;
+        }
+
+        if (SymbolTable* symbolTable = jsDynamicCast<SymbolTable*>(m_vm, cell)) {
+            encode8(static_cast<uint8_t>(ConstantTag::SymbolTable));
+            encode(*symbolTable);
+            return;
+        }
+
+        if (JSTemplateRegistryKey* templateRegistryKey = jsDynamicCast<JSTemplateRegistryKey*>(m_vm, cell)) {
+            encode8(static_cast<uint8_t>(ConstantTag::TemplateRegistryKey));
+            encode(templateRegistryKey->templateRegistryKey());
+            return;
+        }
+
+        fail();
+    }
+
+    void encodeConstantBufferValue(UnlinkedCodeBlock& codeBlock, JSValue value)
+    {
+        if (!value.isCell()) {
+            encode8(static_cast<uint8_t>(ConstantBufferValueTag::Value));
+            encode64(JSValue::encode(value));
+            return;
+        }
+
+        // Cells in constant buffers are strings that the generator also added to the constant pool.
+        for (unsigned i = 0; i < codeBlock.m_constantRegisters.size(); ++i) {
+            if (codeBlock.m_constantRegisters[i].get() == value) {
+                encode8(static_cast<uint8_t>(ConstantBufferValueTag::ConstantRegister));
+                encode32(i);
+                return;
+            }
+        }
+        fail();
+    }
+
+    void encodeRareData(UnlinkedCodeBlock& codeBlock)
+    {
+        UnlinkedCodeBlock::RareData* rareData = codeBlock.m_rareData.get();
+        encode8(!!rareData);
+        if (!rareData)
+            return;
+
+        if (!rareData->m_typeProfilerInfoMap.isEmpty() || !rareData->m_opProfileControlFlowBytecodeOffsets.isEmpty()) {
+            fail();
+            return;
+        }
+
+        encode32(rareData->m_exceptionHandlers.size());
+        for (auto& handler : rareData->m_exceptionHandlers) {
+            encode32(handler.start);
+            encode32(handler.end);
+            encode32(handler.target);
+            encode8(handler.typeBits);
+        }
+
+        encode32(rareData->m_regexps.size());
+        for (auto& regExp : rareData->m_regexps) {
+            encode(regExp->pattern());
+            unsigned flags = NoFlags;
+            if (regExp->global())
+                flags |= FlagGlobal;
+            if (regExp->ignoreCase())
+                flags |= FlagIgnoreCase;
+            if (regExp->multiline())
+                flags |= FlagMultiline;
+            if (regExp->sticky())
+                flags |= FlagSticky;
+            if (regExp->unicode())
+                flags |= FlagUnicode;
+            encode8(flags);
+        }
+
+        encode32(rareData->m_constantBuffers.size());
+        for (auto& constantBuffer : rareData->m_constantBuffers) {
+            encode32(constantBuffer.size());
+            for (JSValue value : constantBuffer)
+                encodeConstantBufferValue(codeBlock, value);
+        }
+
+        encode32(rareData->m_switchJumpTables.size());
+        for (auto& jumpTable : rareData->m_switchJumpTables) {
+            encodeVector(jumpTable.branchOffsets);
+            encode32(jumpTable.min);
+        }
+
+        encode32(rareData->m_stringSwitchJumpTables.size());
+        for (auto& jumpTable : rareData->m_stringSwitchJumpTables) {
+            encode32(jumpTable.offsetTable.size());
+            for (auto& entry : jumpTable.offsetTable) {
+                encode(String(entry.key.get()));
+                encode32(entry.value.branchOffset);
+            }
+        }
+
+        encodeVector(rareData->m_expressionInfoFatPositions);
+    }
+
+    void encodeCodeBlock(UnlinkedCodeBlock& codeBlock)
+    {
+        if (codeBlock.m_isBuiltinFunction || codeBlock.m_wasCompiledWithDebuggingOpcodes || !codeBlock.m_unlinkedInstructions) {
+            fail();
+            return;
+        }
+
+        encode8(codeBlock.m_usesEval);
+        encode8(codeBlock.m_isStrictMode);
+        encode8(codeBlock.m_isConstructor);
+        encode8(codeBlock.m_constructorKind);
+        encode8(codeBlock.m_scriptMode);
+        encode8(codeBlock.m_superBinding);
+        encode32(static_cast<uint32_t>(codeBlock.m_parseMode));
+        encode8(codeBlock.m_derivedContextType);
+        encode8(codeBlock.m_isArrowFunctionContext);
+        encode8(codeBlock.m_isClassContext);
+        encode8(codeBlock.m_evalContextType);
+
+        encode32(codeBlock.m_features);
+        encode8(codeBlock.m_hasCapturedVariables);
+        encode32(codeBlock.m_lineCount);
+        encode32(codeBlock.m_endColumn);
+        encode8(static_cast<uint8_t>(codeBlock.m_didOptimize));
+
+        encode32(codeBlock.m_numVars);
+        encode32(codeBlock.m_numCapturedVars);
+        encode32(codeBlock.m_numCalleeLocals);
+        encode32(codeBlock.m_numParameters);
+        encode32(codeBlock.m_thisRegister.offset());
+        encode32(codeBlock.m_scopeRegister.offset());
+        encode32(codeBlock.m_globalObjectRegister.offset());
+
+        encode(codeBlock.m_sourceURLDirective);
+        encode(codeBlock.m_sourceMappingURLDirective);
+
+        const UnlinkedInstructionStream& instructions = *codeBlock.m_unlinkedInstructions;
+        encode32(instructions.m_instructionCount);
+        encode32(instructions.m_data.size());
+        encodeBytes(instructions.m_data.data(), instructions.m_data.size());
+
+        encodeVector(codeBlock.m_jumpTargets);
+        encodeVector(codeBlock.m_propertyAccessInstructions);
+
+        encode32(codeBlock.m_identifiers.size());
+        for (auto& identifier : codeBlock.m_identifiers)
+            encode(identifier);
+
+        encode32(codeBlock.m_bitVectors.size());
+        for (auto& bitVector : codeBlock.m_bitVectors)
+            encode(bitVector);
+
+        encode32(codeBlock.m_constantRegisters.size());
+        for (unsigned i = 0; i < codeBlock.m_constantRegisters.size(); ++i) {
+            encode8(static_cast<uint8_t>(codeBlock.m_constantsSourceCodeRepresentation[i]));
+            encodeConstant(codeBlock.m_constantRegisters[i].get());
+        }
+        for (unsigned index : codeBlock.m_linkTimeConstants)
+            encode32(index);
+
+        encode32(codeBlock.m_arrayProfileCount);
+        encode32(codeBlock.m_arrayAllocationProfileCount);
+        encode32(codeBlock.m_objectAllocationProfileCount);
+        encode32(codeBlock.m_valueProfileCount);
+        encode32(codeBlock.m_llintCallLinkInfoCount);
+
+        encodeRareData(codeBlock);
+        encodeVector(codeBlock.m_expressionInfo);
+
+        encode32(codeBlock.m_functionDecls.size());
+        for (auto& executable : codeBlock.m_functionDecls)
+            encode(*executable.get());
+        encode32(codeBlock.m_functionExprs.size());
+        for (auto& executable : codeBlock.m_functionExprs)
+            encode(*executable.get());
+    }
+
+    // A function code block is encoded as a segment that the decoder can skip, so that it is
+    // only decoded if the function is called. Segments are position independent, which lets
+    // the segments of functions that were not called in this VM be copied from the file they
+    // were loaded from.
+    void encodeFunctionCodeBlockSegment(UnlinkedFunctionExecutable& executable, UnlinkedFunctionCodeBlock* codeBlock, unsigned cachedOffset)
+    {
+        if (codeBlock) {
+            encode8(true);
+            size_t segmentOffset = m_data.size();
+            encode32(0);
+            encode32(0);
+            unsigned functionCodeBlockCountBefore = m_functionCodeBlockCount;
+            encodeCodeBlock(*codeBlock);
+            uint32_t length = m_data.size() - segmentOffset - 2 * sizeof(uint32_t);
+            uint32_t count = ++m_functionCodeBlockCount - functionCodeBlockCountBefore;
+            memcpy(m_data.data() + segmentOffset, &length, sizeof(length));
+            memcpy(m_data.data() + segmentOffset + sizeof(length), &count, sizeof(count));
+            return;
+        }
+
+        if (cachedOffset && executable.m_cachedBytecode) {
+            CachedBytecode& cachedBytecode = *executable.m_cachedBytecode;
+            uint32_t length;
+            uint32_t count;
+            memcpy(&length, cachedBytecode.data() + cachedOffset, sizeof(length));
+            memcpy(&count, cachedBytecode.data() + cachedOffset + sizeof(length), sizeof(count));
+            encode8(true);
+            encodeBytes(cachedBytecode.data() + cachedOffset, 2 * sizeof(uint32_t) + length);
+            m_functionCodeBlockCount += count;
+            return;
+        }
+
+        encode8(false);
+    }
+
+    void encode(UnlinkedFunctionExecutable& executable)
+    {
+        if (executable.m_isBuiltinFunction || !executable.m_parentSourceOverride.isNull()) {
+            fail();
+            return;
+        }
+
+        encode32(executable.m_firstLineOffset);
+        encode32(executable.m_lineCount);
+        encode32(executable.m_unlinkedFunctionNameStart);
+        encode32(executable.m_unlinkedBodyStartColumn);
+        encode32(executable.m_unlinkedBodyEndColumn);
+        encode32(executable.m_startOffset);
+        encode32(executable.m_sourceLength);
+        encode32(executable.m_parametersStartOffset);
+        encode32(executable.m_typeProfilingStartOffset);
+        encode32(executable.m_typeProfilingEndOffset);
+        encode32(executable.m_parameterCount);
+        encode32(executable.m_features);
+        encode32(static_cast<uint32_t>(executable.m_sourceParseMode));
+        encode8(executable.m_isInStrictContext);
+        encode8(executable.m_hasCapturedVariables);
+        encode8(executable.m_constructAbility);
+        encode8(executable.m_constructorKind);
+        encode8(executable.m_functionMode);
+        encode8(executable.m_scriptMode);
+        encode8(executable.m_superBinding);
+        encode8(executable.m_derivedContextType);
+
+        encode(executable.m_name);
+        encode(executable.m_ecmaName);
+        encode(executable.m_inferredName);
+
+        const SourceCode& classSource = executable.m_classSource;
+        encode8(!classSource.isNull());
+        if (!classSource.isNull()) {
+            encode32(classSource.startOffset());
+            encode32(classSource.endOffset());
+            encode32(classSource.firstLine().oneBasedInt());
+            encode32(classSource.startColumn().oneBasedInt());
+        }
+
+        encode(executable.m_sourceURLDirective);
+        encode(executable.m_sourceMappingURLDirective);
+        encode(executable.m_parentScopeTDZVariables);
+
+        encodeFunctionCodeBlockSegment(executable, executable.m_unlinkedCodeBlockForCall.get(), executable.m_cachedCodeBlockForCallOffset);
+        encodeFunctionCodeBlockSegment(executable, executable.m_unlinkedCodeBlockForConstruct.get(), executable.m_cachedCodeBlockForConstructOffset);
+    }
+
+    VM& m_vm;
+    Vector<uint8_t> m_data;
+    unsigned m_functionCodeBlockCount { 0 };
+    bool m_failed { false };
+};
+
+class BytecodeCacheDecoder {
+public:
+    BytecodeCacheDecoder(VM& vm, CachedBytecode& cachedBytecode, SourceProvider* provider, size_t offset, size_t end)
+        : m_vm(vm)
+        , m_cachedBytecode(cachedBytecode)
+        , m_provider(provider)
+        , m_position(offset)
+        , m_end(end)
+    {
+        ASSERT(offset <= end && end <= cachedBytecode.size());
+    }
+
+    UnlinkedProgramCodeBlock* decodeProgram(const SourceCodeKey& key, unsigned& functionCodeBlockCount)
+    {
+        if (decode32() != bytecodeCacheMagic
+            || decode32() != bytecodeCacheFormatVersion
+            || !decodeBytes(SHA1::hashSize)
+            || decode32() != buildStamp()
+            || decode32() != key.flags().bits()
+            || decode32() != key.length())
+            return nullptr;
+        functionCodeBlockCount = decode32();
+
+        UnlinkedProgramCodeBlock* codeBlock = decodeCodeBlock<UnlinkedProgramCodeBlock>([&] (const ExecutableInfo& info) {
+            return UnlinkedProgramCodeBlock::create(&m_vm, info, DebuggerOff);
+        });
+        if (!codeBlock)
+            return nullptr;
+
+        VariableEnvironment variableDeclarations;
+        decode(variableDeclarations);
+        VariableEnvironment lexicalDeclarations;
+        decode(lexicalDeclarations);
+        if (m_failed || m_position != m_end)
+            return nullptr;
+
+        codeBlock->setVariableDeclarations(variableDeclarations);
+        codeBlock->setLexicalDeclarations(lexicalDeclarations);
+        return codeBlock;
+    }
+
+    static UnlinkedFunctionCodeBlock* decodeFunctionCodeBlock(VM& vm, UnlinkedFunctionExecutable& executable, SourceProvider* provider, CodeSpecializationKind kind, SourceParseMode parseMode)
+    {
+        unsigned& offset = kind == CodeForCall ? executable.m_cachedCodeBlockForCallOffset : executable.m_cachedCodeBlockForConstructOffset;
+        if (!offset || !executable.m_cachedBytecode)
+            return nullptr;
+
+        Ref<CachedBytecode> cachedBytecode = *executable.m_cachedBytecode;
+        unsigned segmentOffset = std::exchange(offset, 0);
+        if (!executable.m_cachedCodeBlockForCallOffset && !executable.m_cachedCodeBlockForConstructOffset)
+            executable.m_cachedBytecode = nullptr;
+
+        BytecodeCacheDecoder decoder(vm, cachedBytecode.get(), provider, segmentOffset, cachedBytecode->size());
+        return decoder.decodeFunctionCodeBlockSegment(kind, parseMode);
+    }
+
+private:
+    UnlinkedFunctionCodeBlock* decodeFunctionCodeBlockSegment(CodeSpecializationKind kind, SourceParseMode parseMode)
+    {
+        uint32_t length = decode32();
+        decode32();
+        if (!canRead(length))
+            return nullptr;
+        m_end = m_position + length;
+
+        UnlinkedFunctionCodeBlock* codeBlock = decodeCodeBlock<UnlinkedFunctionCodeBlock>([&] (const ExecutableInfo& info) -> UnlinkedFunctionCodeBlock* {
+            // The code block was generated for the same executable, so this only fails if the
+            // caller asks for a different specialization than the one that was cached.
+            if (info.parseMode() != parseMode || info.isConstructor() != (kind == CodeForConstruct))
+                return nullptr;
+            return UnlinkedFunctionCodeBlock::create(&m_vm, FunctionCode, info, DebuggerOff);
+        });
+        if (!codeBlock || m_position != m_end)
+            return nullptr;
+        return codeBlock;
+    }
+
+    bool canRead(size_t length)
+    {
+        if (m_failed || length > m_end - m_position) {
+            m_failed = true;
+            return false;
+        }
+        return true;
+    }
+
+    const uint8_t* decodeBytes(size_t length)
+    {
+        if (!canRead(length))
+            return nullptr;
+        const uint8_t* result = m_cachedBytecode.data() + m_position;
+        m_position += length;
+        return result;
+    }
+
+    template<typename T>
+    T decodeValue()
+    {
+        T value { };
+        if (const uint8_t* bytes = decodeBytes(sizeof(T)))
+            memcpy(&value, bytes, sizeof(T));
+        return value;
+    }
+
+    uint8_t decode8() { return decodeValue<uint8_t>(); }
+    uint32_t decode32() { return decodeValue<uint32_t>(); }
+    uint64_t decode64() { return decodeValue<uint64_t>(); }
+
+    // Reads an element count, failing if the remaining data cannot hold that many elements.
+    uint32_t decodeCount(size_t minimumElementSize = 1)
+    {
+        uint32_t count = decode32();
+        if (!m_failed && count > (m_end - m_position) / minimumElementSize)
+            m_failed = true;
+        return m_failed ? 0 : count;
+    }
+
+    template<typename T>
+    void decodeVector(Vector<T>& vector)
+    {
+        uint32_t size = decodeCount(sizeof(T));
+        const uint8_t* bytes = decodeBytes(size * sizeof(T));
+        if (!bytes)
+            return;
+        vector.resize(size);
+        memcpy(vector.data(), bytes, size * sizeof(T));
+    }
+
+    String decodeString()
+    {
+        uint32_t length = decode32();
+        if (length == UINT_MAX)
+            return String();
+        bool is8Bit = decode8();
+        if (is8Bit) {
+            const uint8_t* characters = decodeBytes(length);
+            if (!characters)
+                return String();
+            return String(reinterpret_cast<const LChar*>(characters), length);
+        }
+
+        if (!canRead(length) || !canRead(length * sizeof(UChar)))
+            return String();
+        const uint8_t* bytes = decodeBytes(length * sizeof(UChar));
+        UChar* characters;
+        String result = String::createUninitialized(length, characters);
+        memcpy(characters, bytes, length * sizeof(UChar));
+        return result;
+    }
+
+    Identifier decodeIdentifier()
+    {
+        switch (static_cast<IdentifierTag>(decode8())) {
+        case IdentifierTag::Null:
+            return Identifier();
+        case IdentifierTag::String: {
+            String string = decodeString();
+            if (string.isNull())
+                break;
+            return Identifier::fromString(&m_vm, string);
+        }
+        case IdentifierTag::PrivateName: {
+            String publicName = decodeString();
+            if (publicName.isNull())
+                break;
+            if (const Identifier* privateName = m_vm.propertyNames->lookUpPrivateName(Identifier::fromString(&m_vm, publicName)))
+                return *privateName;
+            break;
+        }
+        case IdentifierTag::WellKnownSymbol:
+            if (const Identifier* symbol = wellKnownSymbolAt(m_vm, decode8()))
+                return *symbol;
+            break;
+        }
+        m_failed = true;
+        return Identifier();
+    }
+
+    void decode(VariableEnvironment& environment)
+    {
+        uint32_t size = decodeCount();
+        for (uint32_t i = 0; i < size && !m_failed; ++i) {
+            Identifier identifier = decodeIdentifier();
+            VariableEnvironmentEntry entry;
+            entry.m_bits = decodeValue<decltype(entry.m_bits)>();
+            if (identifier.isNull())
+                m_failed = true;
+            else
+                environment.m_map.add(identifier.impl(), entry);
+        }
+        environment.m_isEverythingCaptured = decode8();
+    }
+
+    void decode(BitVector& bitVector)
+    {
+        uint32_t size = decode32();
+        const uint8_t* bytes = decodeBytes((static_cast<size_t>(size) + 7) / 8);
+        if (!bytes)
+            return;
+        bitVector.ensureSize(size);
+        for (uint32_t i = 0; i < size; ++i) {
+            if (bytes[i / 8] & (1 << (i % 8)))
+                bitVector.quickSet(i);
+        }
+    }
+
+    SymbolTable* decodeSymbolTable()
+    {
+        SymbolTable* symbolTable = SymbolTable::create(m_vm);
+        {
+            ConcurrentJSLocker locker(symbolTable->m_lock);
+            uint32_t size = decodeCount();
+            for (uint32_t i = 0; i < size && !m_failed; ++i) {
+                Identifier identifier = decodeIdentifier();
+                VarKind kind = static_cast<VarKind>(decode8());
+                unsigned rawOffset = decode32();
+                unsigned attributes = decode8();
+                bool isWatchable = decode8();
+                if (m_failed || identifier.isNull() || (kind != VarKind::Scope && kind != VarKind::Stack && kind != VarKind::DirectArgument)) {
+                    m_failed = true;
+                    break;
+                }
+                SymbolTableEntry entry(VarOffset::assemble(kind, rawOffset), attributes);
+                if (!isWatchable)
+                    entry.disableWatching(m_vm);
+                symbolTable->m_map.add(identifier.impl(), WTFMove(entry));
+            }
+            symbolTable->m_maxScopeOffset = ScopeOffset(decode32());
+            symbolTable->m_usesNonStrictEval = decode8();
+            symbolTable->m_nestedLexicalScope = decode8();
+            symbolTable->m_scopeType = decode8();
+        }
+
+        if (decode8()) {
+            uint32_t length = decodeCount(sizeof(uint32_t));
+            symbolTable->setArgumentsLength(m_vm, length);
+            for (uint32_t i = 0; i < length; ++i)
+                symbolTable->setArgumentOffset(m_vm, i, ScopeOffset(decode32()));
+        }
+        return symbolTable;
+    }
+
+    JSValue decodeConstant()
+    {
+        switch (static_cast<ConstantTag>(decode8())) {
+        case ConstantTag::Value: {
+            JSValue value = JSValue::decode(decode64());
+            if (value.isCell())
+                break;
+            return value;
+        }
+        case ConstantTag::String: {
+            String string = decodeString();
+            if (string.isNull())
+                break;
+            return jsString(&m_vm, Identifier::fromString(&m_vm, string).string());
+        }
+        case ConstantTag::SymbolTable:
+            return decodeSymbolTable();
+        case ConstantTag::TemplateRegistryKey: {
+            TemplateRegistryKey::StringVector rawStrings;
+            uint32_t rawCount = decodeCount(sizeof(uint32_t));
+            for (uint32_t i = 0; i < rawCount; ++i)
+                rawStrings.append(decodeString());
+            TemplateRegistryKey::OptionalStringVector cookedStrings;
+            uint32_t cookedCount = decodeCount();
+            for (uint32_t i = 0; i < cookedCount; ++i) {
+                if (decode8())
+                    cookedStrings.append(decodeString());
+                else
+                    cookedStrings.append(std::nullopt);
+            }
+            if (m_failed)
+                break;
+            return JSTemplateRegistryKey::create(m_vm, m_vm.templateRegistryKeyTable().createKey(WTFMove(rawStrings), WTFMove(cookedStrings)));
+        }
+        }
+        m_failed = true;
+        return JSValue();
+    }
+
+    std::unique_ptr<UnlinkedCodeBlock::RareData> decodeRareData(UnlinkedCodeBlock& codeBlock, const Vector<JSValue>& constants)
+    {
+        if (!decode8())
+            return nullptr;
+
+        auto rareData = std::make_unique<UnlinkedCodeBlock::RareData>();
+
+        uint32_t handlerCount = decodeCount(3 * sizeof(uint32_t) + 1);
+        for (uint32_t i = 0; i < handlerCount; ++i) {
+            uint32_t start = decode32();
+            uint32_t end = decode32();
+            uint32_t target = decode32();
+            HandlerType type = static_cast<HandlerType>(decode8() & 3);
+            rareData->m_exceptionHandlers.append(UnlinkedHandlerInfo(start, end, target, type));
+        }
+
+        uint32_t regExpCount = decodeCount(sizeof(uint32_t) + 1);
+        for (uint32_t i = 0; i < regExpCount && !m_failed; ++i) {
+            String pattern = decodeString();
+            unsigned flags = decode8();
+            if (m_failed || pattern.isNull() || flags >= InvalidFlags) {
+                m_failed = true;
+                break;
+            }
+            rareData->m_regexps.append(WriteBarrier<RegExp>(m_vm, &codeBlock, RegExp::create(m_vm, pattern, static_cast<RegExpFlags>(flags))));
+        }
+
+        uint32_t constantBufferCount = decodeCount(sizeof(uint32_t));
+        for (uint32_t i = 0; i < constantBufferCount && !m_failed; ++i) {
+            uint32_t length = decodeCount(1 + sizeof(uint32_t));
+            UnlinkedCodeBlock::ConstantBuffer constantBuffer(length);
+            for (uint32_t j = 0; j < length; ++j) {
+                if (static_cast<ConstantBufferValueTag>(decode8()) == ConstantBufferValueTag::ConstantRegister) {
+                    uint32_t index = decode32();
+                    if (index >= constants.size()) {
+                        m_failed = true;
+                        break;
+                    }
+                    constantBuffer[j] = constants[index];
+                } else {
+                    constantBuffer[j] = JSValue::decode(decode64());
+                    if (constantBuffer[j].isCell()) {
+                        m_failed = true;
+                        break;
+                    }
+                }
+            }
+            rareData->m_constantBuffers.append(WTFMove(constantBuffer));
+        }
+
+        uint32_t switchJumpTableCount = decodeCount(2 * sizeof(uint32_t));
+        for (uint32_t i = 0; i < switchJumpTableCount; ++i) {
+            UnlinkedSimpleJumpTable jumpTable;
+            decodeVector(jumpTable.branchOffsets);
+            jumpTable.min = decode32();
+            rareData->m_switchJumpTables.append(WTFMove(jumpTable));
+        }
+
+        uint32_t stringSwitchJumpTableCount = decodeCount(sizeof(uint32_t));
+        for (uint32_t i = 0; i < stringSwitchJumpTableCount && !m_failed; ++i) {
+            UnlinkedStringJumpTable jumpTable;
+            uint32_t entryCount = decodeCount(2 * sizeof(uint32_t));
+            for (uint32_t j = 0; j < entryCount && !m_failed; ++j) {
+                String string = decodeString();
+                int32_t branchOffset = decode32();
+                if (string.isNull()) {
+                    m_failed = true;
+                    break;
+                }
+                jumpTable.offsetTable.add(string.impl(), UnlinkedStringJumpTable::OffsetLocation { branchOffset });
+            }
+            rareData->m_stringSwitchJumpTables.append(WTFMove(jumpTable));
+        }
+
+        decodeVector(rareData->m_expressionInfoFatPositions);
+        return rareData;
+    }
+
+    template<typename CodeBlockType, typename CreateFunction>
+    CodeBlockType* decodeCodeBlock(const CreateFunction& create)
+    {
+        bool usesEval = decode8();
+        bool isStrictMode = decode8();
+        bool isConstructor = decode8();
+        ConstructorKind constructorKind = static_cast<ConstructorKind>(decode8());
+        JSParserScriptMode scriptMode = static_cast<JSParserScriptMode>(decode8());
+        SuperBinding superBinding = static_cast<SuperBinding>(decode8());
+        SourceParseMode parseMode = static_cast<SourceParseMode>(decode32());
+        DerivedContextType derivedContextType = static_cast<DerivedContextType>(decode8());
+        bool isArrowFunctionContext = decode8();
+        bool isClassContext = decode8();
+        EvalContextType evalContextType = static_cast<EvalContextType>(decode8());
+        if (m_failed)
+            return nullptr;
+
+        ExecutableInfo info(usesEval, isStrictMode, isConstructor, false, constructorKind, scriptMode, superBinding, parseMode, derivedContextType, isArrowFunctionContext, isClassContext, evalContextType);
+        CodeBlockType* codeBlock = create(info);
+        if (!codeBlock)
+            return nullptr;
+
+        decodeCodeBlockContents(*codeBlock);
+        if (m_failed)
+            return nullptr;
+        return codeBlock;
+    }
+
+    void decodeCodeBlockContents(UnlinkedCodeBlock& codeBlock)
+    {
+        codeBlock.m_features = decode32();
+        codeBlock.m_hasCapturedVariables = decode8();
+        codeBlock.m_lineCount = decode32();
+        codeBlock.m_endColumn = decode32();
+        codeBlock.m_didOptimize = static_cast<TriState>(decode8());
+
+        codeBlock.m_numVars = decode32();
+        codeBlock.m_numCapturedVars = decode32();
+        codeBlock.m_numCalleeLocals = decode32();
+        codeBlock.m_numParameters = decode32();
+        codeBlock.m_thisRegister = VirtualRegister(static_cast<int>(decode32()));
+        codeBlock.m_scopeRegister = VirtualRegister(static_cast<int>(decode32()));
+        codeBlock.m_globalObjectRegister = VirtualRegister(static_cast<int>(decode32()));
+
+        codeBlock.m_sourceURLDirective = decodeString();
+        codeBlock.m_sourceMappingURLDirective = decodeString();
+
+        unsigned instructionCount = decode32();
+        uint32_t instructionsSize = decodeCount();
+        const uint8_t* instructions = decodeBytes(instructionsSize);
+        if (!instructions)
+            return;
+        codeBlock.setInstructions(std::unique_ptr<UnlinkedInstructionStream>(new UnlinkedInstructionStream(instructions, instructionsSize, instructionCount)));
+
+        decodeVector(codeBlock.m_jumpTargets);
+        decodeVector(codeBlock.m_propertyAccessInstructions);
+
+        uint32_t identifierCount = decodeCount();
+        for (uint32_t i = 0; i < identifierCount; ++i)
+            codeBlock.m_identifiers.append(decodeIdentifier());
+
+        uint32_t bitVectorCount = decodeCount(sizeof(uint32_t));
+        for (uint32_t i = 0; i < bitVectorCount; ++i) {
+            BitVector bitVector;
+            decode(bitVector);
+            codeBlock.m_bitVectors.append(WTFMove(bitVector));
+        }
+
+        // Cells are decoded before they are installed in the code block, so that a concurrent
+        // marker never sees a partially decoded constant pool.
+        uint32_t constantCount = decodeCount(2);
+        Vector<JSValue> constants;
+        Vector<SourceCodeRepresentation> constantsSourceCodeRepresentation;
+        for (uint32_t i = 0; i < constantCount && !m_failed; ++i) {
+            constantsSourceCodeRepresentation.append(static_cast<SourceCodeRepresentation>(decode8()));
+            constants.append(decodeConstant());
+        }
+        std::array<unsigned, LinkTimeConstantCount> linkTimeConstants;
+        for (auto& index : linkTimeConstants)
+            index = decode32();
+
+        codeBlock.m_arrayProfileCount = decode32();
+        codeBlock.m_arrayAllocationProfileCount = decode32();
+        codeBlock.m_objectAllocationProfileCount = decode32();
+        codeBlock.m_valueProfileCount = decode32();
+        codeBlock.m_llintCallLinkInfoCount = decode32();
+
+        std::unique_ptr<UnlinkedCodeBlock::RareData> rareData = decodeRareData(codeBlock, constants);
+        decodeVector(codeBlock.m_expressionInfo);
+
+        Vector<UnlinkedFunctionExecutable*> functionDecls;
+        uint32_t functionDeclCount = decodeCount();
+        for (uint32_t i = 0; i < functionDeclCount && !m_failed; ++i)
+            functionDecls.append(decodeFunctionExecutable());
+        Vector<UnlinkedFunctionExecutable*> functionExprs;
+        uint32_t functionExprCount = decodeCount();
+        for (uint32_t i = 0; i < functionExprCount && !m_failed; ++i)
+            functionExprs.append(decodeFunctionExecutable());
+
+        if (m_failed)
+            return;
+
+        auto locker = lockDuringMarking(m_vm.heap, codeBlock);
+        for (JSValue constant : constants)
+            codeBlock.m_constantRegisters.append(WriteBarrier<Unknown>(m_vm, &codeBlock, constant));
+        codeBlock.m_constantsSourceCodeRepresentation = WTFMove(constantsSourceCodeRepresentation);
+        codeBlock.m_linkTimeConstants = linkTimeConstants;
+        codeBlock.m_rareData = WTFMove(rareData);
+        for (UnlinkedFunctionExecutable* executable : functionDecls)
+            codeBlock.m_functionDecls.append(WriteBarrier<UnlinkedFunctionExecutable>(m_vm, &codeBlock, executable));
+        for (UnlinkedFunctionExecutable* executable : functionExprs)
+            codeBlock.m_functionExprs.append(WriteBarrier<UnlinkedFunctionExecutable>(m_vm, &codeBlock, executable));
+    }
+
+    void skipFunctionCodeBlockSegment(UnlinkedFunctionExecutable& executable, unsigned& cachedOffset)
+    {
+        if (!decode8())
+            return;
+        unsigned segmentOffset = m_position;
+        uint32_t length = decode32();
+        decode32();
+        if (!decodeBytes(length))
+            return;
+        cachedOffset = segmentOffset;
+        executable.m_cachedBytecode = &m_cachedBytecode;
+    }
+
+    UnlinkedFunctionExecutable* decodeFunctionExecutable()
+    {
+        UnlinkedFunctionExecutable* executable = new (NotNull, allocateCell<UnlinkedFunctionExecutable>(m_vm.heap)) UnlinkedFunctionExecutable(&m_vm, m_vm.unlinkedFunctionExecutableStructure.get());
+        executable->finishCreation(m_vm);
+
+        executable->m_firstLineOffset = decode32();
+        executable->m_lineCount = decode32();
+        executable->m_unlinkedFunctionNameStart = decode32();
+        executable->m_unlinkedBodyStartColumn = decode32();
+        executable->m_unlinkedBodyEndColumn = decode32();
+        executable->m_startOffset = decode32();
+        executable->m_sourceLength = decode32();
+        executable->m_parametersStartOffset = decode32();
+        executable->m_typeProfilingStartOffset = decode32();
+        executable->m_typeProfilingEndOffset = decode32();
+        executable->m_parameterCount = decode32();
+        executable->m_features = decode32();
+        executable->m_sourceParseMode = static_cast<SourceParseMode>(decode32());
+        executable->m_isInStrictContext = decode8();
+        executable->m_hasCapturedVariables = decode8();
+        executable->m_constructAbility = decode8();
+        executable->m_constructorKind = decode8();
+        executable->m_functionMode = decode8();
+        executable->m_scriptMode = decode8();
+        executable->m_superBinding = decode8();
+        executable->m_derivedContextType = decode8();
+
+        executable->m_name = decodeIdentifier();
+        executable->m_ecmaName = decodeIdentifier();
+        executable->m_inferredName = decodeIdentifier();
+
+        if (decode8()) {
+            int startOffset = decode32();
+            int endOffset = decode32();
+            int firstLine = decode32();
+            int startColumn = decode32();
+            if (!m_provider || startOffset > endOffset || static_cast<unsigned>(endOffset) > m_provider->source().length()) {
+                m_failed = true;
+                return nullptr;
+            }
+            executable->m_classSource = SourceCode(RefPtr<SourceProvider> { m_provider }, startOffset, endOffset, firstLine, startColumn);
+        }
+
+        executable->m_sourceURLDirective = decodeString();
+        executable->m_sourceMappingURLDirective = decodeString();
+        decode(executable->m_parentScopeTDZVariables);
+
+        skipFunctionCodeBlockSegment(*executable, executable->m_cachedCodeBlockForCallOffset);
+        skipFunctionCodeBlockSegment(*executable, executable->m_cachedCodeBlockForConstructOffset);
+        return executable;
+    }
+
+    VM& m_vm;
+    CachedBytecode& m_cachedBytecode;
+    SourceProvider* m_provider;
+    size_t m_position;
+    size_t m_end;
+    bool m_failed { false };
+};
+
+static SHA1::Digest computeDigest(const uint8_t* data, size_t size)
+{
+    ASSERT(size >= bytecodeCacheDigestEnd);
+    SHA1 sha1;
+    sha1.addBytes(data + bytecodeCacheDigestEnd, size - bytecodeCacheDigestEnd);
+    SHA1::Digest digest;
+    sha1.computeHash(digest);
+    return digest;
+}
+
+static bool hasValidDigest(const uint8_t* data, size_t size)
+{
+    if (size < bytecodeCacheDigestEnd)
+        return false;
+
+    uint32_t magic;
+    uint32_t version;
+    memcpy(&magic, data, sizeof(magic));
+    memcpy(&version, data + sizeof(magic), sizeof(version));
+    if (magic != bytecodeCacheMagic || version != bytecodeCacheFormatVersion)
+        return false;
+
+    SHA1::Digest digest = computeDigest(data, size);
+    return !memcmp(digest.data(), data + bytecodeCacheDigestOffset, SHA1::hashSize);
+}
+
+RefPtr<CachedBytecode> CachedBytecode::create(const String& path)
+{
+#if OS(UNIX)
+    int fd = open(path.utf8().data(), O_RDONLY);
+    if (fd == -1)
+        return nullptr;
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) || !fileStat.st_size || static_cast<uint64_t>(fileStat.st_size) > UINT_MAX) {
+        close(fd);
+        return nullptr;
+    }
+
+    size_t size = static_cast<size_t>(fileStat.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    // The whole file is checked up front, including the function code blocks that are only
+    // decoded when the functions are first called. The cache replaces files by renaming new ones
+    // over them and never writes to them in place, so the mapped bytes do not change afterwards.
+    Ref<CachedBytecode> cachedBytecode = adoptRef(*new CachedBytecode(static_cast<const uint8_t*>(data), size));
+    if (!hasValidDigest(cachedBytecode->data(), cachedBytecode->size())) {
+        dataLogLnIf(Options::verboseBytecodeCache(), "Bytecode cache: ", path, " is truncated, corrupt or was written by another version");
+        return nullptr;
+    }
+    return WTFMove(cachedBytecode);
+#else
+    UNUSED_PARAM(path);
+    return nullptr;
+#endif
+}
+
+Ref<CachedBytecode> CachedBytecode::create(Vector<uint8_t>&& buffer)
+{
+    return adoptRef(*new CachedBytecode(WTFMove(buffer)));
+}
+
+CachedBytecode::CachedBytecode(const uint8_t* data, size_t size)
+    : m_data(data)
+    , m_size(size)
+    , m_isMapped(true)
+{
+}
+
+CachedBytecode::CachedBytecode(Vector<uint8_t>&& buffer)
+    : m_buffer(WTFMove(buffer))
+    , m_data(m_buffer.data())
+    , m_size(m_buffer.size())
+    , m_isMapped(false)
+{
+}
+
+CachedBytecode::~CachedBytecode()
+{
+#if OS(UNIX)
+    if (m_isMapped)
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+}
+
+static void writeFile(const String& path, const Vector<uint8_t>& data)
+{
+#if OS(UNIX)
+    // Write to a temporary file and rename it, so that readers, including VMs that still map
+    // the previous version of the file, never see a partially written entry.
+    static std::atomic<unsigned> temporaryFileCount;
+    CString fileSystemPath = path.utf8();
+    CString temporaryPath = makeString(path, '.', String::number(getpid()), '.', String::number(temporaryFileCount++), ".tmp").utf8();
+
+    int fd = open(temporaryPath.data(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd == -1)
+        return;
+
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t result = write(fd, data.data() + written, data.size() - written);
+        if (result == -1) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        written += result;
+    }
+    close(fd);
+
+    if (written != data.size() || rename(temporaryPath.data(), fileSystemPath.data()))
+        unlink(temporaryPath.data());
+#else
+    UNUSED_PARAM(path);
+    UNUSED_PARAM(data);
+#endif
+}
+
+static void evictEntries(const String& directory, const String& keptPath)
+{
+#if OS(UNIX)
+    // Entries are evicted least recently used first. Loading an entry updates its modification
+    // time, so that is when it was last written or loaded.
+    CString fileSystemDirectory = directory.utf8();
+    DIR* dir = opendir(fileSystemDirectory.data());
+    if (!dir)
+        return;
+
+    struct Entry {
+        CString path;
+        uint64_t size;
+        time_t lastUseTime;
+    };
+    Vector<Entry> entries;
+    uint64_t totalSize = 0;
+    CString keptFileSystemPath = keptPath.utf8();
+    while (struct dirent* directoryEntry = readdir(dir)) {
+        size_t nameLength = strlen(directoryEntry->d_name);
+        if (nameLength <= 5 || strcmp(directoryEntry->d_name + nameLength - 5, ".jscb"))
+            continue;
+
+        CString path = makeString(directory, '/', String::fromUTF8(directoryEntry->d_name)).utf8();
+        struct stat fileStat;
+        if (stat(path.data(), &fileStat) || !S_ISREG(fileStat.st_mode))
+            continue;
+
+        totalSize += fileStat.st_size;
+        if (path == keptFileSystemPath)
+            continue;
+        entries.append({ path, static_cast<uint64_t>(fileStat.st_size), fileStat.st_mtime });
+    }
+    closedir(dir);
+
+    uint64_t maximumSize = Options::bytecodeCacheMaximumSize();
+    if (totalSize <= maximumSize)
+        return;
+
+    std::sort(entries.begin(), entries.end(), [] (const Entry& a, const Entry& b) {
+        return a.lastUseTime < b.lastUseTime;
+    });
+    for (auto& entry : entries) {
+        if (totalSize <= maximumSize)
+            break;
+        if (unlink(entry.path.data()))
+            continue;
+        totalSize -= entry.size;
+        dataLogLnIf(Options::verboseBytecodeCache(), "Bytecode cache: evicted ", entry.path);
+    }
+#else
+    UNUSED_PARAM(directory);
+    UNUSED_PARAM(keptPath);
+#endif
+}
+
+static void writeEntry(const String& directory, const String& path, Vector<uint8_t>&& data)
+{
+    SHA1::Digest digest = computeDigest(data.data(), data.size());
+    memcpy(data.data() + bytecodeCacheDigestOffset, digest.data(), SHA1::hashSize);
+    writeFile(path, data);
+
+    // The entry just written is never evicted, even if it is larger than the limit on its own.
+    evictEntries(directory, path);
+}
+
+static void didUseEntry(const String& path)
+{
+#if OS(UNIX)
+    utimes(path.utf8().data(), nullptr);
+#else
+    UNUSED_PARAM(path);
+#endif
+}
+
+RefPtr<BytecodeCache> BytecodeCache::create(VM& vm)
+{
+    if (!Options::bytecodeCachePath())
+        return nullptr;
+
+    String directory = String::fromUTF8(Options::bytecodeCachePath());
+#if OS(UNIX)
+    mkdir(directory.utf8().data(), 0700);
+#endif
+    return adoptRef(*new BytecodeCache(vm, directory));
+}
+
+BytecodeCache::BytecodeCache(VM& vm, const String& directory)
+    : Base(&vm)
+    , m_directory(directory)
+    , m_writeQueue(WorkQueue::create("jsc.bytecodecache.queue", WorkQueue::Type::Serial, WorkQueue::QOS::Background))
+{
+}
+
+BytecodeCache::~BytecodeCache()
+{
+}
+
+bool BytecodeCache::canCache(VM& vm, SourceCodeType codeType, const SourceCode& source, DebuggerMode debuggerMode)
+{
+    if (codeType != SourceCodeType::ProgramType)
+        return false;
+
+    // Bytecode generated for the debugger or the profilers depends on state that is not
+    // persisted, so only plain bytecode is cached.
+    if (debuggerMode == DebuggerOn || Options::forceDebuggerBytecodeGeneration())
+        return false;
+    if (vm.typeProfiler() || vm.controlFlowProfiler())
+        return false;
+    return static_cast<unsigned>(source.length()) >= Options::minimumBytecodeCacheSourceLength();
+}
+
+String BytecodeCache::pathForKey(const SourceCodeKey& key) const
+{
+    SHA1 sha1;
+    auto addUnsigned = [&] (uint32_t value) {
+        sha1.addBytes(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+    };
+    addUnsigned(bytecodeCacheFormatVersion);
+    addUnsigned(buildStamp());
+    addUnsigned(key.flags().bits());
+    sha1.addBytes(key.name().utf8());
+
+    StringView source = key.string();
+    addUnsigned(source.is8Bit());
+    if (source.is8Bit())
+        sha1.addBytes(source.characters8(), source.length() * sizeof(LChar));
+    else
+        sha1.addBytes(reinterpret_cast<const uint8_t*>(source.characters16()), source.length() * sizeof(UChar));
+
+    SHA1::Digest digest;
+    sha1.computeHash(digest);
+    return m_directory + "/" + String(SHA1::hexDigest(digest).data()) + ".jscb";
+}
+
+UnlinkedCodeBlock* BytecodeCache::load(VM& vm, const SourceCode& source, const SourceCodeKey& key)
+{
+    String path = pathForKey(key);
+    RefPtr<CachedBytecode> cachedBytecode = CachedBytecode::create(path);
+    if (!cachedBytecode)
+        return nullptr;
+
+    DeferGC deferGC(vm.heap);
+    unsigned functionCodeBlockCount = 0;
+    BytecodeCacheDecoder decoder(vm, *cachedBytecode, source.provider(), 0, cachedBytecode->size());
+    UnlinkedProgramCodeBlock* codeBlock = decoder.decodeProgram(key, functionCodeBlockCount);
+    if (!codeBlock) {
+        dataLogLnIf(Options::verboseBytecodeCache(), "Bytecode cache: could not decode ", path);
+        return nullptr;
+    }
+
+    dataLogLnIf(Options::verboseBytecodeCache(), "Bytecode cache: loaded ", path, " (", cachedBytecode->size(), " bytes, ", functionCodeBlockCount, " function code blocks)");
+    m_writeQueue->dispatch([path = path.isolatedCopy()] {
+        didUseEntry(path);
+    });
+
+    // Functions that run for the first time in this VM are persisted when the entry is
+    // written again.
+    addPendingEntry(vm, key, codeBlock, functionCodeBlockCount);
+    return codeBlock;
+}
+
+void BytecodeCache::didGenerate(VM& vm, const SourceCodeKey& key, UnlinkedCodeBlock* codeBlock)
+{
+    addPendingEntry(vm, key, jsCast<UnlinkedProgramCodeBlock*>(codeBlock), std::nullopt);
+}
+
+void BytecodeCache::addPendingEntry(VM& vm, const SourceCodeKey& key, UnlinkedProgramCodeBlock* codeBlock, std::optional<unsigned> functionCodeBlockCountOnDisk)
+{
+    m_pendingEntries.append({ key, Strong<UnlinkedProgramCodeBlock>(vm, codeBlock), functionCodeBlockCountOnDisk });
+    if (!isScheduled())
+        scheduleTimer(Seconds(Options::bytecodeCacheWriteDelay()));
+}
+
+void BytecodeCache::doWork()
+{
+    cancelTimer();
+    writePendingEntries(WriteMode::Asynchronous);
+}
+
+void BytecodeCache::writePendingEntries()
+{
+    cancelTimer();
+    writePendingEntries(WriteMode::Synchronous);
+}
+
+void BytecodeCache::writePendingEntries(WriteMode mode)
+{
+    Vector<PendingEntry> pendingEntries = WTFMove(m_pendingEntries);
+    for (auto& entry : pendingEntries) {
+        // Encoding reads the code blocks, so it happens here with the API lock held. Only the
+        // file system work is done on the background queue.
+        BytecodeCacheEncoder encoder(*m_vm);
+        String path = pathForKey(entry.key);
+        if (!encoder.encodeProgram(entry.key, *entry.codeBlock.get())) {
+            dataLogLnIf(Options::verboseBytecodeCache(), "Bytecode cache: could not encode ", path);
+            continue;
+        }
+
+        if (entry.functionCodeBlockCountOnDisk && encoder.functionCodeBlockCount() <= *entry.functionCodeBlockCountOnDisk)
+            continue;
+
+        Vector<uint8_t> data = encoder.takeData();
+        dataLogLnIf(Options::verboseBytecodeCache(), "Bytecode cache: writing ", path, " (", data.size(), " bytes, ", encoder.functionCodeBlockCount(), " function code blocks)");
+        if (mode == WriteMode::Synchronous) {
+            writeEntry(m_directory, path, WTFMove(data));
+            continue;
+        }
+        m_writeQueue->dispatch([directory = m_directory.isolatedCopy(), path = path.isolatedCopy(), data = WTFMove(data)] () mutable {
+            writeEntry(directory, path, WTFMove(data));
+        });
+    }
+}
+
+RefPtr<CachedBytecode> BytecodeCache::encodeProgram(VM& vm, const SourceCodeKey& key, UnlinkedProgramCodeBlock& codeBlock)
+{
+    BytecodeCacheEncoder encoder(vm);
+    if (!encoder.encodeProgram(key, codeBlock))
+        return nullptr;
+    return CachedBytecode::create(encoder.takeData());
+}
+
+UnlinkedProgramCodeBlock* BytecodeCache::decodeProgram(VM& vm, const SourceCode& source, const SourceCodeKey& key, CachedBytecode& cachedBytecode)
+{
+    DeferGC deferGC(vm.heap);
+    unsigned functionCodeBlockCount = 0;
+    BytecodeCacheDecoder decoder(vm, cachedBytecode, source.provider(), 0, cachedBytecode.size());
+    return decoder.decodeProgram(key, functionCodeBlockCount);
+}
+
+UnlinkedFunctionCodeBlock* BytecodeCache::decodeFunctionCodeBlock(VM& vm, UnlinkedFunctionExecutable& executable, const SourceCode& source, CodeSpecializationKind kind, DebuggerMode debuggerMode, SourceParseMode parseMode)
+{
+    if (debuggerMode == DebuggerOn || Options::forceDebuggerBytecodeGeneration())
+        return nullptr;
+    if (vm.typeProfiler() || vm.controlFlowProfiler())
+        return nullptr;
+
+    DeferGC deferGC(vm.heap);
+    return BytecodeCacheDecoder::decodeFunctionCodeBlock(vm, executable, source.provider(), kind, parseMode);
+}
+
+} // namespace JSC
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "CodeSpecializationKind.h"
+#include "JSRunLoopTimer.h"
+#include "ParserModes.h"
+#include "SourceCodeKey.h"
+#include "Strong.h"
+#include <wtf/Optional.h>
+#include <wtf/ThreadSafeRefCounted.h>
+#include <wtf/Vector.h>
+#include <wtf/WorkQueue.h>
+#include <wtf/text/WTFString.h>
+
+namespace JSC {
+
+class SourceCode;
+class UnlinkedCodeBlock;
+class UnlinkedFunctionCodeBlock;
+class UnlinkedFunctionExecutable;
+class UnlinkedProgramCodeBlock;
+class VM;
+
+// The contents of one bytecode cache file, mapped read-only. The code blocks of cached functions
+// are decoded from it when the function is first called, so every UnlinkedFunctionExecutable
+// decoded from the file keeps it alive.
+class CachedBytecode : public ThreadSafeRefCounted<CachedBytecode> {
+public:
+    // Returns nullptr if the file is missing, or if it is truncated, corrupt or was written by
+    // another version of the format, which the digest in its header tells.
+    JS_EXPORT_PRIVATE static RefPtr<CachedBytecode> create(const String& path);
+    JS_EXPORT_PRIVATE static Ref<CachedBytecode> create(Vector<uint8_t>&&);
+    JS_EXPORT_PRIVATE ~CachedBytecode();
+
+    const uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    CachedBytecode(const uint8_t*, size_t);
+    explicit CachedBytecode(Vector<uint8_t>&&);
+
+    Vector<uint8_t> m_buffer;
+    const uint8_t* m_data;
+    size_t m_size;
+    bool m_isMapped;
+};
+
+// Persists the bytecode of large top-level programs, including the code blocks of the functions
+// that ran, to Options::bytecodeCachePath(). A later VM, usually in another process, decodes it
+// instead of parsing the program and generating its bytecode again. Entries are keyed by the
+// SourceCodeKey flags and a SHA-1 hash of the source, and are written some time after the
+// program was first seen, so that they include the functions it called during startup. When the
+// cache grows past Options::bytecodeCacheMaximumSize(), the least recently used entries are deleted.
+class BytecodeCache : public JSRunLoopTimer {
+public:
+    using Base = JSRunLoopTimer;
+
+    // Returns nullptr if Options::bytecodeCachePath() is not set.
+    static RefPtr<BytecodeCache> create(VM&);
+    ~BytecodeCache();
+
+    // Only top-level program code is cached.
+    static bool canCache(VM&, SourceCodeType, const SourceCode&, DebuggerMode);
+
+    UnlinkedCodeBlock* load(VM&, const SourceCode&, const SourceCodeKey&);
+    void didGenerate(VM&, const SourceCodeKey&, UnlinkedCodeBlock*);
+
+    // Writes the pending entries synchronously. Called when the VM is destroyed.
+    void writePendingEntries();
+
+    // Encode and decode a single program without going through the file system, so that
+    // bytecode generated by one VM can be used by another one.
+    static RefPtr<CachedBytecode> encodeProgram(VM&, const SourceCodeKey&, UnlinkedProgramCodeBlock&);
+    JS_EXPORT_PRIVATE static UnlinkedProgramCodeBlock* decodeProgram(VM&, const SourceCode&, const SourceCodeKey&, CachedBytecode&);
+
+    static UnlinkedFunctionCodeBlock* decodeFunctionCodeBlock(VM&, UnlinkedFunctionExecutable&, const SourceCode&, CodeSpecializationKind, DebuggerMode, SourceParseMode);
+
+private:
+    BytecodeCache(VM&, const String& directory);
+
+    void doWork() override;
+
+    String pathForKey(const SourceCodeKey&) const;
+    void addPendingEntry(VM&, const SourceCodeKey&, UnlinkedProgramCodeBlock*, std::optional<unsigned> functionCodeBlockCountOnDisk);
+    enum class WriteMode { Synchronous, Asynchronous };
+    void writePendingEntries(WriteMode);
+
+    struct PendingEntry {
+        SourceCodeKey key;
+        Strong<UnlinkedProgramCodeBlock> codeBlock;
+        std::optional<unsigned> functionCodeBlockCountOnDisk;
+    };
+
+    String m_directory;
+    Vector<PendingEntry> m_pendingEntries;
+    Ref<WorkQueue> m_writeQueue;
+};
+
+} // namespace JSC
@@ -58,9 +58,21 @@ UnlinkedCodeBlockType* CodeCache::getUnlinkedGlobalCodeBlock(VM& vm, ExecutableT
         derivedContextType, evalContextType, isArrowFunctionContext, debuggerMode, 
         vm.typeProfiler() ? TypeProfilerEnabled::Yes : TypeProfilerEnabled::No, 
         vm.controlFlowProfiler() ? ControlFlowProfilerEnabled::Yes : ControlFlowProfilerEnabled::No);
+    BytecodeCache* bytecodeCache = nullptr;
+    if (Options::useCodeCache() && BytecodeCache::canCache(vm, CacheTypes<UnlinkedCodeBlockType>::codeType, source, debuggerMode))
+        bytecodeCache = this->bytecodeCache(vm);
+
     SourceCodeValue* cache = m_sourceCode.findCacheAndUpdateAge(key);
-    if (cache && Options::useCodeCache()) {
-        UnlinkedCodeBlockType* unlinkedCodeBlock = jsCast<UnlinkedCodeBlockType*>(cache->cell.get());
+    UnlinkedCodeBlockType* unlinkedCodeBlock = nullptr;
+    if (cache && Options::useCodeCache())
+        unlinkedCodeBlock = jsCast<UnlinkedCodeBlockType*>(cache->cell.get());
+    else if (bytecodeCache) {
+        unlinkedCodeBlock = jsCast<UnlinkedCodeBlockType*>(bytecodeCache->load(vm, source, key));
+        if (unlinkedCodeBlock)
+            m_sourceCode.addCache(key, SourceCodeValue(vm, unlinkedCodeBlock, m_sourceCode.age()));
+    }
+
+    if (unlinkedCodeBlock) {
         unsigned lineCount = unlinkedCodeBlock->lineCount();
         unsigned startColumn = unlinkedCodeBlock->startColumn() + source.startColumn().oneBasedInt();
         bool endColumnIsOnStartLine = !lineCount;
@@ -72,14 +84,57 @@ UnlinkedCodeBlockType* CodeCache::getUnlinkedGlobalCodeBlock(VM& vm, ExecutableT
     }
     
     VariableEnvironment variablesUnderTDZ;
-    UnlinkedCodeBlockType* unlinkedCodeBlock = generateUnlinkedCodeBlock<UnlinkedCodeBlockType, ExecutableType>(vm, executable, source, strictMode, scriptMode, debuggerMode, error, evalContextType, &variablesUnderTDZ);
+    unlinkedCodeBlock = generateUnlinkedCodeBlock<UnlinkedCodeBlockType, ExecutableType>(vm, executable, source, strictMode, scriptMode, debuggerMode, error, evalContextType, &variablesUnderTDZ);
 
-    if (unlinkedCodeBlock && Options::useCodeCache())
+    if (unlinkedCodeBlock && Options::useCodeCache()) {
         m_sourceCode.addCache(key, SourceCodeValue(vm, unlinkedCodeBlock, m_sourceCode.age()));
+        if (bytecodeCache)
+            bytecodeCache->didGenerate(vm, key, unlinkedCodeBlock);
+    }
 
     return unlinkedCodeBlock;
 }
 
+bool CodeCache::addPrecompiledProgram(VM& vm, const SourceCode& source, CachedBytecode& cachedBytecode)
+{
+    if (!Options::useCodeCache())
+        return false;
+
+    // Precompiled bytecode is generated without the profilers, so it can't stand in for bytecode
+    // that has to be instrumented.
+    if (vm.typeProfiler() || vm.controlFlowProfiler())
+        return false;
+
+    // This must match the key getUnlinkedProgramCodeBlock() uses for a <script> without a debugger.
+    SourceCodeKey key(
+        source, String(), SourceCodeType::ProgramType, JSParserStrictMode::NotStrict, JSParserScriptMode::Classic,
+        DerivedContextType::None, EvalContextType::None, false, DebuggerOff, TypeProfilerEnabled::No, ControlFlowProfilerEnabled::No);
+    if (m_sourceCode.findCacheAndUpdateAge(key))
+        return true;
+
+    UnlinkedProgramCodeBlock* codeBlock = BytecodeCache::decodeProgram(vm, source, key, cachedBytecode);
+    if (!codeBlock)
+        return false;
+
+    m_sourceCode.addCache(key, SourceCodeValue(vm, codeBlock, m_sourceCode.age()));
+    return true;
+}
+
+BytecodeCache* CodeCache::bytecodeCache(VM& vm)
+{
+    if (!m_didCreateBytecodeCache) {
+        m_bytecodeCache = BytecodeCache::create(vm);
+        m_didCreateBytecodeCache = true;
+    }
+    return m_bytecodeCache.get();
+}
+
+void CodeCache::willDestroyVM()
+{
+    if (m_bytecodeCache)
+        m_bytecodeCache->writePendingEntries();
+}
+
 UnlinkedProgramCodeBlock* CodeCache::getUnlinkedProgramCodeBlock(VM& vm, ProgramExecutable* executable, const SourceCode& source, JSParserStrictMode strictMode, DebuggerMode debuggerMode, ParserError& error)
 {
     return getUnlinkedGlobalCodeBlock<UnlinkedProgramCodeBlock>(vm, executable, source, strictMode, JSParserScriptMode::Classic, debuggerMode, error, EvalContextType::None);
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include "BytecodeCache.h"
 #include "BytecodeGenerator.h"
 #include "ExecutableInfo.h"
 #include "JSCInlines.h"
@@ -200,11 +201,22 @@ public:
 
     void clear() { m_sourceCode.clear(); }
 
+    // Adds a program whose bytecode was generated by another VM, see BackgroundCodeGenerator.
+    // Returns false if it cannot be used for the given source in this VM.
+    JS_EXPORT_PRIVATE bool addPrecompiledProgram(VM&, const SourceCode&, CachedBytecode&);
+
+    // Writes the bytecode cache entries that are still pending. Called when the VM is destroyed.
+    void willDestroyVM();
+
 private:
     template <class UnlinkedCodeBlockType, class ExecutableType> 
     UnlinkedCodeBlockType* getUnlinkedGlobalCodeBlock(VM&, ExecutableType*, const SourceCode&, JSParserStrictMode, JSParserScriptMode, DebuggerMode, ParserError&, EvalContextType);
 
+    BytecodeCache* bytecodeCache(VM&);
+
     CodeCacheMap m_sourceCode;
+    RefPtr<BytecodeCache> m_bytecodeCache;
+    bool m_didCreateBytecodeCache { false };
 };
 
 template <typename T> struct CacheTypes { };
@@ -32,6 +32,7 @@
 
 #include "Error.h"
 #include "IntlCollatorConstructor.h"
+#include "IntlFormatterCache.h"
 #include "IntlObject.h"
 #include "JSBoundFunction.h"
 #include "JSCInlines.h"
@@ -39,6 +40,7 @@
 #include "SlotVisitorInlines.h"
 #include "StructureInlines.h"
 #include <unicode/ucol.h>
+#include <wtf/text/StringConcatenateNumbers.h>
 #include <wtf/unicode/Collator.h>
 
 namespace JSC {
@@ -346,6 +348,15 @@ void IntlCollator::createCollator(ExecState& state)
         scope.assertNoException();
     }
 
+    IntlFormatterCache* cache = Options::useIntlFormatterCache() ? &globalObject()->intlFormatterCache() : nullptr;
+    String key;
+    if (cache) {
+        key = makeString(m_locale, '|', static_cast<unsigned>(m_sensitivity), '|', static_cast<unsigned>(m_caseFirst), '|', static_cast<unsigned>(m_numeric), '|', static_cast<unsigned>(m_ignorePunctuation));
+        m_collator = std::unique_ptr<UCollator, UCollatorDeleter>(cache->copyCollator(key));
+        if (m_collator)
+            return;
+    }
+
     UErrorCode status = U_ZERO_ERROR;
     auto collator = std::unique_ptr<UCollator, UCollatorDeleter>(ucol_open(m_locale.utf8().data(), &status));
     if (U_FAILURE(status))
@@ -393,6 +404,8 @@ void IntlCollator::createCollator(ExecState& state)
     if (U_FAILURE(status))
         return;
 
+    if (cache)
+        cache->addCollator(key, collator.get());
     m_collator = WTFMove(collator);
 }
 
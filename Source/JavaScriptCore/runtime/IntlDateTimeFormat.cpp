@@ -32,6 +32,7 @@
 #include "DateInstance.h"
 #include "Error.h"
 #include "IntlDateTimeFormatConstructor.h"
+#include "IntlFormatterCache.h"
 #include "IntlObject.h"
 #include "JSBoundFunction.h"
 #include "JSCInlines.h"
@@ -632,40 +633,59 @@ void IntlDateTimeFormat::initializeDateTimeFormat(ExecState& exec, JSValue local
     // 27. ReturnIfAbrupt(matcher).
     RETURN_IF_EXCEPTION(scope, void());
 
-    // Always use ICU date format generator, rather than our own pattern list and matcher.
-    // Covers steps 28-36.
+    // Everything that decides the ICU pattern and formatter is resolved by now, so the rest can
+    // come from the cache. The options have been read either way.
+    IntlFormatterCache* cache = Options::useIntlFormatterCache() ? &globalObject()->intlFormatterCache() : nullptr;
+    String skeleton = skeletonBuilder.toString();
+    String patternKey = makeString(dataLocale, '|', skeleton);
+    String patternString = cache ? cache->dateTimePattern(patternKey) : String();
+
     UErrorCode status = U_ZERO_ERROR;
-    UDateTimePatternGenerator* generator = udatpg_open(dataLocale.utf8().data(), &status);
-    if (U_FAILURE(status)) {
-        throwTypeError(&exec, scope, ASCIILiteral("failed to initialize DateTimeFormat"));
-        return;
-    }
+    if (patternString.isNull()) {
+        // Always use ICU date format generator, rather than our own pattern list and matcher.
+        // Covers steps 28-36.
+        UDateTimePatternGenerator* generator = udatpg_open(dataLocale.utf8().data(), &status);
+        if (U_FAILURE(status)) {
+            throwTypeError(&exec, scope, ASCIILiteral("failed to initialize DateTimeFormat"));
+            return;
+        }
 
-    String skeleton = skeletonBuilder.toString();
-    StringView skeletonView(skeleton);
-    Vector<UChar, 32> patternBuffer(32);
-    status = U_ZERO_ERROR;
-    auto patternLength = udatpg_getBestPattern(generator, skeletonView.upconvertedCharacters(), skeletonView.length(), patternBuffer.data(), patternBuffer.size(), &status);
-    if (status == U_BUFFER_OVERFLOW_ERROR) {
+        StringView skeletonView(skeleton);
+        Vector<UChar, 32> patternBuffer(32);
         status = U_ZERO_ERROR;
-        patternBuffer.grow(patternLength);
-        udatpg_getBestPattern(generator, skeletonView.upconvertedCharacters(), skeletonView.length(), patternBuffer.data(), patternLength, &status);
-    }
-    udatpg_close(generator);
-    if (U_FAILURE(status)) {
-        throwTypeError(&exec, scope, ASCIILiteral("failed to initialize DateTimeFormat"));
-        return;
+        auto patternLength = udatpg_getBestPattern(generator, skeletonView.upconvertedCharacters(), skeletonView.length(), patternBuffer.data(), patternBuffer.size(), &status);
+        if (status == U_BUFFER_OVERFLOW_ERROR) {
+            status = U_ZERO_ERROR;
+            patternBuffer.grow(patternLength);
+            udatpg_getBestPattern(generator, skeletonView.upconvertedCharacters(), skeletonView.length(), patternBuffer.data(), patternLength, &status);
+        }
+        udatpg_close(generator);
+        if (U_FAILURE(status)) {
+            throwTypeError(&exec, scope, ASCIILiteral("failed to initialize DateTimeFormat"));
+            return;
+        }
+
+        patternString = String(patternBuffer.data(), patternLength);
+        if (cache)
+            cache->addDateTimePattern(patternKey, patternString);
     }
 
-    StringView pattern(patternBuffer.data(), patternLength);
+    StringView pattern(patternString);
     setFormatsFromPattern(pattern);
 
-    status = U_ZERO_ERROR;
-    StringView timeZoneView(m_timeZone);
-    m_dateFormat = std::unique_ptr<UDateFormat, UDateFormatDeleter>(udat_open(UDAT_PATTERN, UDAT_PATTERN, m_locale.utf8().data(), timeZoneView.upconvertedCharacters(), timeZoneView.length(), pattern.upconvertedCharacters(), pattern.length(), &status));
-    if (U_FAILURE(status)) {
-        throwTypeError(&exec, scope, ASCIILiteral("failed to initialize DateTimeFormat"));
-        return;
+    String dateFormatKey = makeString(m_locale, '|', m_timeZone, '|', patternString);
+    if (cache)
+        m_dateFormat = std::unique_ptr<UDateFormat, UDateFormatDeleter>(cache->copyDateFormat(dateFormatKey));
+    if (!m_dateFormat) {
+        status = U_ZERO_ERROR;
+        StringView timeZoneView(m_timeZone);
+        m_dateFormat = std::unique_ptr<UDateFormat, UDateFormatDeleter>(udat_open(UDAT_PATTERN, UDAT_PATTERN, m_locale.utf8().data(), timeZoneView.upconvertedCharacters(), timeZoneView.length(), pattern.upconvertedCharacters(), pattern.length(), &status));
+        if (U_FAILURE(status)) {
+            throwTypeError(&exec, scope, ASCIILiteral("failed to initialize DateTimeFormat"));
+            return;
+        }
+        if (cache)
+            cache->addDateFormat(dateFormatKey, m_dateFormat.get());
     }
 
     // 37. Set dateTimeFormat.[[boundFormat]] to undefined.
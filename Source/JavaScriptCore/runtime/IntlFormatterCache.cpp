@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "IntlFormatterCache.h"
+
+#if ENABLE(INTL)
+
+namespace JSC {
+
+String IntlFormatterCache::dateTimePattern(const String& key) const
+{
+    const String* pattern = m_dateTimePatterns.get(key);
+    return pattern ? *pattern : String();
+}
+
+void IntlFormatterCache::addDateTimePattern(const String& key, const String& pattern)
+{
+    m_dateTimePatterns.add(key, String(pattern));
+}
+
+UDateFormat* IntlFormatterCache::copyDateFormat(const String& key) const
+{
+    auto* dateFormat = m_dateFormats.get(key);
+    if (!dateFormat)
+        return nullptr;
+    UErrorCode status = U_ZERO_ERROR;
+    UDateFormat* copy = udat_clone(dateFormat->get(), &status);
+    if (U_FAILURE(status)) {
+        udat_close(copy);
+        return nullptr;
+    }
+    return copy;
+}
+
+void IntlFormatterCache::addDateFormat(const String& key, const UDateFormat* dateFormat)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    std::unique_ptr<UDateFormat, ICUDeleter<UDateFormat, udat_close>> copy(udat_clone(dateFormat, &status));
+    if (U_SUCCESS(status))
+        m_dateFormats.add(key, WTFMove(copy));
+}
+
+UNumberFormat* IntlFormatterCache::copyNumberFormat(const String& key) const
+{
+    auto* numberFormat = m_numberFormats.get(key);
+    if (!numberFormat)
+        return nullptr;
+    UErrorCode status = U_ZERO_ERROR;
+    UNumberFormat* copy = unum_clone(numberFormat->get(), &status);
+    if (U_FAILURE(status)) {
+        unum_close(copy);
+        return nullptr;
+    }
+    return copy;
+}
+
+void IntlFormatterCache::addNumberFormat(const String& key, const UNumberFormat* numberFormat)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    std::unique_ptr<UNumberFormat, ICUDeleter<UNumberFormat, unum_close>> copy(unum_clone(numberFormat, &status));
+    if (U_SUCCESS(status))
+        m_numberFormats.add(key, WTFMove(copy));
+}
+
+UCollator* IntlFormatterCache::copyCollator(const String& key) const
+{
+    auto* collator = m_collators.get(key);
+    if (!collator)
+        return nullptr;
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator* copy = ucol_safeClone(collator->get(), nullptr, nullptr, &status);
+    if (U_FAILURE(status)) {
+        ucol_close(copy);
+        return nullptr;
+    }
+    return copy;
+}
+
+void IntlFormatterCache::addCollator(const String& key, const UCollator* collator)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    std::unique_ptr<UCollator, ICUDeleter<UCollator, ucol_close>> copy(ucol_safeClone(collator, nullptr, nullptr, &status));
+    if (U_SUCCESS(status))
+        m_collators.add(key, WTFMove(copy));
+}
+
+} // namespace JSC
+
+#endif // ENABLE(INTL)
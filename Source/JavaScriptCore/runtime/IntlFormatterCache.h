@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#if ENABLE(INTL)
+
+#include <unicode/ucol.h>
+#include <unicode/udat.h>
+#include <unicode/unum.h>
+#include <wtf/Deque.h>
+#include <wtf/HashMap.h>
+#include <wtf/text/StringHash.h>
+#include <wtf/text/WTFString.h>
+
+namespace JSC {
+
+// Opening ICU formatters and collators is expensive, mostly because ICU loads and parses locale
+// data each time. The toLocale*() methods and localeCompare() create a new Intl object on every
+// call, so each global object keeps the most recently opened ICU objects, keyed by their resolved
+// locale and options, and hands out copies of them.
+class IntlFormatterCache {
+    WTF_MAKE_NONCOPYABLE(IntlFormatterCache);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    IntlFormatterCache() = default;
+
+    // Lookups return nullptr on a miss. Otherwise the caller owns the returned object.
+    String dateTimePattern(const String& key) const;
+    void addDateTimePattern(const String& key, const String& pattern);
+
+    UDateFormat* copyDateFormat(const String& key) const;
+    void addDateFormat(const String& key, const UDateFormat*);
+
+    UNumberFormat* copyNumberFormat(const String& key) const;
+    void addNumberFormat(const String& key, const UNumberFormat*);
+
+    UCollator* copyCollator(const String& key) const;
+    void addCollator(const String& key, const UCollator*);
+
+private:
+    static const unsigned maxEntriesPerKind = 16;
+
+    template<typename T, void (*closeFunction)(T*)>
+    struct ICUDeleter {
+        void operator()(T* object) const
+        {
+            if (object)
+                closeFunction(object);
+        }
+    };
+
+    // Evicts the oldest entry once full. Lookups are far more common than insertions, so this
+    // doesn't bother tracking recency.
+    template<typename Value>
+    class BoundedMap {
+    public:
+        const Value* get(const String& key) const
+        {
+            auto iterator = m_map.find(key);
+            return iterator == m_map.end() ? nullptr : &iterator->value;
+        }
+
+        void add(const String& key, Value&& value)
+        {
+            if (m_map.contains(key))
+                return;
+            if (m_map.size() >= maxEntriesPerKind)
+                m_map.remove(m_insertionOrder.takeFirst());
+            m_map.add(key, WTFMove(value));
+            m_insertionOrder.append(key);
+        }
+
+    private:
+        HashMap<String, Value> m_map;
+        Deque<String> m_insertionOrder;
+    };
+
+    BoundedMap<String> m_dateTimePatterns;
+    BoundedMap<std::unique_ptr<UDateFormat, ICUDeleter<UDateFormat, udat_close>>> m_dateFormats;
+    BoundedMap<std::unique_ptr<UNumberFormat, ICUDeleter<UNumberFormat, unum_close>>> m_numberFormats;
+    BoundedMap<std::unique_ptr<UCollator, ICUDeleter<UCollator, ucol_close>>> m_collators;
+};
+
+} // namespace JSC
+
+#endif // ENABLE(INTL)
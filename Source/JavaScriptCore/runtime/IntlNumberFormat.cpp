@@ -31,11 +31,13 @@
 #if ENABLE(INTL)
 
 #include "Error.h"
+#include "IntlFormatterCache.h"
 #include "IntlNumberFormatConstructor.h"
 #include "IntlObject.h"
 #include "JSBoundFunction.h"
 #include "JSCInlines.h"
 #include "ObjectConstructor.h"
+#include <wtf/text/StringBuilder.h>
 
 namespace JSC {
 
@@ -388,6 +390,23 @@ void IntlNumberFormat::createNumberFormat(ExecState& state)
         ASSERT_NOT_REACHED();
     }
 
+    IntlFormatterCache* cache = Options::useIntlFormatterCache() ? &globalObject()->intlFormatterCache() : nullptr;
+    StringBuilder keyBuilder;
+    if (cache) {
+        keyBuilder.append(m_locale);
+        keyBuilder.append('|');
+        keyBuilder.appendNumber(static_cast<unsigned>(style));
+        keyBuilder.append('|');
+        keyBuilder.append(m_currency);
+        for (unsigned value : { m_minimumIntegerDigits, m_minimumFractionDigits, m_maximumFractionDigits, m_minimumSignificantDigits, m_maximumSignificantDigits, static_cast<unsigned>(m_useGrouping) }) {
+            keyBuilder.append('|');
+            keyBuilder.appendNumber(value);
+        }
+        m_numberFormat = std::unique_ptr<UNumberFormat, UNumberFormatDeleter>(cache->copyNumberFormat(keyBuilder.toString()));
+        if (m_numberFormat)
+            return;
+    }
+
     UErrorCode status = U_ZERO_ERROR;
     auto numberFormat = std::unique_ptr<UNumberFormat, UNumberFormatDeleter>(unum_open(style, nullptr, 0, m_locale.utf8().data(), nullptr, &status));
     if (U_FAILURE(status))
@@ -409,6 +428,8 @@ void IntlNumberFormat::createNumberFormat(ExecState& state)
     if (U_FAILURE(status))
         return;
 
+    if (cache)
+        cache->addNumberFormat(keyBuilder.toString(), numberFormat.get());
     m_numberFormat = WTFMove(numberFormat);
 }
 
@@ -166,6 +166,7 @@
 #include <wtf/RandomNumber.h>
 
 #if ENABLE(INTL)
+#include "IntlFormatterCache.h"
 #include "IntlObject.h"
 #include <unicode/ucol.h>
 #include <unicode/udat.h>
@@ -257,6 +258,7 @@ const GlobalObjectMethodTable JSGlobalObject::s_globalObjectMethodTable = {
     nullptr, // moduleLoaderEvaluate
     nullptr, // promiseRejectionTracker
     nullptr, // defaultLanguage
+    nullptr, // streamWebAssemblySource
 };
 
 /* Source for JSGlobalObject.lut.h
@@ -1426,6 +1428,13 @@ const HashSet<String>& JSGlobalObject::intlNumberFormatAvailableLocales()
     }
     return m_intlNumberFormatAvailableLocales;
 }
+
+IntlFormatterCache& JSGlobalObject::intlFormatterCache()
+{
+    if (!m_intlFormatterCache)
+        m_intlFormatterCache = std::make_unique<IntlFormatterCache>();
+    return *m_intlFormatterCache;
+}
 #endif // ENABLE(INTL)
 
 void JSGlobalObject::queueMicrotask(Ref<Microtask>&& task)
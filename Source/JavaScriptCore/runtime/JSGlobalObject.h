@@ -73,6 +73,7 @@ class GetterSetter;
 class GlobalCodeBlock;
 class IndirectEvalExecutable;
 class InputCursor;
+class IntlFormatterCache;
 class JSArrayBuffer;
 class JSArrayBufferConstructor;
 class JSArrayBufferPrototype;
@@ -155,6 +156,9 @@ struct HashTable;
     class capitalName ## Constructor;
 
 class IteratorPrototype;
+namespace Wasm {
+class StreamingCompiler;
+}
 FOR_EACH_SIMPLE_BUILTIN_TYPE(DECLARE_SIMPLE_BUILTIN_TYPE)
 FOR_EACH_LAZY_BUILTIN_TYPE(DECLARE_SIMPLE_BUILTIN_TYPE)
 FOR_EACH_BUILTIN_DERIVED_ITERATOR_TYPE(DECLARE_SIMPLE_BUILTIN_TYPE)
@@ -203,6 +207,11 @@ struct GlobalObjectMethodTable {
 
     typedef String (*DefaultLanguageFunctionPtr)();
     DefaultLanguageFunctionPtr defaultLanguage;
+
+    // Feeds the bytes of an embedder-defined source, such as a fetch Response, to the compiler as
+    // they arrive. Throws if the source cannot be streamed.
+    typedef void (*StreamWebAssemblySourcePtr)(JSGlobalObject*, ExecState*, JSValue, Ref<Wasm::StreamingCompiler>&&);
+    StreamWebAssemblySourcePtr streamWebAssemblySource;
 };
 
 class JSGlobalObject : public JSSegmentedVariableObject {
@@ -397,6 +406,7 @@ public:
     HashSet<String> m_intlCollatorAvailableLocales;
     HashSet<String> m_intlDateTimeFormatAvailableLocales;
     HashSet<String> m_intlNumberFormatAvailableLocales;
+    std::unique_ptr<IntlFormatterCache> m_intlFormatterCache;
 #endif // ENABLE(INTL)
 
     RefPtr<WatchpointSet> m_masqueradesAsUndefinedWatchpoint;
@@ -640,6 +650,7 @@ public:
     const HashSet<String>& intlCollatorAvailableLocales();
     const HashSet<String>& intlDateTimeFormatAvailableLocales();
     const HashSet<String>& intlNumberFormatAvailableLocales();
+    IntlFormatterCache& intlFormatterCache();
 #endif // ENABLE(INTL)
 
     void setConsoleClient(ConsoleClient* consoleClient) { m_consoleClient = consoleClient; }
@@ -48,6 +48,35 @@ static ALWAYS_INLINE bool isJSONWhiteSpace(const CharType& c)
     return c == ' ' || c == 0x9 || c == 0xA || c == 0xD;
 }
 
+template <typename CharType>
+static ALWAYS_INLINE const CharType* skipJSONWhiteSpace(const CharType* ptr, const CharType* end)
+{
+    while (ptr < end && isJSONWhiteSpace(*ptr))
+        ++ptr;
+    return ptr;
+}
+
+// Pretty printed JSON is mostly indentation, so skip runs of spaces eight at a time.
+template <>
+ALWAYS_INLINE const LChar* skipJSONWhiteSpace(const LChar* ptr, const LChar* end)
+{
+    const uint64_t spaces = 0x2020202020202020ULL;
+    while (ptr < end) {
+        if (end - ptr >= static_cast<ptrdiff_t>(sizeof(uint64_t))) {
+            uint64_t word;
+            memcpy(&word, ptr, sizeof(word));
+            if (word == spaces) {
+                ptr += sizeof(uint64_t);
+                continue;
+            }
+        }
+        if (!isJSONWhiteSpace(*ptr))
+            break;
+        ++ptr;
+    }
+    return ptr;
+}
+
 template <typename CharType>
 bool LiteralParser<CharType>::tryJSONPParse(Vector<JSONPData>& results, bool needsFullSourceInfo)
 {
@@ -175,8 +204,7 @@ template <ParserMode mode> TokenType LiteralParser<CharType>::Lexer::lex(Literal
     m_currentTokenID++;
 #endif
 
-    while (m_ptr < m_end && isJSONWhiteSpace(*m_ptr))
-        ++m_ptr;
+    m_ptr = skipJSONWhiteSpace(m_ptr, m_end);
 
     ASSERT(m_ptr <= m_end);
     if (m_ptr >= m_end) {
@@ -348,13 +376,50 @@ template <ParserMode mode, typename CharType, UChar terminator> static ALWAYS_IN
     return (c >= ' ' && (mode == StrictJSON || c <= 0xff) && c != '\\' && c != terminator) || (c == '\t' && mode != StrictJSON);
 }
 
+// For 8-bit sources, we check eight characters at a time for anything that can end a run of safe
+// string characters: control characters, the terminator and backslash. Once a word contains one
+// of those we fall back to checking character by character.
+template <char terminator>
+static ALWAYS_INLINE bool mayContainUnsafeStringCharacter(uint64_t word)
+{
+    const uint64_t ones = 0x0101010101010101ULL;
+    const uint64_t highBits = 0x8080808080808080ULL;
+    auto hasZeroByte = [&] (uint64_t value) {
+        return (value - ones) & ~value & highBits;
+    };
+    uint64_t controlCharacters = (word - ones * ' ') & ~word & highBits;
+    return controlCharacters | hasZeroByte(word ^ (ones * terminator)) | hasZeroByte(word ^ (ones * '\\'));
+}
+
+template <ParserMode mode, char terminator>
+static ALWAYS_INLINE const LChar* skipSafeStringCharacters(const LChar* ptr, const LChar* end)
+{
+    while (end - ptr >= static_cast<ptrdiff_t>(sizeof(uint64_t))) {
+        uint64_t word;
+        memcpy(&word, ptr, sizeof(word));
+        if (mayContainUnsafeStringCharacter<terminator>(word))
+            break;
+        ptr += sizeof(uint64_t);
+    }
+    while (ptr < end && isSafeStringCharacter<mode, LChar, terminator>(*ptr))
+        ++ptr;
+    return ptr;
+}
+
+template <ParserMode mode, char terminator>
+static ALWAYS_INLINE const UChar* skipSafeStringCharacters(const UChar* ptr, const UChar* end)
+{
+    while (ptr < end && isSafeStringCharacter<mode, UChar, terminator>(*ptr))
+        ++ptr;
+    return ptr;
+}
+
 template <typename CharType>
 template <ParserMode mode, char terminator> ALWAYS_INLINE TokenType LiteralParser<CharType>::Lexer::lexString(LiteralParserToken<CharType>& token)
 {
     ++m_ptr;
     const CharType* runStart = m_ptr;
-    while (m_ptr < m_end && isSafeStringCharacter<mode, CharType, terminator>(*m_ptr))
-        ++m_ptr;
+    m_ptr = skipSafeStringCharacters<mode, terminator>(m_ptr, m_end);
     if (LIKELY(m_ptr < m_end && *m_ptr == terminator)) {
         setParserTokenString<CharType>(token, runStart);
         token.stringLength = m_ptr - runStart;
@@ -568,6 +633,84 @@ TokenType LiteralParser<CharType>::Lexer::lexNumber(LiteralParserToken<CharType>
     return TokNumber;
 }
 
+namespace {
+
+// JSON documents tend to contain many objects with the same keys in the same order, e.g. an
+// array of records. ObjectShapeCache remembers the structure transitions taken while building
+// an object, keyed by its first property name, so that later objects with the same keys can
+// replay them instead of looking up a transition and checking the key for every property.
+struct ObjectShapeTransition {
+    UniquedStringImpl* uid;
+    Structure* structure;
+    PropertyOffset offset;
+};
+
+struct ObjectShape {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    Structure* initialStructure;
+    Vector<ObjectShapeTransition, 8> transitions;
+};
+
+struct ObjectShapeCursor {
+    explicit ObjectShapeCursor(Structure* initialStructure)
+        : initialStructure(initialStructure)
+    {
+    }
+
+    Structure* initialStructure;
+    // While non-null, the first propertyCount properties of the object matched this shape.
+    ObjectShape* replayedShape { nullptr };
+    unsigned propertyCount { 0 };
+    Vector<ObjectShapeTransition, 8> recordedTransitions;
+    bool isCacheable { true };
+};
+
+class ObjectShapeCache {
+public:
+    ObjectShape* find(UniquedStringImpl* firstPropertyUID, Structure* initialStructure)
+    {
+        if (!m_isEnabled)
+            return nullptr;
+        auto iterator = m_shapes.find(firstPropertyUID);
+        if (iterator == m_shapes.end() || iterator->value->initialStructure != initialStructure)
+            return nullptr;
+        return iterator->value.get();
+    }
+
+    void didFinishObject(JSObject* object, ObjectShapeCursor& cursor)
+    {
+        // A replayed shape is already cached, even if the object only used a prefix of it.
+        if (!m_isEnabled || !cursor.isCacheable || cursor.replayedShape || cursor.recordedTransitions.isEmpty())
+            return;
+        if (m_owners.size() >= maximumOwnerCount)
+            return;
+
+        UniquedStringImpl* firstPropertyUID = cursor.recordedTransitions[0].uid;
+        if (m_shapes.size() >= maximumShapeCount && !m_shapes.contains(firstPropertyUID))
+            return;
+
+        auto shape = std::make_unique<ObjectShape>();
+        shape->initialStructure = cursor.initialStructure;
+        shape->transitions = WTFMove(cursor.recordedTransitions);
+        m_shapes.set(firstPropertyUID, WTFMove(shape));
+
+        // The object's structure keeps every structure along its transition chain, and so
+        // every uid in the shape, alive.
+        m_owners.append(object);
+    }
+
+private:
+    static const unsigned maximumShapeCount = 64;
+    static const unsigned maximumOwnerCount = 256;
+
+    bool m_isEnabled { Options::useJSONObjectShapeCache() };
+    HashMap<UniquedStringImpl*, std::unique_ptr<ObjectShape>> m_shapes;
+    MarkedArgumentBuffer m_owners;
+};
+
+} // anonymous namespace
+
 template <typename CharType>
 JSValue LiteralParser<CharType>::parse(ParserState initialState)
 {
@@ -578,6 +721,8 @@ JSValue LiteralParser<CharType>::parse(ParserState initialState)
     JSValue lastValue;
     Vector<ParserState, 16, UnsafeVectorOverflow> stateStack;
     Vector<Identifier, 16, UnsafeVectorOverflow> identifierStack;
+    Vector<ObjectShapeCursor, 16> shapeCursorStack;
+    ObjectShapeCache shapeCache;
     HashSet<JSObject*> visitedUnderscoreProto;
     while (1) {
         switch(state) {
@@ -626,6 +771,7 @@ JSValue LiteralParser<CharType>::parse(ParserState initialState)
             case StartParseObject: {
                 JSObject* object = constructEmptyObject(m_exec);
                 objectStack.append(object);
+                shapeCursorStack.append(ObjectShapeCursor(object->structure(vm)));
 
                 TokenType type = m_lexer.next();
                 if (type == TokString || (m_mode != StrictJSON && type == TokIdentifier)) {
@@ -652,6 +798,7 @@ JSValue LiteralParser<CharType>::parse(ParserState initialState)
                 m_lexer.next();
                 lastValue = objectStack.last();
                 objectStack.removeLast();
+                shapeCursorStack.removeLast();
                 break;
             }
             doParseObjectStartExpression:
@@ -681,6 +828,33 @@ JSValue LiteralParser<CharType>::parse(ParserState initialState)
             {
                 JSObject* object = asObject(objectStack.last());
                 PropertyName ident = identifierStack.last();
+                ObjectShapeCursor& cursor = shapeCursorStack.last();
+                if (!cursor.propertyCount && cursor.initialStructure == object->structure(vm))
+                    cursor.replayedShape = shapeCache.find(ident.uid(), cursor.initialStructure);
+                if (cursor.replayedShape) {
+                    auto& transitions = cursor.replayedShape->transitions;
+                    if (cursor.propertyCount < transitions.size() && transitions[cursor.propertyCount].uid == ident.uid()) {
+                        // Cached shapes never contain __proto__ in sloppy mode or index properties,
+                        // so this is exactly the existing transition putDirect() would have found.
+                        const ObjectShapeTransition& transition = transitions[cursor.propertyCount];
+                        Structure* structure = object->structure(vm);
+                        ASSERT(structure == (cursor.propertyCount ? transitions[cursor.propertyCount - 1].structure : cursor.initialStructure));
+                        transition.structure->willStoreValueForExistingTransition(vm, ident, lastValue, false);
+                        size_t currentCapacity = structure->outOfLineCapacity();
+                        if (currentCapacity != transition.structure->outOfLineCapacity()) {
+                            Butterfly* newButterfly = object->allocateMoreOutOfLineStorage(vm, currentCapacity, transition.structure->outOfLineCapacity());
+                            object->nukeStructureAndSetButterfly(vm, object->structureID(), newButterfly);
+                        }
+                        object->putDirect(vm, transition.offset, lastValue);
+                        object->setStructure(vm, transition.structure);
+                        ++cursor.propertyCount;
+                        goto doParseObjectFinishProperty;
+                    }
+                    cursor.recordedTransitions.append(transitions.data(), cursor.propertyCount);
+                    cursor.replayedShape = nullptr;
+                }
+                ++cursor.propertyCount;
+
                 if (m_mode != StrictJSON && ident == vm.propertyNames->underscoreProto) {
                     if (!visitedUnderscoreProto.add(object).isNewEntry) {
                         m_parseErrorMessage = ASCIILiteral("Attempted to redefine __proto__ property");
@@ -689,12 +863,24 @@ JSValue LiteralParser<CharType>::parse(ParserState initialState)
                     CodeBlock* codeBlock = m_exec->codeBlock();
                     PutPropertySlot slot(object, codeBlock ? codeBlock->isStrictMode() : false);
                     objectStack.last().put(m_exec, ident, lastValue, slot);
+                    cursor.isCacheable = false;
                 } else {
-                    if (std::optional<uint32_t> index = parseIndex(ident))
+                    if (std::optional<uint32_t> index = parseIndex(ident)) {
                         object->putDirectIndex(m_exec, index.value(), lastValue);
-                    else
-                        object->putDirect(vm, ident, lastValue);
+                        cursor.isCacheable = false;
+                    } else {
+                        PutPropertySlot slot(object);
+                        object->putDirect(vm, ident, lastValue, slot);
+                        if (cursor.isCacheable) {
+                            Structure* structure = object->structure(vm);
+                            if (slot.type() == PutPropertySlot::NewProperty && !structure->isDictionary())
+                                cursor.recordedTransitions.append(ObjectShapeTransition { ident.uid(), structure, slot.cachedOffset() });
+                            else
+                                cursor.isCacheable = false;
+                        }
+                    }
                 }
+            doParseObjectFinishProperty:
                 identifierStack.removeLast();
                 if (m_lexer.currentToken()->type == TokComma)
                     goto doParseObjectStartExpression;
@@ -705,6 +891,8 @@ JSValue LiteralParser<CharType>::parse(ParserState initialState)
                 m_lexer.next();
                 lastValue = objectStack.last();
                 objectStack.removeLast();
+                shapeCache.didFinishObject(asObject(lastValue), shapeCursorStack.last());
+                shapeCursorStack.removeLast();
                 break;
             }
             startParseExpression:
@@ -115,6 +115,9 @@ typedef const char* optionString;
     v(bool, useJIT,    true, Normal, "allows the baseline JIT to be used if true") \
     v(bool, useDFGJIT, true, Normal, "allows the DFG JIT to be used if true") \
     v(bool, useRegExpJIT, true, Normal, "allows the RegExp JIT to be used if true") \
+    v(bool, useJSONObjectShapeCache, true, Normal, "lets JSON.parse replay the structure transitions of earlier objects that start with the same key") \
+    v(bool, useRegExpLeadingCharacterScan, true, Normal, "lets RegExp matching skip ahead to input positions holding a character or literal that every match must begin with") \
+    v(bool, reportRegExpInterpreterFallbacks, false, Normal, "dumps each RegExp that had to be matched by the interpreter while the RegExp JIT was enabled, with the reason and the number of matches") \
     v(bool, useDOMJIT, true, Normal, "allows the DOMJIT to be used if true") \
     \
     v(bool, reportMustSucceedExecutableAllocations, false, Normal, nullptr) \
@@ -184,6 +187,7 @@ typedef const char* optionString;
     v(bool, reportFTLCompileTimes, false, Normal, "dumps JS function signature and the time it took to FTL compile") \
     v(bool, reportDFGPhaseTimes, false, Normal, "dumps JS function name and the time is took for each DFG phase") \
     v(bool, reportTotalCompileTimes, false, Normal, nullptr) \
+    v(bool, reportInstructionStreamSizes, false, Normal, "Report the size of the packed unlinked instruction streams, and of the linked instructions they expand into, when the jsc shell exits.") \
     v(bool, verboseExitProfile, false, Normal, nullptr) \
     v(bool, verboseCFA, false, Normal, nullptr) \
     v(bool, verboseFTLToJSThunk, false, Normal, nullptr) \
@@ -194,6 +198,7 @@ typedef const char* optionString;
     v(bool, useGenerationalGC, true, Normal, nullptr) \
     v(bool, useConcurrentBarriers, true, Normal, nullptr) \
     v(bool, useConcurrentGC, true, Normal, nullptr) \
+    v(bool, useConcurrentSweeping, true, Normal, "Build free lists for blocks that don't need destruction on GC helper threads after a collection.") \
     v(bool, collectContinuously, false, Normal, nullptr) \
     v(double, collectContinuouslyPeriodMS, 1, Normal, nullptr) \
     v(bool, forceFencedBarrier, false, Normal, nullptr) \
@@ -365,8 +370,12 @@ typedef const char* optionString;
     v(bool, gcAtEnd, false, Normal, "If true, the jsc CLI will do a GC before exiting") \
     v(bool, forceGCSlowPaths, false, Normal, "If true, we will force all JIT fast allocations down their slow paths.")\
     v(unsigned, gcMaxHeapSize, 0, Normal, nullptr) \
+    v(unsigned, gcHardHeapLimit, 0, Normal, "if non-zero, caps the size of each VM's heap (marked space plus extra memory) in bytes") \
+    v(double, hardHeapLimitFullCollectionRatio, 0.75, Normal, "fraction of the hard heap limit above which every collection is a full collection") \
+    v(double, hardHeapLimitDeleteAllCodeRatio, 0.9, Normal, "fraction of the hard heap limit above which a full collection also throws away all compiled code") \
     v(unsigned, forceRAMSize, 0, Normal, nullptr) \
     v(bool, recordGCPauseTimes, false, Normal, nullptr) \
+    v(unsigned, gcEventLogSize, 32, Normal, "number of recent collection cycles each heap keeps a record of (0 = none)") \
     v(bool, logHeapStatisticsAtExit, false, Normal, nullptr) \
     v(bool, forceCodeBlockToJettisonDueToOldAge, false, Normal, "If true, this means that anytime we can jettison a CodeBlock due to old age, we do.") \
     v(bool, useEagerCodeBlockJettisonTiming, false, Normal, "If true, the time slices for jettisoning a CodeBlock due to old age are shrunk significantly.") \
@@ -439,12 +448,24 @@ typedef const char* optionString;
     \
     v(bool, useSourceProviderCache, true, Normal, "If false, the parser will not use the source provider cache. It's good to verify everything works when this is false. Because the cache is so successful, it can mask bugs.") \
     v(bool, useCodeCache, true, Normal, "If false, the unlinked byte code cache will not be used.") \
+    v(bool, useIntlFormatterCache, true, Normal, "If false, every Intl object opens its own ICU formatter or collator.") \
+    v(optionString, bytecodeCachePath, nullptr, Normal, "The directory where the bytecode of large programs is persisted and reused across VMs. The bytecode cache is disabled if unset.") \
+    v(unsigned, minimumBytecodeCacheSourceLength, 64 * KB, Normal, "Programs shorter than this are not persisted in the bytecode cache.") \
+    v(double, bytecodeCacheWriteDelay, 3, Normal, "Delay in seconds between the first run of a program and the write of its bytecode cache entry, so that it includes the functions called at startup.") \
+    v(unsigned, bytecodeCacheMaximumSize, 64 * MB, Normal, "When the files in bytecodeCachePath take more than this many bytes, the least recently used ones are deleted.") \
+    v(bool, verboseBytecodeCache, false, Normal, nullptr) \
+    v(bool, useBackgroundCodeGeneration, true, Normal, "If true, embedders may parse large programs and generate their bytecode on a background thread ahead of running them.") \
+    v(unsigned, minimumBackgroundCodeGenerationSourceLength, 32 * KB, Normal, "Programs shorter than this are compiled on the main thread when they run.") \
+    v(unsigned, numberOfBackgroundCodeGenerationThreads, 2, Normal, "The number of threads, each with a VM of its own, that generate bytecode in the background.") \
+    v(double, backgroundCodeGenerationIdleTime, 5, Normal, "Delay in seconds after which an idle background code generation thread destroys its VM.") \
+    v(bool, verboseBackgroundCodeGeneration, false, Normal, nullptr) \
     \
     v(bool, useWebAssembly, true, Normal, "Expose the WebAssembly global object.") \
     \
     v(bool, failToCompileWebAssemblyCode, false, Normal, "If true, no Wasm::Plan will sucessfully compile a function.") \
     v(size, webAssemblyPartialCompileLimit, 5000, Normal, "Limit on the number of bytes a Wasm::Plan::compile should attempt before checking for other work.") \
     v(unsigned, webAssemblyBBQOptimizationLevel, 1, Normal, "B3 Optimization level for BBQ Web Assembly module compilations.") \
+    v(unsigned, webAssemblyBBQLargeFunctionSize, 20000, Normal, "Functions whose body is at least this many bytes are compiled by BBQ at B3 optimization level 0 since they dominate module compile time. Hot ones still tier up to OMG.") \
     v(unsigned, webAssemblyOMGOptimizationLevel, Options::defaultB3OptLevel(), Normal, "B3 Optimization level for OMG Web Assembly module compilations.") \
     \
     v(unsigned, webAssemblyOMGTierUpCount, 5000, Normal, "The countdown before we tier up a function to OMG.") \
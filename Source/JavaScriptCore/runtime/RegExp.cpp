@@ -25,6 +25,7 @@
 
 #include "Lexer.h"
 #include "JSCInlines.h"
+#include "Options.h"
 #include "RegExpCache.h"
 #include "RegExpInlines.h"
 #include "Yarr.h"
@@ -234,6 +235,14 @@ void RegExp::destroy(JSCell* cell)
     RegExp* thisObject = static_cast<RegExp*>(cell);
 #if REGEXP_FUNC_TEST_DATA_GEN
     RegExpFunctionalTestCollector::get()->clearRegExp(this);
+#endif
+#if ENABLE(YARR_JIT)
+    if (Options::reportRegExpInterpreterFallbacks() && thisObject->m_interpreterFallbackCount) {
+        dataLog("RegExp /", thisObject->pattern(), "/ ran ", thisObject->m_interpreterFallbackCount, " matches in the interpreter");
+        if (auto failureReason = thisObject->jitFailureReason())
+            dataLog(" (", *failureReason, ")");
+        dataLog("\n");
+    }
 #endif
     thisObject->RegExp::~RegExp();
 }
@@ -281,11 +290,17 @@ void RegExp::compile(VM* vm, Yarr::YarrCharSize charSize)
     }
 
 #if ENABLE(YARR_JIT)
-    if (!pattern.m_containsBackreferences && !pattern.containsUnsignedLengthPattern() && !unicode() && vm->canUseRegExpJIT()) {
-        Yarr::jitCompile(pattern, charSize, vm, m_regExpJITCode);
-        if (!m_regExpJITCode.isFallBack()) {
-            m_state = JITCode;
-            return;
+    if (vm->canUseRegExpJIT()) {
+        if (unicode())
+            m_regExpJITCode.setFallBackWithFailureReason(Yarr::JITFailureReason::Unicode);
+        else if (pattern.containsUnsignedLengthPattern())
+            m_regExpJITCode.setFallBackWithFailureReason(Yarr::JITFailureReason::UnsignedLengthPattern);
+        else {
+            Yarr::jitCompile(pattern, charSize, vm, m_regExpJITCode);
+            if (!m_regExpJITCode.isFallBack()) {
+                m_state = JITCode;
+                return;
+            }
         }
     }
 #else
@@ -309,6 +324,12 @@ bool RegExp::matchConcurrently(
     if (!hasCodeFor(s.is8Bit() ? Yarr::Char8 : Yarr::Char16))
         return false;
 
+#if ENABLE(YARR_JIT)
+    // Falling back to the interpreter would need the lock we are holding.
+    if (m_state == JITCode && m_regExpJITCode.usesParenContextStack() && !m_regExpBytecode)
+        return false;
+#endif
+
     position = match(vm, s, startOffset, ovector);
     return true;
 }
@@ -334,11 +355,17 @@ void RegExp::compileMatchOnly(VM* vm, Yarr::YarrCharSize charSize)
     }
 
 #if ENABLE(YARR_JIT)
-    if (!pattern.m_containsBackreferences && !pattern.containsUnsignedLengthPattern() && !unicode() && vm->canUseRegExpJIT()) {
-        Yarr::jitCompile(pattern, charSize, vm, m_regExpJITCode, Yarr::MatchOnly);
-        if (!m_regExpJITCode.isFallBack()) {
-            m_state = JITCode;
-            return;
+    if (vm->canUseRegExpJIT()) {
+        if (unicode())
+            m_regExpJITCode.setFallBackWithFailureReason(Yarr::JITFailureReason::Unicode);
+        else if (pattern.containsUnsignedLengthPattern())
+            m_regExpJITCode.setFallBackWithFailureReason(Yarr::JITFailureReason::UnsignedLengthPattern);
+        else {
+            Yarr::jitCompile(pattern, charSize, vm, m_regExpJITCode, Yarr::MatchOnly);
+            if (!m_regExpJITCode.isFallBack()) {
+                m_state = JITCode;
+                return;
+            }
         }
     }
 #else
@@ -361,10 +388,48 @@ bool RegExp::matchConcurrently(VM& vm, const String& s, unsigned startOffset, Ma
     if (!hasMatchOnlyCodeFor(s.is8Bit() ? Yarr::Char8 : Yarr::Char16))
         return false;
 
+#if ENABLE(YARR_JIT)
+    // Falling back to the interpreter would need the lock we are holding.
+    if (m_state == JITCode && m_regExpJITCode.usesParenContextStack() && !m_regExpBytecode)
+        return false;
+#endif
+
     result = match(vm, s, startOffset);
     return true;
 }
 
+#if ENABLE(YARR_JIT)
+void RegExp::byteCodeCompileIfNecessary(VM* vm)
+{
+    if (m_regExpBytecode)
+        return;
+
+    ConcurrentJSLocker locker(m_lock);
+
+    Yarr::YarrPattern pattern(m_patternString, m_flags, &m_constructionError, vm->stackLimit());
+    if (m_constructionError) {
+        RELEASE_ASSERT_NOT_REACHED();
+#if COMPILER_QUIRK(CONSIDERS_UNREACHABLE_CODE)
+        m_state = ParseError;
+        return;
+#endif
+    }
+
+    m_regExpBytecode = Yarr::byteCompile(pattern, &vm->m_regExpAllocator, &vm->m_regExpAllocatorLock);
+}
+
+void RegExp::didFallBackToInterpreter(VM& vm)
+{
+    vm.regExpInterpreterFallbackMatchCount++;
+    if (!m_interpreterFallbackCount++ && Options::reportRegExpInterpreterFallbacks()) {
+        dataLog("RegExp /", pattern(), "/ fell back to the interpreter");
+        if (auto failureReason = jitFailureReason())
+            dataLog(" (", *failureReason, ")");
+        dataLog("\n");
+    }
+}
+#endif
+
 void RegExp::deleteCode()
 {
     ConcurrentJSLocker locker(m_lock);
@@ -89,6 +89,14 @@ public:
 
     void deleteCode();
 
+#if ENABLE(YARR_JIT)
+    // The number of matches run by the interpreter while the RegExp JIT was enabled, either
+    // because the JIT could not compile this pattern (see jitFailureReason()), or because
+    // its code gave up part way through a match.
+    unsigned interpreterFallbackCount() const { return m_interpreterFallbackCount; }
+    std::optional<Yarr::JITFailureReason> jitFailureReason() const { return m_regExpJITCode.failureReason(); }
+#endif
+
 #if ENABLE(REGEXP_TRACING)
     void printTraceData();
 #endif
@@ -126,6 +134,11 @@ private:
     void compileMatchOnly(VM*, Yarr::YarrCharSize);
     void compileIfNecessaryMatchOnly(VM&, Yarr::YarrCharSize);
 
+#if ENABLE(YARR_JIT)
+    void byteCodeCompileIfNecessary(VM*);
+    void didFallBackToInterpreter(VM&);
+#endif
+
 #if ENABLE(YARR_JIT_DEBUG)
     void matchCompareWithInterpreter(const String&, int startOffset, int* offsetVector, int jitResult);
 #endif
@@ -146,6 +159,7 @@ private:
 
 #if ENABLE(YARR_JIT)
     Yarr::YarrCodeBlock m_regExpJITCode;
+    unsigned m_interpreterFallbackCount { 0 };
 #endif
     std::unique_ptr<Yarr::BytecodePattern> m_regExpBytecode;
 };
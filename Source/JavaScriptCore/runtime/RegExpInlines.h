@@ -115,12 +115,27 @@ ALWAYS_INLINE int RegExp::matchInline(VM& vm, const String& s, unsigned startOff
             result = m_regExpJITCode.execute(s.characters8(), startOffset, s.length(), offsetVector).start;
         else
             result = m_regExpJITCode.execute(s.characters16(), startOffset, s.length(), offsetVector).start;
+
+        if (result == Yarr::JSRegExpJITCodeFailure) {
+            // The JIT code ran out of parentheses context space; finish this match in the interpreter.
+            byteCodeCompileIfNecessary(&vm);
+            vm.regExpJITCodeFailureCount++;
+            didFallBackToInterpreter(vm);
+            result = Yarr::interpret(m_regExpBytecode.get(), s, startOffset, reinterpret_cast<unsigned*>(offsetVector));
+        }
 #if ENABLE(YARR_JIT_DEBUG)
-        matchCompareWithInterpreter(s, startOffset, offsetVector, result);
+        else
+            matchCompareWithInterpreter(s, startOffset, offsetVector, result);
 #endif
     } else
+#endif
+    {
+#if ENABLE(YARR_JIT)
+        if (m_regExpJITCode.isFallBack())
+            didFallBackToInterpreter(vm);
 #endif
         result = Yarr::interpret(m_regExpBytecode.get(), s, startOffset, reinterpret_cast<unsigned*>(offsetVector));
+    }
 
     // FIXME: The YARR engine should handle unsigned or size_t length matches.
     // The YARR Interpreter is "unsigned" clean, while the YARR JIT hasn't been addressed.
@@ -203,12 +218,21 @@ ALWAYS_INLINE MatchResult RegExp::matchInline(VM& vm, const String& s, unsigned
         MatchResult result = s.is8Bit() ?
             m_regExpJITCode.execute(s.characters8(), startOffset, s.length()) :
             m_regExpJITCode.execute(s.characters16(), startOffset, s.length());
+        if (result.start != static_cast<size_t>(Yarr::JSRegExpJITCodeFailure)) {
 #if ENABLE(REGEXP_TRACING)
-        if (!result)
-            m_rtMatchOnlyFoundCount++;
+            if (!result)
+                m_rtMatchOnlyFoundCount++;
 #endif
-        return result;
+            return result;
+        }
+
+        // The JIT code ran out of parentheses context space; finish this match in the interpreter.
+        byteCodeCompileIfNecessary(&vm);
+        vm.regExpJITCodeFailureCount++;
     }
+
+    if (m_regExpJITCode.isFallBack() || m_state == JITCode)
+        didFallBackToInterpreter(vm);
 #endif
 
     int offsetVectorSize = (m_numSubpatterns + 1) * 2;
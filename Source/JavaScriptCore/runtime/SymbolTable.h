@@ -689,6 +689,9 @@ public:
     DECLARE_EXPORT_INFO;
 
 private:
+    friend class BytecodeCacheDecoder;
+    friend class BytecodeCacheEncoder;
+
     JS_EXPORT_PRIVATE SymbolTable(VM&);
     ~SymbolTable();
     
@@ -351,6 +351,7 @@ VM::VM(VMType vmType, HeapType heapType)
 VM::~VM()
 {
     promiseDeferredTimer->stopRunningTasks();
+    m_codeCache->willDestroyVM();
 #if ENABLE(WEBASSEMBLY)
     if (Wasm::existingWorklistOrNull())
         Wasm::ensureWorklist().stopAllPlansForVM(*this);
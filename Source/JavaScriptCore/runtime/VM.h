@@ -590,6 +590,11 @@ public:
     BumpPointerAllocator m_regExpAllocator;
     ConcurrentJSLock m_regExpAllocatorLock;
 
+    // Matches that the RegExp interpreter ran while the RegExp JIT was enabled, and how many of
+    // them were JIT code giving up part way through. WebKit reports both with its statistics.
+    uint64_t regExpInterpreterFallbackMatchCount { 0 };
+    uint64_t regExpJITCodeFailureCount { 0 };
+
     std::unique_ptr<HasOwnPropertyCache> m_hasOwnPropertyCache;
     ALWAYS_INLINE HasOwnPropertyCache* hasOwnPropertyCache() { return m_hasOwnPropertyCache.get(); }
     HasOwnPropertyCache* ensureHasOwnPropertyCache();
@@ -25,6 +25,7 @@
 #include "InitializeThreading.h"
 #include "JSCInlines.h"
 #include "JSGlobalObject.h"
+#include "Options.h"
 #include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -54,11 +55,13 @@ struct CommandLine {
     CommandLine()
         : interactive(false)
         , verbose(false)
+        , runJITVsInterpreterTests(false)
     {
     }
 
     bool interactive;
     bool verbose;
+    bool runJITVsInterpreterTests;
     Vector<String> arguments;
     Vector<String> files;
 };
@@ -485,6 +488,184 @@ static bool runFromFiles(GlobalObject* globalObject, const Vector<String>& files
     return success;
 }
 
+struct JITVsInterpreterTest {
+    const char* pattern;
+    const char* flags;
+    const char* subject;
+};
+
+// Patterns that the JIT compiles with generic parentheses or backreferences, so that its
+// results are checked against the interpreter's.
+static const JITVsInterpreterTest jitVsInterpreterTests[] = {
+    { "(a|b){2,5}", "", "ababab" },
+    { "(a|b){2,5}", "", "xaxbabx" },
+    { "(a|b){2,5}?c", "", "abababc" },
+    { "(a|bc){2,5}d", "", "abcbcad abcabcbcd" },
+    { "(A|b){2,}", "i", "xaBAbx" },
+    { "(\\w+)\\s\\1", "", "hello hello" },
+    { "(\\w+)\\s\\1", "", "hello help help" },
+    { "(\\w+)\\s\\1\\b", "i", "Abc ABC abcd ABCD" },
+    { "(?:(a)|b)*\\1c", "", "abac bac" },
+    { "((a|b)+c)+", "", "abcbaccabc" },
+    { "(a(b(c)?)*)+d", "", "abbcabcabd" },
+    { "((a)|(b))*?c", "", "abbac" },
+    { "(a*)*b", "", "aaab" },
+    { "(a*)*b", "", "aaa" },
+    { "(a*)+?b", "", "aab" },
+    { "(a|)*b", "", "aab" },
+    { "(()|a)+b", "", "aab" },
+    { "(?:a?)+?c", "", "aac" },
+    { "(?:(a)|b?)*c", "", "abac" },
+    { "((a?)*)*$", "", "aaa" },
+};
+
+// Patterns that run out of the JIT's parentheses context stack on a long subject, so that the
+// JIT code gives up and the match is finished by the interpreter.
+static const JITVsInterpreterTest parenContextStackExhaustionTests[] = {
+    { "(a|b)*c", "", nullptr },
+    { "(a|b)*?c", "", nullptr },
+    { "((a)|b)+c$", "", nullptr },
+    { "(a|b)*d", "", nullptr },
+};
+
+// Patterns whose matches must all begin with one of a few characters, or with a literal, so
+// that matching skips ahead to the next place one could begin. Their results are checked
+// against the interpreter with the scan disabled.
+static const JITVsInterpreterTest leadingCharacterScanTests[] = {
+    { "xyz|a", "", "bbbbba" },
+    { "xyz|a", "", "bbbbbxyz" },
+    { "xyz|a", "", "xyxyzb" },
+    { "abc", "", "ababababc" },
+    { "abcd|abd", "", "abcabdabcd" },
+    { "foo\\d+", "", "fo foo foo42" },
+    { "(?:foo|bar)\\d", "", "ba fo bar7" },
+    { "\\u2603|xyz", "", "abc xy" },
+    { "[a-c]x", "i", "dDbX cx" },
+    { "[A-C]X", "i", "ddbx Cx" },
+    { "[\xe0-\xe2]" "b", "i", "xx\xc0" "B" },
+    { "\\bfoo", "", "afoo xfoo foo" },
+    { "\\Bfoo", "", "foo afoo" },
+    { "\\bfoo\\b", "i", "FOOD FOO" },
+    { "^ab", "m", "xab\nab" },
+    { "^ab", "m", "ab" },
+    { "^ab", "", "xab\nab" },
+    { "^(?:ab|cd)", "m", "x\nxcd\ncd" },
+    { "a$", "m", "ab\nba\n" },
+    { "\\d{4}-\\d\\d", "", "12-3 2017-05" },
+    { "[&<>]", "", "abc&lt;<" },
+};
+
+static String make16BitString(const String& string, UChar prefix = 0)
+{
+    Vector<UChar> characters;
+    if (prefix)
+        characters.append(prefix);
+    for (unsigned i = 0; i < string.length(); ++i)
+        characters.append(string[i]);
+    return String(characters.data(), characters.size());
+}
+
+static int matchInVM(VM& vm, const JITVsInterpreterTest& test, bool useLeadingCharacterScan, const String& subject, unsigned offset, Vector<int>& ovector)
+{
+    JSLockHolder locker(vm);
+
+    // The scan is set up when the pattern is compiled, on its first match.
+    bool oldUseLeadingCharacterScan = Options::useRegExpLeadingCharacterScan();
+    Options::useRegExpLeadingCharacterScan() = useLeadingCharacterScan;
+    int result = RegExp::create(vm, test.pattern, regExpFlags(test.flags))->match(vm, subject, offset, ovector);
+    Options::useRegExpLeadingCharacterScan() = oldUseLeadingCharacterScan;
+    return result;
+}
+
+// Checks the JIT and the interpreter, both with the leading character scan, against the
+// interpreter without it.
+static bool testAgainstInterpreter(VM& jitVM, VM& interpreterVM, VM& referenceVM, const JITVsInterpreterTest& test, const String& subject, bool expectJITCodeFailure, bool verbose)
+{
+    RegExp* jitRegExp = RegExp::create(jitVM, test.pattern, regExpFlags(test.flags));
+    if (!jitRegExp->isValid()) {
+        printf("/%s/%s is not a valid regexp\n", test.pattern, test.flags);
+        return false;
+    }
+
+    bool result = true;
+    for (unsigned offset = 0; offset <= std::min(subject.length(), 1u); ++offset) {
+        Vector<int> referenceVector;
+        int referenceResult = matchInVM(referenceVM, test, false, subject, offset, referenceVector);
+
+        uint64_t jitCodeFailureCount = jitVM.regExpJITCodeFailureCount;
+        Vector<int> jitVector;
+        int jitResult = matchInVM(jitVM, test, true, subject, offset, jitVector);
+
+        Vector<int> interpreterVector;
+        int interpreterResult = matchInVM(interpreterVM, test, true, subject, offset, interpreterVector);
+
+        auto check = [&] (const char* engine, int engineResult, const Vector<int>& engineVector) {
+            if (engineResult == referenceResult && (engineResult == -1 || engineVector == referenceVector))
+                return;
+            result = false;
+            printf("/%s/%s at offset %u of a %u character %s-bit subject: %s returned %d, the interpreter without the leading character scan returned %d\n",
+                test.pattern, test.flags, offset, subject.length(), subject.is8Bit() ? "8" : "16", engine, engineResult, referenceResult);
+            if (verbose) {
+                for (size_t i = 0; i < engineVector.size() && i < referenceVector.size(); ++i)
+                    printf("  ovector[%u]: %d, expected %d\n", static_cast<unsigned>(i), engineVector[i], referenceVector[i]);
+            }
+        };
+        check("JIT", jitResult, jitVector);
+        check("interpreter", interpreterResult, interpreterVector);
+
+#if ENABLE(YARR_JIT_ALL_PARENS_EXPRESSIONS)
+        if (expectJITCodeFailure && jitVM.canUseRegExpJIT()) {
+            if (jitRegExp->jitFailureReason()) {
+                result = false;
+                printf("/%s/%s was not compiled by the JIT\n", test.pattern, test.flags);
+            } else if (jitVM.regExpJITCodeFailureCount == jitCodeFailureCount) {
+                result = false;
+                printf("/%s/%s did not run out of parentheses context space on a %u character subject\n", test.pattern, test.flags, subject.length());
+            }
+        }
+#else
+        UNUSED_PARAM(expectJITCodeFailure);
+        UNUSED_PARAM(jitCodeFailureCount);
+#endif
+    }
+    return result;
+}
+
+static bool runJITVsInterpreterTests(VM& jitVM, VM& interpreterVM, VM& referenceVM, bool verbose)
+{
+    unsigned tests = 0;
+    unsigned failures = 0;
+
+    // Each subject is also run as a 16-bit string, as is and after a U+2603 SNOWMAN.
+    auto run = [&] (const JITVsInterpreterTest& test, const String& subject, bool expectJITCodeFailure) {
+        for (const String& subjectToTest : { subject, make16BitString(subject), make16BitString(subject, 0x2603) }) {
+            ++tests;
+            if (!testAgainstInterpreter(jitVM, interpreterVM, referenceVM, test, subjectToTest, expectJITCodeFailure, verbose))
+                ++failures;
+        }
+    };
+
+    for (const auto& test : jitVsInterpreterTests)
+        run(test, String(test.subject), false);
+
+    for (const auto& test : leadingCharacterScanTests)
+        run(test, String(test.subject), false);
+
+    StringBuilder longSubject;
+    for (unsigned i = 0; i < 1024; ++i)
+        longSubject.appendLiteral("ab");
+    longSubject.append('c');
+    for (const auto& test : parenContextStackExhaustionTests)
+        run(test, longSubject.toString(), true);
+
+    if (failures)
+        printf("%u JIT vs. interpreter tests run, %u failures\n", tests, failures);
+    else
+        printf("%u JIT vs. interpreter tests passed\n", tests);
+
+    return !failures;
+}
+
 #define RUNNING_FROM_XCODE 0
 
 static NO_RETURN void printUsageStatement(bool help = false)
@@ -492,6 +673,7 @@ static NO_RETURN void printUsageStatement(bool help = false)
     fprintf(stderr, "Usage: regexp_test [options] file\n");
     fprintf(stderr, "  -h|--help  Prints this help message\n");
     fprintf(stderr, "  -v|--verbose  Verbose output\n");
+    fprintf(stderr, "  -d|--jit-vs-interpreter  Also checks the RegExp JIT and the leading character scan against the interpreter on built-in tests\n");
 
     exit(help ? EXIT_SUCCESS : EXIT_FAILURE);
 }
@@ -505,6 +687,8 @@ static void parseArguments(int argc, char** argv, CommandLine& options)
             printUsageStatement(true);
         if (!strcmp(arg, "-v") || !strcmp(arg, "--verbose"))
             options.verbose = true;
+        else if (!strcmp(arg, "-d") || !strcmp(arg, "--jit-vs-interpreter"))
+            options.runJITVsInterpreterTests = true;
         else
             options.files.append(argv[i]);
     }
@@ -524,6 +708,17 @@ int realMain(int argc, char** argv)
     GlobalObject* globalObject = GlobalObject::create(*vm, GlobalObject::createStructure(*vm, jsNull()), options.arguments);
     bool success = runFromFiles(globalObject, options.files, options.verbose);
 
+    if (options.runJITVsInterpreterTests) {
+        bool useRegExpJIT = Options::useRegExpJIT();
+        Options::useRegExpJIT() = false;
+        VM* interpreterVM = &VM::create(LargeHeap).leakRef();
+        VM* referenceVM = &VM::create(LargeHeap).leakRef();
+        Options::useRegExpJIT() = useRegExpJIT;
+
+        if (!runJITVsInterpreterTests(*vm, *interpreterVM, *referenceVM, options.verbose))
+            success = false;
+    }
+
     return success ? 0 : 3;
 }
 
@@ -61,6 +61,7 @@
 #include "WasmOpcodeOrigin.h"
 #include "WasmThunks.h"
 #include <limits>
+#include <wtf/MonotonicTime.h>
 #include <wtf/Optional.h>
 #include <wtf/StdLibExtras.h>
 
@@ -1468,9 +1469,24 @@ Expected<std::unique_ptr<WasmInternalFunction>, String> parseAndCompile(Compilat
     // optLevel=1.
     procedure.setNeedsUsedRegisters(false);
     
-    procedure.setOptLevel(compilationMode == CompilationMode::BBQMode
-        ? Options::webAssemblyBBQOptimizationLevel()
-        : Options::webAssemblyOMGOptimizationLevel());
+    unsigned optLevel;
+    if (compilationMode == CompilationMode::BBQMode) {
+        // Very large functions are where BBQ spends most of its time, mostly in B3 strength
+        // reduction and Air's block ordering passes. Compile them at -O0 without the late Air
+        // optimizations so they start running sooner, and let the tier up counter send the hot
+        // ones to OMG.
+        optLevel = Options::webAssemblyBBQOptimizationLevel();
+        if (functionLength >= Options::webAssemblyBBQLargeFunctionSize()) {
+            optLevel = 0;
+            procedure.setNeedsLateAirOptimizations(false);
+        }
+    } else
+        optLevel = Options::webAssemblyOMGOptimizationLevel();
+    procedure.setOptLevel(optLevel);
+
+    MonotonicTime startTime;
+    if (Options::reportCompileTimes())
+        startTime = MonotonicTime::now();
 
     B3IRGenerator context(info, procedure, result.get(), unlinkedWasmToWasmCalls, mode, compilationMode, functionIndex, tierUp);
     FunctionParser<B3IRGenerator> parser(context, functionStart, functionLength, signature, info);
@@ -1495,6 +1511,11 @@ Expected<std::unique_ptr<WasmInternalFunction>, String> parseAndCompile(Compilat
 
     if (compilationMode == CompilationMode::BBQMode)
         createJSToWasmWrapper(compilationContext, *result, signature, info, mode, functionIndex, &unlinkedWasmToWasmCalls);
+
+    if (Options::reportCompileTimes()) {
+        dataLogLn("Took ", (MonotonicTime::now() - startTime).microseconds(), " us to compile wasm function[", functionIndex, "] (",
+            functionLength, " bytes) in ", compilationMode == CompilationMode::BBQMode ? "BBQ" : "OMG", " mode at -O", optLevel);
+    }
     return WTFMove(result);
 }
 
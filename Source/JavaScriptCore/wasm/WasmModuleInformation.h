@@ -55,7 +55,8 @@ struct ModuleInformation : public ThreadSafeRefCounted<ModuleInformation> {
 
     JS_EXPORT_PRIVATE ~ModuleInformation();
 
-    const Vector<uint8_t> source;
+    // Filled in by the StreamingCompiler only once the last chunk of a streamed module has arrived.
+    Vector<uint8_t> source;
 
     Vector<Import> imports;
     Vector<SignatureIndex> importFunctionSignatureIndices;
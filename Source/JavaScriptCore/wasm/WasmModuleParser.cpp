@@ -75,20 +75,7 @@ auto ModuleParser::parse() -> Result
 
         auto end = m_offset + sectionLength;
 
-        switch (section) {
-#define WASM_SECTION_PARSE(NAME, ID, DESCRIPTION)                   \
-        case Section::NAME: {                                       \
-            WASM_FAIL_IF_HELPER_FAILS(parse ## NAME());             \
-            break;                                                  \
-        }
-        FOR_EACH_WASM_SECTION(WASM_SECTION_PARSE)
-#undef WASM_SECTION_PARSE
-
-        case Section::Custom: {
-            WASM_FAIL_IF_HELPER_FAILS(parseCustom(sectionLength));
-            break;
-        }
-        }
+        WASM_FAIL_IF_HELPER_FAILS(parseSection(section, sectionLength));
 
         WASM_PARSER_FAIL_IF(end != m_offset, "parsing ended before the end of ", section, " section");
 
@@ -98,6 +85,34 @@ auto ModuleParser::parse() -> Result
     return { };
 }
 
+auto ModuleParser::parseSectionPayload(Section section) -> PartialResult
+{
+    WASM_PARSER_FAIL_IF(length() > std::numeric_limits<uint32_t>::max(), section, " section of size ", length(), " is too large");
+    WASM_FAIL_IF_HELPER_FAILS(parseSection(section, length()));
+    WASM_PARSER_FAIL_IF(m_offset != length(), "parsing ended before the end of ", section, " section");
+    return { };
+}
+
+auto ModuleParser::parseSection(Section section, uint32_t sectionLength) -> PartialResult
+{
+    switch (section) {
+#define WASM_SECTION_PARSE(NAME, ID, DESCRIPTION)                   \
+    case Section::NAME: {                                           \
+        WASM_FAIL_IF_HELPER_FAILS(parse ## NAME());                 \
+        break;                                                      \
+    }
+    FOR_EACH_WASM_SECTION(WASM_SECTION_PARSE)
+#undef WASM_SECTION_PARSE
+
+    case Section::Custom: {
+        WASM_FAIL_IF_HELPER_FAILS(parseCustom(sectionLength));
+        break;
+    }
+    }
+
+    return { };
+}
+
 auto ModuleParser::parseType() -> PartialResult
 {
     uint32_t count;
@@ -252,9 +267,7 @@ auto ModuleParser::parseResizableLimits(uint32_t& initial, std::optional<uint32_
 
 auto ModuleParser::parseTableHelper(bool isImport) -> PartialResult
 {
-    WASM_PARSER_FAIL_IF(m_hasTable, "Table section cannot exist if an Import has a table");
-
-    m_hasTable = true;
+    WASM_PARSER_FAIL_IF(!!m_info->tableInformation, "Table section cannot exist if an Import has a table");
 
     int8_t type;
     WASM_PARSER_FAIL_IF(!parseInt7(type), "can't parse Table type");
@@ -385,7 +398,7 @@ auto ModuleParser::parseExport() -> PartialResult
             break;
         }
         case ExternalKind::Table: {
-            WASM_PARSER_FAIL_IF(!m_hasTable, "can't export a non-existent Table");
+            WASM_PARSER_FAIL_IF(!m_info->tableInformation, "can't export a non-existent Table");
             WASM_PARSER_FAIL_IF(kindIndex, "can't export Table ", kindIndex, " only zero-index Table is currently supported");
             break;
         }
@@ -422,7 +435,7 @@ auto ModuleParser::parseStart() -> PartialResult
 
 auto ModuleParser::parseElement() -> PartialResult
 {
-    WASM_PARSER_FAIL_IF(!m_hasTable, "Element section expects a Table to be present");
+    WASM_PARSER_FAIL_IF(!m_info->tableInformation, "Element section expects a Table to be present");
 
     uint32_t elementCount;
     WASM_PARSER_FAIL_IF(!parseVarUInt32(elementCount), "can't get Element section's count");
@@ -466,7 +479,7 @@ auto ModuleParser::parseCode() -> PartialResult
     uint32_t count;
     WASM_PARSER_FAIL_IF(!parseVarUInt32(count), "can't get Code section's count");
     WASM_PARSER_FAIL_IF(count == std::numeric_limits<uint32_t>::max(), "Code section's count is too big ", count);
-    WASM_PARSER_FAIL_IF(count != m_info->functionLocationInBinary.size(), "Code section count ", count, " exceeds the declared number of functions ", m_info->functionLocationInBinary.size());
+    WASM_PARSER_FAIL_IF(count != m_info->functionLocationInBinary.size(), "Code section count ", count, " doesn't match the Function section count ", m_info->functionLocationInBinary.size());
 
     for (uint32_t i = 0; i < count; ++i) {
         uint32_t functionSize;
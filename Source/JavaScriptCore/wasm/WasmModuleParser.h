@@ -30,6 +30,7 @@
 #include "WasmFormat.h"
 #include "WasmOps.h"
 #include "WasmParser.h"
+#include "WasmSections.h"
 #include <wtf/Optional.h>
 #include <wtf/Vector.h>
 
@@ -45,7 +46,12 @@ public:
 
     Result WARN_UNUSED_RETURN parse();
 
+    // Parses a single section whose payload spans this parser's whole buffer. The streaming
+    // parser uses this to parse each section as soon as all of its bytes have arrived.
+    PartialResult WARN_UNUSED_RETURN parseSectionPayload(Section);
+
 private:
+    PartialResult WARN_UNUSED_RETURN parseSection(Section, uint32_t sectionLength);
 
 #define WASM_SECTION_DECLARE_PARSER(NAME, ID, DESCRIPTION) PartialResult WARN_UNUSED_RETURN parse ## NAME();
     FOR_EACH_WASM_SECTION(WASM_SECTION_DECLARE_PARSER)
@@ -59,7 +65,6 @@ private:
     PartialResult WARN_UNUSED_RETURN parseInitExpr(uint8_t&, uint64_t&, Type& initExprType);
 
     Ref<ModuleInformation> m_info;
-    bool m_hasTable { false };
 };
 
 } } // namespace JSC::Wasm
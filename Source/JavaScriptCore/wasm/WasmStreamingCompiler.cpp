@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "WasmStreamingCompiler.h"
+
+#if ENABLE(WEBASSEMBLY)
+
+#include "JSCInlines.h"
+#include "WasmModuleInformation.h"
+#include "WasmPlan.h"
+#include "WasmSignature.h"
+#include "WasmValidate.h"
+#include "WasmWorklist.h"
+#include <wtf/Locker.h>
+#include <wtf/text/StringConcatenate.h>
+
+namespace JSC { namespace Wasm {
+
+static const bool verbose = false;
+
+// Validates the bodies of a contiguous range of functions. The bodies are a copy of the part of
+// the module that holds them, since the streaming parser's buffer keeps growing while this runs.
+// The module information is shared with the parser, which by now only appends the sections that
+// follow Code, none of which validation reads.
+class StreamingValidationPlan final : public Plan {
+public:
+    using Base = Plan;
+
+    StreamingValidationPlan(VM& vm, Ref<ModuleInformation> info, Vector<uint8_t>&& bodies, size_t bodiesOffset, uint32_t firstFunctionIndex, uint32_t endFunctionIndex, CompletionTask&& task)
+        : Base(&vm, WTFMove(info), WTFMove(task))
+        , m_bodies(WTFMove(bodies))
+        , m_bodiesOffset(bodiesOffset)
+        , m_firstFunctionIndex(firstFunctionIndex)
+        , m_endFunctionIndex(endFunctionIndex)
+    {
+    }
+
+    bool hasWork() const override { return !m_isComplete; }
+    bool multiThreaded() const override { return false; }
+
+    void work(CompilationEffort) override
+    {
+        for (uint32_t functionIndex = m_firstFunctionIndex; functionIndex < m_endFunctionIndex; ++functionIndex) {
+            const auto& location = m_moduleInformation->functionLocationInBinary[functionIndex];
+            ASSERT(location.start >= m_bodiesOffset && location.end - m_bodiesOffset <= m_bodies.size());
+            const Signature& signature = SignatureInformation::get(m_moduleInformation->internalFunctionSignatureIndices[functionIndex]);
+            auto validationResult = validateFunction(m_bodies.data() + location.start - m_bodiesOffset, location.end - location.start, signature, m_moduleInformation.get());
+            if (!validationResult) {
+                Base::fail(holdLock(m_lock), makeString(validationResult.error(), ", in function at index ", String::number(functionIndex)));
+                return;
+            }
+        }
+        complete(holdLock(m_lock));
+    }
+
+private:
+    bool isComplete() const override { return m_isComplete; }
+    void complete(const AbstractLocker& locker) override
+    {
+        m_isComplete = true;
+        runCompletionTasks(locker);
+    }
+
+    Vector<uint8_t> m_bodies;
+    size_t m_bodiesOffset;
+    uint32_t m_firstFunctionIndex;
+    uint32_t m_endFunctionIndex;
+    bool m_isComplete { false };
+};
+
+Ref<StreamingCompiler> StreamingCompiler::create(VM& vm, Module::AsyncValidationCallback&& callback)
+{
+    return adoptRef(*new StreamingCompiler(vm, WTFMove(callback)));
+}
+
+StreamingCompiler::StreamingCompiler(VM& vm, Module::AsyncValidationCallback&& callback)
+    : m_vm(vm)
+    , m_info(adoptRef(*new ModuleInformation(Vector<uint8_t>())))
+    , m_parser(m_info.get())
+    , m_callback(WTFMove(callback))
+{
+}
+
+StreamingCompiler::~StreamingCompiler()
+{
+}
+
+void StreamingCompiler::addBytes(const uint8_t* bytes, size_t length)
+{
+    {
+        auto locker = holdLock(m_lock);
+        ASSERT(!m_finalized);
+        if (!m_callback)
+            return;
+    }
+
+    if (m_parser.addBytes(bytes, length) == StreamingParser::State::FatalError) {
+        fail(String(m_parser.errorMessage()));
+        return;
+    }
+    dispatchCompletedFunctions();
+}
+
+void StreamingCompiler::finalize()
+{
+    {
+        auto locker = holdLock(m_lock);
+        if (!m_callback)
+            return;
+    }
+
+    if (m_parser.finalize() == StreamingParser::State::FatalError) {
+        fail(String(m_parser.errorMessage()));
+        return;
+    }
+    dataLogLnIf(verbose, "Finished streaming ", m_parser.bytes().size(), " bytes, ", m_info->functionLocationInBinary.size(), " functions");
+
+    Module::AsyncValidationCallback callback;
+    {
+        auto locker = holdLock(m_lock);
+        m_finalized = true;
+        callback = takeCallbackIfComplete(locker);
+    }
+    runCallback(WTFMove(callback));
+}
+
+void StreamingCompiler::fail(String&& errorMessage)
+{
+    Module::AsyncValidationCallback callback;
+    {
+        auto locker = holdLock(m_lock);
+        recordFailure(locker, WTFMove(errorMessage));
+        callback = takeCallbackIfComplete(locker);
+    }
+    runCallback(WTFMove(callback));
+}
+
+void StreamingCompiler::dispatchCompletedFunctions()
+{
+    uint32_t completedFunctionCount = m_parser.completedFunctionCount();
+    if (completedFunctionCount == m_dispatchedFunctionCount)
+        return;
+
+    const auto& functionLocations = m_info->functionLocationInBinary;
+    size_t start = functionLocations[m_dispatchedFunctionCount].start;
+    size_t end = functionLocations[completedFunctionCount - 1].end;
+    Vector<uint8_t> bodies;
+    if (!bodies.tryAppend(m_parser.bytes().data() + start, end - start)) {
+        fail(ASCIILiteral("can't allocate enough memory to validate the module's functions"));
+        return;
+    }
+
+    dataLogLnIf(verbose, "Dispatching functions [", m_dispatchedFunctionCount, ", ", completedFunctionCount, ") for validation");
+    Ref<Plan> plan = adoptRef(*new StreamingValidationPlan(m_vm, m_info.copyRef(), WTFMove(bodies), start, m_dispatchedFunctionCount, completedFunctionCount,
+        createSharedTask<Plan::CallbackType>([protectedThis = makeRef(*this)] (VM*, Plan& plan) {
+            protectedThis->didCompleteValidationPlan(plan);
+        })));
+    m_dispatchedFunctionCount = completedFunctionCount;
+
+    {
+        auto locker = holdLock(m_lock);
+        ++m_pendingPlanCount;
+    }
+    ensureWorklist().enqueue(WTFMove(plan));
+}
+
+void StreamingCompiler::didCompleteValidationPlan(Plan& plan)
+{
+    Module::AsyncValidationCallback callback;
+    {
+        auto locker = holdLock(m_lock);
+        ASSERT(m_pendingPlanCount);
+        --m_pendingPlanCount;
+        if (plan.failed())
+            recordFailure(locker, String(plan.errorMessage()));
+        callback = takeCallbackIfComplete(locker);
+    }
+    runCallback(WTFMove(callback));
+}
+
+void StreamingCompiler::recordFailure(const AbstractLocker&, String&& errorMessage)
+{
+    if (!m_callback || !m_errorMessage.isNull())
+        return;
+    m_errorMessage = WTFMove(errorMessage);
+}
+
+Module::AsyncValidationCallback StreamingCompiler::takeCallbackIfComplete(const AbstractLocker&)
+{
+    // A failure is reported right away, without waiting for the batches still being validated.
+    if (m_errorMessage.isNull() && (!m_finalized || m_pendingPlanCount))
+        return nullptr;
+    return WTFMove(m_callback);
+}
+
+void StreamingCompiler::runCallback(Module::AsyncValidationCallback&& callback)
+{
+    if (!callback)
+        return;
+
+    if (!m_errorMessage.isNull()) {
+        callback->run(m_vm, UnexpectedType<String>(m_errorMessage));
+        return;
+    }
+
+    m_info->source = m_parser.takeBytes();
+    callback->run(m_vm, Module::ValidationResult(Module::create(m_info.copyRef())));
+}
+
+} } // namespace JSC::Wasm
+
+#endif // ENABLE(WEBASSEMBLY)
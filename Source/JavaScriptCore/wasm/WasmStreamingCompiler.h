@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#if ENABLE(WEBASSEMBLY)
+
+#include "WasmModule.h"
+#include "WasmStreamingParser.h"
+#include <wtf/Lock.h>
+#include <wtf/ThreadSafeRefCounted.h>
+
+namespace JSC {
+
+class VM;
+
+namespace Wasm {
+
+class Plan;
+
+// Validates a module while its bytes are still arriving. Function bodies are handed to the
+// Worklist in batches, one batch per chunk, as soon as their Code section entries are complete.
+// The callback runs exactly once, either from finalize() or from the Worklist thread that
+// validates the last batch, with the same result Module::validateAsync would have produced.
+class StreamingCompiler final : public ThreadSafeRefCounted<StreamingCompiler> {
+public:
+    JS_EXPORT_PRIVATE static Ref<StreamingCompiler> create(VM&, Module::AsyncValidationCallback&&);
+    JS_EXPORT_PRIVATE ~StreamingCompiler();
+
+    // These must be called from the thread that owns the VM.
+    JS_EXPORT_PRIVATE void addBytes(const uint8_t*, size_t);
+    JS_EXPORT_PRIVATE void finalize();
+    JS_EXPORT_PRIVATE void fail(String&& errorMessage);
+
+private:
+    StreamingCompiler(VM&, Module::AsyncValidationCallback&&);
+
+    void dispatchCompletedFunctions();
+    void didCompleteValidationPlan(Plan&);
+    void recordFailure(const AbstractLocker&, String&& errorMessage);
+    Module::AsyncValidationCallback takeCallbackIfComplete(const AbstractLocker&);
+    void runCallback(Module::AsyncValidationCallback&&);
+
+    VM& m_vm;
+    Ref<ModuleInformation> m_info;
+    StreamingParser m_parser;
+    Module::AsyncValidationCallback m_callback;
+    uint32_t m_dispatchedFunctionCount { 0 };
+
+    Lock m_lock;
+    unsigned m_pendingPlanCount { 0 };
+    bool m_finalized { false };
+    String m_errorMessage;
+};
+
+} } // namespace JSC::Wasm
+
+#endif // ENABLE(WEBASSEMBLY)
@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "WasmStreamingParser.h"
+
+#if ENABLE(WEBASSEMBLY)
+
+#include "WasmLimits.h"
+#include "WasmModuleParser.h"
+#include "WasmOps.h"
+#include <wtf/LEBDecoder.h>
+#include <wtf/text/StringConcatenate.h>
+
+namespace JSC { namespace Wasm {
+
+static const size_t moduleHeaderSize = 8;
+static const size_t maxVarUInt32ByteLength = 5;
+
+StreamingParser::StreamingParser(ModuleInformation& info)
+    : m_info(info)
+{
+}
+
+auto StreamingParser::fail(String&& errorMessage) -> State
+{
+    m_errorMessage = makeString(ASCIILiteral("WebAssembly.Module doesn't parse at byte "), String::number(m_offset), ASCIILiteral(": "), errorMessage);
+    m_state = State::FatalError;
+    return m_state;
+}
+
+auto StreamingParser::consumeVarUInt32(uint32_t& result, size_t limit) -> ConsumeResult
+{
+    size_t offset = m_offset;
+    if (WTF::LEBDecoder::decodeUInt32(m_buffer.data(), limit, offset, result)) {
+        m_offset = offset;
+        return ConsumeResult::Done;
+    }
+    // An unterminated LEB that may still be completed by the next chunk.
+    if (limit == m_buffer.size() && limit - m_offset < maxVarUInt32ByteLength)
+        return ConsumeResult::NeedMoreBytes;
+    return ConsumeResult::Malformed;
+}
+
+void StreamingParser::finishSection()
+{
+    m_previousSection = m_section;
+    m_offset = m_sectionEnd;
+    m_state = State::SectionID;
+}
+
+auto StreamingParser::addBytes(const uint8_t* bytes, size_t length) -> State
+{
+    ASSERT(m_state != State::Finished);
+    if (m_state == State::FatalError)
+        return m_state;
+
+    if (length > maxModuleSize - m_buffer.size())
+        return fail(makeString(ASCIILiteral("module size "), String::number(m_buffer.size() + length), ASCIILiteral(" is too large, maximum "), String::number(maxModuleSize)));
+    if (!m_buffer.tryAppend(bytes, length))
+        return fail(ASCIILiteral("can't allocate enough memory for the module's bytes"));
+
+    while (true) {
+        size_t available = m_buffer.size() - m_offset;
+
+        switch (m_state) {
+        case State::ModuleHeader: {
+            if (available < moduleHeaderSize)
+                return m_state;
+            const uint8_t* header = m_buffer.data();
+            if (header[0] || header[1] != 'a' || header[2] != 's' || header[3] != 'm')
+                return fail(ASCIILiteral("modules doesn't start with '\\0asm'"));
+            uint32_t versionNumber = header[4] | header[5] << 8 | header[6] << 16 | static_cast<uint32_t>(header[7]) << 24;
+            if (versionNumber != expectedVersionNumber)
+                return fail(makeString(ASCIILiteral("unexpected version number "), String::number(versionNumber), ASCIILiteral(" expected "), String::number(expectedVersionNumber)));
+            m_offset = moduleHeaderSize;
+            m_state = State::SectionID;
+            break;
+        }
+
+        case State::SectionID: {
+            if (!available)
+                return m_state;
+            uint8_t sectionByte = m_buffer[m_offset];
+            if (sectionByte & 0x80)
+                return fail(ASCIILiteral("can't get section byte"));
+            m_section = Section::Custom;
+            if (sectionByte && isValidSection(sectionByte))
+                m_section = static_cast<Section>(sectionByte);
+            if (!validateOrder(m_previousSection, m_section))
+                return fail(makeString(ASCIILiteral("invalid section order, "), makeString(m_previousSection), ASCIILiteral(" followed by "), makeString(m_section)));
+            ++m_offset;
+            m_state = State::SectionSize;
+            break;
+        }
+
+        case State::SectionSize: {
+            uint32_t sectionLength;
+            switch (consumeVarUInt32(sectionLength, m_buffer.size())) {
+            case ConsumeResult::NeedMoreBytes:
+                return m_state;
+            case ConsumeResult::Malformed:
+                return fail(makeString(ASCIILiteral("can't get "), makeString(m_section), ASCIILiteral(" section's length")));
+            case ConsumeResult::Done:
+                break;
+            }
+            if (sectionLength > maxModuleSize - m_offset)
+                return fail(makeString(makeString(m_section), ASCIILiteral(" section of size "), String::number(sectionLength), ASCIILiteral(" would overflow the maximum module size")));
+            m_sectionEnd = m_offset + sectionLength;
+            m_state = m_section == Section::Code ? State::CodeSectionCount : State::SectionPayload;
+            break;
+        }
+
+        case State::SectionPayload: {
+            if (m_buffer.size() < m_sectionEnd)
+                return m_state;
+            ModuleParser parser(m_buffer.data() + m_offset, m_sectionEnd - m_offset, m_info.get());
+            auto result = parser.parseSectionPayload(m_section);
+            if (!result) {
+                // The section parser reports offsets relative to the start of the section.
+                m_errorMessage = makeString(result.error(), ASCIILiteral(", in the "), makeString(m_section), ASCIILiteral(" section starting at byte "), String::number(m_offset));
+                m_state = State::FatalError;
+                return m_state;
+            }
+            finishSection();
+            break;
+        }
+
+        case State::CodeSectionCount: {
+            uint32_t count;
+            switch (consumeVarUInt32(count, std::min(m_buffer.size(), m_sectionEnd))) {
+            case ConsumeResult::NeedMoreBytes:
+                return m_state;
+            case ConsumeResult::Malformed:
+                return fail(ASCIILiteral("can't get Code section's count"));
+            case ConsumeResult::Done:
+                break;
+            }
+            if (count != m_info->functionLocationInBinary.size())
+                return fail(makeString(ASCIILiteral("Code section count "), String::number(count), ASCIILiteral(" doesn't match the Function section count "), String::number(m_info->functionLocationInBinary.size())));
+            m_functionCount = count;
+            m_functionIndex = 0;
+            if (!m_functionCount) {
+                if (m_offset != m_sectionEnd)
+                    return fail(ASCIILiteral("parsing ended before the end of Code section"));
+                finishSection();
+                break;
+            }
+            m_state = State::FunctionSize;
+            break;
+        }
+
+        case State::FunctionSize: {
+            switch (consumeVarUInt32(m_functionSize, std::min(m_buffer.size(), m_sectionEnd))) {
+            case ConsumeResult::NeedMoreBytes:
+                return m_state;
+            case ConsumeResult::Malformed:
+                return fail(makeString(ASCIILiteral("can't get "), String::number(m_functionIndex), ASCIILiteral("th Code function's size")));
+            case ConsumeResult::Done:
+                break;
+            }
+            if (m_functionSize > m_sectionEnd - m_offset)
+                return fail(makeString(ASCIILiteral("Code function's size "), String::number(m_functionSize), ASCIILiteral(" exceeds the Code section's remaining size "), String::number(m_sectionEnd - m_offset)));
+            m_state = State::FunctionPayload;
+            break;
+        }
+
+        case State::FunctionPayload: {
+            if (available < m_functionSize)
+                return m_state;
+            m_info->functionLocationInBinary[m_functionIndex].start = m_offset;
+            m_info->functionLocationInBinary[m_functionIndex].end = m_offset + m_functionSize;
+            m_offset += m_functionSize;
+            if (++m_functionIndex < m_functionCount) {
+                m_state = State::FunctionSize;
+                break;
+            }
+            if (m_offset != m_sectionEnd)
+                return fail(ASCIILiteral("parsing ended before the end of Code section"));
+            finishSection();
+            break;
+        }
+
+        case State::Finished:
+        case State::FatalError:
+            return m_state;
+        }
+    }
+}
+
+auto StreamingParser::finalize() -> State
+{
+    switch (m_state) {
+    case State::ModuleHeader:
+        return fail(makeString(ASCIILiteral("expected a module of at least "), String::number(moduleHeaderSize), ASCIILiteral(" bytes")));
+    case State::SectionID:
+        ASSERT(m_offset == m_buffer.size());
+        if (m_functionIndex != m_info->functionLocationInBinary.size())
+            return fail(makeString(ASCIILiteral("module declares "), String::number(m_info->functionLocationInBinary.size()), ASCIILiteral(" functions but has no Code section")));
+        m_state = State::Finished;
+        return m_state;
+    case State::SectionSize:
+    case State::SectionPayload:
+    case State::CodeSectionCount:
+    case State::FunctionSize:
+    case State::FunctionPayload:
+        return fail(makeString(makeString(m_section), ASCIILiteral(" section ends past the end of the module")));
+    case State::Finished:
+    case State::FatalError:
+        break;
+    }
+    return m_state;
+}
+
+} } // namespace JSC::Wasm
+
+#endif // ENABLE(WEBASSEMBLY)
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#if ENABLE(WEBASSEMBLY)
+
+#include "WasmModuleInformation.h"
+#include "WasmSections.h"
+#include <wtf/Vector.h>
+#include <wtf/text/WTFString.h>
+
+namespace JSC { namespace Wasm {
+
+// Parses a module whose bytes arrive in chunks, e.g. from the network. Every section but Code is
+// parsed by a ModuleParser as soon as all of its bytes have arrived. The Code section is parsed one
+// function body at a time so that each body can be validated and compiled before the rest of the
+// module has been downloaded.
+class StreamingParser {
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    enum class State : uint8_t {
+        ModuleHeader,
+        SectionID,
+        SectionSize,
+        SectionPayload,
+        CodeSectionCount,
+        FunctionSize,
+        FunctionPayload,
+        Finished,
+        FatalError,
+    };
+
+    JS_EXPORT_PRIVATE StreamingParser(ModuleInformation&);
+
+    JS_EXPORT_PRIVATE State addBytes(const uint8_t*, size_t);
+    JS_EXPORT_PRIVATE State finalize();
+
+    State state() const { return m_state; }
+    const String& errorMessage() const { return m_errorMessage; }
+
+    // The bodies of functions [0, completedFunctionCount()) are all in bytes(), at the offsets
+    // recorded in the ModuleInformation's functionLocationInBinary.
+    uint32_t completedFunctionCount() const { return m_functionIndex; }
+    const Vector<uint8_t>& bytes() const { return m_buffer; }
+    Vector<uint8_t> takeBytes() { return WTFMove(m_buffer); }
+
+private:
+    enum class ConsumeResult : uint8_t { Done, NeedMoreBytes, Malformed };
+    ConsumeResult consumeVarUInt32(uint32_t&, size_t limit);
+
+    void finishSection();
+    State fail(String&&);
+
+    Ref<ModuleInformation> m_info;
+    Vector<uint8_t> m_buffer;
+    size_t m_offset { 0 };
+    size_t m_sectionEnd { 0 };
+    uint32_t m_functionSize { 0 };
+    uint32_t m_functionCount { 0 };
+    uint32_t m_functionIndex { 0 };
+    Section m_section { Section::Custom };
+    Section m_previousSection { Section::Custom };
+    State m_state { State::ModuleHeader };
+    String m_errorMessage;
+};
+
+} } // namespace JSC::Wasm
+
+#endif // ENABLE(WEBASSEMBLY)
@@ -31,6 +31,8 @@
 #include "Exception.h"
 #include "FunctionPrototype.h"
 #include "JSCInlines.h"
+#include "JSNativeStdFunction.h"
+#include "JSPromise.h"
 #include "JSPromiseDeferred.h"
 #include "JSWebAssemblyHelpers.h"
 #include "JSWebAssemblyInstance.h"
@@ -39,6 +41,7 @@
 #include "PromiseDeferredTimer.h"
 #include "StrongInlines.h"
 #include "WasmBBQPlan.h"
+#include "WasmStreamingCompiler.h"
 #include "WasmWorklist.h"
 #include "WebAssemblyInstanceConstructor.h"
 #include "WebAssemblyModuleConstructor.h"
@@ -50,6 +53,8 @@ namespace JSC {
 static EncodedJSValue JSC_HOST_CALL webAssemblyCompileFunc(ExecState*);
 static EncodedJSValue JSC_HOST_CALL webAssemblyInstantiateFunc(ExecState*);
 static EncodedJSValue JSC_HOST_CALL webAssemblyValidateFunc(ExecState*);
+static EncodedJSValue JSC_HOST_CALL webAssemblyCompileStreamingFunc(ExecState*);
+static EncodedJSValue JSC_HOST_CALL webAssemblyInstantiateStreamingFunc(ExecState*);
 }
 
 #include "WebAssemblyPrototype.lut.h"
@@ -60,9 +65,11 @@ const ClassInfo WebAssemblyPrototype::s_info = { "WebAssembly.prototype", &Base:
 
 /* Source for WebAssemblyPrototype.lut.h
  @begin prototypeTableWebAssembly
- compile     webAssemblyCompileFunc     DontEnum|Function 1
- instantiate webAssemblyInstantiateFunc DontEnum|Function 1
- validate    webAssemblyValidateFunc    DontEnum|Function 1
+ compile              webAssemblyCompileFunc              DontEnum|Function 1
+ instantiate          webAssemblyInstantiateFunc          DontEnum|Function 1
+ validate             webAssemblyValidateFunc             DontEnum|Function 1
+ compileStreaming     webAssemblyCompileStreamingFunc     DontEnum|Function 1
+ instantiateStreaming webAssemblyInstantiateStreamingFunc DontEnum|Function 1
  @end
  */
 
@@ -107,7 +114,7 @@ static EncodedJSValue JSC_HOST_CALL webAssemblyCompileFunc(ExecState* exec)
     return JSValue::encode(promise->promise());
 }
 
-enum class Resolve { WithInstance, WithModuleAndInstance };
+enum class Resolve { WithInstance, WithModuleAndInstance, WithModule };
 static void resolve(VM& vm, ExecState* exec, JSPromiseDeferred* promise, JSWebAssemblyInstance* instance, JSWebAssemblyModule* module, Ref<Wasm::CodeBlock>&& codeBlock, Resolve resolveKind)
 {
     auto scope = DECLARE_CATCH_SCOPE(vm);
@@ -117,6 +124,7 @@ static void resolve(VM& vm, ExecState* exec, JSPromiseDeferred* promise, JSWebAs
         return;
     }
 
+    ASSERT(resolveKind != Resolve::WithModule);
     if (resolveKind == Resolve::WithInstance)
         promise->resolve(exec, instance);
     else {
@@ -218,6 +226,123 @@ static EncodedJSValue JSC_HOST_CALL webAssemblyValidateFunc(ExecState* exec)
     return JSValue::encode(jsBoolean(plan.parseAndValidateModule()));
 }
 
+static void compileStreaming(VM& vm, ExecState* exec, JSPromiseDeferred* promise, JSValue source, JSObject* importObject, Resolve resolveKind)
+{
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+    auto* globalObject = exec->lexicalGlobalObject();
+
+    // The source is usually the promise returned by fetch(), so start streaming once it settles.
+    if (auto* sourcePromise = jsDynamicCast<JSPromise*>(vm, source)) {
+        Strong<JSPromiseDeferred> strongPromise(vm, promise);
+        Strong<JSObject> strongImportObject(vm, importObject);
+        JSFunction* fulfillHandler = JSNativeStdFunction::create(vm, globalObject, 1, String(), [strongPromise, strongImportObject, resolveKind] (ExecState* exec) {
+            compileStreaming(exec->vm(), exec, strongPromise.get(), exec->argument(0), strongImportObject.get(), resolveKind);
+            return JSValue::encode(jsUndefined());
+        });
+        JSFunction* rejectHandler = JSNativeStdFunction::create(vm, globalObject, 1, String(), [strongPromise] (ExecState* exec) {
+            strongPromise->reject(exec, exec->argument(0));
+            return JSValue::encode(jsUndefined());
+        });
+
+        JSValue then = sourcePromise->get(exec, vm.propertyNames->then);
+        if (scope.exception()) {
+            reject(exec, scope, promise);
+            return;
+        }
+        CallData callData;
+        CallType callType = getCallData(then, callData);
+        if (callType == CallType::None) {
+            promise->reject(exec, createTypeError(exec, ASCIILiteral("WebAssembly streaming source's then is not a function")));
+            return;
+        }
+        MarkedArgumentBuffer arguments;
+        arguments.append(fulfillHandler);
+        arguments.append(rejectHandler);
+        call(exec, then, callType, callData, sourcePromise, arguments);
+        if (scope.exception())
+            reject(exec, scope, promise);
+        return;
+    }
+
+    Vector<Strong<JSCell>> dependencies;
+    dependencies.append(Strong<JSCell>(vm, globalObject));
+    if (importObject)
+        dependencies.append(Strong<JSCell>(vm, importObject));
+    vm.promiseDeferredTimer->addPendingPromise(promise, WTFMove(dependencies));
+
+    Ref<Wasm::StreamingCompiler> compiler = Wasm::StreamingCompiler::create(vm, createSharedTask<Wasm::Module::CallbackType>([promise, importObject, globalObject, resolveKind] (VM& vm, Wasm::Module::ValidationResult&& result) mutable {
+        vm.promiseDeferredTimer->scheduleWorkSoon(promise, [promise, importObject, globalObject, resolveKind, result = WTFMove(result), &vm] () mutable {
+            auto scope = DECLARE_CATCH_SCOPE(vm);
+            ExecState* exec = globalObject->globalExec();
+            JSWebAssemblyModule* module = JSWebAssemblyModule::createStub(vm, exec, globalObject->WebAssemblyModuleStructure(), WTFMove(result));
+            if (scope.exception()) {
+                reject(exec, scope, promise);
+                return;
+            }
+
+            if (resolveKind == Resolve::WithModuleAndInstance)
+                instantiate(vm, exec, promise, module, importObject, Resolve::WithModuleAndInstance);
+            else
+                promise->resolve(exec, module);
+        });
+    }));
+
+    // The embedder feeds the compiler as the source's bytes arrive. It throws before feeding
+    // anything if the source can't be streamed.
+    if (auto streamWebAssemblySource = globalObject->globalObjectMethodTable()->streamWebAssemblySource) {
+        streamWebAssemblySource(globalObject, exec, source, WTFMove(compiler));
+        if (scope.exception()) {
+            vm.promiseDeferredTimer->cancelPendingPromise(promise);
+            reject(exec, scope, promise);
+        }
+        return;
+    }
+
+    // Without an embedder there is nothing to stream from, but buffers still take the streaming path.
+    Vector<uint8_t> bytes = createSourceBufferFromValue(vm, exec, source);
+    if (scope.exception()) {
+        vm.promiseDeferredTimer->cancelPendingPromise(promise);
+        reject(exec, scope, promise);
+        return;
+    }
+    compiler->addBytes(bytes.data(), bytes.size());
+    compiler->finalize();
+}
+
+static EncodedJSValue JSC_HOST_CALL webAssemblyCompileStreamingFunc(ExecState* exec)
+{
+    VM& vm = exec->vm();
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+
+    JSPromiseDeferred* promise = JSPromiseDeferred::create(exec, exec->lexicalGlobalObject());
+    RETURN_IF_EXCEPTION(scope, encodedJSValue());
+
+    compileStreaming(vm, exec, promise, exec->argument(0), nullptr, Resolve::WithModule);
+
+    return JSValue::encode(promise->promise());
+}
+
+static EncodedJSValue JSC_HOST_CALL webAssemblyInstantiateStreamingFunc(ExecState* exec)
+{
+    VM& vm = exec->vm();
+    auto scope = DECLARE_CATCH_SCOPE(vm);
+
+    JSPromiseDeferred* promise = JSPromiseDeferred::create(exec, exec->lexicalGlobalObject());
+    RETURN_IF_EXCEPTION(scope, encodedJSValue());
+
+    JSValue importArgument = exec->argument(1);
+    JSObject* importObject = importArgument.getObject();
+    if (!importArgument.isUndefined() && !importObject) {
+        promise->reject(exec, createTypeError(exec,
+            ASCIILiteral("second argument to WebAssembly.instantiateStreaming must be undefined or an Object"), defaultSourceAppender, runtimeTypeForValue(importArgument)));
+        return JSValue::encode(promise->promise());
+    }
+
+    compileStreaming(vm, exec, promise, exec->argument(0), importObject, Resolve::WithModuleAndInstance);
+
+    return JSValue::encode(promise->promise());
+}
+
 WebAssemblyPrototype* WebAssemblyPrototype::create(VM& vm, JSGlobalObject*, Structure* structure)
 {
     auto* object = new (NotNull, allocateCell<WebAssemblyPrototype>(vm.heap)) WebAssemblyPrototype(vm, structure);
@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include "ArrayBuffer.h"
+#include "Completion.h"
+#include "Exception.h"
+#include "InitializeThreading.h"
+#include "JSArrayBuffer.h"
+#include "JSCInlines.h"
+#include "JSGlobalObject.h"
+#include "JSLock.h"
+#include "SourceCode.h"
+#include "VM.h"
+#include <limits>
+#include <wtf/CurrentTime.h>
+#include <wtf/MainThread.h>
+#include <wtf/text/StringBuilder.h>
+
+using namespace JSC;
+
+namespace {
+
+StaticLock crashLock;
+
+#define CHECK(x) do {                                                   \
+        if (!!(x))                                                      \
+            break;                                                      \
+        crashLock.lock();                                               \
+        WTFReportAssertionFailure(__FILE__, __LINE__, WTF_PRETTY_FUNCTION, #x); \
+        CRASH();                                                        \
+    } while (false)
+
+void appendVarUInt32(Vector<uint8_t>& bytes, uint32_t value)
+{
+    do {
+        uint8_t byte = value & 0x7f;
+        value >>= 7;
+        if (value)
+            byte |= 0x80;
+        bytes.append(byte);
+    } while (value);
+}
+
+void appendSection(Vector<uint8_t>& bytes, uint8_t id, const Vector<uint8_t>& payload)
+{
+    bytes.append(id);
+    appendVarUInt32(bytes, payload.size());
+    bytes.appendVector(payload);
+}
+
+// Function i, exported as "fi", takes an iteration count and runs a loop whose body is a long
+// straight line of i32 arithmetic on a local, like the large functions emitted by compilers for
+// unrolled or inlined code. Each statement is 10 bytes, so a function is about 10 * statementCount
+// bytes long.
+Vector<uint8_t> makeModule(unsigned functionCount, unsigned statementCount)
+{
+    Vector<uint8_t> module({ 0x00, 'a', 's', 'm', 0x01, 0x00, 0x00, 0x00 });
+
+    // (param i32) (result i32)
+    appendSection(module, 0x01, Vector<uint8_t>({ 0x01, 0x60, 0x01, 0x7f, 0x01, 0x7f }));
+
+    Vector<uint8_t> functions;
+    appendVarUInt32(functions, functionCount);
+    for (unsigned i = 0; i < functionCount; ++i)
+        functions.append(0x00);
+    appendSection(module, 0x03, functions);
+
+    Vector<uint8_t> exports;
+    appendVarUInt32(exports, functionCount);
+    for (unsigned i = 0; i < functionCount; ++i) {
+        CString name = makeString("f", String::number(i)).utf8();
+        appendVarUInt32(exports, name.length());
+        exports.append(reinterpret_cast<const uint8_t*>(name.data()), name.length());
+        exports.append(0x00);
+        appendVarUInt32(exports, i);
+    }
+    appendSection(module, 0x07, exports);
+
+    Vector<uint8_t> code;
+    appendVarUInt32(code, functionCount);
+    for (unsigned i = 0; i < functionCount; ++i) {
+        Vector<uint8_t> body({ 0x01, 0x01, 0x7f }); // One i32 local.
+        body.appendVector(Vector<uint8_t>({ 0x02, 0x40, 0x03, 0x40 })); // block, loop
+        body.appendVector(Vector<uint8_t>({ 0x20, 0x00, 0x45, 0x0d, 0x01 })); // br_if 1 (i32.eqz (get_local 0))
+        for (unsigned j = 0; j < statementCount; ++j) {
+            // set_local 1 (i32.mul (i32.xor (get_local 1) (i32.const c)) (i32.const 3))
+            uint8_t constant = (j * 7 + i) % 64;
+            body.appendVector(Vector<uint8_t>({ 0x20, 0x01, 0x41, constant, 0x73, 0x41, 0x03, 0x6c, 0x21, 0x01 }));
+        }
+        body.appendVector(Vector<uint8_t>({ 0x20, 0x00, 0x41, 0x01, 0x6b, 0x21, 0x00 })); // set_local 0 (i32.sub (get_local 0) (i32.const 1))
+        body.appendVector(Vector<uint8_t>({ 0x0c, 0x00, 0x0b, 0x0b })); // br 0, end loop, end block
+        body.appendVector(Vector<uint8_t>({ 0x20, 0x01, 0x0b })); // get_local 1, end
+        appendVarUInt32(code, body.size());
+        code.appendVector(body);
+    }
+    appendSection(module, 0x0a, code);
+    return module;
+}
+
+struct Configuration {
+    const char* name;
+    bool compileLargeFunctionsAtO0;
+    bool tierUp;
+};
+
+const Configuration configurations[] = {
+    { "BBQ -O1", false, false },
+    { "BBQ -O0", true, false },
+    { "BBQ -O1 with tier up", false, true },
+    { "BBQ -O0 with tier up", true, true },
+};
+
+// Compiles the module and calls every function in a fresh VM. Compile time is what delays the
+// first call; the run time is what code that never gets hot enough for OMG pays.
+int32_t run(const Configuration& configuration, const Vector<uint8_t>& module, unsigned functionCount, unsigned iterations, unsigned repetitions)
+{
+    Options::webAssemblyBBQLargeFunctionSize() = configuration.compileLargeFunctionsAtO0 ? 0 : std::numeric_limits<unsigned>::max();
+    // Without decrements, the tier up counts never reach zero.
+    Options::webAssemblyLoopDecrement() = configuration.tierUp ? 15 : 0;
+    Options::webAssemblyFunctionEntryDecrement() = configuration.tierUp ? 1 : 0;
+
+    StringBuilder builder;
+    builder.appendLiteral("var instance = new WebAssembly.Instance(module);\n");
+    builder.appendLiteral("var checksum = 0;\n");
+    builder.appendLiteral("for (var r = 0; r < ");
+    builder.appendNumber(repetitions);
+    builder.appendLiteral("; ++r) {\n");
+    builder.appendLiteral("    for (var i = 0; i < ");
+    builder.appendNumber(functionCount);
+    builder.appendLiteral("; ++i)\n");
+    builder.appendLiteral("        checksum = (checksum * 31 + instance.exports['f' + i](");
+    builder.appendNumber(iterations);
+    builder.appendLiteral(")) | 0;\n");
+    builder.appendLiteral("}\n");
+    builder.appendLiteral("checksum;\n");
+    String runScript = builder.toString();
+
+    VM* vm = &VM::create(LargeHeap).leakRef();
+    int32_t result;
+    {
+        JSLockHolder locker(vm);
+        JSGlobalObject* globalObject = JSGlobalObject::create(*vm, JSGlobalObject::createStructure(*vm, jsNull()));
+        ExecState* exec = globalObject->globalExec();
+        JSArrayBuffer* bytes = JSArrayBuffer::create(*vm, globalObject->arrayBufferStructure(ArrayBufferSharingMode::Default), ArrayBuffer::create(module.data(), module.size()));
+        globalObject->putDirect(*vm, Identifier::fromString(vm, "bytes"), bytes);
+
+        double before = monotonicallyIncreasingTimeMS();
+        NakedPtr<Exception> exception;
+        evaluate(exec, makeSource("var module = new WebAssembly.Module(bytes);", SourceOrigin(), ASCIILiteral("compile.js")), JSValue(), exception);
+        double afterCompile = monotonicallyIncreasingTimeMS();
+        CHECK(!exception);
+
+        JSValue value = evaluate(exec, makeSource(runScript, SourceOrigin(), ASCIILiteral("run.js")), JSValue(), exception);
+        double after = monotonicallyIncreasingTimeMS();
+        CHECK(!exception);
+        CHECK(value.isInt32());
+        result = value.asInt32();
+        dataLog(configuration.name, ": compiled in ", afterCompile - before, " ms, ran in ", after - afterCompile, " ms.\n");
+
+        vm->deref();
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    unsigned functionCount = 8;
+    unsigned statementCount = 5000;
+    unsigned iterations = 2000;
+    unsigned repetitions = 5;
+    if (argc >= 2) {
+        if (argc != 5
+            || sscanf(argv[1], "%u", &functionCount) != 1
+            || sscanf(argv[2], "%u", &statementCount) != 1
+            || sscanf(argv[3], "%u", &iterations) != 1
+            || sscanf(argv[4], "%u", &repetitions) != 1) {
+            dataLog("Usage: wasmtierbench [<function count> <statements per function> <loop iterations> <repetitions>]\n");
+            return 1;
+        }
+    }
+
+    Options::initialize();
+    WTF::initializeMainThread();
+    JSC::initializeThreading();
+
+    Vector<uint8_t> module = makeModule(functionCount, statementCount);
+    dataLog("Module size: ", module.size(), " bytes, ", functionCount, " functions.\n");
+
+    int32_t expected = run(configurations[0], module, functionCount, iterations, repetitions);
+    for (unsigned i = 1; i < WTF_ARRAY_LENGTH(configurations); ++i)
+        CHECK(run(configurations[i], module, functionCount, iterations, repetitions) == expected);
+
+    return 0;
+}
@@ -47,13 +47,18 @@ static const unsigned offsetNoMatch = std::numeric_limits<unsigned>::max();
 // avoid spending exponential time on complex regular expressions.
 static const unsigned matchLimit = 1000000;
 
+// Longest literal prefix YarrPattern records for skipping ahead to possible matches; it
+// keeps the interpreter's skip distances within a byte.
+static const unsigned maximumLeadingLiteralLength = 32;
+
 enum JSRegExpResult {
     JSRegExpMatch = 1,
     JSRegExpNoMatch = 0,
     JSRegExpErrorNoMatch = -1,
     JSRegExpErrorHitLimit = -2,
     JSRegExpErrorNoMemory = -3,
-    JSRegExpErrorInternal = -4
+    JSRegExpErrorInternal = -4,
+    JSRegExpJITCodeFailure = -5
 };
 
 enum YarrCharSize {
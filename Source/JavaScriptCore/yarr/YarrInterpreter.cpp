@@ -244,6 +244,13 @@ public:
             return result;
         }
 
+        // Unlike reread(), never decodes surrogate pairs; used only for non-unicode patterns.
+        CharType at(unsigned p)
+        {
+            ASSERT(p < length);
+            return input[p];
+        }
+
         int prev()
         {
             ASSERT(!(pos > length));
@@ -336,6 +343,46 @@ public:
         return false;
     }
 
+    // Moves the input position forwards to the next position at which a match could begin,
+    // going by the pattern's leading literal or else its leading character class. Returns
+    // false if there is no such position.
+    bool advanceToStartCandidate()
+    {
+        if (!pattern->m_leadingCharacterClass)
+            return true;
+
+        unsigned position = input.getPos();
+        unsigned length = input.end();
+
+        const Vector<UChar>& literal = pattern->m_leadingLiteral;
+        if (unsigned literalLength = literal.size()) {
+            UChar lastCharacter = literal[literalLength - 1];
+            while (literalLength <= length - position) {
+                CharType ch = input.at(position + literalLength - 1);
+                if (ch == lastCharacter) {
+                    unsigned i = 0;
+                    while (i < literalLength - 1 && input.at(position + i) == literal[i])
+                        ++i;
+                    if (i == literalLength - 1) {
+                        input.setPos(position);
+                        return true;
+                    }
+                }
+                position += (ch >> 8) ? literalLength : pattern->m_leadingLiteralShifts[ch];
+            }
+            return false;
+        }
+
+        for (; position < length; ++position) {
+            CharType ch = input.at(position);
+            if (isASCII(ch) ? pattern->m_leadingASCIICharacters.test(ch) : (pattern->m_leadingCharacterClassHasNonASCII && testCharacterClass(pattern->m_leadingCharacterClass, ch))) {
+                input.setPos(position);
+                return true;
+            }
+        }
+        return false;
+    }
+
     bool checkCharacter(int testChar, unsigned negativeInputOffset)
     {
         return testChar == input.readChecked(negativeInputOffset);
@@ -1405,6 +1452,8 @@ public:
                 return JSRegExpNoMatch;
 
             input.next();
+            if (!advanceToStartCandidate())
+                return JSRegExpNoMatch;
 
             context->matchBegin = input.getPos();
 
@@ -1542,7 +1591,9 @@ public:
 
         DisjunctionContext* context = allocDisjunctionContext(pattern->m_body.get());
 
-        JSRegExpResult result = matchDisjunction(pattern->m_body.get(), context, false);
+        JSRegExpResult result = JSRegExpNoMatch;
+        if (advanceToStartCandidate())
+            result = matchDisjunction(pattern->m_body.get(), context, false);
         if (result == JSRegExpMatch) {
             output[0] = context->matchBegin;
             output[1] = context->matchEnd;
@@ -1833,15 +1884,26 @@ public:
         bool capture = parenthesesBegin.capture();
         unsigned subpatternId = parenthesesBegin.atom.subpatternId;
 
+        // YarrPattern lays the disjunction's frame out after the parentheses' own frame, which is what
+        // the JIT wants. Each iteration gets a frame of its own here, so start it at zero instead.
+        unsigned frameBase = m_bodyDisjunction->terms[beginTerm + 1].frameLocation;
+        ASSERT(callFrameSize >= frameBase);
+
         unsigned numSubpatterns = lastSubpatternId - subpatternId + 1;
-        auto parenthesesDisjunction = std::make_unique<ByteDisjunction>(numSubpatterns, callFrameSize);
+        auto parenthesesDisjunction = std::make_unique<ByteDisjunction>(numSubpatterns, callFrameSize - frameBase);
 
         unsigned firstTermInParentheses = beginTerm + 1;
         parenthesesDisjunction->terms.reserveInitialCapacity(endTerm - firstTermInParentheses + 2);
 
         parenthesesDisjunction->terms.append(ByteTerm::SubpatternBegin());
-        for (unsigned termInParentheses = firstTermInParentheses; termInParentheses < endTerm; ++termInParentheses)
+        for (unsigned termInParentheses = firstTermInParentheses; termInParentheses < endTerm; ++termInParentheses) {
             parenthesesDisjunction->terms.append(m_bodyDisjunction->terms[termInParentheses]);
+            // Terms that use the frame are all in the disjunction's part of it; the others don't
+            // care about their frameLocation.
+            ByteTerm& term = parenthesesDisjunction->terms.last();
+            if (term.frameLocation >= frameBase)
+                term.frameLocation -= frameBase;
+        }
         parenthesesDisjunction->terms.append(ByteTerm::SubpatternEnd());
 
         m_bodyDisjunction->terms.shrink(beginTerm);
@@ -2009,7 +2071,7 @@ public:
                     } else {
                         ASSERT(currentCountAlreadyChecked >= term.inputPosition);
                         unsigned delegateEndInputOffset = currentCountAlreadyChecked - term.inputPosition;
-                        atomParenthesesSubpatternBegin(term.parentheses.subpatternId, term.capture(), disjunctionAlreadyCheckedCount + delegateEndInputOffset, term.frameLocation, 0);
+                        atomParenthesesSubpatternBegin(term.parentheses.subpatternId, term.capture(), disjunctionAlreadyCheckedCount + delegateEndInputOffset, term.frameLocation, term.frameLocation + YarrStackSpaceForBackTrackInfoParentheses);
                         emitDisjunction(term.parentheses.disjunction, currentCountAlreadyChecked, 0);
                         atomParenthesesSubpatternEnd(term.parentheses.lastSubpatternId, delegateEndInputOffset, term.frameLocation, term.quantityMinCount, term.quantityMaxCount, term.quantityType, term.parentheses.disjunction->m_callFrameSize);
                     }
@@ -2054,6 +2116,29 @@ private:
     Vector<std::unique_ptr<ByteDisjunction>> m_allParenthesesInfo;
 };
 
+void BytecodePattern::setupLeadingCharacters(YarrPattern& pattern)
+{
+    m_leadingCharacterClass = pattern.m_leadingCharacterClass;
+    if (!m_leadingCharacterClass)
+        return;
+
+    for (UChar32 ch : m_leadingCharacterClass->m_matches)
+        m_leadingASCIICharacters.set(ch);
+    for (const CharacterRange& range : m_leadingCharacterClass->m_ranges) {
+        for (UChar32 ch = range.begin; ch <= range.end; ++ch)
+            m_leadingASCIICharacters.set(ch);
+    }
+    m_leadingCharacterClassHasNonASCII = m_leadingCharacterClass->m_matchesUnicode.size() || m_leadingCharacterClass->m_rangesUnicode.size();
+
+    m_leadingLiteral = pattern.m_leadingLiteral;
+    if (unsigned literalLength = m_leadingLiteral.size()) {
+        ASSERT(literalLength <= maximumLeadingLiteralLength);
+        m_leadingLiteralShifts.fill(literalLength);
+        for (unsigned i = 0; i < literalLength - 1; ++i)
+            m_leadingLiteralShifts[m_leadingLiteral[i]] = literalLength - 1 - i;
+    }
+}
+
 std::unique_ptr<BytecodePattern> byteCompile(YarrPattern& pattern, BumpPointerAllocator* allocator, ConcurrentJSLock* lock)
 {
     return ByteCompiler(pattern).compile(allocator, lock);
@@ -27,6 +27,8 @@
 
 #include "ConcurrentJSLock.h"
 #include "YarrPattern.h"
+#include <array>
+#include <bitset>
 
 namespace WTF {
 class BumpPointerAllocator;
@@ -363,6 +365,8 @@ public:
 
         m_userCharacterClasses.swap(pattern.m_userCharacterClasses);
         m_userCharacterClasses.shrinkToFit();
+
+        setupLeadingCharacters(pattern);
     }
 
     size_t estimatedSizeInBytes() const { return m_body->estimatedSizeInBytes(); }
@@ -382,7 +386,18 @@ public:
     CharacterClass* newlineCharacterClass;
     CharacterClass* wordcharCharacterClass;
 
+    // Taken from the YarrPattern, with lookup tables for skipping ahead to the next input
+    // position where a match could begin: the ASCII members of the leading character class,
+    // and the Horspool shift for each Latin-1 character ending a window of the leading literal.
+    CharacterClass* m_leadingCharacterClass { nullptr };
+    std::bitset<128> m_leadingASCIICharacters;
+    bool m_leadingCharacterClassHasNonASCII { false };
+    Vector<UChar> m_leadingLiteral;
+    std::array<uint8_t, 256> m_leadingLiteralShifts;
+
 private:
+    void setupLeadingCharacters(YarrPattern&);
+
     Vector<std::unique_ptr<ByteDisjunction>> m_allParenthesesInfo;
     Vector<std::unique_ptr<CharacterClass>> m_userCharacterClasses;
 };
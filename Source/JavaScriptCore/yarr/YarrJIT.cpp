@@ -61,6 +61,9 @@ class YarrGenerator : private MacroAssembler {
 
     static const RegisterID regT0 = ARM64Registers::x4;
     static const RegisterID regT1 = ARM64Registers::x5;
+#if ENABLE(YARR_JIT_BACKREFERENCES)
+    static const RegisterID regT2 = ARM64Registers::x6;
+#endif
 
     static const RegisterID returnRegister = ARM64Registers::x0;
     static const RegisterID returnRegister2 = ARM64Registers::x1;
@@ -104,6 +107,9 @@ class YarrGenerator : private MacroAssembler {
 
     static const RegisterID regT0 = X86Registers::eax;
     static const RegisterID regT1 = X86Registers::ebx;
+#if ENABLE(YARR_JIT_BACKREFERENCES)
+    static const RegisterID regT2 = X86Registers::r10;
+#endif
 
     static const RegisterID returnRegister = X86Registers::eax;
     static const RegisterID returnRegister2 = X86Registers::edx;
@@ -340,6 +346,11 @@ class YarrGenerator : private MacroAssembler {
         poke(imm, frameLocation);
     }
 
+    void storeToFrame(TrustedImmPtr imm, unsigned frameLocation)
+    {
+        poke(imm, frameLocation);
+    }
+
     DataLabelPtr storeToFrameWithPatch(unsigned frameLocation)
     {
         return storePtrWithPatch(TrustedImmPtr(0), Address(stackPointerRegister, frameLocation * sizeof(void*)));
@@ -358,7 +369,7 @@ class YarrGenerator : private MacroAssembler {
     unsigned alignCallFrameSizeInBytes(unsigned callFrameSize)
     {
         callFrameSize *= sizeof(void*);
-        if (callFrameSize / sizeof(void*) != m_pattern.m_body->m_callFrameSize)
+        if (callFrameSize / sizeof(void*) != m_callFrameSize)
             CRASH();
         callFrameSize = (callFrameSize + 0x3f) & ~0x3f;
         if (!callFrameSize)
@@ -367,13 +378,13 @@ class YarrGenerator : private MacroAssembler {
     }
     void initCallFrame()
     {
-        unsigned callFrameSize = m_pattern.m_body->m_callFrameSize;
+        unsigned callFrameSize = m_callFrameSize;
         if (callFrameSize)
             subPtr(Imm32(alignCallFrameSizeInBytes(callFrameSize)), stackPointerRegister);
     }
     void removeCallFrame()
     {
-        unsigned callFrameSize = m_pattern.m_body->m_callFrameSize;
+        unsigned callFrameSize = m_callFrameSize;
         if (callFrameSize)
             addPtr(Imm32(alignCallFrameSizeInBytes(callFrameSize)), stackPointerRegister);
     }
@@ -385,24 +396,64 @@ class YarrGenerator : private MacroAssembler {
         generateReturn();
     }
 
-    // Used to record subpatters, should only be called if compileMode is IncludeSubpatterns.
+#if ENABLE(YARR_JIT_ALL_PARENS_EXPRESSIONS)
+    void generateJITCodeFailureReturn()
+    {
+        if (m_abortExecution.empty())
+            return;
+
+        m_abortExecution.link(this);
+        removeCallFrame();
+        move(TrustedImmPtr(reinterpret_cast<void*>(static_cast<intptr_t>(JSRegExpJITCodeFailure))), returnRegister);
+        move(TrustedImm32(0), returnRegister2);
+        generateReturn();
+    }
+#endif
+
+    // Subpatterns are recorded when compiling IncludeSubpatterns, and also when matching
+    // back-references, which need to read them back. In MatchOnly mode there is no output
+    // vector, so they are kept in the pattern's frame instead.
+    bool shouldRecordSubpatterns()
+    {
+        return compileMode == IncludeSubpatterns || m_pattern.m_containsBackreferences;
+    }
+    Address subpatternStartAddress(unsigned subpattern)
+    {
+        if (compileMode == IncludeSubpatterns)
+            return Address(output, (subpattern << 1) * sizeof(int));
+        return Address(stackPointerRegister, (m_captureFrameLocation + (subpattern << 1)) * sizeof(void*));
+    }
+    Address subpatternEndAddress(unsigned subpattern)
+    {
+        if (compileMode == IncludeSubpatterns)
+            return Address(output, ((subpattern << 1) + 1) * sizeof(int));
+        return Address(stackPointerRegister, (m_captureFrameLocation + (subpattern << 1) + 1) * sizeof(void*));
+    }
+
+    // Used to record subpatters, should only be called if shouldRecordSubpatterns().
     void setSubpatternStart(RegisterID reg, unsigned subpattern)
     {
         ASSERT(subpattern);
-        // FIXME: should be able to ASSERT(compileMode == IncludeSubpatterns), but then this function is conditionally NORETURN. :-(
-        store32(reg, Address(output, (subpattern << 1) * sizeof(int)));
+        ASSERT(shouldRecordSubpatterns());
+        store32(reg, subpatternStartAddress(subpattern));
     }
     void setSubpatternEnd(RegisterID reg, unsigned subpattern)
     {
         ASSERT(subpattern);
-        // FIXME: should be able to ASSERT(compileMode == IncludeSubpatterns), but then this function is conditionally NORETURN. :-(
-        store32(reg, Address(output, ((subpattern << 1) + 1) * sizeof(int)));
+        ASSERT(shouldRecordSubpatterns());
+        store32(reg, subpatternEndAddress(subpattern));
     }
     void clearSubpatternStart(unsigned subpattern)
     {
         ASSERT(subpattern);
-        // FIXME: should be able to ASSERT(compileMode == IncludeSubpatterns), but then this function is conditionally NORETURN. :-(
-        store32(TrustedImm32(-1), Address(output, (subpattern << 1) * sizeof(int)));
+        ASSERT(shouldRecordSubpatterns());
+        store32(TrustedImm32(-1), subpatternStartAddress(subpattern));
+    }
+    void clearSubpatternEnd(unsigned subpattern)
+    {
+        ASSERT(subpattern);
+        ASSERT(shouldRecordSubpatterns());
+        store32(TrustedImm32(-1), subpatternEndAddress(subpattern));
     }
 
     // We use one of three different strategies to track the start of the current match,
@@ -431,6 +482,137 @@ class YarrGenerator : private MacroAssembler {
             move(output, reg);
     }
 
+    // 'Generic' parentheses are those that are neither matched once (quantityMaxCount
+    // == 1, and not a copy) nor terminal; these may need to backtrack back into any of
+    // their iterations.
+    static bool isGenericParentheses(PatternTerm* term)
+    {
+        return term->type == PatternTerm::TypeParenthesesSubpattern
+            && !(term->quantityMaxCount == 1 && !term->parentheses.isCopy)
+            && !term->parentheses.isTerminal;
+    }
+
+    // The frame location at which the alternatives of a subpattern store the return
+    // address used to backtrack back into them; this follows the parentheses' own
+    // backtracking information.
+    static unsigned alternativeFrameLocationFor(PatternTerm* term)
+    {
+        unsigned alternativeFrameLocation = term->frameLocation;
+        if (isGenericParentheses(term))
+            alternativeFrameLocation += YarrStackSpaceForBackTrackInfoParentheses;
+        else if (term->quantityType != QuantifierFixedCount)
+            alternativeFrameLocation += YarrStackSpaceForBackTrackInfoParenthesesOnce;
+        return alternativeFrameLocation;
+    }
+
+#if ENABLE(YARR_JIT_ALL_PARENS_EXPRESSIONS)
+    // Each iteration of a set of generic parentheses records the state it started from
+    // in a paren context, so that it can be restored upon backtracking back out of the
+    // iteration. A context holds the context of the previous iteration, the input
+    // position the iteration started at, the captures nested within the parentheses,
+    // and the frame of the parentheses' alternatives.
+    //
+    // Contexts are allocated in a fixed size region at the end of the pattern's frame,
+    // and are released in the reverse order; backtracking out of an iteration releases
+    // its context along with any allocated after it. If the region is exhausted the
+    // match is abandoned, and JSRegExpJITCodeFailure is returned so that the caller can
+    // rerun it in the interpreter.
+    static const unsigned parenContextStackSizeInBytes = 8192;
+    static const unsigned parenContextNextIndex = 0;
+    static const unsigned parenContextBeginIndexIndex = 1;
+    static const unsigned parenContextCapturesIndex = 2;
+
+    // The parentheses' own frame holds the context of the current iteration, and the
+    // number of iterations that have completed.
+    unsigned parenContextHeadFrameLocation(PatternTerm* term) { return term->frameLocation; }
+    unsigned parenContextMatchAmountFrameLocation(PatternTerm* term) { return term->frameLocation + 1; }
+
+    unsigned parenContextStackTopFrameLocation() { return m_parenContextStackFrameLocation; }
+    unsigned parenContextStackLimitFrameLocation() { return m_parenContextStackFrameLocation + 1; }
+    unsigned parenContextStackBeginFrameLocation() { return m_parenContextStackFrameLocation + 2; }
+
+    unsigned parenContextCaptureCount(PatternTerm* term)
+    {
+        if (!shouldRecordSubpatterns() || term->parentheses.lastSubpatternId < term->parentheses.subpatternId)
+            return 0;
+        return term->parentheses.lastSubpatternId - term->parentheses.subpatternId + 1;
+    }
+    unsigned parenContextFrameIndex(PatternTerm* term)
+    {
+        return parenContextCapturesIndex + 2 * parenContextCaptureCount(term);
+    }
+    unsigned parenContextSizeInBytes(PatternTerm* term)
+    {
+        unsigned disjunctionFrameSize = term->parentheses.disjunction->m_callFrameSize - alternativeFrameLocationFor(term);
+        return (parenContextFrameIndex(term) + disjunctionFrameSize) * sizeof(void*);
+    }
+
+    void resetParenContextStack(RegisterID temp)
+    {
+        addPtr(TrustedImm32(parenContextStackBeginFrameLocation() * sizeof(void*)), stackPointerRegister, temp);
+        storeToFrame(temp, parenContextStackTopFrameLocation());
+    }
+
+    // Allocates a context for a new iteration, saving the current state into it, and
+    // clears the nested captures.
+    void pushParenContext(PatternTerm* term, RegisterID context, RegisterID temp)
+    {
+        loadFromFrame(parenContextStackTopFrameLocation(), context);
+        addPtr(TrustedImm32(parenContextSizeInBytes(term)), context, temp);
+        m_abortExecution.append(branchPtr(Above, temp, Address(stackPointerRegister, parenContextStackLimitFrameLocation() * sizeof(void*))));
+        storeToFrame(temp, parenContextStackTopFrameLocation());
+
+        loadFromFrame(parenContextHeadFrameLocation(term), temp);
+        storePtr(temp, Address(context, parenContextNextIndex * sizeof(void*)));
+        store32(index, Address(context, parenContextBeginIndexIndex * sizeof(void*)));
+
+        unsigned captureCount = parenContextCaptureCount(term);
+        for (unsigned i = 0; i < captureCount; ++i) {
+            unsigned subpatternId = term->parentheses.subpatternId + i;
+            load32(subpatternStartAddress(subpatternId), temp);
+            store32(temp, Address(context, (parenContextCapturesIndex + 2 * i) * sizeof(void*)));
+            load32(subpatternEndAddress(subpatternId), temp);
+            store32(temp, Address(context, (parenContextCapturesIndex + 2 * i + 1) * sizeof(void*)));
+            clearSubpatternStart(subpatternId);
+            clearSubpatternEnd(subpatternId);
+        }
+
+        unsigned frameIndex = parenContextFrameIndex(term);
+        for (unsigned frameLocation = alternativeFrameLocationFor(term); frameLocation < term->parentheses.disjunction->m_callFrameSize; ++frameLocation) {
+            loadFromFrame(frameLocation, temp);
+            storePtr(temp, Address(context, frameIndex++ * sizeof(void*)));
+        }
+
+        storeToFrame(context, parenContextHeadFrameLocation(term));
+    }
+
+    // Restores the state saved in the current iteration's context, and releases it.
+    void popParenContext(PatternTerm* term, RegisterID context, RegisterID temp)
+    {
+        loadFromFrame(parenContextHeadFrameLocation(term), context);
+        load32(Address(context, parenContextBeginIndexIndex * sizeof(void*)), index);
+
+        unsigned captureCount = parenContextCaptureCount(term);
+        for (unsigned i = 0; i < captureCount; ++i) {
+            unsigned subpatternId = term->parentheses.subpatternId + i;
+            load32(Address(context, (parenContextCapturesIndex + 2 * i) * sizeof(void*)), temp);
+            store32(temp, subpatternStartAddress(subpatternId));
+            load32(Address(context, (parenContextCapturesIndex + 2 * i + 1) * sizeof(void*)), temp);
+            store32(temp, subpatternEndAddress(subpatternId));
+        }
+
+        unsigned frameIndex = parenContextFrameIndex(term);
+        for (unsigned frameLocation = alternativeFrameLocationFor(term); frameLocation < term->parentheses.disjunction->m_callFrameSize; ++frameLocation) {
+            loadPtr(Address(context, frameIndex++ * sizeof(void*)), temp);
+            storeToFrame(temp, frameLocation);
+        }
+
+        loadPtr(Address(context, parenContextNextIndex * sizeof(void*)), temp);
+        storeToFrame(temp, parenContextHeadFrameLocation(term));
+        storeToFrame(context, parenContextStackTopFrameLocation());
+    }
+#endif
+
     enum YarrOpCode {
         // These nodes wrap body alternatives - those in the main disjunction,
         // rather than subpatterns or assertions. These are chained together in
@@ -456,6 +638,10 @@ class YarrGenerator : private MacroAssembler {
         // Used to wrap 'Once' subpattern matches (quantityMaxCount == 1).
         OpParenthesesSubpatternOnceBegin,
         OpParenthesesSubpatternOnceEnd,
+        // Used to wrap all other subpattern matches ('Generic' parentheses),
+        // which keep the state of each iteration in a paren context.
+        OpParenthesesSubpatternBegin,
+        OpParenthesesSubpatternEnd,
         // Used to wrap 'Terminal' subpattern matches (at the end of the regexp).
         OpParenthesesSubpatternTerminalBegin,
         OpParenthesesSubpatternTerminalEnd,
@@ -523,6 +709,11 @@ class YarrGenerator : private MacroAssembler {
         // value that will be pushed into the pattern's frame to return to,
         // upon backtracking back into the disjunction.
         DataLabelPtr m_returnAddress;
+
+        // Used by OpParenthesesSubpatternEnd to hold the entry point to the
+        // backtracking code of the subpattern's alternatives, used to
+        // backtrack back into an iteration that has already matched.
+        Label m_disjunctionBacktrackEntry;
     };
 
     // BacktrackingState
@@ -1241,6 +1432,170 @@ class YarrGenerator : private MacroAssembler {
     {
         backtrackTermDefault(opIndex);
     }
+
+#if ENABLE(YARR_JIT_BACKREFERENCES)
+    // Back-references keep two values in their frame: the input position at which the
+    // term (or, when Greedy, its current repetition) started, and the number of times
+    // the referenced text has been matched.
+    unsigned backReferenceBeginIndexFrameLocation(PatternTerm* term) { return term->frameLocation; }
+    unsigned backReferenceMatchAmountFrameLocation(PatternTerm* term) { return term->frameLocation + 1; }
+
+    // A back-reference to a subpattern that has not matched, or that matched the empty
+    // string, always succeeds without consuming any input. Leaves the start of the
+    // referenced text in patternIndex.
+    void jumpIfBackReferenceMatchesEmpty(unsigned subpatternId, JumpList& matchesEmpty, RegisterID patternIndex, RegisterID patternTemp)
+    {
+        load32(subpatternStartAddress(subpatternId), patternIndex);
+        matchesEmpty.append(branch32(Equal, patternIndex, TrustedImm32(-1)));
+        load32(subpatternEndAddress(subpatternId), patternTemp);
+        matchesEmpty.append(branch32(Equal, patternTemp, TrustedImm32(-1)));
+        matchesEmpty.append(branch32(Equal, patternIndex, patternTemp));
+    }
+
+    // Matches the referenced text once, starting at patternIndex, and advances index past
+    // it. On failure index may have been advanced part of the way.
+    void matchBackReference(size_t opIndex, JumpList& characterMatchFails, RegisterID character, RegisterID patternIndex, RegisterID patternCharacter)
+    {
+        YarrOp& op = m_ops[opIndex];
+        PatternTerm* term = op.m_term;
+        unsigned subpatternId = term->backReferenceSubpatternId;
+
+        load32(subpatternEndAddress(subpatternId), patternCharacter);
+        sub32(patternIndex, patternCharacter);
+        add32(index, patternCharacter);
+        characterMatchFails.append(branch32(Above, patternCharacter, length));
+
+        Label loop(this);
+        readCharacter(0, patternCharacter, patternIndex);
+        readCharacter(m_checkedOffset - term->inputPosition, character);
+        characterMatchFails.append(branch32(NotEqual, character, patternCharacter));
+        add32(TrustedImm32(1), index);
+        add32(TrustedImm32(1), patternIndex);
+        branch32(NotEqual, patternIndex, subpatternEndAddress(subpatternId)).linkTo(loop, this);
+    }
+
+    void generateBackReference(size_t opIndex)
+    {
+        YarrOp& op = m_ops[opIndex];
+        PatternTerm* term = op.m_term;
+        unsigned subpatternId = term->backReferenceSubpatternId;
+        unsigned beginIndexFrameLocation = backReferenceBeginIndexFrameLocation(term);
+        unsigned matchAmountFrameLocation = backReferenceMatchAmountFrameLocation(term);
+
+        const RegisterID character = regT0;
+        const RegisterID patternIndex = regT1;
+        const RegisterID patternCharacter = regT2;
+
+        storeToFrame(index, beginIndexFrameLocation);
+        storeToFrame(TrustedImm32(0), matchAmountFrameLocation);
+
+        switch (term->quantityType) {
+        case QuantifierFixedCount: {
+            JumpList matchesEmpty;
+            jumpIfBackReferenceMatchesEmpty(subpatternId, matchesEmpty, patternIndex, patternCharacter);
+
+            Label loop(this);
+            matchBackReference(opIndex, op.m_jumps, character, patternIndex, patternCharacter);
+            if (term->quantityMaxCount != 1) {
+                loadFromFrame(matchAmountFrameLocation, character);
+                add32(TrustedImm32(1), character);
+                storeToFrame(character, matchAmountFrameLocation);
+                Jump done = branch32(Equal, character, Imm32(term->quantityMaxCount.unsafeGet()));
+                load32(subpatternStartAddress(subpatternId), patternIndex);
+                jump(loop);
+                done.link(this);
+            }
+
+            matchesEmpty.link(this);
+            break;
+        }
+        case QuantifierGreedy: {
+            JumpList matches;
+            JumpList incompleteMatch;
+            jumpIfBackReferenceMatchesEmpty(subpatternId, matches, patternIndex, patternCharacter);
+
+            Label loop(this);
+            if (term->quantityMaxCount != quantifyInfinite) {
+                loadFromFrame(matchAmountFrameLocation, character);
+                matches.append(branch32(Equal, character, Imm32(term->quantityMaxCount.unsafeGet())));
+            }
+            storeToFrame(index, beginIndexFrameLocation);
+            load32(subpatternStartAddress(subpatternId), patternIndex);
+            matchBackReference(opIndex, incompleteMatch, character, patternIndex, patternCharacter);
+            loadFromFrame(matchAmountFrameLocation, character);
+            add32(TrustedImm32(1), character);
+            storeToFrame(character, matchAmountFrameLocation);
+            jump(loop);
+
+            // Drop the partially matched repetition.
+            incompleteMatch.link(this);
+            loadFromFrame(beginIndexFrameLocation, index);
+
+            matches.link(this);
+            op.m_reentry = label();
+            break;
+        }
+        case QuantifierNonGreedy:
+            op.m_reentry = label();
+            break;
+        }
+    }
+    void backtrackBackReference(size_t opIndex)
+    {
+        YarrOp& op = m_ops[opIndex];
+        PatternTerm* term = op.m_term;
+        unsigned subpatternId = term->backReferenceSubpatternId;
+        unsigned beginIndexFrameLocation = backReferenceBeginIndexFrameLocation(term);
+        unsigned matchAmountFrameLocation = backReferenceMatchAmountFrameLocation(term);
+
+        const RegisterID character = regT0;
+        const RegisterID patternIndex = regT1;
+        const RegisterID patternCharacter = regT2;
+
+        switch (term->quantityType) {
+        case QuantifierFixedCount:
+            m_backtrackingState.append(op.m_jumps);
+            m_backtrackingState.link(this);
+            loadFromFrame(beginIndexFrameLocation, index);
+            m_backtrackingState.fallthrough();
+            break;
+
+        case QuantifierGreedy:
+            // Give back the last repetition, if there is one.
+            m_backtrackingState.link(this);
+            loadFromFrame(matchAmountFrameLocation, character);
+            m_backtrackingState.append(branchTest32(Zero, character));
+            sub32(TrustedImm32(1), character);
+            storeToFrame(character, matchAmountFrameLocation);
+            load32(subpatternEndAddress(subpatternId), patternIndex);
+            sub32(subpatternStartAddress(subpatternId), patternIndex);
+            sub32(patternIndex, index);
+            jump(op.m_reentry);
+            break;
+
+        case QuantifierNonGreedy: {
+            // Try to match one more repetition.
+            JumpList failures;
+            m_backtrackingState.link(this);
+            jumpIfBackReferenceMatchesEmpty(subpatternId, failures, patternIndex, patternCharacter);
+            if (term->quantityMaxCount != quantifyInfinite) {
+                loadFromFrame(matchAmountFrameLocation, character);
+                failures.append(branch32(Equal, character, Imm32(term->quantityMaxCount.unsafeGet())));
+            }
+            matchBackReference(opIndex, failures, character, patternIndex, patternCharacter);
+            loadFromFrame(matchAmountFrameLocation, character);
+            add32(TrustedImm32(1), character);
+            storeToFrame(character, matchAmountFrameLocation);
+            jump(op.m_reentry);
+
+            failures.link(this);
+            loadFromFrame(beginIndexFrameLocation, index);
+            m_backtrackingState.fallthrough();
+            break;
+        }
+        }
+    }
+#endif
     
     // Code generation/backtracking for simple terms
     // (pattern characters, character classes, and assertions).
@@ -1304,7 +1659,11 @@ class YarrGenerator : private MacroAssembler {
         case PatternTerm::TypeParentheticalAssertion:
             RELEASE_ASSERT_NOT_REACHED();
         case PatternTerm::TypeBackReference:
-            m_shouldFallBack = true;
+#if ENABLE(YARR_JIT_BACKREFERENCES)
+            generateBackReference(opIndex);
+#else
+            RELEASE_ASSERT_NOT_REACHED();
+#endif
             break;
         case PatternTerm::TypeDotStarEnclosure:
             generateDotStarEnclosure(opIndex);
@@ -1375,11 +1734,56 @@ class YarrGenerator : private MacroAssembler {
             break;
 
         case PatternTerm::TypeBackReference:
-            m_shouldFallBack = true;
+#if ENABLE(YARR_JIT_BACKREFERENCES)
+            backtrackBackReference(opIndex);
+#else
+            RELEASE_ASSERT_NOT_REACHED();
+#endif
             break;
         }
     }
 
+    // Planted at the head of the repeating body alternatives when every match has to begin
+    // with a character from m_pattern.m_leadingCharacterClass: moves the input position on
+    // until the character at the start of the attempted match is in that class. Running out
+    // of input is handled as a failed input check for the first alternative, so that any
+    // shorter alternatives still get to try the positions that were skipped to.
+    void generateSkipToStartCandidate(YarrOp& op)
+    {
+        const RegisterID character = regT0;
+        const CharacterClass* leadingCharacterClass = m_pattern.m_leadingCharacterClass;
+        unsigned minimumSize = op.m_alternative->m_minimumSize;
+        ASSERT(minimumSize);
+
+        JumpList isCandidate;
+        readCharacter(minimumSize, character);
+        matchCharacterClass(character, isCandidate, leadingCharacterClass);
+
+        JumpList advancedToCandidate;
+        Label advance(this);
+        add32(TrustedImm32(1), index);
+        Jump noCandidate = jumpIfNoAvailableInput();
+        readCharacter(minimumSize, character);
+        matchCharacterClass(character, advancedToCandidate, leadingCharacterClass);
+        jump(advance);
+
+        noCandidate.link(this);
+        if (!m_pattern.m_body->m_hasFixedSize) {
+            move(index, regT0);
+            sub32(Imm32(minimumSize), regT0);
+            setMatchStart(regT0);
+        }
+        op.m_jumps.append(jump());
+
+        advancedToCandidate.link(this);
+        if (!m_pattern.m_body->m_hasFixedSize) {
+            move(index, regT0);
+            sub32(Imm32(minimumSize), regT0);
+            setMatchStart(regT0);
+        }
+        isCandidate.link(this);
+    }
+
     void generate()
     {
         // Forwards generate the matching code.
@@ -1426,6 +1830,18 @@ class YarrGenerator : private MacroAssembler {
                 // set as appropriate to this alternative.
                 op.m_reentry = label();
 
+                if (m_pattern.m_leadingCharacterClass) {
+                    ASSERT(!alternative->onceThrough() && !m_pattern.sticky());
+                    generateSkipToStartCandidate(op);
+                }
+
+#if ENABLE(YARR_JIT_ALL_PARENS_EXPRESSIONS)
+                // Release any paren contexts left behind by a previous attempt (those
+                // allocated within parenthetical assertions are never popped).
+                if (m_usesParenContextStack)
+                    resetParenContextStack(regT0);
+#endif
+
                 m_checkedOffset += alternative->m_minimumSize;
                 break;
             }
@@ -1471,6 +1887,10 @@ class YarrGenerator : private MacroAssembler {
                         op.m_jumps.append(jumpIfNoAvailableInput());
                     } else if (priorAlternative->m_minimumSize > alternative->m_minimumSize)
                         sub32(Imm32(priorAlternative->m_minimumSize - alternative->m_minimumSize), index);
+#if ENABLE(YARR_JIT_ALL_PARENS_EXPRESSIONS)
+                    if (m_usesParenContextStack)
+                        resetParenContextStack(regT0);
+#endif
                 } else if (op.m_nextOp == notFound) {
                     // This is the reentry point for the End of 'once through' alternatives,
                     // jumped to when the last alternative fails to match.
@@ -1508,7 +1928,7 @@ class YarrGenerator : private MacroAssembler {
 
                 // Calculate how much input we need to check for, and if non-zero check.
                 op.m_checkAdjust = Checked<unsigned>(alternative->m_minimumSize);
-                if ((term->quantityType == QuantifierFixedCount) && (term->type != PatternTerm::TypeParentheticalAssertion))
+                if ((term->quantityType == QuantifierFixedCount) && (term->type != PatternTerm::TypeParentheticalAssertion) && !isGenericParentheses(term))
                     op.m_checkAdjust -= disjunction->m_minimumSize;
                 if (op.m_checkAdjust)
                     op.m_jumps.append(jumpIfNoAvailableInput(op.m_checkAdjust.unsafeGet()));
@@ -1524,14 +1944,11 @@ class YarrGenerator : private MacroAssembler {
 
                 // In the non-simple case, store a 'return address' so we can backtrack correctly.
                 if (op.m_op == OpNestedAlternativeNext) {
-                    unsigned parenthesesFrameLocation = term->frameLocation;
-                    unsigned alternativeFrameLocation = parenthesesFrameLocation;
-                    if (term->quantityType != QuantifierFixedCount)
-                        alternativeFrameLocation += YarrStackSpaceForBackTrackInfoParenthesesOnce;
-                    op.m_returnAddress = storeToFrameWithPatch(alternativeFrameLocation);
+                    op.m_returnAddress = storeToFrameWithPatch(alternativeFrameLocationFor(term));
                 }
 
-                if (term->quantityType != QuantifierFixedCount && !m_ops[op.m_previousOp].m_alternative->m_minimumSize) {
+                // Generic parentheses reject zero length iterations themselves, at their End node.
+                if (term->quantityType != QuantifierFixedCount && !isGenericParentheses(term) && !m_ops[op.m_previousOp].m_alternative->m_minimumSize) {
                     // If the previous alternative matched without consuming characters then
                     // backtrack to try to match while consumming some input.
                     op.m_zeroLengthMatch = branch32(Equal, index, Address(stackPointerRegister, term->frameLocation * sizeof(void*)));
@@ -1558,7 +1975,7 @@ class YarrGenerator : private MacroAssembler {
 
                 // Calculate how much input we need to check for, and if non-zero check.
                 op.m_checkAdjust = alternative->m_minimumSize;
-                if ((term->quantityType == QuantifierFixedCount) && (term->type != PatternTerm::TypeParentheticalAssertion))
+                if ((term->quantityType == QuantifierFixedCount) && (term->type != PatternTerm::TypeParentheticalAssertion) && !isGenericParentheses(term))
                     op.m_checkAdjust -= disjunction->m_minimumSize;
                 if (op.m_checkAdjust)
                     op.m_jumps.append(jumpIfNoAvailableInput(op.m_checkAdjust.unsafeGet()));
@@ -1574,14 +1991,11 @@ class YarrGenerator : private MacroAssembler {
 
                 // In the non-simple case, store a 'return address' so we can backtrack correctly.
                 if (op.m_op == OpNestedAlternativeEnd) {
-                    unsigned parenthesesFrameLocation = term->frameLocation;
-                    unsigned alternativeFrameLocation = parenthesesFrameLocation;
-                    if (term->quantityType != QuantifierFixedCount)
-                        alternativeFrameLocation += YarrStackSpaceForBackTrackInfoParenthesesOnce;
-                    op.m_returnAddress = storeToFrameWithPatch(alternativeFrameLocation);
+                    op.m_returnAddress = storeToFrameWithPatch(alternativeFrameLocationFor(term));
                 }
 
-                if (term->quantityType != QuantifierFixedCount && !m_ops[op.m_previousOp].m_alternative->m_minimumSize) {
+                // Generic parentheses reject zero length iterations themselves, at their End node.
+                if (term->quantityType != QuantifierFixedCount && !isGenericParentheses(term) && !m_ops[op.m_previousOp].m_alternative->m_minimumSize) {
                     // If the previous alternative matched without consuming characters then
                     // backtrack to try to match while consumming some input.
                     op.m_zeroLengthMatch = branch32(Equal, index, Address(stackPointerRegister, term->frameLocation * sizeof(void*)));
@@ -1637,7 +2051,7 @@ class YarrGenerator : private MacroAssembler {
                 // FIXME: could avoid offsetting this value in JIT code, apply
                 // offsets only afterwards, at the point the results array is
                 // being accessed.
-                if (term->capture() && compileMode == IncludeSubpatterns) {
+                if (term->capture() && shouldRecordSubpatterns()) {
                     unsigned inputOffset = (m_checkedOffset - term->inputPosition).unsafeGet();
                     if (term->quantityType == QuantifierFixedCount)
                         inputOffset += term->parentheses.disjunction->m_minimumSize;
@@ -1647,6 +2061,11 @@ class YarrGenerator : private MacroAssembler {
                         setSubpatternStart(indexTemporary, term->parentheses.subpatternId);
                     } else
                         setSubpatternStart(index, term->parentheses.subpatternId);
+
+                    // A back-reference from within the parentheses must not see the end
+                    // of an earlier match of them.
+                    if (m_pattern.m_containsBackreferences)
+                        clearSubpatternEnd(term->parentheses.subpatternId);
                 }
                 break;
             }
@@ -1670,7 +2089,7 @@ class YarrGenerator : private MacroAssembler {
                 // FIXME: could avoid offsetting this value in JIT code, apply
                 // offsets only afterwards, at the point the results array is
                 // being accessed.
-                if (term->capture() && compileMode == IncludeSubpatterns) {
+                if (term->capture() && shouldRecordSubpatterns()) {
                     unsigned inputOffset = (m_checkedOffset - term->inputPosition).unsafeGet();
                     if (inputOffset) {
                         move(index, indexTemporary);
@@ -1692,6 +2111,94 @@ class YarrGenerator : private MacroAssembler {
                 break;
             }
 
+#if ENABLE(YARR_JIT_ALL_PARENS_EXPRESSIONS)
+            // OpParenthesesSubpatternBegin/End
+            //
+            // These nodes support generic subpatterns, matched between quantityMinCount
+            // and quantityMaxCount times. Each iteration starts by pushing a paren
+            // context recording the state before it; the End node counts completed
+            // iterations, and loops back to the Begin node's reentry point while more
+            // iterations are wanted. The End node's reentry point is the exit from the
+            // parentheses.
+            case OpParenthesesSubpatternBegin: {
+                PatternTerm* term = op.m_term;
+                const RegisterID context = regT0;
+                const RegisterID temp = regT1;
+
+                storeToFrame(TrustedImmPtr(nullptr), parenContextHeadFrameLocation(term));
+                storeToFrame(TrustedImm32(0), parenContextMatchAmountFrameLocation(term));
+
+                // NonGreedy parentheses that may match no iterations start out by skipping
+                // the subpattern; we'll backtrack into it later.
+                if (term->quantityType == QuantifierNonGreedy && !term->quantityMinCount)
+                    op.m_jumps.append(jump());
+
+                // Each iteration begins here.
+                op.m_reentry = label();
+                pushParenContext(term, context, temp);
+
+                if (term->capture() && shouldRecordSubpatterns()) {
+                    unsigned inputOffset = (m_checkedOffset - term->inputPosition).unsafeGet();
+                    if (inputOffset) {
+                        move(index, temp);
+                        sub32(Imm32(inputOffset), temp);
+                        setSubpatternStart(temp, term->parentheses.subpatternId);
+                    } else
+                        setSubpatternStart(index, term->parentheses.subpatternId);
+                }
+                break;
+            }
+            case OpParenthesesSubpatternEnd: {
+                PatternTerm* term = op.m_term;
+                YarrOp& beginOp = m_ops[op.m_previousOp];
+                const RegisterID countRegister = regT0;
+                const RegisterID temp = regT1;
+
+                // Once the minimum has been reached, an iteration that matched the empty
+                // string is rejected; backtrack into it to look for a non-empty match.
+                if (!term->parentheses.disjunction->m_minimumSize) {
+                    Jump belowMinimum;
+                    if (term->quantityMinCount) {
+                        loadFromFrame(parenContextMatchAmountFrameLocation(term), countRegister);
+                        belowMinimum = branch32(Below, countRegister, Imm32(term->quantityMinCount.unsafeGet()));
+                    }
+                    loadFromFrame(parenContextHeadFrameLocation(term), temp);
+                    op.m_jumps.append(branch32(Equal, index, Address(temp, parenContextBeginIndexIndex * sizeof(void*))));
+                    if (belowMinimum.isSet())
+                        belowMinimum.link(this);
+                }
+
+                if (term->capture() && shouldRecordSubpatterns()) {
+                    unsigned inputOffset = (m_checkedOffset - term->inputPosition).unsafeGet();
+                    if (inputOffset) {
+                        move(index, temp);
+                        sub32(Imm32(inputOffset), temp);
+                        setSubpatternEnd(temp, term->parentheses.subpatternId);
+                    } else
+                        setSubpatternEnd(index, term->parentheses.subpatternId);
+                }
+
+                loadFromFrame(parenContextMatchAmountFrameLocation(term), countRegister);
+                add32(TrustedImm32(1), countRegister);
+                storeToFrame(countRegister, parenContextMatchAmountFrameLocation(term));
+
+                // Greedy (and fixed count) parentheses match as many iterations as they
+                // can; NonGreedy ones only go on until they reach the minimum.
+                if (term->quantityType == QuantifierNonGreedy) {
+                    if (term->quantityMinCount)
+                        branch32(Below, countRegister, Imm32(term->quantityMinCount.unsafeGet())).linkTo(beginOp.m_reentry, this);
+                } else if (term->quantityMaxCount == quantifyInfinite)
+                    jump(beginOp.m_reentry);
+                else
+                    branch32(Below, countRegister, Imm32(term->quantityMaxCount.unsafeGet())).linkTo(beginOp.m_reentry, this);
+
+                op.m_reentry = label();
+                beginOp.m_jumps.link(this);
+                beginOp.m_jumps.clear();
+                break;
+            }
+#endif
+
             // OpParenthesesSubpatternTerminalBegin/End
             case OpParenthesesSubpatternTerminalBegin: {
                 PatternTerm* term = op.m_term;
@@ -2147,11 +2654,7 @@ class YarrGenerator : private MacroAssembler {
                     m_backtrackingState.link(this);
 
                     // Plant a jump to the return address.
-                    unsigned parenthesesFrameLocation = term->frameLocation;
-                    unsigned alternativeFrameLocation = parenthesesFrameLocation;
-                    if (term->quantityType != QuantifierFixedCount)
-                        alternativeFrameLocation += YarrStackSpaceForBackTrackInfoParenthesesOnce;
-                    loadFromFrameAndJump(alternativeFrameLocation);
+                    loadFromFrameAndJump(alternativeFrameLocationFor(term));
 
                     // Link the DataLabelPtr associated with the end of the last
                     // alternative to this point.
@@ -2183,11 +2686,11 @@ class YarrGenerator : private MacroAssembler {
                 ASSERT(term->quantityMaxCount == 1);
 
                 // We only need to backtrack to thispoint if capturing or greedy.
-                if ((term->capture() && compileMode == IncludeSubpatterns) || term->quantityType == QuantifierGreedy) {
+                if ((term->capture() && shouldRecordSubpatterns()) || term->quantityType == QuantifierGreedy) {
                     m_backtrackingState.link(this);
 
                     // If capturing, clear the capture (we only need to reset start).
-                    if (term->capture() && compileMode == IncludeSubpatterns)
+                    if (term->capture() && shouldRecordSubpatterns())
                         clearSubpatternStart(term->parentheses.subpatternId);
 
                     // If Greedy, jump to the end.
@@ -2240,6 +2743,73 @@ class YarrGenerator : private MacroAssembler {
                 break;
             }
 
+#if ENABLE(YARR_JIT_ALL_PARENS_EXPRESSIONS)
+            // OpParenthesesSubpatternBegin/End
+            //
+            // Backtracking into the End node from after the parentheses either backtracks
+            // into the last iteration (Greedy), or first tries to match one more (NonGreedy).
+            // Backtracking out of the alternatives into the Begin node means the current
+            // iteration cannot match; its context is popped, and we either exit with the
+            // iterations matched so far (Greedy, if enough have matched), or backtrack into
+            // the previous iteration. Once there are no iterations left to backtrack into,
+            // we backtrack out of the parentheses.
+            case OpParenthesesSubpatternBegin: {
+                PatternTerm* term = op.m_term;
+                YarrOp& endOp = m_ops[op.m_nextOp];
+                const RegisterID context = regT0;
+                const RegisterID temp = regT1;
+                const RegisterID countRegister = regT0;
+
+                m_backtrackingState.link(this);
+                popParenContext(term, context, temp);
+                loadFromFrame(parenContextMatchAmountFrameLocation(term), countRegister);
+
+                if (term->quantityType == QuantifierGreedy && !term->quantityMinCount)
+                    jump(endOp.m_reentry);
+                else {
+                    if (term->quantityType == QuantifierGreedy)
+                        branch32(AboveOrEqual, countRegister, Imm32(term->quantityMinCount.unsafeGet())).linkTo(endOp.m_reentry, this);
+                    Jump noIterations = branchTest32(Zero, countRegister);
+                    sub32(TrustedImm32(1), countRegister);
+                    storeToFrame(countRegister, parenContextMatchAmountFrameLocation(term));
+                    jump(endOp.m_disjunctionBacktrackEntry);
+                    noIterations.link(this);
+                    m_backtrackingState.fallthrough();
+                }
+
+                // The End node adds jumps here when there is no iteration to backtrack into.
+                m_backtrackingState.append(op.m_jumps);
+                break;
+            }
+            case OpParenthesesSubpatternEnd: {
+                PatternTerm* term = op.m_term;
+                YarrOp& beginOp = m_ops[op.m_previousOp];
+                const RegisterID countRegister = regT0;
+
+                m_backtrackingState.link(this);
+                loadFromFrame(parenContextMatchAmountFrameLocation(term), countRegister);
+
+                if (term->quantityType == QuantifierNonGreedy) {
+                    if (term->quantityMaxCount == quantifyInfinite)
+                        jump(beginOp.m_reentry);
+                    else
+                        branch32(Below, countRegister, Imm32(term->quantityMaxCount.unsafeGet())).linkTo(beginOp.m_reentry, this);
+                }
+                if (term->quantityType != QuantifierNonGreedy || term->quantityMaxCount != quantifyInfinite) {
+                    beginOp.m_jumps.append(branchTest32(Zero, countRegister));
+                    sub32(TrustedImm32(1), countRegister);
+                    storeToFrame(countRegister, parenContextMatchAmountFrameLocation(term));
+                }
+
+                // Backtrack into the alternatives of the last iteration; zero length
+                // iterations rejected on the forwards path also come here.
+                op.m_disjunctionBacktrackEntry = label();
+                op.m_jumps.link(this);
+                m_backtrackingState.fallthrough();
+                break;
+            }
+#endif
+
             // OpParenthesesSubpatternTerminalBegin/End
             //
             // Terminal subpatterns will always match - there is nothing after them to
@@ -2319,9 +2889,10 @@ class YarrGenerator : private MacroAssembler {
     // Emits ops for a subpattern (set of parentheses). These consist
     // of a set of alternatives wrapped in an outer set of nodes for
     // the parentheses.
-    // Supported types of parentheses are 'Once' (quantityMaxCount == 1)
-    // and 'Terminal' (non-capturing parentheses quantified as greedy
-    // and infinite).
+    // Supported types of parentheses are 'Once' (quantityMaxCount == 1),
+    // 'Terminal' (non-capturing parentheses quantified as greedy
+    // and infinite), and, where the platform supports them, 'Generic'
+    // (all others).
     // Alternatives will use the 'Simple' set of ops if either the
     // subpattern is terminal (in which case we will never need to
     // backtrack), or if the subpattern only contains one alternative.
@@ -2333,17 +2904,7 @@ class YarrGenerator : private MacroAssembler {
         YarrOpCode alternativeNextOpCode = OpSimpleNestedAlternativeNext;
         YarrOpCode alternativeEndOpCode = OpSimpleNestedAlternativeEnd;
 
-        // We can currently only compile quantity 1 subpatterns that are
-        // not copies. We generate a copy in the case of a range quantifier,
-        // e.g. /(?:x){3,9}/, or /(?:x)+/ (These are effectively expanded to
-        // /(?:x){3,3}(?:x){0,6}/ and /(?:x)(?:x)*/ repectively). The problem
-        // comes where the subpattern is capturing, in which case we would
-        // need to restore the capture from the first subpattern upon a
-        // failure in the second.
-        if (term->quantityMinCount && term->quantityMinCount != term->quantityMaxCount) {
-            m_shouldFallBack = true;
-            return;
-        } if (term->quantityMaxCount == 1 && !term->parentheses.isCopy) {
+        if (term->quantityMaxCount == 1 && !term->parentheses.isCopy) {
             // Select the 'Once' nodes.
             parenthesesBeginOpCode = OpParenthesesSubpatternOnceBegin;
             parenthesesEndOpCode = OpParenthesesSubpatternOnceEnd;
@@ -2359,9 +2920,24 @@ class YarrGenerator : private MacroAssembler {
             parenthesesBeginOpCode = OpParenthesesSubpatternTerminalBegin;
             parenthesesEndOpCode = OpParenthesesSubpatternTerminalEnd;
         } else {
+#if ENABLE(YARR_JIT_ALL_PARENS_EXPRESSIONS)
+            // Select the 'Generic' nodes. These cover range quantifiers, e.g. /(x){3,9}/
+            // or /(x)+/, and copies made of them.
+            parenthesesBeginOpCode = OpParenthesesSubpatternBegin;
+            parenthesesEndOpCode = OpParenthesesSubpatternEnd;
+            m_usesParenContextStack = true;
+
+            // We may backtrack into any iteration, so any alternative.
+            if (term->parentheses.disjunction->m_alternatives.size() != 1) {
+                alternativeBeginOpCode = OpNestedAlternativeBegin;
+                alternativeNextOpCode = OpNestedAlternativeNext;
+                alternativeEndOpCode = OpNestedAlternativeEnd;
+            }
+#else
             // This subpattern is not supported by the JIT.
-            m_shouldFallBack = true;
+            m_failureReason = JITFailureReason::ParenthesizedSubpattern;
             return;
+#endif
         }
 
         size_t parenBegin = m_ops.size();
@@ -2474,6 +3050,17 @@ class YarrGenerator : private MacroAssembler {
                 opCompileParentheticalAssertion(term);
                 break;
 
+            case PatternTerm::TypeBackReference:
+#if ENABLE(YARR_JIT_BACKREFERENCES)
+                // Case insensitive back-references are left to the interpreter.
+                if (!m_pattern.ignoreCase()) {
+                    m_ops.append(term);
+                    break;
+                }
+#endif
+                m_failureReason = JITFailureReason::BackReference;
+                return;
+
             default:
                 m_ops.append(term);
             }
@@ -2642,12 +3229,33 @@ public:
         : m_vm(vm)
         , m_pattern(pattern)
         , m_charSize(charSize)
-        , m_shouldFallBack(false)
     {
     }
 
     void compile(YarrCodeBlock& jitObject)
     {
+        opCompileBody(m_pattern.m_body);
+
+        if (m_failureReason) {
+            jitObject.setFallBackWithFailureReason(*m_failureReason);
+            return;
+        }
+
+        // The frame holds the pattern's backtracking information, followed by the
+        // subpatterns if they are needed but there is no output vector to keep them
+        // in, followed by the paren context stack.
+        m_callFrameSize = m_pattern.m_body->m_callFrameSize;
+        if (compileMode == MatchOnly && shouldRecordSubpatterns()) {
+            m_captureFrameLocation = m_callFrameSize;
+            m_callFrameSize += (m_pattern.m_numSubpatterns + 1) * 2;
+        }
+#if ENABLE(YARR_JIT_ALL_PARENS_EXPRESSIONS)
+        if (m_usesParenContextStack) {
+            m_parenContextStackFrameLocation = m_callFrameSize;
+            m_callFrameSize += 2 + parenContextStackSizeInBytes / sizeof(void*);
+        }
+#endif
+
         generateEnter();
 
         Jump hasInput = checkInput();
@@ -2664,19 +3272,30 @@ public:
 
         initCallFrame();
 
-        opCompileBody(m_pattern.m_body);
+        if (compileMode == MatchOnly && shouldRecordSubpatterns()) {
+            for (unsigned i = 1; i < m_pattern.m_numSubpatterns + 1; ++i) {
+                clearSubpatternStart(i);
+                clearSubpatternEnd(i);
+            }
+        }
 
-        if (m_shouldFallBack) {
-            jitObject.setFallBack(true);
-            return;
+#if ENABLE(YARR_JIT_ALL_PARENS_EXPRESSIONS)
+        if (m_usesParenContextStack) {
+            addPtr(TrustedImm32(m_callFrameSize * sizeof(void*)), stackPointerRegister, regT0);
+            storeToFrame(regT0, parenContextStackLimitFrameLocation());
         }
+#endif
 
         generate();
         backtrack();
 
+#if ENABLE(YARR_JIT_ALL_PARENS_EXPRESSIONS)
+        generateJITCodeFailureReturn();
+#endif
+
         LinkBuffer linkBuffer(*this, REGEXP_CODE_ID, JITCompilationCanFail);
         if (linkBuffer.didFailToAllocate()) {
-            jitObject.setFallBack(true);
+            jitObject.setFallBackWithFailureReason(JITFailureReason::ExecutableMemoryAllocationFailure);
             return;
         }
 
@@ -2693,7 +3312,7 @@ public:
             else
                 jitObject.set16BitCode(FINALIZE_CODE(linkBuffer, ("16-bit regular expression")));
         }
-        jitObject.setFallBack(m_shouldFallBack);
+        jitObject.setUsesParenContextStack(m_usesParenContextStack);
     }
 
 private:
@@ -2705,7 +3324,20 @@ private:
 
     // Used to detect regular expression constructs that are not currently
     // supported in the JIT; fall back to the interpreter when this is detected.
-    bool m_shouldFallBack;
+    std::optional<JITFailureReason> m_failureReason;
+
+    // The size of the pattern's frame, in pointer sized slots, and the locations
+    // within it of the subpatterns (when kept in the frame) and of the paren
+    // context stack (when used).
+    unsigned m_callFrameSize { 0 };
+    unsigned m_captureFrameLocation { 0 };
+    bool m_usesParenContextStack { false };
+#if ENABLE(YARR_JIT_ALL_PARENS_EXPRESSIONS)
+    unsigned m_parenContextStackFrameLocation { 0 };
+
+    // Jumps taken when the paren context stack is exhausted.
+    JumpList m_abortExecution;
+#endif
 
     // The regular expression expressed as a linear sequence of operations.
     Vector<YarrOp, 128> m_ops;
@@ -2736,4 +3368,33 @@ void jitCompile(YarrPattern& pattern, YarrCharSize charSize, VM* vm, YarrCodeBlo
 
 }}
 
+namespace WTF {
+
+using namespace JSC::Yarr;
+
+void printInternal(PrintStream& out, JITFailureReason failureReason)
+{
+    switch (failureReason) {
+    case JITFailureReason::BackReference:
+        out.print("BackReference");
+        return;
+    case JITFailureReason::ParenthesizedSubpattern:
+        out.print("ParenthesizedSubpattern");
+        return;
+    case JITFailureReason::ExecutableMemoryAllocationFailure:
+        out.print("ExecutableMemoryAllocationFailure");
+        return;
+    case JITFailureReason::Unicode:
+        out.print("Unicode");
+        return;
+    case JITFailureReason::UnsignedLengthPattern:
+        out.print("UnsignedLengthPattern");
+        return;
+    }
+
+    RELEASE_ASSERT_NOT_REACHED();
+}
+
+} // namespace WTF
+
 #endif
@@ -46,6 +46,16 @@ class ExecutablePool;
 
 namespace Yarr {
 
+// Why a pattern is matched by the interpreter rather than by JIT code.
+enum class JITFailureReason : uint8_t {
+    BackReference,
+    ParenthesizedSubpattern,
+    ExecutableMemoryAllocationFailure,
+    // These are recorded by RegExp for patterns it never hands to the JIT.
+    Unicode,
+    UnsignedLengthPattern,
+};
+
 class YarrCodeBlock {
 #if CPU(X86_64) || CPU(ARM64)
     typedef MatchResult (*YarrJITCode8)(const LChar* input, unsigned start, unsigned length, int* output) YARR_CALL;
@@ -61,7 +71,6 @@ class YarrCodeBlock {
 
 public:
     YarrCodeBlock()
-        : m_needFallBack(false)
     {
     }
 
@@ -69,8 +78,14 @@ public:
     {
     }
 
-    void setFallBack(bool fallback) { m_needFallBack = fallback; }
-    bool isFallBack() { return m_needFallBack; }
+    void setFallBackWithFailureReason(JITFailureReason failureReason) { m_failureReason = failureReason; }
+    bool isFallBack() const { return !!m_failureReason; }
+    std::optional<JITFailureReason> failureReason() const { return m_failureReason; }
+
+    // Code for patterns with generic parentheses may give up at run time, in which case it
+    // returns JSRegExpJITCodeFailure and the match has to be retried in the interpreter.
+    void setUsesParenContextStack(bool usesParenContextStack) { m_usesParenContextStack = usesParenContextStack; }
+    bool usesParenContextStack() const { return m_usesParenContextStack; }
 
     bool has8BitCode() { return m_ref8.size(); }
     bool has16BitCode() { return m_ref16.size(); }
@@ -151,7 +166,8 @@ public:
         m_ref16 = MacroAssemblerCodeRef();
         m_matchOnly8 = MacroAssemblerCodeRef();
         m_matchOnly16 = MacroAssemblerCodeRef();
-        m_needFallBack = false;
+        m_failureReason = std::nullopt;
+        m_usesParenContextStack = false;
     }
 
 private:
@@ -159,7 +175,8 @@ private:
     MacroAssemblerCodeRef m_ref16;
     MacroAssemblerCodeRef m_matchOnly8;
     MacroAssemblerCodeRef m_matchOnly16;
-    bool m_needFallBack;
+    std::optional<JITFailureReason> m_failureReason;
+    bool m_usesParenContextStack { false };
 };
 
 enum YarrJITCompileMode {
@@ -170,4 +187,10 @@ void jitCompile(YarrPattern&, YarrCharSize, VM*, YarrCodeBlock& jitObject, YarrJ
 
 } } // namespace JSC::Yarr
 
+namespace WTF {
+
+void printInternal(PrintStream&, JSC::Yarr::JITFailureReason);
+
+} // namespace WTF
+
 #endif
@@ -27,6 +27,7 @@
 #include "config.h"
 #include "YarrPattern.h"
 
+#include "Options.h"
 #include "Yarr.h"
 #include "YarrCanonicalize.h"
 #include "YarrParser.h"
@@ -655,12 +656,15 @@ public:
                         return error;
                     term.inputPosition = currentInputPosition.unsafeGet();
                 } else {
+                    // The disjunction's frame is laid out after the parentheses' own backtracking
+                    // info, so that the JIT can keep it in the pattern's frame and save / restore
+                    // it for each iteration. The interpreter gives each iteration a frame of its
+                    // own, and rebases the disjunction's frame locations to start at zero.
                     term.inputPosition = currentInputPosition.unsafeGet();
-                    unsigned ignoredCallFrameSize;
-                    error = setupDisjunctionOffsets(term.parentheses.disjunction, 0, currentInputPosition.unsafeGet(), ignoredCallFrameSize);
+                    currentCallFrameSize += YarrStackSpaceForBackTrackInfoParentheses;
+                    error = setupDisjunctionOffsets(term.parentheses.disjunction, currentCallFrameSize, currentInputPosition.unsafeGet(), currentCallFrameSize);
                     if (error)
                         return error;
-                    currentCallFrameSize += YarrStackSpaceForBackTrackInfoParentheses;
                 }
                 // Fixed count of 1 could be accepted, if they have a fixed size *AND* if all alternatives are of the same length.
                 alternative->m_hasFixedSize = false;
@@ -790,6 +794,109 @@ public:
         }
     }
 
+    // Works out what every match has to begin with, so that the matchers can skip ahead to
+    // the next input position where a match could start. Each alternative of the body must
+    // begin, ignoring zero-width word boundary and multiline BOL assertions, with a character
+    // or a non-inverted character class that has to match at least once, or with parentheses
+    // whose alternatives all do. We also collect the literal characters that start the body
+    // when it has a single case-sensitive alternative.
+    void setupLeadingCharacters()
+    {
+        if (m_pattern.sticky() || m_pattern.unicode())
+            return;
+
+        CharacterClassConstructor leadingCharacters(m_pattern.ignoreCase(), CanonicalMode::UCS2);
+        const CharacterClass* onlyCharacterClass = nullptr;
+        unsigned leadingTermCount = 0;
+        if (!addLeadingCharacters(m_pattern.m_body, leadingCharacters, onlyCharacterClass, leadingTermCount))
+            return;
+
+        // A single character class term can be used as it is, keeping any lookup table it has.
+        if (leadingTermCount == 1 && onlyCharacterClass)
+            m_pattern.m_leadingCharacterClass = const_cast<CharacterClass*>(onlyCharacterClass);
+        else {
+            auto leadingCharacterClass = leadingCharacters.charClass();
+            m_pattern.m_leadingCharacterClass = leadingCharacterClass.get();
+            m_pattern.m_userCharacterClasses.append(WTFMove(leadingCharacterClass));
+        }
+
+        if (m_pattern.ignoreCase() || m_pattern.m_body->m_alternatives.size() != 1)
+            return;
+
+        for (PatternTerm& term : m_pattern.m_body->m_alternatives[0]->m_terms) {
+            if (isZeroWidthLeadingAssertion(term))
+                continue;
+            if (term.type != PatternTerm::TypePatternCharacter || term.patternCharacter > 0xff)
+                break;
+
+            unsigned count = std::min<unsigned>(term.quantityMinCount.unsafeGet(), maximumLeadingLiteralLength - m_pattern.m_leadingLiteral.size());
+            for (unsigned i = 0; i < count; ++i)
+                m_pattern.m_leadingLiteral.append(term.patternCharacter);
+            if (term.quantityType != QuantifierFixedCount || m_pattern.m_leadingLiteral.size() == maximumLeadingLiteralLength)
+                break;
+        }
+
+        // A single character is no better than the leading character class.
+        if (m_pattern.m_leadingLiteral.size() < 2)
+            m_pattern.m_leadingLiteral.clear();
+        m_pattern.m_leadingLiteral.shrinkToFit();
+    }
+
+    bool isZeroWidthLeadingAssertion(const PatternTerm& term)
+    {
+        return term.type == PatternTerm::TypeAssertionWordBoundary
+            || (term.type == PatternTerm::TypeAssertionBOL && m_pattern.multiline());
+    }
+
+    bool addLeadingCharacters(PatternDisjunction* disjunction, CharacterClassConstructor& leadingCharacters, const CharacterClass*& onlyCharacterClass, unsigned& leadingTermCount)
+    {
+        if (disjunction->m_alternatives.isEmpty())
+            return false;
+
+        for (auto& alternative : disjunction->m_alternatives) {
+            if (alternative->onceThrough())
+                return false;
+            if (!addLeadingCharacters(alternative.get(), leadingCharacters, onlyCharacterClass, leadingTermCount))
+                return false;
+        }
+        return true;
+    }
+
+    bool addLeadingCharacters(PatternAlternative* alternative, CharacterClassConstructor& leadingCharacters, const CharacterClass*& onlyCharacterClass, unsigned& leadingTermCount)
+    {
+        for (PatternTerm& term : alternative->m_terms) {
+            if (isZeroWidthLeadingAssertion(term))
+                continue;
+
+            if (!term.quantityMinCount)
+                return false;
+
+            switch (term.type) {
+            case PatternTerm::TypePatternCharacter:
+                leadingCharacters.putChar(term.patternCharacter);
+                ++leadingTermCount;
+                return true;
+
+            case PatternTerm::TypeCharacterClass:
+                if (term.invert())
+                    return false;
+                leadingCharacters.append(term.characterClass);
+                onlyCharacterClass = term.characterClass;
+                ++leadingTermCount;
+                return true;
+
+            case PatternTerm::TypeParenthesesSubpattern:
+                return addLeadingCharacters(term.parentheses.disjunction, leadingCharacters, onlyCharacterClass, leadingTermCount);
+
+            default:
+                return false;
+            }
+        }
+
+        // An alternative that can match without consuming a character can match anywhere.
+        return false;
+    }
+
     bool containsCapturingTerms(PatternAlternative* alternative, size_t firstTermIndex, size_t endIndex)
     {
         Vector<PatternTerm>& terms = alternative->m_terms;
@@ -954,6 +1061,9 @@ const char* YarrPattern::compile(const String& patternString, void* stackLimit)
     if (const char* error = constructor.setupOffsets())
         return error;
 
+    if (Options::useRegExpLeadingCharacterScan())
+        constructor.setupLeadingCharacters();
+
     return nullptr;
 }
 
@@ -965,6 +1075,7 @@ YarrPattern::YarrPattern(const String& pattern, RegExpFlags flags, const char**
     , m_flags(flags)
     , m_numSubpatterns(0)
     , m_maxBackReference(0)
+    , m_leadingCharacterClass(nullptr)
     , newlineCached(0)
     , digitsCached(0)
     , spacesCached(0)
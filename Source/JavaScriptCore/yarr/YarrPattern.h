@@ -348,6 +348,8 @@ struct YarrPattern {
         m_containsBOL = false;
         m_containsUnsignedLengthPattern = false;
         m_hasCopiedParenSubexpressions = false;
+        m_leadingCharacterClass = nullptr;
+        m_leadingLiteral.clear();
 
         newlineCached = 0;
         digitsCached = 0;
@@ -462,6 +464,12 @@ struct YarrPattern {
     Vector<std::unique_ptr<PatternDisjunction>, 4> m_disjunctions;
     Vector<std::unique_ptr<CharacterClass>> m_userCharacterClasses;
 
+    // When set, every match begins with a character from this class, so positions where
+    // none occurs can be skipped without trying to match there. m_leadingLiteral, when
+    // not empty, is a string of Latin-1 characters that every match begins with.
+    CharacterClass* m_leadingCharacterClass;
+    Vector<UChar> m_leadingLiteral;
+
 private:
     const char* compile(const String& patternString, void* stackLimit);
 
@@ -926,6 +926,13 @@
 #define ENABLE_YARR_JIT_DEBUG 0
 #endif
 
+/* The RegExp JIT compiles back-references and counted / variable-count parentheses on 64-bit
+   ports that have enough scratch registers; other ports fall back to the interpreter for them. */
+#if ENABLE(YARR_JIT) && (CPU(ARM64) || (CPU(X86_64) && !OS(WINDOWS)))
+#define ENABLE_YARR_JIT_ALL_PARENS_EXPRESSIONS 1
+#define ENABLE_YARR_JIT_BACKREFERENCES 1
+#endif
+
 /* If either the JIT or the RegExp JIT is enabled, then the Assembler must be
    enabled as well: */
 #if ENABLE(JIT) || ENABLE(YARR_JIT)
@@ -189,6 +189,41 @@ void FetchBody::consumeAsStream(FetchBodyOwner& owner, FetchResponseSource& sour
 }
 #endif
 
+void FetchBody::consumeByChunk(FetchBodyOwner& owner, ConsumeDataByChunkCallback&& callback)
+{
+    auto consumeData = [&callback] (const uint8_t* data, size_t size) {
+        if (size)
+            callback(std::pair<const uint8_t*, size_t> { data, size });
+        callback(std::pair<const uint8_t*, size_t> { nullptr, 0 });
+    };
+
+    if (isArrayBuffer()) {
+        consumeData(static_cast<const uint8_t*>(arrayBufferBody().data()), arrayBufferBody().byteLength());
+        m_data = nullptr;
+    } else if (isArrayBufferView()) {
+        consumeData(static_cast<const uint8_t*>(arrayBufferViewBody().baseAddress()), arrayBufferViewBody().byteLength());
+        m_data = nullptr;
+    } else if (isText()) {
+        auto data = UTF8Encoding().encode(textBody(), EntitiesForUnencodables);
+        consumeData(reinterpret_cast<const uint8_t*>(data.data()), data.length());
+        m_data = nullptr;
+    } else if (isURLSearchParams()) {
+        auto data = UTF8Encoding().encode(urlSearchParamsBody().toString(), EntitiesForUnencodables);
+        consumeData(reinterpret_cast<const uint8_t*>(data.data()), data.length());
+        m_data = nullptr;
+    } else if (isBlob()) {
+        owner.loadBlob(blobBody(), WTFMove(callback));
+        m_data = nullptr;
+    } else if (isFormData())
+        callback(Exception { NOT_SUPPORTED_ERR, ASCIILiteral("Consuming FormData bodies by chunk is not supported") });
+    else if (isReadableStream())
+        callback(Exception { TypeError, ASCIILiteral("Consuming ReadableStream bodies by chunk is not supported") });
+    else if (RefPtr<SharedBuffer> data = m_consumer.takeData())
+        consumeData(reinterpret_cast<const uint8_t*>(data->data()), data->size());
+    else
+        consumeData(nullptr, 0);
+}
+
 void FetchBody::consumeArrayBuffer(Ref<DeferredPromise>&& promise)
 {
     m_consumer.resolveWithData(WTFMove(promise), static_cast<const uint8_t*>(arrayBufferBody().data()), arrayBufferBody().byteLength());
@@ -62,6 +62,11 @@ public:
     void consumeAsStream(FetchBodyOwner&, FetchResponseSource&);
 #endif
 
+    // Receives each chunk of the body, then an empty chunk once the whole body was delivered,
+    // or an exception if it cannot be read.
+    using ConsumeDataByChunkCallback = WTF::Function<void (ExceptionOr<std::pair<const uint8_t*, size_t>>&&)>;
+    void consumeByChunk(FetchBodyOwner&, ConsumeDataByChunkCallback&&);
+
     bool isBlob() const { return WTF::holds_alternative<Ref<const Blob>>(m_data); }
     bool isFormData() const { return WTF::holds_alternative<Ref<FormData>>(m_data); }
     bool isArrayBuffer() const { return WTF::holds_alternative<Ref<const ArrayBuffer>>(m_data); }
@@ -69,6 +74,7 @@ public:
     bool isURLSearchParams() const { return WTF::holds_alternative<Ref<const URLSearchParams>>(m_data); }
     bool isText() const { return WTF::holds_alternative<String>(m_data); }
     bool isReadableStream() const { return m_isReadableStream; }
+    bool isEmpty() const { return WTF::holds_alternative<std::nullptr_t>(m_data) && !m_isReadableStream; }
 
     static std::optional<FetchBody> extract(ScriptExecutionContext&, JSC::ExecState&, JSC::JSValue, String&);
     static FetchBody loadingBody() { return { }; }
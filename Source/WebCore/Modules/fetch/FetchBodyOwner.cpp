@@ -186,6 +186,8 @@ void FetchBodyOwner::loadBlob(const Blob& blob, FetchBodyConsumer* consumer)
 
     if (!scriptExecutionContext()) {
         m_body->loadingFailed();
+        if (m_consumeDataCallback)
+            std::exchange(m_consumeDataCallback, nullptr)(Exception { TypeError, ASCIILiteral("Blob loading failed") });
         return;
     }
 
@@ -195,12 +197,22 @@ void FetchBodyOwner::loadBlob(const Blob& blob, FetchBodyConsumer* consumer)
     m_blobLoader->loader->start(*scriptExecutionContext(), blob);
     if (!m_blobLoader->loader->isStarted()) {
         m_body->loadingFailed();
+        if (m_consumeDataCallback)
+            std::exchange(m_consumeDataCallback, nullptr)(Exception { TypeError, ASCIILiteral("Blob loading failed") });
         m_blobLoader = std::nullopt;
         return;
     }
     setPendingActivity(this);
 }
 
+void FetchBodyOwner::loadBlob(const Blob& blob, FetchBody::ConsumeDataByChunkCallback&& callback)
+{
+    // Without a consumer, the loader hands each chunk to blobChunk().
+    ASSERT(!m_consumeDataCallback);
+    m_consumeDataCallback = WTFMove(callback);
+    loadBlob(blob, nullptr);
+}
+
 void FetchBodyOwner::finishBlobLoading()
 {
     ASSERT(m_blobLoader);
@@ -212,6 +224,8 @@ void FetchBodyOwner::finishBlobLoading()
 void FetchBodyOwner::blobLoadingSucceeded()
 {
     ASSERT(!isBodyNull());
+    if (m_consumeDataCallback)
+        std::exchange(m_consumeDataCallback, nullptr)(std::pair<const uint8_t*, size_t> { nullptr, 0 });
 #if ENABLE(STREAMS_API)
     if (m_readableStreamSource) {
         m_readableStreamSource->close();
@@ -225,6 +239,8 @@ void FetchBodyOwner::blobLoadingSucceeded()
 void FetchBodyOwner::blobLoadingFailed()
 {
     ASSERT(!isBodyNull());
+    if (m_consumeDataCallback)
+        std::exchange(m_consumeDataCallback, nullptr)(Exception { TypeError, ASCIILiteral("Blob loading failed") });
 #if ENABLE(STREAMS_API)
     if (m_readableStreamSource) {
         if (!m_readableStreamSource->isCancelling())
@@ -240,6 +256,11 @@ void FetchBodyOwner::blobLoadingFailed()
 void FetchBodyOwner::blobChunk(const char* data, size_t size)
 {
     ASSERT(data);
+    if (m_consumeDataCallback) {
+        if (size)
+            m_consumeDataCallback(std::pair<const uint8_t*, size_t> { reinterpret_cast<const uint8_t*>(data), size });
+        return;
+    }
 #if ENABLE(STREAMS_API)
     ASSERT(m_readableStreamSource);
     if (!m_readableStreamSource->enqueue(ArrayBuffer::tryCreate(data, size)))
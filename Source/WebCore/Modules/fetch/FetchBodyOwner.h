@@ -56,6 +56,7 @@ public:
     bool isDisturbedOrLocked() const;
 
     void loadBlob(const Blob&, FetchBodyConsumer*);
+    void loadBlob(const Blob&, FetchBody::ConsumeDataByChunkCallback&&);
 
     bool isActive() const { return !!m_blobLoader; }
 
@@ -101,6 +102,7 @@ protected:
 #if ENABLE(STREAMS_API)
     RefPtr<FetchResponseSource> m_readableStreamSource;
 #endif
+    FetchBody::ConsumeDataByChunkCallback m_consumeDataCallback;
     Ref<FetchHeaders> m_headers;
 
 private:
@@ -37,6 +37,7 @@
 #include "JSBlob.h"
 #include "JSFetchResponse.h"
 #include "ScriptExecutionContext.h"
+#include "SharedBuffer.h"
 
 namespace WebCore {
 
@@ -123,6 +124,9 @@ void FetchResponse::BodyLoader::didSucceed()
     ASSERT(m_response.hasPendingActivity());
     m_response.m_body->loadingSucceeded();
 
+    if (m_response.m_consumeDataCallback)
+        std::exchange(m_response.m_consumeDataCallback, nullptr)(std::pair<const uint8_t*, size_t> { nullptr, 0 });
+
 #if ENABLE(STREAMS_API)
     if (m_response.m_readableStreamSource && !m_response.body().consumer().hasData())
         m_response.closeStream();
@@ -140,6 +144,9 @@ void FetchResponse::BodyLoader::didFail()
     if (m_promise)
         std::exchange(m_promise, std::nullopt)->reject(TypeError);
 
+    if (m_response.m_consumeDataCallback)
+        std::exchange(m_response.m_consumeDataCallback, nullptr)(Exception { TypeError, ASCIILiteral("Loading failed") });
+
 #if ENABLE(STREAMS_API)
     if (m_response.m_readableStreamSource) {
         if (!m_response.m_readableStreamSource->isCancelling())
@@ -180,6 +187,12 @@ void FetchResponse::BodyLoader::didReceiveResponse(const ResourceResponse& resou
 
 void FetchResponse::BodyLoader::didReceiveData(const char* data, size_t size)
 {
+    if (m_response.m_consumeDataCallback) {
+        if (size)
+            m_response.m_consumeDataCallback(std::pair<const uint8_t*, size_t> { reinterpret_cast<const uint8_t*>(data), size });
+        return;
+    }
+
 #if ENABLE(STREAMS_API)
     ASSERT(m_response.m_readableStreamSource);
     auto& source = *m_response.m_readableStreamSource;
@@ -218,6 +231,36 @@ void FetchResponse::BodyLoader::stop()
         m_loader->stop();
 }
 
+RefPtr<SharedBuffer> FetchResponse::BodyLoader::startStreaming()
+{
+    ASSERT(m_loader);
+    return m_loader->startStreaming();
+}
+
+void FetchResponse::consumeBodyReceivedByChunk(ConsumeDataByChunkCallback&& callback)
+{
+    ASSERT(!m_consumeDataCallback);
+    ASSERT(!isDisturbedOrLocked());
+    m_isDisturbed = true;
+
+    if (isLoading()) {
+        // The loader buffered whatever arrived before this call; the rest goes straight to the callback.
+        RefPtr<SharedBuffer> data = m_bodyLoader->startStreaming();
+        if (data && data->size())
+            callback(std::pair<const uint8_t*, size_t> { reinterpret_cast<const uint8_t*>(data->data()), data->size() });
+        m_consumeDataCallback = WTFMove(callback);
+        return;
+    }
+
+    if (isBodyNull()) {
+        callback(std::pair<const uint8_t*, size_t> { nullptr, 0 });
+        return;
+    }
+
+    // Bodies that were fetched and fully received, and bodies set from script.
+    body().consumeByChunk(*this, WTFMove(callback));
+}
+
 void FetchResponse::consume(unsigned type, Ref<DeferredPromise>&& wrapper)
 {
     ASSERT(type <= static_cast<unsigned>(FetchBodyConsumer::Type::Text));
@@ -329,12 +372,6 @@ ReadableStreamSource* FetchResponse::createReadableStreamSource()
     return m_readableStreamSource.get();
 }
 
-RefPtr<SharedBuffer> FetchResponse::BodyLoader::startStreaming()
-{
-    ASSERT(m_loader);
-    return m_loader->startStreaming();
-}
-
 void FetchResponse::cancel()
 {
     m_isDisturbed = true;
@@ -347,6 +384,8 @@ void FetchResponse::stop()
 {
     RefPtr<FetchResponse> protectedThis(this);
     FetchBodyOwner::stop();
+    if (m_consumeDataCallback)
+        std::exchange(m_consumeDataCallback, nullptr)(Exception { ABORT_ERR, ASCIILiteral("Loading was stopped") });
     if (m_bodyLoader) {
         m_bodyLoader->stop();
         m_bodyLoader = std::nullopt;
@@ -84,6 +84,11 @@ public:
 
     bool isLoading() const { return !!m_bodyLoader; }
 
+    // Hands out the body as it is received rather than once it is complete: each chunk as it
+    // arrives, then an empty chunk once the whole body was delivered, or an exception if loading fails.
+    using ConsumeDataByChunkCallback = FetchBody::ConsumeDataByChunkCallback;
+    void consumeBodyReceivedByChunk(ConsumeDataByChunkCallback&&);
+
 private:
     FetchResponse(ScriptExecutionContext&, std::optional<FetchBody>&&, Ref<FetchHeaders>&&, ResourceResponse&&);
 
@@ -105,9 +110,7 @@ private:
         bool start(ScriptExecutionContext&, const FetchRequest&);
         void stop();
 
-#if ENABLE(STREAMS_API)
         RefPtr<SharedBuffer> startStreaming();
-#endif
 
     private:
         // FetchLoaderClient API
@@ -147,6 +147,7 @@ list(APPEND WebCore_SOURCES
     platform/network/soup/SocketStreamHandleImplSoup.cpp
     platform/network/soup/SoupNetworkSession.cpp
     platform/network/soup/SynchronousLoaderClientSoup.cpp
+    platform/network/soup/WebKitCachingResolver.cpp
     platform/network/soup/WebKitSoupRequestGeneric.cpp
     platform/network/soup/gwildcardproxyresolver.c
 
@@ -44,6 +44,13 @@
 #include "WorkerGlobalScope.h"
 #include <builtins/BuiltinNames.h>
 
+#if ENABLE(WEBASSEMBLY) && ENABLE(FETCH_API)
+#include "FetchResponse.h"
+#include "HTTPParsers.h"
+#include "JSFetchResponse.h"
+#include <wasm/WasmStreamingCompiler.h>
+#endif
+
 using namespace JSC;
 
 namespace WebCore {
@@ -238,6 +245,47 @@ Event* JSDOMGlobalObject::currentEvent() const
     return m_currentEvent;
 }
 
+#if ENABLE(WEBASSEMBLY) && ENABLE(FETCH_API)
+// Used by WebAssembly.compileStreaming and WebAssembly.instantiateStreaming, which compile the
+// body of a fetch Response while it is still being downloaded.
+void JSDOMGlobalObject::streamWebAssemblySource(JSGlobalObject*, ExecState* exec, JSValue source, Ref<Wasm::StreamingCompiler>&& compiler)
+{
+    VM& vm = exec->vm();
+    auto scope = DECLARE_THROW_SCOPE(vm);
+
+    auto* response = JSFetchResponse::toWrapped(vm, source);
+    if (!response) {
+        throwTypeError(exec, scope, ASCIILiteral("WebAssembly streaming source must be a Response"));
+        return;
+    }
+    if (response->isDisturbedOrLocked()) {
+        throwTypeError(exec, scope, ASCIILiteral("Response body has already been used"));
+        return;
+    }
+    if (!equalLettersIgnoringASCIICase(extractMIMETypeFromMediaType(response->headers().fastGet(HTTPHeaderName::ContentType)), "application/wasm")) {
+        throwTypeError(exec, scope, ASCIILiteral("Response has an unsupported MIME type, expected application/wasm"));
+        return;
+    }
+    if (!response->ok()) {
+        throwTypeError(exec, scope, ASCIILiteral("Response status is not ok"));
+        return;
+    }
+
+    response->consumeBodyReceivedByChunk([compiler = WTFMove(compiler)] (ExceptionOr<std::pair<const uint8_t*, size_t>>&& result) {
+        if (result.hasException()) {
+            compiler->fail(result.releaseException().releaseMessage());
+            return;
+        }
+        auto chunk = result.releaseReturnValue();
+        if (!chunk.second) {
+            compiler->finalize();
+            return;
+        }
+        compiler->addBytes(chunk.first, chunk.second);
+    });
+}
+#endif
+
 JSDOMGlobalObject* toJSDOMGlobalObject(Document* document, JSC::ExecState* exec)
 {
     return toJSDOMWindow(document->frame(), currentWorld(exec));
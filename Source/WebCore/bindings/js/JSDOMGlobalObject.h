@@ -55,6 +55,10 @@ namespace WebCore {
         void finishCreation(JSC::VM&);
         void finishCreation(JSC::VM&, JSC::JSObject*);
 
+#if ENABLE(WEBASSEMBLY) && ENABLE(FETCH_API)
+        static void streamWebAssemblySource(JSC::JSGlobalObject*, JSC::ExecState*, JSC::JSValue, Ref<JSC::Wasm::StreamingCompiler>&&);
+#endif
+
     public:
         Lock& gcLock() { return m_gcLock; }
 
@@ -74,7 +74,12 @@ const GlobalObjectMethodTable JSDOMWindowBase::s_globalObjectMethodTable = {
     nullptr, // moduleLoaderInstantiate
     &moduleLoaderEvaluate,
     &promiseRejectionTracker,
-    &defaultLanguage
+    &defaultLanguage,
+#if ENABLE(WEBASSEMBLY) && ENABLE(FETCH_API)
+    &streamWebAssemblySource,
+#else
+    nullptr, // streamWebAssemblySource
+#endif
 };
 
 JSDOMWindowBase::JSDOMWindowBase(VM& vm, Structure* structure, RefPtr<DOMWindow>&& window, JSDOMWindowShell* shell)
@@ -58,7 +58,12 @@ const GlobalObjectMethodTable JSWorkerGlobalScopeBase::s_globalObjectMethodTable
     nullptr, // moduleLoaderInstantiate
     nullptr, // moduleLoaderEvaluate
     nullptr, // promiseRejectionTracker
-    &defaultLanguage
+    &defaultLanguage,
+#if ENABLE(WEBASSEMBLY) && ENABLE(FETCH_API)
+    &streamWebAssemblySource,
+#else
+    nullptr, // streamWebAssemblySource
+#endif
 };
 
 JSWorkerGlobalScopeBase::JSWorkerGlobalScopeBase(JSC::VM& vm, JSC::Structure* structure, RefPtr<WorkerGlobalScope>&& impl)
@@ -26,9 +26,13 @@
 #include "config.h"
 #include "LoadableClassicScript.h"
 
+#include "CommonVM.h"
+#include "Logging.h"
 #include "ScriptElement.h"
 #include "ScriptSourceCode.h"
 #include "SubresourceIntegrity.h"
+#include <runtime/JSLock.h>
+#include <wtf/MainThread.h>
 #include <wtf/NeverDestroyed.h>
 #include <wtf/text/StringImpl.h>
 
@@ -48,7 +52,7 @@ LoadableClassicScript::~LoadableClassicScript()
 bool LoadableClassicScript::isLoaded() const
 {
     ASSERT(m_cachedScript);
-    return m_cachedScript->isLoaded();
+    return m_cachedScript->isLoaded() && !m_isGeneratingCode;
 }
 
 std::optional<LoadableScript::Error> LoadableClassicScript::error() const
@@ -104,13 +108,51 @@ void LoadableClassicScript::notifyFinished(CachedResource& resource)
         };
     }
 
+    if (!m_error && !resource.errorOccurred() && m_backgroundCodeGenerationPriority && generateCodeInBackground())
+        return;
+
+    notifyClientFinished();
+}
+
+bool LoadableClassicScript::generateCodeInBackground()
+{
+    StringView script = m_cachedScript->script();
+    if (!JSC::BackgroundCodeGenerator::shouldGenerate(script.length()))
+        return false;
+
+    m_isGeneratingCode = true;
+    m_codeGenerationStartTime = MonotonicTime::now();
+    JSC::BackgroundCodeGenerator::singleton().generate(script.toString(), m_cachedScript->url(), TextPosition(), *m_backgroundCodeGenerationPriority, [protectedThis = makeRef(*this)] (Ref<JSC::PrecompiledProgram>&& program) mutable {
+        callOnMainThread([protectedThis = WTFMove(protectedThis), program = WTFMove(program)] () mutable {
+            protectedThis->didGenerateCodeInBackground(WTFMove(program));
+        });
+    });
+    return true;
+}
+
+void LoadableClassicScript::didGenerateCodeInBackground(Ref<JSC::PrecompiledProgram>&& program)
+{
+    ASSERT(m_isGeneratingCode);
+    LOG(Loading, "LoadableClassicScript %p: background code generation for '%s' %s after %.2f ms (waited %.2f ms, generated in %.2f ms, encoded in %.2f ms, %zu bytes)", this, m_cachedScript->url().string().utf8().data(),
+        program->didSucceed() ? "finished" : "failed", (MonotonicTime::now() - m_codeGenerationStartTime).milliseconds(),
+        program->queueTime().milliseconds(), program->generationTime().milliseconds(), program->encodingTime().milliseconds(), program->encodedSize());
+
+    m_isGeneratingCode = false;
+    if (program->didSucceed())
+        m_precompiledProgram = WTFMove(program);
     notifyClientFinished();
 }
 
 void LoadableClassicScript::execute(ScriptElement& scriptElement)
 {
     ASSERT(!error());
-    scriptElement.executeClassicScript(ScriptSourceCode(m_cachedScript.get(), JSC::SourceProviderSourceType::Program, *this));
+    ScriptSourceCode sourceCode(m_cachedScript.get(), JSC::SourceProviderSourceType::Program, *this);
+    if (auto precompiledProgram = WTFMove(m_precompiledProgram)) {
+        JSC::VM& vm = commonVM();
+        JSC::JSLockHolder lock(vm);
+        JSC::BackgroundCodeGenerator::install(vm, sourceCode.jsSourceCode(), *precompiledProgram);
+    }
+    scriptElement.executeClassicScript(sourceCode);
 }
 
 bool LoadableClassicScript::load(Document& document, const URL& sourceURL)
@@ -30,6 +30,8 @@
 #include "CachedScript.h"
 #include "LoadableScript.h"
 #include "LoadableScriptClient.h"
+#include <runtime/BackgroundCodeGenerator.h>
+#include <wtf/MonotonicTime.h>
 #include <wtf/TypeCasts.h>
 
 namespace WebCore {
@@ -55,6 +57,11 @@ public:
 
     bool load(Document&, const URL&);
 
+    // Async and deferred scripts are not run as soon as they are loaded, so large ones are
+    // compiled off the main thread before clients are told that they finished loading.
+    // Deferred scripts hold back DOMContentLoaded, so they get a higher priority.
+    void setShouldGenerateCodeInBackground(JSC::BackgroundCodeGenerator::Priority priority) { m_backgroundCodeGenerationPriority = priority; }
+
 private:
     LoadableClassicScript(const String& nonce, const String& integrity, const String& crossOriginMode, const String& charset, const AtomicString& initiatorName, bool isInUserAgentShadowTree)
         : LoadableScript(nonce, crossOriginMode, charset, initiatorName, isInUserAgentShadowTree)
@@ -64,9 +71,16 @@ private:
 
     void notifyFinished(CachedResource&) final;
 
+    bool generateCodeInBackground();
+    void didGenerateCodeInBackground(Ref<JSC::PrecompiledProgram>&&);
+
     CachedResourceHandle<CachedScript> m_cachedScript { };
     std::optional<Error> m_error { std::nullopt };
     String m_integrity;
+    RefPtr<JSC::PrecompiledProgram> m_precompiledProgram;
+    MonotonicTime m_codeGenerationStartTime;
+    std::optional<JSC::BackgroundCodeGenerator::Priority> m_backgroundCodeGenerationPriority;
+    bool m_isGeneratingCode { false };
 };
 
 }
@@ -300,6 +300,10 @@ bool ScriptElement::requestClassicScript(const String& sourceURL)
             scriptCharset(),
             m_element.localName(),
             m_element.isInUserAgentShadowTree());
+        if (hasAsyncAttribute() || m_forceAsync)
+            script->setShouldGenerateCodeInBackground(JSC::BackgroundCodeGenerator::Priority::Normal);
+        else if (hasDeferAttribute())
+            script->setShouldGenerateCodeInBackground(JSC::BackgroundCodeGenerator::Priority::High);
         if (script->load(m_element.document(), m_element.document().completeURL(sourceURL))) {
             m_loadableScript = WTFMove(script);
             m_isExternalScript = true;
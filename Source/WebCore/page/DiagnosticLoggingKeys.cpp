@@ -533,6 +533,11 @@ String DiagnosticLoggingKeys::styleSheetKey()
     return ASCIILiteral("styleSheet");
 }
 
+String DiagnosticLoggingKeys::successfulSpeculativeDNSPrefetchKey()
+{
+    return ASCIILiteral("successfulSpeculativeDNSPrefetch");
+}
+
 String DiagnosticLoggingKeys::successfulSpeculativeWarmupWithRevalidationKey()
 {
     return ASCIILiteral("successfulSpeculativeWarmupWithRevalidation");
@@ -653,6 +658,11 @@ String DiagnosticLoggingKeys::visibleAndActiveStateKey()
     return ASCIILiteral("visibleAndActiveState");
 }
 
+String DiagnosticLoggingKeys::wastedSpeculativeDNSPrefetchKey()
+{
+    return ASCIILiteral("wastedSpeculativeDNSPrefetch");
+}
+
 String DiagnosticLoggingKeys::wastedSpeculativeWarmupWithRevalidationKey()
 {
     return ASCIILiteral("wastedSpeculativeWarmupWithRevalidation");
@@ -138,6 +138,7 @@ public:
     static String scriptKey();
     WEBCORE_EXPORT static String streamingMedia();
     static String styleSheetKey();
+    WEBCORE_EXPORT static String successfulSpeculativeDNSPrefetchKey();
     WEBCORE_EXPORT static String successfulSpeculativeWarmupWithRevalidationKey();
     WEBCORE_EXPORT static String successfulSpeculativeWarmupWithoutRevalidationKey();
     static String svgDocumentKey();
@@ -162,6 +163,7 @@ public:
     static String videoKey();
     WEBCORE_EXPORT static String visibleNonActiveStateKey();
     WEBCORE_EXPORT static String visibleAndActiveStateKey();
+    WEBCORE_EXPORT static String wastedSpeculativeDNSPrefetchKey();
     WEBCORE_EXPORT static String wastedSpeculativeWarmupWithRevalidationKey();
     WEBCORE_EXPORT static String wastedSpeculativeWarmupWithoutRevalidationKey();
     WEBCORE_EXPORT static String webGLStateKey();
@@ -53,6 +53,12 @@ SharedBuffer::SharedBuffer(MappedFileData&& fileData)
     m_segments.append(DataSegment::create(WTFMove(fileData)));
 }
 
+SharedBuffer::SharedBuffer(Ref<DataSegment>&& segment)
+    : m_size(segment->size())
+{
+    m_segments.append(WTFMove(segment));
+}
+
 SharedBuffer::SharedBuffer(Vector<char>&& data)
 {
     append(WTFMove(data));
@@ -74,6 +80,11 @@ Ref<SharedBuffer> SharedBuffer::create(Vector<char>&& vector)
     return adoptRef(*new SharedBuffer(WTFMove(vector)));
 }
 
+Ref<SharedBuffer> SharedBuffer::create(Ref<DataSegment>&& segment)
+{
+    return adoptRef(*new SharedBuffer(WTFMove(segment)));
+}
+
 void SharedBuffer::combineIntoOneSegment() const
 {
     if (m_segments.size() <= 1)
@@ -163,7 +174,8 @@ const char* SharedBuffer::DataSegment::data() const
 #if USE(SOUP)
         [](const GUniquePtr<SoupBuffer>& data) { return data->data; },
 #endif
-        [](const MappedFileData& data) { return reinterpret_cast<const char*>(data.data()); }
+        [](const MappedFileData& data) { return reinterpret_cast<const char*>(data.data()); },
+        [](const Provider& provider) { return provider.data(); }
     );
     return WTF::visit(visitor, m_immutableData);
 }
@@ -184,7 +196,8 @@ size_t SharedBuffer::DataSegment::size() const
 #if USE(SOUP)
         [](const GUniquePtr<SoupBuffer>& data) { return static_cast<size_t>(data->length); },
 #endif
-        [](const MappedFileData& data) { return data.size(); }
+        [](const MappedFileData& data) { return data.size(); },
+        [](const Provider& provider) { return provider.size(); }
     );
     return WTF::visit(visitor, m_immutableData);
 }
@@ -29,6 +29,7 @@
 #include "FileSystem.h"
 #include <runtime/ArrayBuffer.h>
 #include <wtf/Forward.h>
+#include <wtf/Function.h>
 #include <wtf/RefCounted.h>
 #include <wtf/ThreadSafeRefCounted.h>
 #include <wtf/Variant.h>
@@ -58,6 +59,7 @@ public:
     static RefPtr<SharedBuffer> createWithContentsOfFile(const String& filePath);
 
     static Ref<SharedBuffer> create(Vector<char>&&);
+    static Ref<SharedBuffer> create(Ref<DataSegment>&&);
     
 #if USE(FOUNDATION)
     RetainPtr<NSData> createNSData();
@@ -113,6 +115,13 @@ public:
 #endif
         static Ref<DataSegment> create(MappedFileData&& data) { return adoptRef(*new DataSegment(WTFMove(data))); }
 
+        // For data owned by someone else, for example a range of a file mapping that is shared by several buffers.
+        struct Provider {
+            Function<const char*()> data;
+            Function<size_t()> size;
+        };
+        static Ref<DataSegment> create(Provider&& provider) { return adoptRef(*new DataSegment(WTFMove(provider))); }
+
     private:
         DataSegment(Vector<char>&& data)
             : m_immutableData(WTFMove(data)) { }
@@ -126,6 +135,8 @@ public:
 #endif
         DataSegment(MappedFileData&& data)
             : m_immutableData(WTFMove(data)) { }
+        DataSegment(Provider&& provider)
+            : m_immutableData(WTFMove(provider)) { }
 
         Variant<Vector<char>,
 #if USE(CF)
@@ -134,7 +145,8 @@ public:
 #if USE(SOUP)
             GUniquePtr<SoupBuffer>,
 #endif
-            MappedFileData> m_immutableData;
+            MappedFileData,
+            Provider> m_immutableData;
         friend class SharedBuffer;
     };
 
@@ -150,6 +162,7 @@ private:
     explicit SharedBuffer(const unsigned char*, size_t);
     explicit SharedBuffer(Vector<char>&&);
     explicit SharedBuffer(MappedFileData&&);
+    explicit SharedBuffer(Ref<DataSegment>&&);
 #if USE(CF)
     explicit SharedBuffer(CFDataRef);
 #endif
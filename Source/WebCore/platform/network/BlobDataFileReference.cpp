@@ -28,6 +28,7 @@
 
 #include "File.h"
 #include "FileMetadata.h"
+#include "SharedBuffer.h"
 
 namespace WebCore {
 
@@ -41,12 +42,23 @@ BlobDataFileReference::BlobDataFileReference(const String& path)
 {
 }
 
+Ref<BlobDataFileReference> BlobDataFileReference::createForTemporaryFile(const String& path)
+{
+    auto reference = adoptRef(*new BlobDataFileReference(path));
+    reference->m_isTemporaryFile = true;
+    return reference;
+}
+
 BlobDataFileReference::~BlobDataFileReference()
 {
 #if ENABLE(FILE_REPLACEMENT)
     if (!m_replacementPath.isNull())
         deleteFile(m_replacementPath);
 #endif
+    if (m_isTemporaryFile) {
+        m_mappedData = nullptr;
+        deleteFile(m_path);
+    }
 }
 
 const String& BlobDataFileReference::path()
@@ -84,6 +96,21 @@ double BlobDataFileReference::expectedModificationTime()
     return m_expectedModificationTime;
 }
 
+SharedBuffer* BlobDataFileReference::mappedData()
+{
+    if (!m_isTemporaryFile)
+        return nullptr;
+
+    if (!m_didTryToMap) {
+        m_didTryToMap = true;
+        bool success;
+        MappedFileData mappedFileData(m_path, success);
+        if (success)
+            m_mappedData = SharedBuffer::create(SharedBuffer::DataSegment::create(WTFMove(mappedFileData)));
+    }
+    return m_mappedData.get();
+}
+
 void BlobDataFileReference::startTrackingModifications()
 {
     // This is not done automatically by the constructor, because BlobDataFileReference is
@@ -28,10 +28,13 @@
 
 #include "FileSystem.h"
 #include <wtf/RefCounted.h>
+#include <wtf/RefPtr.h>
 #include <wtf/text/WTFString.h>
 
 namespace WebCore {
 
+class SharedBuffer;
+
 class WEBCORE_EXPORT BlobDataFileReference : public RefCounted<BlobDataFileReference> {
 public:
     static Ref<BlobDataFileReference> create(const String& path)
@@ -39,6 +42,9 @@ public:
         return adoptRef(*new BlobDataFileReference(path));
     }
 
+    // For the temporary files BlobRegistryImpl moves large blob data to. The file is deleted with the reference.
+    static Ref<BlobDataFileReference> createForTemporaryFile(const String& path);
+
     virtual ~BlobDataFileReference();
 
     void startTrackingModifications();
@@ -47,6 +53,11 @@ public:
     unsigned long long size();
     double expectedModificationTime();
 
+    bool isTemporaryFile() const { return m_isTemporaryFile; }
+    // Only temporary files are mapped since nobody else can modify them. The mapping is created on
+    // first use and shared by all the readers, it is null if the file could not be mapped.
+    SharedBuffer* mappedData();
+
     virtual void prepareForFileAccess();
     virtual void revokeFileAccess();
 
@@ -65,6 +76,9 @@ private:
 #endif
     unsigned long long m_size;
     double m_expectedModificationTime;
+    bool m_isTemporaryFile { false };
+    bool m_didTryToMap { false };
+    RefPtr<SharedBuffer> m_mappedData;
 };
 
 }
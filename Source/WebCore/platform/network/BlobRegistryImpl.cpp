@@ -49,6 +49,14 @@
 
 namespace WebCore {
 
+// Blob data parts at least this large are moved to temporary files so that they don't stay in memory.
+static const size_t minimumDataSizeForFileBacking = 1024 * 1024;
+
+BlobRegistryImpl::BlobRegistryImpl()
+    : m_weakPtrFactory(this)
+{
+}
+
 BlobRegistryImpl::~BlobRegistryImpl()
 {
 }
@@ -139,6 +147,8 @@ void BlobRegistryImpl::registerBlobURL(const URL& url, Vector<BlobPart>&& blobPa
             auto movedData = part.moveData();
             auto data = ThreadSafeDataBuffer::create(WTFMove(movedData));
             blobData->appendData(data);
+            if (data.size() >= minimumDataSizeForFileBacking)
+                moveDataToTemporaryFile(data);
             break;
         }
         case BlobPart::Blob: {
@@ -247,6 +257,95 @@ static WorkQueue& blobUtilityQueue()
     return queue.get();
 }
 
+static bool writeDataToFile(PlatformFileHandle file, const Vector<uint8_t>& data)
+{
+    const char* bytes = reinterpret_cast<const char*>(data.data());
+    size_t remaining = data.size();
+    while (remaining) {
+        int length = static_cast<int>(std::min<size_t>(remaining, std::numeric_limits<int>::max()));
+        if (writeToFile(file, bytes, length) != length)
+            return false;
+        bytes += length;
+        remaining -= length;
+    }
+    return true;
+}
+
+void BlobRegistryImpl::moveDataToTemporaryFile(const ThreadSafeDataBuffer& data)
+{
+    ASSERT(isMainThread());
+
+    // The data stays in memory and can be read until it has been written, the items using it are then
+    // switched to the file in didMoveDataToTemporaryFile().
+    blobUtilityQueue().dispatch([weakThis = m_weakPtrFactory.createWeakPtr(), data]() mutable {
+        PlatformFileHandle file;
+        String path = openTemporaryFile(ASCIILiteral("Blob"), file);
+        if (path.isEmpty() || !isHandleValid(file)) {
+            LOG_ERROR("Failed to open temporary file for storing Blob data");
+            return;
+        }
+
+        bool success = writeDataToFile(file, *data.data());
+        closeFile(file);
+        if (!success) {
+            LOG_ERROR("Failed writing Blob data to temporary file %s", path.utf8().data());
+            deleteFile(path);
+            return;
+        }
+
+        callOnMainThread([weakThis = WTFMove(weakThis), data = WTFMove(data), path = path.isolatedCopy()] {
+            if (!weakThis) {
+                deleteFile(path);
+                return;
+            }
+            weakThis->didMoveDataToTemporaryFile(data, path);
+        });
+    });
+}
+
+void BlobRegistryImpl::didMoveDataToTemporaryFile(const ThreadSafeDataBuffer& data, const String& path)
+{
+    ASSERT(isMainThread());
+
+    auto usesData = [&data](const BlobDataItem& item) {
+        return item.type() == BlobDataItem::Type::Data && item.data().data() == data.data();
+    };
+
+    // BlobData items are not modified once registered since they may be being read, the blobs using the
+    // data are replaced instead. Slices of the data become slices of the file.
+    RefPtr<BlobDataFileReference> file;
+    HashMap<BlobData*, RefPtr<BlobData>> replacements;
+    for (auto& blobData : m_blobs.values()) {
+        if (replacements.contains(blobData.get()) || !std::any_of(blobData->items().begin(), blobData->items().end(), usesData))
+            continue;
+
+        if (!file) {
+            file = BlobDataFileReference::createForTemporaryFile(path);
+            file->startTrackingModifications();
+        }
+
+        auto replacement = BlobData::create(blobData->contentType());
+        for (auto& item : blobData->items()) {
+            if (usesData(item))
+                replacement->appendFile(file.get(), item.offset(), item.length());
+            else
+                replacement->m_items.append(item);
+        }
+        replacements.add(blobData.get(), WTFMove(replacement));
+    }
+
+    // Nobody uses the data anymore.
+    if (!file) {
+        deleteFile(path);
+        return;
+    }
+
+    for (auto& blobData : m_blobs.values()) {
+        if (auto replacement = replacements.get(blobData.get()))
+            blobData = WTFMove(replacement);
+    }
+}
+
 struct BlobForFileWriting {
     String blobURL;
     Vector<std::pair<String, ThreadSafeDataBuffer>> filePathsOrDataBuffers;
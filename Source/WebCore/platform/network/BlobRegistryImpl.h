@@ -35,6 +35,7 @@
 #include "BlobRegistry.h"
 #include "URLHash.h"
 #include <wtf/HashMap.h>
+#include <wtf/WeakPtr.h>
 #include <wtf/text/StringHash.h>
 #include <wtf/text/WTFString.h>
 
@@ -49,6 +50,7 @@ class ResourceRequest;
 class WEBCORE_EXPORT BlobRegistryImpl final : public BlobRegistry {
     WTF_MAKE_FAST_ALLOCATED;
 public:
+    BlobRegistryImpl();
     virtual ~BlobRegistryImpl();
 
     BlobData* getBlobDataFromURL(const URL&) const;
@@ -57,6 +59,8 @@ public:
 
 private:
     void appendStorageItems(BlobData*, const BlobDataItemList&, long long offset, long long length);
+    void moveDataToTemporaryFile(const ThreadSafeDataBuffer&);
+    void didMoveDataToTemporaryFile(const ThreadSafeDataBuffer&, const String& path);
 
     void registerFileBlobURL(const URL&, Ref<BlobDataFileReference>&&, const String& contentType) override;
     void registerBlobURL(const URL&, Vector<BlobPart>&&, const String& contentType) override;
@@ -71,6 +75,7 @@ private:
     void writeBlobsToTemporaryFiles(const Vector<String>& blobURLs, Function<void (const Vector<String>& filePaths)>&& completionHandler) override;
 
     HashMap<String, RefPtr<BlobData>> m_blobs;
+    WeakPtrFactory<BlobRegistryImpl> m_weakPtrFactory;
 };
 
 } // namespace WebCore
@@ -0,0 +1,309 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "DNSCache.h"
+
+#include "FileSystem.h"
+#include "Logging.h"
+#include "SharedBuffer.h"
+#include <wtf/MainThread.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/StringBuilder.h>
+
+namespace WebCore {
+
+// The system resolver does not expose the time to live of the records it returns, so use a
+// conservative default. Platforms that know the actual value pass it to store().
+static const Seconds defaultTimeToLive { 5_min };
+static const unsigned defaultCapacity = 256;
+
+// Coalesce disk writes, the cache is usually updated in bursts while a page loads.
+static const Seconds saveDelay { 10_s };
+
+DNSCache& DNSCache::singleton()
+{
+    static NeverDestroyed<DNSCache> cache;
+    return cache;
+}
+
+DNSCache::DNSCache()
+    : m_defaultTimeToLive(defaultTimeToLive)
+    , m_capacity(defaultCapacity)
+    , m_saveTimer(RunLoop::main(), this, &DNSCache::saveToPersistentStorage)
+{
+}
+
+std::optional<Vector<String>> DNSCache::lookup(const String& hostname)
+{
+    LockHolder locker(m_lock);
+    auto it = m_entries.find(hostname);
+    if (it == m_entries.end()) {
+        ++m_statistics.misses;
+        return std::nullopt;
+    }
+
+    auto now = WallTime::now();
+    if (it->value.expirationTime <= now) {
+        m_entries.remove(it);
+        ++m_statistics.expiredEntries;
+        ++m_statistics.misses;
+        return std::nullopt;
+    }
+
+    ++m_statistics.hits;
+    it->value.lastUsedTime = now;
+    return it->value.addresses;
+}
+
+bool DNSCache::hasValidEntry(const String& hostname)
+{
+    LockHolder locker(m_lock);
+    auto it = m_entries.find(hostname);
+    return it != m_entries.end() && it->value.expirationTime > WallTime::now();
+}
+
+void DNSCache::store(const String& hostname, Vector<String>&& addresses, std::optional<Seconds> timeToLive)
+{
+    if (hostname.isEmpty() || addresses.isEmpty())
+        return;
+
+    {
+        LockHolder locker(m_lock);
+        auto now = WallTime::now();
+        m_entries.set(hostname.isolatedCopy(), Entry { WTFMove(addresses), now + timeToLive.value_or(m_defaultTimeToLive), now });
+        evictIfNeeded(locker);
+        m_needsSave = true;
+    }
+
+    scheduleSave();
+}
+
+void DNSCache::remove(const String& hostname)
+{
+    {
+        LockHolder locker(m_lock);
+        if (!m_entries.remove(hostname))
+            return;
+        m_needsSave = true;
+    }
+
+    scheduleSave();
+}
+
+void DNSCache::clear()
+{
+    {
+        LockHolder locker(m_lock);
+        m_entries.clear();
+        m_hostnamesExcludedFromPersistentStorage.clear();
+        m_needsSave = true;
+    }
+
+    scheduleSave();
+}
+
+void DNSCache::excludeFromPersistentStorage(const String& hostname)
+{
+    if (hostname.isEmpty())
+        return;
+
+    {
+        LockHolder locker(m_lock);
+        if (!m_hostnamesExcludedFromPersistentStorage.add(hostname.isolatedCopy()).isNewEntry || !m_entries.contains(hostname))
+            return;
+        // The host might have been saved already when it was loaded by a persistent session.
+        m_needsSave = true;
+    }
+
+    scheduleSave();
+}
+
+Vector<String> DNSCache::mostRecentlyUsedHostnames(size_t maximumCount)
+{
+    Vector<std::pair<WallTime, String>> hostnames;
+    {
+        LockHolder locker(m_lock);
+        hostnames.reserveInitialCapacity(m_entries.size());
+        for (auto& entry : m_entries)
+            hostnames.uncheckedAppend({ entry.value.lastUsedTime, entry.key.isolatedCopy() });
+    }
+
+    std::sort(hostnames.begin(), hostnames.end(), [](auto& a, auto& b) {
+        return a.first > b.first;
+    });
+
+    Vector<String> result;
+    result.reserveInitialCapacity(std::min(maximumCount, hostnames.size()));
+    for (size_t i = 0; i < hostnames.size() && i < maximumCount; ++i)
+        result.uncheckedAppend(WTFMove(hostnames[i].second));
+    return result;
+}
+
+void DNSCache::setDefaultTimeToLive(Seconds timeToLive)
+{
+    LockHolder locker(m_lock);
+    m_defaultTimeToLive = timeToLive;
+}
+
+void DNSCache::setCapacity(unsigned capacity)
+{
+    LockHolder locker(m_lock);
+    m_capacity = capacity;
+    evictIfNeeded(locker);
+}
+
+void DNSCache::evictIfNeeded(const AbstractLocker&)
+{
+    while (m_entries.size() > m_capacity) {
+        auto leastRecentlyUsed = m_entries.begin();
+        for (auto it = m_entries.begin(), end = m_entries.end(); it != end; ++it) {
+            if (it->value.lastUsedTime < leastRecentlyUsed->value.lastUsedTime)
+                leastRecentlyUsed = it;
+        }
+        m_entries.remove(leastRecentlyUsed);
+        ++m_statistics.evictedEntries;
+    }
+}
+
+auto DNSCache::statistics() -> Statistics
+{
+    LockHolder locker(m_lock);
+    return m_statistics;
+}
+
+void DNSCache::resetStatistics()
+{
+    LockHolder locker(m_lock);
+    m_statistics = { };
+}
+
+void DNSCache::setPersistentStoragePath(const String& path)
+{
+    ASSERT(isMainThread());
+    m_persistentStoragePath = path;
+    if (!m_persistentStoragePath.isEmpty())
+        loadFromPersistentStorage();
+}
+
+// Every line of the file is an entry of the form:
+// <host name> <expiration time> <last used time> <address>[,<address>...]
+// Expired entries are kept too, they are not used to answer lookups but they still tell
+// which hosts are worth resolving ahead of time.
+void DNSCache::loadFromPersistentStorage()
+{
+    auto buffer = SharedBuffer::createWithContentsOfFile(m_persistentStoragePath);
+    if (!buffer)
+        return;
+
+    Vector<String> lines;
+    String::fromUTF8(buffer->data(), buffer->size()).split('\n', lines);
+
+    LockHolder locker(m_lock);
+    for (auto& line : lines) {
+        Vector<String> fields;
+        line.split(' ', fields);
+        if (fields.size() != 4)
+            continue;
+
+        bool expirationTimeIsValid;
+        auto expirationTime = WallTime::fromRawSeconds(fields[1].toDouble(&expirationTimeIsValid));
+        bool lastUsedTimeIsValid;
+        auto lastUsedTime = WallTime::fromRawSeconds(fields[2].toDouble(&lastUsedTimeIsValid));
+        if (!expirationTimeIsValid || !lastUsedTimeIsValid)
+            continue;
+
+        Vector<String> addresses;
+        fields[3].split(',', addresses);
+        if (addresses.isEmpty())
+            continue;
+
+        m_entries.add(fields[0], Entry { WTFMove(addresses), expirationTime, lastUsedTime });
+    }
+    evictIfNeeded(locker);
+
+    LOG(Network, "DNSCache: loaded %u entries from %s", m_entries.size(), m_persistentStoragePath.utf8().data());
+}
+
+void DNSCache::scheduleSave()
+{
+    if (!isMainThread()) {
+        callOnMainThread([] {
+            DNSCache::singleton().scheduleSave();
+        });
+        return;
+    }
+
+    if (m_persistentStoragePath.isEmpty() || m_saveTimer.isActive())
+        return;
+
+    m_saveTimer.startOneShot(saveDelay);
+}
+
+void DNSCache::saveToPersistentStorage()
+{
+    ASSERT(isMainThread());
+    m_saveTimer.stop();
+    if (m_persistentStoragePath.isEmpty())
+        return;
+
+    StringBuilder builder;
+    {
+        LockHolder locker(m_lock);
+        if (!m_needsSave)
+            return;
+        m_needsSave = false;
+
+        for (auto& entry : m_entries) {
+            if (m_hostnamesExcludedFromPersistentStorage.contains(entry.key))
+                continue;
+            builder.append(entry.key);
+            builder.append(' ');
+            builder.appendECMAScriptNumber(entry.value.expirationTime.secondsSinceEpoch().value());
+            builder.append(' ');
+            builder.appendECMAScriptNumber(entry.value.lastUsedTime.secondsSinceEpoch().value());
+            builder.append(' ');
+            for (size_t i = 0; i < entry.value.addresses.size(); ++i) {
+                if (i)
+                    builder.append(',');
+                builder.append(entry.value.addresses[i]);
+            }
+            builder.append('\n');
+        }
+    }
+
+    // Remove the previous file first, not every platform truncates files opened for writing.
+    makeAllDirectories(directoryName(m_persistentStoragePath));
+    deleteFile(m_persistentStoragePath);
+    auto handle = openFile(m_persistentStoragePath, OpenForWrite);
+    if (!isHandleValid(handle))
+        return;
+
+    auto data = builder.toString().utf8();
+    writeToFile(handle, data.data(), data.length());
+    closeFile(handle);
+}
+
+} // namespace WebCore
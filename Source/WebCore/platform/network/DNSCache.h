@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <wtf/HashMap.h>
+#include <wtf/HashSet.h>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Optional.h>
+#include <wtf/RunLoop.h>
+#include <wtf/Vector.h>
+#include <wtf/WallTime.h>
+#include <wtf/text/StringHash.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebCore {
+
+// In-process cache of host name resolutions. Addresses are kept as strings so that the cache
+// does not depend on the platform resolver. The cache is thread safe, because resolvers might
+// call into it from worker threads, and it can be persisted to disk so that hosts visited in
+// a previous run can be resolved ahead of time.
+class DNSCache {
+    WTF_MAKE_NONCOPYABLE(DNSCache); WTF_MAKE_FAST_ALLOCATED;
+    friend NeverDestroyed<DNSCache>;
+public:
+    WEBCORE_EXPORT static DNSCache& singleton();
+
+    struct Statistics {
+        uint64_t hits { 0 };
+        uint64_t misses { 0 };
+        uint64_t expiredEntries { 0 };
+        uint64_t evictedEntries { 0 };
+
+        double hitRate() const { return hits + misses ? static_cast<double>(hits) / (hits + misses) : 0; }
+    };
+
+    WEBCORE_EXPORT std::optional<Vector<String>> lookup(const String& hostname);
+    WEBCORE_EXPORT bool hasValidEntry(const String& hostname);
+    // Platforms that know the time to live of the records should pass it, otherwise the default one is used.
+    WEBCORE_EXPORT void store(const String& hostname, Vector<String>&& addresses, std::optional<Seconds> timeToLive = std::nullopt);
+    WEBCORE_EXPORT void remove(const String& hostname);
+    WEBCORE_EXPORT void clear();
+
+    WEBCORE_EXPORT Vector<String> mostRecentlyUsedHostnames(size_t maximumCount);
+
+    WEBCORE_EXPORT void setDefaultTimeToLive(Seconds);
+    WEBCORE_EXPORT void setCapacity(unsigned);
+
+    WEBCORE_EXPORT void setPersistentStoragePath(const String&);
+    WEBCORE_EXPORT void saveToPersistentStorage();
+    // The resolver is shared by all the sessions of the process, so the hosts loaded by ephemeral
+    // sessions are cached like any other, but they must never be written to disk.
+    WEBCORE_EXPORT void excludeFromPersistentStorage(const String& hostname);
+
+    WEBCORE_EXPORT Statistics statistics();
+    WEBCORE_EXPORT void resetStatistics();
+
+private:
+    DNSCache();
+
+    struct Entry {
+        Vector<String> addresses;
+        WallTime expirationTime;
+        WallTime lastUsedTime;
+    };
+
+    void evictIfNeeded(const AbstractLocker&);
+    void loadFromPersistentStorage();
+    void scheduleSave();
+
+    Lock m_lock;
+    HashMap<String, Entry> m_entries;
+    Seconds m_defaultTimeToLive;
+    unsigned m_capacity;
+    Statistics m_statistics;
+
+    String m_persistentStoragePath;
+    HashSet<String> m_hostnamesExcludedFromPersistentStorage;
+    bool m_needsSave { false };
+    RunLoop::Timer<DNSCache> m_saveTimer;
+};
+
+} // namespace WebCore
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "DOMCookieCache.h"
+
+#include "URL.h"
+#include <wtf/text/StringBuilder.h>
+
+namespace WebCore {
+
+static const Seconds defaultMaximumAge { 5_s };
+static const unsigned maximumEntryCount = 256;
+
+DOMCookieCache::DOMCookieCache()
+    : m_maximumAge(defaultMaximumAge)
+{
+}
+
+static String cacheKey(const URL& firstParty, const URL& url)
+{
+    StringBuilder key;
+    key.append(firstParty.string());
+    key.append('\n');
+    // The fragment doesn't change the cookies, other parts of the URL can.
+    key.append(url.serialize(true));
+    return key.toString();
+}
+
+std::optional<String> DOMCookieCache::cookiesForDOM(const URL& firstParty, const URL& url)
+{
+    auto it = m_entries.find(cacheKey(firstParty, url));
+    if (it == m_entries.end()) {
+        ++m_statistics.misses;
+        return std::nullopt;
+    }
+
+    if (it->value.expirationTime <= MonotonicTime::now()) {
+        m_entries.remove(it);
+        ++m_statistics.misses;
+        return std::nullopt;
+    }
+
+    ++m_statistics.hits;
+    return it->value.cookies;
+}
+
+void DOMCookieCache::add(const URL& firstParty, const URL& url, const String& cookies, Seconds timeToLive)
+{
+    timeToLive = std::min(timeToLive, m_maximumAge);
+    if (timeToLive <= 0_s)
+        return;
+
+    // Pages read the cookies of a few URLs only, don't bother with a replacement policy.
+    if (m_entries.size() >= maximumEntryCount)
+        m_entries.clear();
+
+    m_entries.set(cacheKey(firstParty, url), Entry { cookies, MonotonicTime::now() + timeToLive });
+}
+
+void DOMCookieCache::clear()
+{
+    m_entries.clear();
+}
+
+} // namespace WebCore
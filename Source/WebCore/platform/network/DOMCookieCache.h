@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <wtf/HashMap.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/Optional.h>
+#include <wtf/Seconds.h>
+#include <wtf/text/StringHash.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebCore {
+
+class URL;
+
+// Cache of the document.cookie strings for processes that get them from the process owning the
+// cookie jar. Entries are keyed by first party and URL, since both decide which cookies are visible,
+// and only hold what cookiesForDOM() returned, so HttpOnly cookies never get here. The owner has to
+// clear the cache when the cookie jar changes or when a document sets a cookie. A cookie jar doesn't
+// report cookies reaching their expiration date, so entries expire with the first of their cookies,
+// and after a few seconds at most.
+class DOMCookieCache {
+    WTF_MAKE_NONCOPYABLE(DOMCookieCache); WTF_MAKE_FAST_ALLOCATED;
+public:
+    WEBCORE_EXPORT DOMCookieCache();
+
+    struct Statistics {
+        uint64_t hits { 0 };
+        uint64_t misses { 0 };
+    };
+
+    WEBCORE_EXPORT std::optional<String> cookiesForDOM(const URL& firstParty, const URL&);
+    WEBCORE_EXPORT void add(const URL& firstParty, const URL&, const String& cookies, Seconds timeToLive);
+    WEBCORE_EXPORT void clear();
+
+    unsigned size() const { return m_entries.size(); }
+    const Statistics& statistics() const { return m_statistics; }
+
+    void setMaximumAge(Seconds maximumAge) { m_maximumAge = maximumAge; }
+
+private:
+    struct Entry {
+        String cookies;
+        MonotonicTime expirationTime;
+    };
+
+    HashMap<String, Entry> m_entries;
+    Seconds m_maximumAge;
+    Statistics m_statistics;
+};
+
+} // namespace WebCore
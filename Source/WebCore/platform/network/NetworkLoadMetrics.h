@@ -81,6 +81,8 @@ public:
         copy.responseHeaderBytesReceived = responseHeaderBytesReceived;
         copy.responseBodyBytesReceived = responseBodyBytesReceived;
         copy.responseBodyDecodedSize = responseBodyDecodedSize;
+        copy.responseBodyReadCount = responseBodyReadCount;
+        copy.queueingDelay = queueingDelay;
 
         return copy;
     }
@@ -106,6 +108,8 @@ public:
         responseHeaderBytesReceived = std::nullopt;
         responseBodyBytesReceived = std::nullopt;
         responseBodyDecodedSize = std::nullopt;
+        responseBodyReadCount = std::nullopt;
+        queueingDelay = std::nullopt;
     }
 
     void clearNonTimingData()
@@ -119,6 +123,8 @@ public:
         responseHeaderBytesReceived = std::nullopt;
         responseBodyBytesReceived = std::nullopt;
         responseBodyDecodedSize = std::nullopt;
+        responseBodyReadCount = std::nullopt;
+        queueingDelay = std::nullopt;
     }
 
     bool operator==(const NetworkLoadMetrics& other) const
@@ -141,7 +147,9 @@ public:
             && requestBodyBytesSent == other.requestBodyBytesSent
             && responseHeaderBytesReceived == other.responseHeaderBytesReceived
             && responseBodyBytesReceived == other.responseBodyBytesReceived
-            && responseBodyDecodedSize == other.responseBodyDecodedSize;
+            && responseBodyDecodedSize == other.responseBodyDecodedSize
+            && responseBodyReadCount == other.responseBodyReadCount
+            && queueingDelay == other.queueingDelay;
     }
 
     bool operator!=(const NetworkLoadMetrics& other) const
@@ -182,6 +190,12 @@ public:
     std::optional<uint64_t> responseHeaderBytesReceived;
     std::optional<uint64_t> responseBodyBytesReceived;
     std::optional<uint64_t> responseBodyDecodedSize;
+
+    // Number of read operations the network backend needed to receive the response body.
+    std::optional<uint64_t> responseBodyReadCount;
+
+    // Time the load spent waiting in the network process load scheduler before hitting the network.
+    std::optional<Seconds> queueingDelay;
 };
 
 #if PLATFORM(COCOA)
@@ -214,6 +228,8 @@ void NetworkLoadMetrics::encode(Encoder& encoder) const
     encoder << responseHeaderBytesReceived;
     encoder << responseBodyBytesReceived;
     encoder << responseBodyDecodedSize;
+    encoder << responseBodyReadCount;
+    encoder << queueingDelay;
 }
 
 template<class Decoder>
@@ -237,7 +253,9 @@ bool NetworkLoadMetrics::decode(Decoder& decoder, NetworkLoadMetrics& metrics)
         && decoder.decode(metrics.requestBodyBytesSent)
         && decoder.decode(metrics.responseHeaderBytesReceived)
         && decoder.decode(metrics.responseBodyBytesReceived)
-        && decoder.decode(metrics.responseBodyDecodedSize);
+        && decoder.decode(metrics.responseBodyDecodedSize)
+        && decoder.decode(metrics.responseBodyReadCount)
+        && decoder.decode(metrics.queueingDelay);
 }
 
 } // namespace WebCore
@@ -26,6 +26,7 @@
 
 #include "config.h"
 #include "DNS.h"
+#include "DNSCache.h"
 #include "DNSResolveQueue.h"
 
 #if USE(SOUP)
@@ -104,6 +105,10 @@ void prefetchDNS(const String& hostname)
     if (hostname.isEmpty())
         return;
 
+    // Nothing to gain from a prefetch if the resolver will answer from the cache anyway.
+    if (DNSCache::singleton().hasValidEntry(hostname))
+        return;
+
     DNSResolveQueue::singleton().add(hostname);
 }
 
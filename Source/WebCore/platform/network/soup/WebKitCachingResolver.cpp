@@ -0,0 +1,292 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "WebKitCachingResolver.h"
+
+#if USE(SOUP)
+
+#include "DNSCache.h"
+#include <wtf/glib/GRefPtr.h>
+#include <wtf/glib/GUniquePtr.h>
+#include <wtf/text/CString.h>
+
+using namespace WebCore;
+
+G_DEFINE_TYPE(WebKitCachingResolver, webkit_caching_resolver, G_TYPE_RESOLVER)
+
+struct _WebKitCachingResolverPrivate {
+    GRefPtr<GResolver> wrappedResolver;
+};
+
+static GResolver* wrappedResolver(GResolver* resolver)
+{
+    return WEBKIT_CACHING_RESOLVER(resolver)->priv->wrappedResolver.get();
+}
+
+static GList* addressListFromCache(const Vector<String>& addresses)
+{
+    GList* list = nullptr;
+    for (auto& address : addresses) {
+        if (auto* inetAddress = g_inet_address_new_from_string(address.utf8().data()))
+            list = g_list_prepend(list, inetAddress);
+    }
+    return g_list_reverse(list);
+}
+
+static void storeAddressListInCache(const char* hostname, GList* addresses)
+{
+    Vector<String> addressStrings;
+    for (GList* item = addresses; item; item = g_list_next(item)) {
+        GUniquePtr<char> address(g_inet_address_to_string(G_INET_ADDRESS(item->data)));
+        addressStrings.append(String::fromUTF8(address.get()));
+    }
+    DNSCache::singleton().store(String::fromUTF8(hostname), WTFMove(addressStrings));
+}
+
+static GList* lookupInCache(const char* hostname)
+{
+    auto addresses = DNSCache::singleton().lookup(String::fromUTF8(hostname));
+    if (!addresses)
+        return nullptr;
+    return addressListFromCache(addresses.value());
+}
+
+static GList* webkitCachingResolverLookupByName(GResolver* resolver, const char* hostname, GCancellable* cancellable, GError** error)
+{
+    if (GList* addresses = lookupInCache(hostname))
+        return addresses;
+
+    GList* addresses = g_resolver_lookup_by_name(wrappedResolver(resolver), hostname, cancellable, error);
+    if (addresses)
+        storeAddressListInCache(hostname, addresses);
+    return addresses;
+}
+
+static void lookupByNameCallback(GResolver* wrappedResolver, GAsyncResult* result, GTask* task)
+{
+    GRefPtr<GTask> protectedTask = adoptGRef(task);
+    GError* error = nullptr;
+    GList* addresses = g_resolver_lookup_by_name_finish(wrappedResolver, result, &error);
+    if (!addresses) {
+        g_task_return_error(task, error);
+        return;
+    }
+
+    storeAddressListInCache(static_cast<const char*>(g_task_get_task_data(task)), addresses);
+    g_task_return_pointer(task, addresses, reinterpret_cast<GDestroyNotify>(g_resolver_free_addresses));
+}
+
+static void webkitCachingResolverLookupByNameAsync(GResolver* resolver, const char* hostname, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer userData)
+{
+    GRefPtr<GTask> task = adoptGRef(g_task_new(resolver, cancellable, callback, userData));
+    if (GList* addresses = lookupInCache(hostname)) {
+        g_task_return_pointer(task.get(), addresses, reinterpret_cast<GDestroyNotify>(g_resolver_free_addresses));
+        return;
+    }
+
+    g_task_set_task_data(task.get(), g_strdup(hostname), g_free);
+    g_resolver_lookup_by_name_async(wrappedResolver(resolver), hostname, cancellable,
+        reinterpret_cast<GAsyncReadyCallback>(lookupByNameCallback), task.leakRef());
+}
+
+static GList* webkitCachingResolverLookupByNameFinish(GResolver* resolver, GAsyncResult* result, GError** error)
+{
+    g_return_val_if_fail(g_task_is_valid(result, resolver), nullptr);
+    return static_cast<GList*>(g_task_propagate_pointer(G_TASK(result), error));
+}
+
+static char* webkitCachingResolverLookupByAddress(GResolver* resolver, GInetAddress* address, GCancellable* cancellable, GError** error)
+{
+    return g_resolver_lookup_by_address(wrappedResolver(resolver), address, cancellable, error);
+}
+
+static void lookupByAddressCallback(GResolver* wrappedResolver, GAsyncResult* result, GTask* task)
+{
+    GRefPtr<GTask> protectedTask = adoptGRef(task);
+    GError* error = nullptr;
+    if (char* hostname = g_resolver_lookup_by_address_finish(wrappedResolver, result, &error))
+        g_task_return_pointer(task, hostname, g_free);
+    else
+        g_task_return_error(task, error);
+}
+
+static void webkitCachingResolverLookupByAddressAsync(GResolver* resolver, GInetAddress* address, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer userData)
+{
+    GTask* task = g_task_new(resolver, cancellable, callback, userData);
+    g_resolver_lookup_by_address_async(wrappedResolver(resolver), address, cancellable,
+        reinterpret_cast<GAsyncReadyCallback>(lookupByAddressCallback), task);
+}
+
+static char* webkitCachingResolverLookupByAddressFinish(GResolver* resolver, GAsyncResult* result, GError** error)
+{
+    g_return_val_if_fail(g_task_is_valid(result, resolver), nullptr);
+    return static_cast<char*>(g_task_propagate_pointer(G_TASK(result), error));
+}
+
+static GList* webkitCachingResolverLookupRecords(GResolver* resolver, const char* rrname, GResolverRecordType recordType, GCancellable* cancellable, GError** error)
+{
+    return g_resolver_lookup_records(wrappedResolver(resolver), rrname, recordType, cancellable, error);
+}
+
+static void freeRecords(GList* records)
+{
+    g_list_free_full(records, reinterpret_cast<GDestroyNotify>(g_variant_unref));
+}
+
+static void lookupRecordsCallback(GResolver* wrappedResolver, GAsyncResult* result, GTask* task)
+{
+    GRefPtr<GTask> protectedTask = adoptGRef(task);
+    GError* error = nullptr;
+    if (GList* records = g_resolver_lookup_records_finish(wrappedResolver, result, &error))
+        g_task_return_pointer(task, records, reinterpret_cast<GDestroyNotify>(freeRecords));
+    else
+        g_task_return_error(task, error);
+}
+
+static void webkitCachingResolverLookupRecordsAsync(GResolver* resolver, const char* rrname, GResolverRecordType recordType, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer userData)
+{
+    GTask* task = g_task_new(resolver, cancellable, callback, userData);
+    g_resolver_lookup_records_async(wrappedResolver(resolver), rrname, recordType, cancellable,
+        reinterpret_cast<GAsyncReadyCallback>(lookupRecordsCallback), task);
+}
+
+static GList* webkitCachingResolverLookupRecordsFinish(GResolver* resolver, GAsyncResult* result, GError** error)
+{
+    g_return_val_if_fail(g_task_is_valid(result, resolver), nullptr);
+    return static_cast<GList*>(g_task_propagate_pointer(G_TASK(result), error));
+}
+
+// The service lookup virtual methods receive the already built record name, which the public
+// API of the wrapped resolver doesn't accept, so they are implemented on top of SRV records.
+static GList* serviceTargetsFromRecords(GList* records)
+{
+    GList* targets = nullptr;
+    for (GList* item = records; item; item = g_list_next(item)) {
+        guint16 priority, weight, port;
+        const char* target;
+        g_variant_get(static_cast<GVariant*>(item->data), "(qqq&s)", &priority, &weight, &port, &target);
+        targets = g_list_prepend(targets, g_srv_target_new(target, port, priority, weight));
+    }
+    freeRecords(records);
+    return g_srv_target_list_sort(targets);
+}
+
+static void freeServiceTargets(GList* targets)
+{
+    g_list_free_full(targets, reinterpret_cast<GDestroyNotify>(g_srv_target_free));
+}
+
+static GList* webkitCachingResolverLookupService(GResolver* resolver, const char* rrname, GCancellable* cancellable, GError** error)
+{
+    GList* records = g_resolver_lookup_records(wrappedResolver(resolver), rrname, G_RESOLVER_RECORD_SRV, cancellable, error);
+    return records ? serviceTargetsFromRecords(records) : nullptr;
+}
+
+static void lookupServiceCallback(GResolver* wrappedResolver, GAsyncResult* result, GTask* task)
+{
+    GRefPtr<GTask> protectedTask = adoptGRef(task);
+    GError* error = nullptr;
+    if (GList* records = g_resolver_lookup_records_finish(wrappedResolver, result, &error))
+        g_task_return_pointer(task, serviceTargetsFromRecords(records), reinterpret_cast<GDestroyNotify>(freeServiceTargets));
+    else
+        g_task_return_error(task, error);
+}
+
+static void webkitCachingResolverLookupServiceAsync(GResolver* resolver, const char* rrname, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer userData)
+{
+    GTask* task = g_task_new(resolver, cancellable, callback, userData);
+    g_resolver_lookup_records_async(wrappedResolver(resolver), rrname, G_RESOLVER_RECORD_SRV, cancellable,
+        reinterpret_cast<GAsyncReadyCallback>(lookupServiceCallback), task);
+}
+
+static GList* webkitCachingResolverLookupServiceFinish(GResolver* resolver, GAsyncResult* result, GError** error)
+{
+    g_return_val_if_fail(g_task_is_valid(result, resolver), nullptr);
+    return static_cast<GList*>(g_task_propagate_pointer(G_TASK(result), error));
+}
+
+static void webkitCachingResolverReload(GResolver*)
+{
+    // The system configuration changed (e.g. /etc/resolv.conf was modified), cached answers might be stale.
+    DNSCache::singleton().clear();
+}
+
+static void webkitCachingResolverFinalize(GObject* object)
+{
+    WEBKIT_CACHING_RESOLVER(object)->priv->~WebKitCachingResolverPrivate();
+    G_OBJECT_CLASS(webkit_caching_resolver_parent_class)->finalize(object);
+}
+
+static void webkit_caching_resolver_init(WebKitCachingResolver* resolver)
+{
+    WebKitCachingResolverPrivate* priv = G_TYPE_INSTANCE_GET_PRIVATE(resolver, WEBKIT_TYPE_CACHING_RESOLVER, WebKitCachingResolverPrivate);
+    resolver->priv = priv;
+    new (priv) WebKitCachingResolverPrivate();
+}
+
+static void webkit_caching_resolver_class_init(WebKitCachingResolverClass* cachingResolverClass)
+{
+    GObjectClass* gObjectClass = G_OBJECT_CLASS(cachingResolverClass);
+    gObjectClass->finalize = webkitCachingResolverFinalize;
+
+    GResolverClass* resolverClass = G_RESOLVER_CLASS(cachingResolverClass);
+    resolverClass->reload = webkitCachingResolverReload;
+    resolverClass->lookup_by_name = webkitCachingResolverLookupByName;
+    resolverClass->lookup_by_name_async = webkitCachingResolverLookupByNameAsync;
+    resolverClass->lookup_by_name_finish = webkitCachingResolverLookupByNameFinish;
+    resolverClass->lookup_by_address = webkitCachingResolverLookupByAddress;
+    resolverClass->lookup_by_address_async = webkitCachingResolverLookupByAddressAsync;
+    resolverClass->lookup_by_address_finish = webkitCachingResolverLookupByAddressFinish;
+    resolverClass->lookup_service = webkitCachingResolverLookupService;
+    resolverClass->lookup_service_async = webkitCachingResolverLookupServiceAsync;
+    resolverClass->lookup_service_finish = webkitCachingResolverLookupServiceFinish;
+    resolverClass->lookup_records = webkitCachingResolverLookupRecords;
+    resolverClass->lookup_records_async = webkitCachingResolverLookupRecordsAsync;
+    resolverClass->lookup_records_finish = webkitCachingResolverLookupRecordsFinish;
+
+    g_type_class_add_private(cachingResolverClass, sizeof(WebKitCachingResolverPrivate));
+}
+
+GResolver* webkitCachingResolverNew(GResolver* wrappedResolver)
+{
+    g_return_val_if_fail(G_IS_RESOLVER(wrappedResolver), nullptr);
+
+    auto* resolver = WEBKIT_CACHING_RESOLVER(g_object_new(WEBKIT_TYPE_CACHING_RESOLVER, nullptr));
+    resolver->priv->wrappedResolver = wrappedResolver;
+    return G_RESOLVER(resolver);
+}
+
+void webkitCachingResolverInstall()
+{
+    GRefPtr<GResolver> defaultResolver = adoptGRef(g_resolver_get_default());
+    if (WEBKIT_IS_CACHING_RESOLVER(defaultResolver.get()))
+        return;
+
+    GRefPtr<GResolver> cachingResolver = adoptGRef(webkitCachingResolverNew(defaultResolver.get()));
+    g_resolver_set_default(cachingResolver.get());
+}
+
+#endif // USE(SOUP)
@@ -52,6 +52,7 @@
 #include <WebCore/ResourceLoaderOptions.h>
 #include <WebCore/ResourceRequest.h>
 #include <WebCore/SessionID.h>
+#include <wtf/CurrentTime.h>
 
 #if USE(NETWORK_SESSION)
 #include "PingLoad.h"
@@ -69,6 +70,10 @@ Ref<NetworkConnectionToWebProcess> NetworkConnectionToWebProcess::create(IPC::Co
 NetworkConnectionToWebProcess::NetworkConnectionToWebProcess(IPC::Connection::Identifier connectionIdentifier)
     : m_connection(IPC::Connection::createServerConnection(connectionIdentifier, *this))
 {
+#if USE(UNIX_DOMAIN_SOCKETS)
+    // Resource loads send bursts of small DidReceiveData / DidFinishResourceLoad messages.
+    m_connection->setShouldBatchOutgoingMessages(true);
+#endif
     m_connection->open();
 }
 
@@ -280,9 +285,35 @@ void NetworkConnectionToWebProcess::convertMainResourceLoadToDownload(SessionID
     loader->convertToDownload(downloadID, request, response);
 }
 
-void NetworkConnectionToWebProcess::cookiesForDOM(SessionID sessionID, const URL& firstParty, const URL& url, String& result)
+void NetworkConnectionToWebProcess::cookiesForDOM(SessionID sessionID, const URL& firstParty, const URL& url, String& result, double& timeToLive)
+{
+    auto& session = storageSession(sessionID);
+    result = WebCore::cookiesForDOM(session, firstParty, url);
+    m_sessionsWithCachedDOMCookies.add(sessionID);
+
+    // The cookie jar doesn't report cookies reaching their expiration date, so the web process
+    // must not use the result after the first of the visible cookies expires.
+    timeToLive = std::numeric_limits<double>::infinity();
+#if USE(SOUP)
+    Vector<Cookie> cookies;
+    if (!WebCore::getRawCookies(session, firstParty, url, cookies))
+        return;
+    double now = currentTime();
+    for (auto& cookie : cookies) {
+        if (cookie.session || cookie.httpOnly)
+            continue;
+        timeToLive = std::min(timeToLive, std::max(cookie.expires / 1000 - now, 0.0));
+    }
+#endif
+}
+
+void NetworkConnectionToWebProcess::cookiesDidChange(SessionID sessionID)
 {
-    result = WebCore::cookiesForDOM(storageSession(sessionID), firstParty, url);
+    // This is sent right away, so that the web process gets it before the responses that set the cookies.
+    // A synchronous load waiting for its response has to handle it too, before the document reads
+    // document.cookie again.
+    if (m_sessionsWithCachedDOMCookies.remove(sessionID))
+        m_connection->send(Messages::NetworkProcessConnection::CookiesDidChange(sessionID), 0, IPC::SendOption::DispatchMessageEvenWhenWaitingForSyncReply);
 }
 
 void NetworkConnectionToWebProcess::setCookiesFromDOM(SessionID sessionID, const URL& firstParty, const URL& url, const String& cookieString)
@@ -332,30 +332,47 @@ void NetworkDataTaskBlob::read()
 {
     ASSERT(isMainThread());
 
-    // If there is no more remaining data to read, we are done.
-    if (!m_totalRemainingSize || m_readItemCount >= m_blobData->items().size()) {
-        didFinish();
-        return;
-    }
+    // Data items and memory mapped files are read synchronously, so keep going until the data
+    // runs out or a file has to be read asynchronously.
+    while (true) {
+        // If there is no more remaining data to read, we are done.
+        if (!m_totalRemainingSize || m_readItemCount >= m_blobData->items().size()) {
+            didFinish();
+            return;
+        }
 
-    const BlobDataItem& item = m_blobData->items().at(m_readItemCount);
-    if (item.type() == BlobDataItem::Type::Data)
-        readData(item);
-    else if (item.type() == BlobDataItem::Type::File)
-        readFile(item);
-    else
-        ASSERT_NOT_REACHED();
+        const BlobDataItem& item = m_blobData->items().at(m_readItemCount);
+        if (item.type() == BlobDataItem::Type::Data) {
+            if (!readData(item))
+                return;
+        } else if (item.type() == BlobDataItem::Type::File) {
+            auto* mappedData = item.file()->mappedData();
+            if (!mappedData) {
+                readFile(item);
+                return;
+            }
+            if (!readMappedFile(item, *mappedData))
+                return;
+        } else {
+            ASSERT_NOT_REACHED();
+            return;
+        }
+    }
 }
 
-void NetworkDataTaskBlob::readData(const BlobDataItem& item)
+bool NetworkDataTaskBlob::readData(const BlobDataItem& item)
 {
     ASSERT(item.data().data());
 
     long long bytesToRead = item.length() - m_currentItemReadSize;
     if (bytesToRead > m_totalRemainingSize)
         bytesToRead = m_totalRemainingSize;
-    consumeData(reinterpret_cast<const char*>(item.data().data()->data()) + item.offset() + m_currentItemReadSize, static_cast<int>(bytesToRead));
+    const char* data = reinterpret_cast<const char*>(item.data().data()->data()) + item.offset() + m_currentItemReadSize;
+
+    // The text item is read as a whole, starting at the offset seek() left for the first item of a range.
     m_currentItemReadSize = 0;
+    m_readItemCount++;
+    return consumeData(data, static_cast<int>(bytesToRead));
 }
 
 void NetworkDataTaskBlob::readFile(const BlobDataItem& item)
@@ -375,6 +392,35 @@ void NetworkDataTaskBlob::readFile(const BlobDataItem& item)
     m_currentItemReadSize = 0;
 }
 
+bool NetworkDataTaskBlob::readMappedFile(const BlobDataItem& item, SharedBuffer& mappedData)
+{
+    ASSERT(!m_fileOpened);
+
+    long long itemRemainingSize = m_itemLengthList[m_readItemCount] - m_currentItemReadSize;
+    long long bytesToRead = std::min<long long>({ itemRemainingSize, m_totalRemainingSize, bufferSize });
+    long long offset = item.offset() + m_currentItemReadSize;
+    if (offset + bytesToRead > static_cast<long long>(mappedData.size())) {
+        didFail(Error::NotReadableError);
+        return false;
+    }
+
+    // Hand out the mapped pages instead of copying them, the buffer keeps the mapping alive.
+    auto& segment = *mappedData.begin();
+    auto buffer = SharedBuffer::create(SharedBuffer::DataSegment::create(SharedBuffer::DataSegment::Provider {
+        [segment = segment.copyRef(), offset] { return segment->data() + offset; },
+        [bytesToRead] { return static_cast<size_t>(bytesToRead); }
+    }));
+
+    // The item is read in chunks, move to the next item once the last one is out.
+    if (bytesToRead < itemRemainingSize)
+        m_currentItemReadSize += bytesToRead;
+    else {
+        m_currentItemReadSize = 0;
+        m_readItemCount++;
+    }
+    return consumeData(segment->data() + offset, static_cast<int>(bytesToRead), WTFMove(buffer));
+}
+
 void NetworkDataTaskBlob::didOpen(bool success)
 {
     if (m_state == State::Canceling || m_state == State::Completed || (!m_client && !isDownload())) {
@@ -403,40 +449,39 @@ void NetworkDataTaskBlob::didRead(int bytesRead)
         return;
     }
 
+    // When the current item is a file item, the reading is completed only if bytesRead is 0.
+    if (!bytesRead) {
+        m_fileOpened = false;
+        m_stream->close();
+        m_readItemCount++;
+    }
+
     Ref<NetworkDataTaskBlob> protectedThis(*this);
-    consumeData(m_buffer.data(), bytesRead);
+    if (consumeData(m_buffer.data(), bytesRead))
+        read();
 }
 
-void NetworkDataTaskBlob::consumeData(const char* data, int bytesRead)
+bool NetworkDataTaskBlob::consumeData(const char* data, int bytesRead, RefPtr<SharedBuffer>&& buffer)
 {
     m_totalRemainingSize -= bytesRead;
 
-    if (bytesRead) {
-        if (m_downloadFile != invalidPlatformFileHandle) {
-            if (!writeDownload(data, bytesRead))
-                return;
-        } else {
-            ASSERT(m_client);
-            m_client->didReceiveData(SharedBuffer::create(data, bytesRead));
-        }
-    }
+    if (!bytesRead)
+        return true;
 
-    if (m_fileOpened) {
-        // When the current item is a file item, the reading is completed only if bytesRead is 0.
-        if (!bytesRead) {
-            // Close the file.
-            m_fileOpened = false;
-            m_stream->close();
-
-            // Move to the next item.
-            m_readItemCount++;
-        }
+    if (m_downloadFile != invalidPlatformFileHandle) {
+        if (!writeDownload(data, bytesRead))
+            return false;
     } else {
-        // Otherwise, we read the current text item as a whole and move to the next item.
-        m_readItemCount++;
+        ASSERT(m_client);
+        m_client->didReceiveData(buffer ? buffer.releaseNonNull() : SharedBuffer::create(data, bytesRead));
     }
 
-    read();
+    // The load might have been cancelled while the data was handled.
+    if (m_state == State::Canceling || m_state == State::Completed || (!m_client && !isDownload())) {
+        clearStream();
+        return false;
+    }
+    return true;
 }
 
 void NetworkDataTaskBlob::setPendingDownloadLocation(const String& filename, const SandboxExtension::Handle& sandboxExtensionHandle, bool allowOverwrite)
@@ -42,6 +42,7 @@ class AsyncFileStream;
 class BlobDataFileReference;
 class BlobData;
 class BlobDataItem;
+class SharedBuffer;
 }
 
 namespace WebKit {
@@ -85,10 +86,11 @@ private:
     void getSizeForNext();
     void dispatchDidReceiveResponse(Error = Error::NoError);
     void seek();
-    void consumeData(const char* data, int bytesRead);
+    bool consumeData(const char* data, int bytesRead, RefPtr<WebCore::SharedBuffer>&& = nullptr);
     void read();
-    void readData(const WebCore::BlobDataItem&);
+    bool readData(const WebCore::BlobDataItem&);
     void readFile(const WebCore::BlobDataItem&);
+    bool readMappedFile(const WebCore::BlobDataItem&, WebCore::SharedBuffer& mappedData);
     void download();
     bool writeDownload(const char* data, int bytesRead);
     void cleanDownloadFiles();
@@ -0,0 +1,257 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "NetworkLoadScheduler.h"
+
+#include <WebCore/ResourceRequest.h>
+#include <wtf/SetForScope.h>
+#include <wtf/Vector.h>
+
+using namespace WebCore;
+
+namespace WebKit {
+
+const unsigned NetworkLoadScheduler::maximumActiveLoads;
+const unsigned NetworkLoadScheduler::maximumActiveLoadsPerHost;
+const unsigned NetworkLoadScheduler::maximumActiveLowPriorityLoadsPerPageWhileLoadingCriticalResources;
+
+NetworkLoadScheduler::NetworkLoadScheduler()
+{
+}
+
+NetworkLoadScheduler::~NetworkLoadScheduler()
+{
+    ASSERT(m_loads.isEmpty());
+}
+
+bool NetworkLoadScheduler::isLowPriority(const Load& load)
+{
+    return !load.isMainResource && load.priority < ResourceLoadPriority::Medium;
+}
+
+void NetworkLoadScheduler::schedule(NetworkLoadSchedulerClient& client, const ResourceRequest& request, uint64_t pageID, bool isMainResource)
+{
+    ASSERT(!m_loads.contains(&client));
+
+    auto priority = request.priority();
+    bool isCritical = isMainResource || priority >= ResourceLoadPriority::High;
+    auto& load = m_loads.add(&client, Load { request.url().host(), pageID, priority, isMainResource, isCritical }).iterator->value;
+    load.scheduledTime = MonotonicTime::now();
+    if (isCritical)
+        m_criticalLoadsPerPage.add(pageID);
+
+    // Navigations are never held back, otherwise a page full of pending subresources could delay the next one.
+    if (isMainResource) {
+        startLoad(client, load);
+        return;
+    }
+
+    addPendingLoad(client, load);
+    startPendingLoads();
+}
+
+void NetworkLoadScheduler::didReceiveResponse(NetworkLoadSchedulerClient& client)
+{
+    auto it = m_loads.find(&client);
+    if (it == m_loads.end() || !it->value.isMainResource)
+        return;
+
+    // Once the response is in, the rest of the main resource competes with its subresources like any other load.
+    releaseCriticalLoad(it->value);
+    startPendingLoads();
+}
+
+void NetworkLoadScheduler::unschedule(NetworkLoadSchedulerClient& client)
+{
+    auto it = m_loads.find(&client);
+    if (it == m_loads.end())
+        return;
+
+    Load load = WTFMove(it->value);
+    m_loads.remove(it);
+
+    if (load.isActive) {
+        ASSERT(m_activeLoadCount);
+        --m_activeLoadCount;
+        auto* hostLoads = m_hosts.get(load.host);
+        ASSERT(hostLoads && hostLoads->activeLoadCount);
+        --hostLoads->activeLoadCount;
+        updateStartableHost(load.host, *hostLoads);
+        if (isLowPriority(load)) {
+            m_activeLowPriorityLoadsPerPage.remove(load.pageID);
+            releaseLoadsWaitingForPage(load.pageID, 1);
+        }
+    } else
+        removePendingLoad(client, load);
+
+    releaseCriticalLoad(load);
+    startPendingLoads();
+}
+
+bool NetworkLoadScheduler::canStartLoadForPage(const Load& load) const
+{
+    if (!isLowPriority(load) || !m_criticalLoadsPerPage.contains(load.pageID))
+        return true;
+    return m_activeLowPriorityLoadsPerPage.count(load.pageID) < maximumActiveLowPriorityLoadsPerPageWhileLoadingCriticalResources;
+}
+
+void NetworkLoadScheduler::startLoad(NetworkLoadSchedulerClient& client, Load& load)
+{
+    ASSERT(!load.isActive);
+    load.isActive = true;
+    ++m_activeLoadCount;
+
+    auto& hostLoads = m_hosts.ensure(load.host, [] { return std::make_unique<HostLoads>(); }).iterator->value;
+    ++hostLoads->activeLoadCount;
+    updateStartableHost(load.host, *hostLoads);
+    if (isLowPriority(load))
+        m_activeLowPriorityLoadsPerPage.add(load.pageID);
+
+    // The client can call back into the scheduler, so load must not be used after this.
+    client.startScheduledLoad(MonotonicTime::now() - load.scheduledTime);
+}
+
+NetworkLoadSchedulerClient* NetworkLoadScheduler::takeNextStartableLoad()
+{
+    if (m_activeLoadCount >= maximumActiveLoads)
+        return nullptr;
+
+    for (unsigned priority = resourceLoadPriorityCount; priority > 0; --priority) {
+        auto& startableHosts = m_startableHosts[priority - 1];
+        while (!startableHosts.isEmpty()) {
+            String host = startableHosts.first();
+            auto* hostLoads = m_hosts.get(host);
+            auto* client = hostLoads->pendingLoads[priority - 1].takeFirst();
+
+            auto& load = m_loads.find(client)->value;
+            if (!canStartLoadForPage(load)) {
+                load.isWaitingForCriticalResources = true;
+                m_loadsWaitingForCriticalResources.ensure(load.pageID, [] { return Deque<NetworkLoadSchedulerClient*>(); }).iterator->value.append(client);
+                updateStartableHost(host, *hostLoads);
+                continue;
+            }
+
+            // Take turns between hosts with loads of the same priority.
+            if (!hostLoads->pendingLoads[priority - 1].isEmpty())
+                startableHosts.appendOrMoveToLast(host);
+            return client;
+        }
+    }
+    return nullptr;
+}
+
+void NetworkLoadScheduler::startPendingLoads()
+{
+    if (m_isStartingPendingLoads)
+        return;
+
+    SetForScope<bool> isStartingPendingLoads(m_isStartingPendingLoads, true);
+    while (auto* client = takeNextStartableLoad())
+        startLoad(*client, m_loads.find(client)->value);
+}
+
+void NetworkLoadScheduler::addPendingLoad(NetworkLoadSchedulerClient& client, const Load& load)
+{
+    auto& hostLoads = m_hosts.ensure(load.host, [] { return std::make_unique<HostLoads>(); }).iterator->value;
+    hostLoads->pendingLoads[static_cast<unsigned>(load.priority)].append(&client);
+    updateStartableHost(load.host, *hostLoads);
+}
+
+void NetworkLoadScheduler::removePendingLoad(NetworkLoadSchedulerClient& client, const Load& load)
+{
+    auto matchesClient = [&client](auto* pendingClient) {
+        return pendingClient == &client;
+    };
+
+    if (load.isWaitingForCriticalResources) {
+        auto it = m_loadsWaitingForCriticalResources.find(load.pageID);
+        ASSERT(it != m_loadsWaitingForCriticalResources.end());
+        it->value.removeAllMatching(matchesClient);
+        if (it->value.isEmpty())
+            m_loadsWaitingForCriticalResources.remove(it);
+        return;
+    }
+
+    auto* hostLoads = m_hosts.get(load.host);
+    ASSERT(hostLoads);
+    hostLoads->pendingLoads[static_cast<unsigned>(load.priority)].removeAllMatching(matchesClient);
+    updateStartableHost(load.host, *hostLoads);
+}
+
+void NetworkLoadScheduler::updateStartableHost(const String& host, HostLoads& hostLoads)
+{
+    bool hasPendingLoads = false;
+    bool isBelowLimit = hostLoads.activeLoadCount < maximumActiveLoadsPerHost;
+    for (unsigned priority = 0; priority < resourceLoadPriorityCount; ++priority) {
+        if (hostLoads.pendingLoads[priority].isEmpty()) {
+            m_startableHosts[priority].remove(host);
+            continue;
+        }
+        hasPendingLoads = true;
+        if (isBelowLimit)
+            m_startableHosts[priority].add(host);
+        else
+            m_startableHosts[priority].remove(host);
+    }
+
+    if (!hasPendingLoads && !hostLoads.activeLoadCount)
+        m_hosts.remove(host);
+}
+
+void NetworkLoadScheduler::releaseCriticalLoad(Load& load)
+{
+    if (!load.isCritical)
+        return;
+
+    load.isCritical = false;
+    if (m_criticalLoadsPerPage.remove(load.pageID))
+        releaseLoadsWaitingForPage(load.pageID);
+}
+
+void NetworkLoadScheduler::releaseLoadsWaitingForPage(uint64_t pageID, size_t maximumCount)
+{
+    auto it = m_loadsWaitingForCriticalResources.find(pageID);
+    if (it == m_loadsWaitingForCriticalResources.end())
+        return;
+
+    Vector<NetworkLoadSchedulerClient*> releasedLoads;
+    while (!it->value.isEmpty() && releasedLoads.size() < maximumCount)
+        releasedLoads.append(it->value.takeFirst());
+    if (it->value.isEmpty())
+        m_loadsWaitingForCriticalResources.remove(it);
+
+    // Put them back in front of their queues so they keep their turn. Those that still cannot start are held back again.
+    for (size_t i = releasedLoads.size(); i--; ) {
+        auto* client = releasedLoads[i];
+        auto& load = m_loads.find(client)->value;
+        load.isWaitingForCriticalResources = false;
+        auto& hostLoads = m_hosts.ensure(load.host, [] { return std::make_unique<HostLoads>(); }).iterator->value;
+        hostLoads->pendingLoads[static_cast<unsigned>(load.priority)].prepend(client);
+        updateStartableHost(load.host, *hostLoads);
+    }
+}
+
+} // namespace WebKit
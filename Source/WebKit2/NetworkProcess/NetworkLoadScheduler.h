@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <WebCore/ResourceLoadPriority.h>
+#include <wtf/Deque.h>
+#include <wtf/HashCountedSet.h>
+#include <wtf/HashMap.h>
+#include <wtf/ListHashSet.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/Seconds.h>
+#include <wtf/text/StringHash.h>
+
+namespace WebCore {
+class ResourceRequest;
+}
+
+namespace WebKit {
+
+class NetworkLoadSchedulerClient {
+public:
+    virtual ~NetworkLoadSchedulerClient() { }
+
+    virtual void startScheduledLoad(Seconds queueingDelay) = 0;
+};
+
+// Decides when asynchronous resource loads of a NetworkSession hit the network. Loads are started
+// by priority while respecting a global and a per host limit of active loads, and low priority
+// loads of a page are held back while the page still has critical resources (main resource
+// until its response, style sheets, scripts) in flight.
+//
+// Pending loads are indexed by priority and host, and only hosts below their limit are considered
+// when picking the next load, so starting a load does not walk all the pending ones.
+class NetworkLoadScheduler {
+    WTF_MAKE_NONCOPYABLE(NetworkLoadScheduler); WTF_MAKE_FAST_ALLOCATED;
+public:
+    static const unsigned maximumActiveLoads = 24;
+    static const unsigned maximumActiveLoadsPerHost = 6;
+    static const unsigned maximumActiveLowPriorityLoadsPerPageWhileLoadingCriticalResources = 1;
+
+    NetworkLoadScheduler();
+    ~NetworkLoadScheduler();
+
+    // Clients must be unscheduled before they are destroyed. Starting a load can call back into
+    // the scheduler, the client is responsible for keeping itself alive while it starts.
+    void schedule(NetworkLoadSchedulerClient&, const WebCore::ResourceRequest&, uint64_t pageID, bool isMainResource);
+    void didReceiveResponse(NetworkLoadSchedulerClient&);
+    void unschedule(NetworkLoadSchedulerClient&);
+
+    bool isScheduled(NetworkLoadSchedulerClient& client) const { return m_loads.contains(&client); }
+    size_t pendingLoadCount() const { return m_loads.size() - m_activeLoadCount; }
+    size_t activeLoadCount() const { return m_activeLoadCount; }
+
+private:
+    struct Load {
+        String host;
+        uint64_t pageID;
+        WebCore::ResourceLoadPriority priority;
+        bool isMainResource;
+        bool isCritical;
+        bool isActive { false };
+        bool isWaitingForCriticalResources { false };
+        MonotonicTime scheduledTime;
+    };
+
+    struct HostLoads {
+        unsigned activeLoadCount { 0 };
+        Deque<NetworkLoadSchedulerClient*> pendingLoads[WebCore::resourceLoadPriorityCount];
+    };
+
+    static bool isLowPriority(const Load&);
+
+    bool canStartLoadForPage(const Load&) const;
+    void startLoad(NetworkLoadSchedulerClient&, Load&);
+    void startPendingLoads();
+    NetworkLoadSchedulerClient* takeNextStartableLoad();
+
+    void addPendingLoad(NetworkLoadSchedulerClient&, const Load&);
+    void removePendingLoad(NetworkLoadSchedulerClient&, const Load&);
+    void updateStartableHost(const String& host, HostLoads&);
+    void releaseCriticalLoad(Load&);
+    void releaseLoadsWaitingForPage(uint64_t pageID, size_t maximumCount = std::numeric_limits<size_t>::max());
+
+    HashMap<NetworkLoadSchedulerClient*, Load> m_loads;
+    HashMap<String, std::unique_ptr<HostLoads>> m_hosts;
+    // Hosts below maximumActiveLoadsPerHost with pending loads of the given priority, in the order they got their first one.
+    ListHashSet<String> m_startableHosts[WebCore::resourceLoadPriorityCount];
+    // Low priority loads that were next in line but are held back by their page's critical resources.
+    HashMap<uint64_t, Deque<NetworkLoadSchedulerClient*>> m_loadsWaitingForCriticalResources;
+    HashCountedSet<uint64_t> m_criticalLoadsPerPage;
+    HashCountedSet<uint64_t> m_activeLowPriorityLoadsPerPage;
+    unsigned m_activeLoadCount { 0 };
+    bool m_isStartingPendingLoads { false };
+};
+
+} // namespace WebKit
@@ -34,6 +34,7 @@
 #include "DownloadProxyMessages.h"
 #include "LegacyCustomProtocolManager.h"
 #include "Logging.h"
+#include "MessageTelemetry.h"
 #include "NetworkConnectionToWebProcess.h"
 #include "NetworkProcessCreationParameters.h"
 #include "NetworkProcessPlatformStrategies.h"
@@ -140,6 +141,12 @@ void NetworkProcess::removeNetworkConnectionToWebProcess(NetworkConnectionToWebP
     m_webProcessConnections.remove(vectorIndex);
 }
 
+void NetworkProcess::cookiesDidChange(SessionID sessionID)
+{
+    for (auto& connection : m_webProcessConnections)
+        connection->cookiesDidChange(sessionID);
+}
+
 bool NetworkProcess::shouldTerminate()
 {
     // Network process keeps session cookies and credentials, so it should never terminate (as long as UI process connection is alive).
@@ -594,6 +601,14 @@ void NetworkProcess::getNetworkProcessStatistics(uint64_t callbackID)
     parentProcessConnection()->send(Messages::WebProcessPool::DidGetStatistics(data, callbackID), 0);
 }
 
+void NetworkProcess::getIPCMessageStatistics(uint64_t callbackID)
+{
+    StatisticsData data;
+    data.ipcMessageStatistics = IPC::MessageTelemetry::processStatistics();
+
+    parentProcessConnection()->send(Messages::WebProcessPool::DidGetStatistics(data, callbackID), 0);
+}
+
 void NetworkProcess::setAllowsAnySSLCertificateForWebSocket(bool allows)
 {
     Settings::setAllowsAnySSLCertificate(allows);
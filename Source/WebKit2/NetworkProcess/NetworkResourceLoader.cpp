@@ -34,9 +34,11 @@
 #include "NetworkLoad.h"
 #include "NetworkProcess.h"
 #include "NetworkProcessConnectionMessages.h"
+#include "NetworkSession.h"
 #include "SessionTracker.h"
 #include "WebCoreArgumentCoders.h"
 #include "WebErrors.h"
+#include "WebResourceLoaderDispatcherMessages.h"
 #include "WebResourceLoaderMessages.h"
 #include <WebCore/BlobDataFileReference.h>
 #include <WebCore/CertificateInfo.h>
@@ -211,6 +213,24 @@ void NetworkResourceLoader::retrieveCacheEntry(const ResourceRequest& request)
 
 void NetworkResourceLoader::startNetworkLoad(const ResourceRequest& request)
 {
+#if USE(NETWORK_SESSION)
+    // Synchronous loads block the web process, so they never wait in the scheduler.
+    if (!isSynchronous() && m_loadSchedulerState != LoadSchedulerState::Active) {
+        if (m_loadSchedulerState == LoadSchedulerState::Pending) {
+            m_requestPendingInLoadScheduler = request;
+            return;
+        }
+        if (auto* networkSession = SessionTracker::networkSession(sessionID())) {
+            // Keep the session the load was scheduled in, the session ID could refer to another one by the time we unschedule.
+            m_loadSchedulerSession = networkSession;
+            m_requestPendingInLoadScheduler = request;
+            m_loadSchedulerState = LoadSchedulerState::Pending;
+            networkSession->loadScheduler().schedule(*this, request, m_parameters.webPageID, isMainResource());
+            return;
+        }
+    }
+#endif
+
     RELEASE_LOG_IF_ALLOWED("startNetworkLoad: (pageID = %" PRIu64 ", frameID = %" PRIu64 ", resourceID = %" PRIu64 ", isMainResource = %d, isSynchronous = %d)", m_parameters.webPageID, m_parameters.webFrameID, m_parameters.identifier, isMainResource(), isSynchronous());
 
     consumeSandboxExtensions();
@@ -250,6 +270,22 @@ void NetworkResourceLoader::startNetworkLoad(const ResourceRequest& request)
     }
 }
 
+#if USE(NETWORK_SESSION)
+void NetworkResourceLoader::startScheduledLoad(Seconds queueingDelay)
+{
+    ASSERT(m_loadSchedulerState == LoadSchedulerState::Pending);
+    // Starting the load might fail synchronously and clean up this loader.
+    Ref<NetworkResourceLoader> protectedThis(*this);
+    m_loadSchedulerState = LoadSchedulerState::Active;
+    m_queueingDelay = queueingDelay;
+
+    if (queueingDelay > 0_s)
+        RELEASE_LOG_IF_ALLOWED("startScheduledLoad: Starting load after %.3f ms in the load scheduler (pageID = %" PRIu64 ", frameID = %" PRIu64 ", resourceID = %" PRIu64 ")", queueingDelay.milliseconds(), m_parameters.webPageID, m_parameters.webFrameID, m_parameters.identifier);
+
+    startNetworkLoad(std::exchange(m_requestPendingInLoadScheduler, { }));
+}
+#endif
+
 void NetworkResourceLoader::setDefersLoading(bool defers)
 {
     if (m_defersLoading == defers)
@@ -282,6 +318,13 @@ void NetworkResourceLoader::cleanup()
 
     m_networkLoad = nullptr;
 
+#if USE(NETWORK_SESSION)
+    if (auto session = WTFMove(m_loadSchedulerSession)) {
+        m_loadSchedulerState = LoadSchedulerState::NotScheduled;
+        session->loadScheduler().unschedule(*this);
+    }
+#endif
+
     // This will cause NetworkResourceLoader to be destroyed and therefore we do it last.
     m_connection->didCleanupResourceLoader(*this);
 }
@@ -319,6 +362,11 @@ auto NetworkResourceLoader::didReceiveResponse(ResourceResponse&& receivedRespon
 
     m_response = WTFMove(receivedResponse);
 
+#if USE(NETWORK_SESSION)
+    if (m_loadSchedulerSession)
+        m_loadSchedulerSession->loadScheduler().didReceiveResponse(*this);
+#endif
+
     // For multipart/x-mixed-replace didReceiveResponseAsync gets called multiple times and buffering would require special handling.
     if (!isSynchronous() && m_response.isMultipart())
         m_bufferedData = nullptr;
@@ -417,7 +465,16 @@ void NetworkResourceLoader::didFinishLoading(const NetworkLoadMetrics& networkLo
             // FIXME: Pass a real value or remove the encoded data size feature.
             sendBuffer(*m_bufferedData, -1);
         }
-        send(Messages::WebResourceLoader::DidFinishResourceLoad(networkLoadMetrics));
+#if USE(NETWORK_SESSION)
+        if (m_queueingDelay) {
+            auto metrics = networkLoadMetrics;
+            metrics.queueingDelay = m_queueingDelay;
+            send(Messages::WebResourceLoaderDispatcher::DidFinishResourceLoad(m_parameters.identifier, metrics), 0);
+        } else
+            send(Messages::WebResourceLoaderDispatcher::DidFinishResourceLoad(m_parameters.identifier, networkLoadMetrics), 0);
+#else
+        send(Messages::WebResourceLoaderDispatcher::DidFinishResourceLoad(m_parameters.identifier, networkLoadMetrics), 0);
+#endif
     }
 
 #if ENABLE(NETWORK_CACHE)
@@ -441,7 +498,7 @@ void NetworkResourceLoader::didFailLoading(const ResourceError& error)
         m_synchronousLoadData->error = error;
         sendReplyToSynchronousRequest(*m_synchronousLoadData, nullptr);
     } else if (auto* connection = messageSenderConnection())
-        connection->send(Messages::WebResourceLoader::DidFailResourceLoad(error), messageSenderDestinationID());
+        connection->send(Messages::WebResourceLoaderDispatcher::DidFailResourceLoad(m_parameters.identifier, error), 0);
 
     cleanup();
 }
@@ -537,7 +594,7 @@ void NetworkResourceLoader::bufferingTimerFired()
     m_bufferedData = SharedBuffer::create();
     m_bufferedDataEncodedDataLength = 0;
 
-    send(Messages::WebResourceLoader::DidReceiveData(dataReference, encodedLength));
+    send(Messages::WebResourceLoaderDispatcher::DidReceiveData(m_parameters.identifier, dataReference, encodedLength), 0);
 }
 
 void NetworkResourceLoader::sendBuffer(SharedBuffer& buffer, size_t encodedDataLength)
@@ -545,7 +602,7 @@ void NetworkResourceLoader::sendBuffer(SharedBuffer& buffer, size_t encodedDataL
     ASSERT(!isSynchronous());
 
     IPC::SharedBufferDataReference dataReference(&buffer);
-    send(Messages::WebResourceLoader::DidReceiveData(dataReference, encodedDataLength));
+    send(Messages::WebResourceLoaderDispatcher::DidReceiveData(m_parameters.identifier, dataReference, encodedDataLength), 0);
 }
 
 #if ENABLE(NETWORK_CACHE)
@@ -627,7 +684,7 @@ void NetworkResourceLoader::sendResultForCacheEntry(std::unique_ptr<NetworkCache
     networkLoadMetrics.responseBodyDecodedSize = 0;
 
     sendBuffer(*entry->buffer(), entry->buffer()->size());
-    send(Messages::WebResourceLoader::DidFinishResourceLoad(networkLoadMetrics));
+    send(Messages::WebResourceLoaderDispatcher::DidFinishResourceLoad(m_parameters.identifier, networkLoadMetrics), 0);
 }
 
 void NetworkResourceLoader::validateCacheEntry(std::unique_ptr<NetworkCache::Entry> entry)
@@ -30,6 +30,7 @@
 #include "MessageSender.h"
 #include "NetworkConnectionToWebProcessMessages.h"
 #include "NetworkLoadClient.h"
+#include "NetworkLoadScheduler.h"
 #include "NetworkResourceLoadParameters.h"
 #include "ShareableResource.h"
 #include <WebCore/Timer.h>
@@ -43,13 +44,18 @@ namespace WebKit {
 
 class NetworkConnectionToWebProcess;
 class NetworkLoad;
+class NetworkSession;
 class SandboxExtension;
 
 namespace NetworkCache {
 class Entry;
 }
 
-class NetworkResourceLoader final : public RefCounted<NetworkResourceLoader>, public NetworkLoadClient, public IPC::MessageSender {
+class NetworkResourceLoader final : public RefCounted<NetworkResourceLoader>, public NetworkLoadClient, public IPC::MessageSender
+#if USE(NETWORK_SESSION)
+    , public NetworkLoadSchedulerClient
+#endif
+{
 public:
     static Ref<NetworkResourceLoader> create(const NetworkResourceLoadParameters& parameters, NetworkConnectionToWebProcess& connection, RefPtr<Messages::NetworkConnectionToWebProcess::PerformSynchronousLoad::DelayedReply>&& reply = nullptr)
     {
@@ -157,6 +163,17 @@ private:
 
     unsigned m_retrievedDerivedDataCount { 0 };
 
+#if USE(NETWORK_SESSION)
+    // NetworkLoadSchedulerClient.
+    void startScheduledLoad(Seconds queueingDelay) override;
+
+    enum class LoadSchedulerState { NotScheduled, Pending, Active };
+    LoadSchedulerState m_loadSchedulerState { LoadSchedulerState::NotScheduled };
+    RefPtr<NetworkSession> m_loadSchedulerSession;
+    WebCore::ResourceRequest m_requestPendingInLoadScheduler;
+    std::optional<Seconds> m_queueingDelay;
+#endif
+
     WebCore::Timer m_bufferingTimer;
 #if ENABLE(NETWORK_CACHE)
     RefPtr<WebCore::SharedBuffer> m_bufferedDataForCache;
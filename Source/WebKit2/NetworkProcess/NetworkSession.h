@@ -27,6 +27,7 @@
 
 #if USE(NETWORK_SESSION)
 
+#include "NetworkLoadScheduler.h"
 #include <WebCore/SessionID.h>
 #include <wtf/HashSet.h>
 #include <wtf/Ref.h>
@@ -56,12 +57,15 @@ public:
     void registerNetworkDataTask(NetworkDataTask& task) { m_dataTaskSet.add(&task); }
     void unregisterNetworkDataTask(NetworkDataTask& task) { m_dataTaskSet.remove(&task); }
 
+    NetworkLoadScheduler& loadScheduler() { return m_loadScheduler; }
+
 protected:
     NetworkSession(WebCore::SessionID);
 
     WebCore::SessionID m_sessionID;
 
     HashSet<NetworkDataTask*> m_dataTaskSet;
+    NetworkLoadScheduler m_loadScheduler;
 };
 
 } // namespace WebKit
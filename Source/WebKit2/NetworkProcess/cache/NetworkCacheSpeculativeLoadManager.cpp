@@ -33,14 +33,20 @@
 #include "NetworkCacheSpeculativeLoad.h"
 #include "NetworkCacheSubresourcesEntry.h"
 #include "NetworkProcess.h"
+#include <WebCore/DNS.h>
 #include <WebCore/DiagnosticLoggingKeys.h>
 #include <WebCore/HysteresisActivity.h>
 #include <wtf/HashCountedSet.h>
+#include <wtf/HashSet.h>
 #include <wtf/NeverDestroyed.h>
 #include <wtf/RefCounted.h>
 #include <wtf/RunLoop.h>
 #include <wtf/Seconds.h>
 
+#if USE(SOUP)
+#include <WebCore/DNSCache.h>
+#endif
+
 namespace WebKit {
 
 namespace NetworkCache {
@@ -48,6 +54,7 @@ namespace NetworkCache {
 using namespace WebCore;
 
 static const Seconds preloadedEntryLifetime { 10_s };
+static const unsigned maximumHostnamePrefetchesPerNavigation = 6;
 
 #if !LOG_DISABLED
 static HashCountedSet<String>& allSpeculativeLoadingDiagnosticMessages()
@@ -362,6 +369,8 @@ void SpeculativeLoadManager::registerLoad(const GlobalFrameID& frameID, const Re
     ASSERT(RunLoop::isMain());
     ASSERT(request.url().protocolIsInHTTPFamily());
 
+    registerHostnameLoad(frameID, request.url());
+
     if (request.httpMethod() != "GET")
         return;
     if (!request.httpHeaderField(HTTPHeaderName::Range).isEmpty())
@@ -383,9 +392,11 @@ void SpeculativeLoadManager::registerLoad(const GlobalFrameID& frameID, const Re
         m_pendingFrameLoads.add(frameID, pendingFrameLoad);
 
         // Retrieve the subresources entry if it exists to start speculative revalidation and to update it.
-        retrieveSubresourcesEntry(resourceKey, [this, frameID, pendingFrameLoad](std::unique_ptr<SubresourcesEntry> entry) {
-            if (entry)
+        retrieveSubresourcesEntry(resourceKey, [this, frameID, pendingFrameLoad, mainResourceURL = request.url()](std::unique_ptr<SubresourcesEntry> entry) {
+            if (entry) {
+                prefetchSubresourceHostnames(frameID, mainResourceURL, *entry);
                 startSpeculativeRevalidation(frameID, *entry);
+            }
 
             pendingFrameLoad->setExistingSubresourcesEntry(WTFMove(entry));
         });
@@ -564,6 +575,60 @@ void SpeculativeLoadManager::startSpeculativeRevalidation(const GlobalFrameID& f
     }
 }
 
+void SpeculativeLoadManager::prefetchSubresourceHostnames(const GlobalFrameID& frameID, const URL& mainResourceURL, const SubresourcesEntry& entry)
+{
+    // The subresources entry of a page records the URLs it loaded, so it also records the hosts it
+    // needs. The main resource host has just been resolved for the main resource load.
+    HashSet<String> seenHostnames;
+    seenHostnames.add(mainResourceURL.host());
+
+    unsigned prefetchCount = 0;
+    for (auto& subresourceInfo : entry.subresources()) {
+        if (prefetchCount >= maximumHostnamePrefetchesPerNavigation)
+            break;
+
+        URL url(URL(), subresourceInfo.key().identifier());
+        if (!url.protocolIsInHTTPFamily())
+            continue;
+
+        auto hostname = url.host();
+        if (hostname.isEmpty() || !seenHostnames.add(hostname).isNewEntry)
+            continue;
+
+        // Still pending from an earlier navigation, don't spend the budget on it.
+        if (m_prefetchedHostnames.contains(hostname))
+            continue;
+
+#if USE(SOUP)
+        // Already resolved, the load will be answered by the DNS cache without any help.
+        if (DNSCache::singleton().hasValidEntry(hostname))
+            continue;
+#endif
+
+        LOG(NetworkCacheSpeculativePreloading, "(NetworkProcess) Prefetching DNS for '%s' for '%s'", hostname.utf8().data(), mainResourceURL.string().utf8().data());
+        prefetchDNS(hostname);
+        ++prefetchCount;
+
+        m_prefetchedHostnames.add(hostname, std::make_unique<ExpiringEntry>([this, hostname, frameID] {
+            LOG(NetworkCacheSpeculativePreloading, "(NetworkProcess) DNS prefetch for '%s' was not used", hostname.utf8().data());
+            logSpeculativeLoadingDiagnosticMessage(frameID, DiagnosticLoggingKeys::wastedSpeculativeDNSPrefetchKey());
+            m_prefetchedHostnames.remove(hostname);
+        }));
+    }
+}
+
+void SpeculativeLoadManager::registerHostnameLoad(const GlobalFrameID& frameID, const URL& url)
+{
+    if (m_prefetchedHostnames.isEmpty())
+        return;
+
+    if (!m_prefetchedHostnames.remove(url.host()))
+        return;
+
+    LOG(NetworkCacheSpeculativePreloading, "(NetworkProcess) Using DNS prefetch for '%s'", url.string().utf8().data());
+    logSpeculativeLoadingDiagnosticMessage(frameID, DiagnosticLoggingKeys::successfulSpeculativeDNSPrefetchKey());
+}
+
 void SpeculativeLoadManager::retrieveSubresourcesEntry(const Key& storageKey, std::function<void (std::unique_ptr<SubresourcesEntry>)>&& completionHandler)
 {
     ASSERT(storageKey.type() == "Resource");
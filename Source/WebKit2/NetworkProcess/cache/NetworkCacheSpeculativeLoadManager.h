@@ -66,6 +66,8 @@ private:
     bool satisfyPendingRequests(const Key&, Entry*);
     void retrieveSubresourcesEntry(const Key& storageKey, std::function<void (std::unique_ptr<SubresourcesEntry>)>&&);
     void startSpeculativeRevalidation(const GlobalFrameID&, SubresourcesEntry&);
+    void prefetchSubresourceHostnames(const GlobalFrameID&, const WebCore::URL& mainResourceURL, const SubresourcesEntry&);
+    void registerHostnameLoad(const GlobalFrameID&, const WebCore::URL&);
 
     static bool canUsePreloadedEntry(const PreloadedEntry&, const WebCore::ResourceRequest& actualRequest);
     static bool canUsePendingPreload(const SpeculativeLoad&, const WebCore::ResourceRequest& actualRequest);
@@ -82,6 +84,7 @@ private:
 
     class ExpiringEntry;
     HashMap<Key, std::unique_ptr<ExpiringEntry>> m_notPreloadedEntries; // For logging.
+    HashMap<String, std::unique_ptr<ExpiringEntry>> m_prefetchedHostnames; // For logging.
 };
 
 } // namespace NetworkCache
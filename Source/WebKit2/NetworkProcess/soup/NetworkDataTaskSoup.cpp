@@ -33,8 +33,10 @@
 #include "NetworkLoad.h"
 #include "NetworkProcess.h"
 #include "NetworkSessionSoup.h"
+#include "ReadBufferPool.h"
 #include "WebErrors.h"
 #include <WebCore/AuthenticationChallenge.h>
+#include <WebCore/DNSCache.h>
 #include <WebCore/HTTPParsers.h>
 #include <WebCore/MIMETypeRegistry.h>
 #include <WebCore/NetworkStorageSession.h>
@@ -47,11 +49,13 @@ using namespace WebCore;
 
 namespace WebKit {
 
-static const size_t gDefaultReadBufferSize = 8192;
+static const size_t gDefaultReadBufferSize = ReadBufferPool::minimumBufferSize;
+static const size_t gMaximumReadBufferSize = ReadBufferPool::maximumBufferSize;
 
 NetworkDataTaskSoup::NetworkDataTaskSoup(NetworkSession& session, NetworkDataTaskClient& client, const ResourceRequest& requestWithCredentials, StoredCredentials storedCredentials, ContentSniffingPolicy shouldContentSniff, bool shouldClearReferrerOnHTTPSToHTTPRedirect)
     : NetworkDataTask(session, client, requestWithCredentials, storedCredentials, shouldClearReferrerOnHTTPSToHTTPRedirect)
     , m_shouldContentSniff(shouldContentSniff)
+    , m_readBufferSize(gDefaultReadBufferSize)
     , m_timeoutSource(RunLoop::main(), this, &NetworkDataTaskSoup::timeoutFired)
 {
     m_session->registerNetworkDataTask(*this);
@@ -113,6 +117,9 @@ void NetworkDataTaskSoup::createRequest(ResourceRequest&& request)
         return;
     }
 
+    if (m_session->sessionID().isEphemeral())
+        DNSCache::singleton().excludeFromPersistentStorage(m_currentRequest.url().host());
+
     GRefPtr<SoupRequest> soupRequest = adoptGRef(soup_session_request_uri(static_cast<NetworkSessionSoup&>(m_session.get()).soupSession(), soupURI.get(), nullptr));
     if (!soupRequest) {
         scheduleFailure(InvalidURLFailure);
@@ -195,6 +202,7 @@ void NetworkDataTaskSoup::clearRequest()
     m_inputStream = nullptr;
     m_multipartInputStream = nullptr;
     m_downloadOutputStream = nullptr;
+    ReadBufferPool::singleton().recycle(WTFMove(m_readBuffer));
     g_cancellable_cancel(m_cancellable.get());
     m_cancellable = nullptr;
     if (m_soupMessage) {
@@ -365,6 +373,13 @@ void NetworkDataTaskSoup::dispatchDidReceiveResponse()
 {
     ASSERT(!m_response.isNull());
 
+    m_responseBodyBytesRead = 0;
+    long long expectedContentLength = m_response.expectedContentLength();
+    if (expectedContentLength > 0)
+        m_readBufferSize = ReadBufferPool::bufferSizeFor(std::min<uint64_t>(expectedContentLength, gMaximumReadBufferSize));
+    else
+        m_readBufferSize = gDefaultReadBufferSize;
+
 #if ENABLE(WEB_TIMING)
     // FIXME: Remove this once nobody depends on deprecatedNetworkLoadMetrics.
     NetworkLoadMetrics& deprecatedResponseMetrics = m_response.deprecatedNetworkLoadMetrics();
@@ -408,6 +423,7 @@ void NetworkDataTaskSoup::dispatchDidCompleteWithError(const ResourceError& erro
 {
 #if ENABLE(WEB_TIMING)
     m_networkLoadMetrics.responseEnd = MonotonicTime::now() - m_startTime;
+    m_networkLoadMetrics.responseBodyReadCount = m_readCount;
     m_networkLoadMetrics.markComplete();
 #endif
 
@@ -728,24 +744,67 @@ void NetworkDataTaskSoup::readCallback(GInputStream* inputStream, GAsyncResult*
         task->didFinishRead();
 }
 
+size_t NetworkDataTaskSoup::nextReadSize() const
+{
+    size_t readSize = m_readBufferSize;
+    long long expectedContentLength = m_response.expectedContentLength();
+    if (expectedContentLength > 0 && static_cast<uint64_t>(expectedContentLength) > m_responseBodyBytesRead) {
+        // Ask for one extra byte so that the end of the stream is usually noticed by the same read.
+        uint64_t remainingBytes = static_cast<uint64_t>(expectedContentLength) - m_responseBodyBytesRead + 1;
+        if (remainingBytes < readSize)
+            readSize = std::max<size_t>(remainingBytes, gDefaultReadBufferSize);
+    }
+    return readSize;
+}
+
+void NetworkDataTaskSoup::updateReadBufferSize(size_t bytesRead)
+{
+    // A read that fills the whole buffer means more data was already waiting, so grow the next
+    // read to reduce the number of round trips through the main loop. Mostly empty reads mean the
+    // network is the bottleneck and a big buffer only wastes memory.
+    if (bytesRead == m_readBuffer.size())
+        m_readBufferSize = std::min(m_readBufferSize * 2, gMaximumReadBufferSize);
+    else if (bytesRead < m_readBufferSize / 4)
+        m_readBufferSize = std::max(m_readBufferSize / 2, gDefaultReadBufferSize);
+}
+
+Ref<SharedBuffer> NetworkDataTaskSoup::takeReadData(size_t bytesRead)
+{
+    // Hand the buffer over to the SharedBuffer without copying when most of it was used,
+    // otherwise copy the data and keep the buffer for the next read.
+    if (bytesRead >= m_readBuffer.size() / 2) {
+        m_readBuffer.shrink(bytesRead);
+        return SharedBuffer::create(WTFMove(m_readBuffer));
+    }
+    return SharedBuffer::create(m_readBuffer.data(), bytesRead);
+}
+
 void NetworkDataTaskSoup::read()
 {
     RefPtr<NetworkDataTaskSoup> protectedThis(this);
     ASSERT(m_inputStream);
-    m_readBuffer.grow(gDefaultReadBufferSize);
+    size_t readSize = nextReadSize();
+    if (m_readBuffer.capacity() < readSize) {
+        ReadBufferPool::singleton().recycle(WTFMove(m_readBuffer));
+        m_readBuffer = ReadBufferPool::singleton().take(readSize);
+    }
+    m_readBuffer.resize(readSize);
     g_input_stream_read_async(m_inputStream.get(), m_readBuffer.data(), m_readBuffer.size(), RunLoopSourcePriority::AsyncIONetwork, m_cancellable.get(),
         reinterpret_cast<GAsyncReadyCallback>(readCallback), protectedThis.leakRef());
 }
 
 void NetworkDataTaskSoup::didRead(gssize bytesRead)
 {
-    m_readBuffer.shrink(bytesRead);
+    ++m_readCount;
+    m_responseBodyBytesRead += bytesRead;
+    updateReadBufferSize(bytesRead);
     if (m_downloadOutputStream) {
         ASSERT(isDownload());
+        m_readBuffer.shrink(bytesRead);
         writeDownload();
     } else {
         ASSERT(m_client);
-        m_client->didReceiveData(SharedBuffer::create(WTFMove(m_readBuffer)));
+        m_client->didReceiveData(takeReadData(bytesRead));
         read();
     }
 }
@@ -32,6 +32,10 @@
 #include <wtf/RunLoop.h>
 #include <wtf/glib/GRefPtr.h>
 
+namespace WebCore {
+class SharedBuffer;
+}
+
 namespace WebKit {
 
 class NetworkDataTaskSoup final : public NetworkDataTask {
@@ -82,6 +86,9 @@ private:
 
     static void readCallback(GInputStream*, GAsyncResult*, NetworkDataTaskSoup*);
     void read();
+    size_t nextReadSize() const;
+    void updateReadBufferSize(size_t bytesRead);
+    Ref<WebCore::SharedBuffer> takeReadData(size_t bytesRead);
     void didRead(gssize bytesRead);
     void didFinishRead();
 
@@ -132,6 +139,9 @@ private:
     WebCore::ResourceRequest m_currentRequest;
     WebCore::ResourceResponse m_response;
     Vector<char> m_readBuffer;
+    size_t m_readBufferSize;
+    uint64_t m_responseBodyBytesRead { 0 };
+    uint64_t m_readCount { 0 };
     unsigned m_redirectCount { 0 };
     uint64_t m_bodyDataTotalBytesSent { 0 };
     GRefPtr<GFile> m_downloadDestinationFile;
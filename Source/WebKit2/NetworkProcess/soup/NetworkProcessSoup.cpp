@@ -27,16 +27,19 @@
 #include "config.h"
 #include "NetworkProcess.h"
 
+#include "Logging.h"
 #include "NetworkCache.h"
 #include "NetworkProcessCreationParameters.h"
 #include "ResourceCachesToClear.h"
 #include "WebCookieManager.h"
 #include <WebCore/CertificateInfo.h>
+#include <WebCore/DNS.h>
+#include <WebCore/DNSCache.h>
 #include <WebCore/FileSystem.h>
 #include <WebCore/NetworkStorageSession.h>
-#include <WebCore/NotImplemented.h>
 #include <WebCore/ResourceHandle.h>
 #include <WebCore/SoupNetworkSession.h>
+#include <WebCore/WebKitCachingResolver.h>
 #include <libsoup/soup.h>
 #include <wtf/RAMSize.h>
 #include <wtf/glib/GRefPtr.h>
@@ -48,6 +51,12 @@ using namespace WebCore;
 
 namespace WebKit {
 
+// Number of hosts from the previous runs that are resolved ahead of time at startup.
+static const size_t recentlyUsedHostnamesToPrefetch = 16;
+
+// DNS prefetch is disabled until the proxy settings are known, so give them time to be resolved.
+static const Seconds recentlyUsedHostnamesPrefetchDelay { 2_s };
+
 static CString buildAcceptLanguages(const Vector<String>& languages)
 {
     size_t languagesCount = languages.size();
@@ -157,6 +166,15 @@ void NetworkProcess::platformInitializeNetworkProcess(const NetworkProcessCreati
         userPreferredLanguagesChanged(parameters.languages);
 
     setIgnoreTLSErrors(parameters.ignoreTLSErrors);
+
+    webkitCachingResolverInstall();
+    // Without a cache directory the DNS cache only lives in memory.
+    if (!m_diskCacheDirectory.isEmpty())
+        DNSCache::singleton().setPersistentStoragePath(WebCore::pathByAppendingComponent(m_diskCacheDirectory, "DNSCache"));
+    RunLoop::main().dispatchAfter(recentlyUsedHostnamesPrefetchDelay, [] {
+        for (auto& hostname : DNSCache::singleton().mostRecentlyUsedHostnames(recentlyUsedHostnamesToPrefetch))
+            WebCore::prefetchDNS(hostname);
+    });
 }
 
 void NetworkProcess::platformSetURLCacheSize(unsigned /*urlCacheMemoryCapacity*/, uint64_t urlCacheDiskCapacity)
@@ -195,11 +213,18 @@ void NetworkProcess::clearDiskCache(std::chrono::system_clock::time_point modifi
     UNUSED_PARAM(completionHandler);
     soup_cache_clear(NetworkStorageSession::defaultStorageSession().getOrCreateSoupNetworkSession().cache());
 #endif
+
+    // The host names in the DNS cache reveal the browsing history as much as the disk cache does.
+    DNSCache::singleton().clear();
+    DNSCache::singleton().saveToPersistentStorage();
 }
 
 void NetworkProcess::platformTerminate()
 {
-    notImplemented();
+    auto statistics = DNSCache::singleton().statistics();
+    LOG(Network, "(NetworkProcess) DNS cache: %" PRIu64 " hits, %" PRIu64 " misses (hit rate %.2f), %" PRIu64 " expired, %" PRIu64 " evicted",
+        statistics.hits, statistics.misses, statistics.hitRate(), statistics.expiredEntries, statistics.evictedEntries);
+    DNSCache::singleton().saveToPersistentStorage();
 }
 
 void NetworkProcess::setNetworkProxySettings(const SoupNetworkProxySettings& settings)
@@ -40,6 +40,7 @@ NetworkSessionSoup::NetworkSessionSoup(SessionID sessionID)
     : NetworkSession(sessionID)
 {
     networkStorageSession().setCookieObserverHandler([this] {
+        NetworkProcess::singleton().cookiesDidChange(m_sessionID);
         NetworkProcess::singleton().supplement<WebCookieManager>()->notifyCookiesDidChange(m_sessionID);
     });
 }
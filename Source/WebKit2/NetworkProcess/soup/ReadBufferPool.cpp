@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "ReadBufferPool.h"
+
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+
+namespace WebKit {
+
+const size_t ReadBufferPool::minimumBufferSize;
+const size_t ReadBufferPool::maximumBufferSize;
+const size_t ReadBufferPool::maximumBuffersPerSizeClass;
+
+ReadBufferPool& ReadBufferPool::singleton()
+{
+    ASSERT(isMainThread());
+    static NeverDestroyed<ReadBufferPool> pool;
+    return pool;
+}
+
+// The size classes are the powers of two from minimumBufferSize to maximumBufferSize.
+size_t ReadBufferPool::bufferSizeFor(size_t size)
+{
+    size_t bufferSize = minimumBufferSize;
+    while (bufferSize < size && bufferSize < maximumBufferSize)
+        bufferSize *= 2;
+    return bufferSize;
+}
+
+unsigned ReadBufferPool::sizeClassIndex(size_t bufferSize)
+{
+    unsigned index = 0;
+    for (size_t size = minimumBufferSize; size < bufferSize; size *= 2)
+        ++index;
+    ASSERT(index < sizeClassCount);
+    return index;
+}
+
+Vector<char> ReadBufferPool::take(size_t size)
+{
+    size_t bufferSize = bufferSizeFor(size);
+    auto& buffers = m_buffers[sizeClassIndex(bufferSize)];
+    if (!buffers.isEmpty())
+        return buffers.takeLast();
+
+    Vector<char> buffer;
+    buffer.reserveInitialCapacity(bufferSize);
+    return buffer;
+}
+
+void ReadBufferPool::recycle(Vector<char>&& buffer)
+{
+    // Only buffers this pool handed out have a capacity that is exactly a size class.
+    size_t capacity = buffer.capacity();
+    if (capacity < minimumBufferSize || capacity > maximumBufferSize || bufferSizeFor(capacity) != capacity)
+        return;
+
+    auto& buffers = m_buffers[sizeClassIndex(capacity)];
+    if (buffers.size() >= maximumBuffersPerSizeClass)
+        return;
+
+    buffer.shrink(0);
+    buffers.append(WTFMove(buffer));
+}
+
+size_t ReadBufferPool::pooledBufferCount() const
+{
+    size_t count = 0;
+    for (auto& buffers : m_buffers)
+        count += buffers.size();
+    return count;
+}
+
+void ReadBufferPool::clear()
+{
+    for (auto& buffers : m_buffers)
+        buffers.clear();
+}
+
+} // namespace WebKit
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <wtf/Vector.h>
+
+namespace WebKit {
+
+// Recycles the buffers NetworkDataTaskSoup reads response bodies into. Buffers come in a
+// few fixed size classes, so that a buffer given back for one read size can be handed out
+// again for any other read size that rounds up to the same class.
+class ReadBufferPool {
+    WTF_MAKE_NONCOPYABLE(ReadBufferPool);
+public:
+    static ReadBufferPool& singleton();
+
+    static const size_t minimumBufferSize = 8 * 1024;
+    static const size_t maximumBufferSize = 256 * 1024;
+    static const size_t maximumBuffersPerSizeClass = 4;
+
+    ReadBufferPool() = default;
+
+    // Rounds size up to the size class a buffer for it is allocated from, which is never
+    // more than maximumBufferSize.
+    static size_t bufferSizeFor(size_t);
+
+    // Returns an empty buffer whose capacity is bufferSizeFor(size).
+    Vector<char> take(size_t size);
+    void recycle(Vector<char>&&);
+
+    size_t pooledBufferCount() const;
+    void clear();
+
+private:
+    static unsigned sizeClassIndex(size_t bufferSize);
+    static const unsigned sizeClassCount = 6;
+
+    Vector<Vector<char>, maximumBuffersPerSizeClass> m_buffers[sizeClassCount];
+};
+
+} // namespace WebKit
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "BorrowedDataReference.h"
+
+#include "Decoder.h"
+#include "Encoder.h"
+
+namespace IPC {
+
+Ref<WebCore::SharedBuffer> BorrowedDataReference::sharedBuffer() const
+{
+    if (!m_messageBody)
+        return WebCore::SharedBuffer::create(data(), size());
+
+    return WebCore::SharedBuffer::create(WebCore::SharedBuffer::DataSegment::create(WebCore::SharedBuffer::DataSegment::Provider {
+        [messageBody = m_messageBody, data = data()] { return reinterpret_cast<const char*>(data); },
+        [size = size()] { return size; }
+    }));
+}
+
+void BorrowedDataReference::encode(Encoder& encoder) const
+{
+    m_dataReference.encode(encoder);
+}
+
+bool BorrowedDataReference::decode(Decoder& decoder, BorrowedDataReference& dataReference)
+{
+    return decoder.decodeVariableLengthByteArray(dataReference);
+}
+
+} // namespace IPC
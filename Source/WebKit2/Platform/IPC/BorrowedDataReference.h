@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "DataReference.h"
+#include <WebCore/SharedBuffer.h>
+
+namespace IPC {
+
+class Decoder;
+class Encoder;
+
+// A byte array argument that can outlive the Decoder it was decoded from. The Decoder always works on
+// a private copy of the message body, which the sender can't write to anymore; decoded references share
+// that copy instead of copying the bytes again, and keep it alive. On the sending side it simply wraps
+// the bytes that get encoded.
+class BorrowedDataReference {
+public:
+    BorrowedDataReference() = default;
+
+    BorrowedDataReference(const DataReference& dataReference)
+        : m_dataReference(dataReference)
+    {
+    }
+
+    BorrowedDataReference(const DataReference& dataReference, Ref<WebCore::SharedBuffer::DataSegment>&& messageBody)
+        : m_dataReference(dataReference)
+        , m_messageBody(WTFMove(messageBody))
+    {
+    }
+
+    bool isEmpty() const { return m_dataReference.isEmpty(); }
+    size_t size() const { return m_dataReference.size(); }
+    const uint8_t* data() const { return m_dataReference.data(); }
+
+    const DataReference& dataReference() const { return m_dataReference; }
+    Ref<WebCore::SharedBuffer> sharedBuffer() const;
+
+    void encode(Encoder&) const;
+    static bool decode(Decoder&, BorrowedDataReference&);
+
+private:
+    DataReference m_dataReference;
+    // The message body the bytes point into, when they were decoded.
+    RefPtr<WebCore::SharedBuffer::DataSegment> m_messageBody;
+};
+
+} // namespace IPC
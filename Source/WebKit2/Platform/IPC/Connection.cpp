@@ -295,8 +295,12 @@ void Connection::removeWorkQueueMessageReceiver(StringReference messageReceiverN
 
 void Connection::dispatchWorkQueueMessageReceiverMessage(WorkQueueMessageReceiver& workQueueMessageReceiver, Decoder& decoder)
 {
+    MonotonicTime dispatchStartTime = MonotonicTime::now();
+
     if (!decoder.isSyncMessage()) {
         workQueueMessageReceiver.didReceiveMessage(*this, decoder);
+        if (!decoder.isInvalid())
+            m_messageTelemetry.didDispatchMessageOnWorkQueue(decoder.messageReceiverName(), decoder.messageName(), MonotonicTime::now() - dispatchStartTime);
         return;
     }
 
@@ -312,6 +316,8 @@ void Connection::dispatchWorkQueueMessageReceiverMessage(WorkQueueMessageReceive
 
     // Hand off both the decoder and encoder to the work queue message receiver.
     workQueueMessageReceiver.didReceiveSyncMessage(*this, decoder, replyEncoder);
+    if (!decoder.isInvalid())
+        m_messageTelemetry.didDispatchMessageOnWorkQueue(decoder.messageReceiverName(), decoder.messageName(), MonotonicTime::now() - dispatchStartTime);
 
     // FIXME: If the message was invalid, we should send back a SyncMessageError.
     ASSERT(!decoder.isInvalid());
@@ -392,12 +398,25 @@ bool Connection::sendMessage(std::unique_ptr<Encoder> encoder, OptionSet<SendOpt
             || m_inDispatchMessageMarkedDispatchWhenWaitingForSyncReplyCount))
         encoder->setShouldDispatchMessageWhenWaitingForSyncReply(true);
 
+    m_messageTelemetry.didSendMessage(encoder->messageReceiverName(), encoder->messageName(), encoder->bufferSize());
+
+    bool shouldScheduleSend = true;
     {
         std::lock_guard<Lock> lock(m_outgoingMessagesMutex);
         m_outgoingMessages.append(WTFMove(encoder));
+#if USE(UNIX_DOMAIN_SOCKETS)
+        // When batching, the messages appended before the connection queue gets to run are all sent together.
+        if (m_shouldBatchOutgoingMessages) {
+            shouldScheduleSend = !m_hasScheduledOutgoingMessages;
+            m_hasScheduledOutgoingMessages = true;
+        }
+#endif
     }
-    
-    // FIXME: We should add a boolean flag so we don't call this when work has already been scheduled.
+
+    if (!shouldScheduleSend)
+        return true;
+
+    // FIXME: We should also avoid scheduling this when work has already been scheduled and messages are not batched.
     m_connectionQueue->dispatch([protectedThis = makeRef(*this)]() mutable {
         protectedThis->sendOutgoingMessages();
     });
@@ -477,16 +496,18 @@ std::unique_ptr<Decoder> Connection::waitForMessage(StringReference messageRecei
         m_waitingForMessage = &waitingForMessage;
     }
 
-    MonotonicTime absoluteTimeout = MonotonicTime::now() + timeout;
+    MonotonicTime waitStartTime = MonotonicTime::now();
+    MonotonicTime absoluteTimeout = waitStartTime + timeout;
 
     // Now wait for it to be set.
+    std::unique_ptr<Decoder> decoder;
     while (true) {
         std::unique_lock<Lock> lock(m_waitForMessageMutex);
 
         if (m_waitingForMessage->decoder) {
-            auto decoder = WTFMove(m_waitingForMessage->decoder);
+            decoder = WTFMove(m_waitingForMessage->decoder);
             m_waitingForMessage = nullptr;
-            return decoder;
+            break;
         }
 
         // Now we wait.
@@ -498,7 +519,8 @@ std::unique_ptr<Decoder> Connection::waitForMessage(StringReference messageRecei
         }
     }
 
-    return nullptr;
+    m_messageTelemetry.didBlockOnMessage(messageReceiverName, messageName, MonotonicTime::now() - waitStartTime);
+    return decoder;
 }
 
 std::unique_ptr<Decoder> Connection::sendSyncMessage(uint64_t syncRequestID, std::unique_ptr<Encoder> encoder, Seconds timeout, OptionSet<SendSyncOption> sendSyncOptions)
@@ -523,13 +545,19 @@ std::unique_ptr<Decoder> Connection::sendSyncMessage(uint64_t syncRequestID, std
 
     ++m_inSendSyncCount;
 
+    // The encoder names refer to the message definitions, so they outlive the encoder.
+    StringReference messageReceiverName = encoder->messageReceiverName();
+    StringReference messageName = encoder->messageName();
+
     // First send the message.
     sendMessage(WTFMove(encoder), IPC::SendOption::DispatchMessageEvenWhenWaitingForSyncReply);
 
     // Then wait for a reply. Waiting for a reply could involve dispatching incoming sync messages, so
     // keep an extra reference to the connection here in case it's invalidated.
     Ref<Connection> protect(*this);
+    MonotonicTime waitStartTime = MonotonicTime::now();
     std::unique_ptr<Decoder> reply = waitForSyncReply(syncRequestID, timeout, sendSyncOptions);
+    m_messageTelemetry.didBlockOnMessage(messageReceiverName, messageName, MonotonicTime::now() - waitStartTime);
 
     --m_inSendSyncCount;
 
@@ -813,9 +841,23 @@ bool Connection::canSendOutgoingMessages() const
 
 void Connection::sendOutgoingMessages()
 {
+#if USE(UNIX_DOMAIN_SOCKETS)
+    {
+        std::lock_guard<Lock> lock(m_outgoingMessagesMutex);
+        m_hasScheduledOutgoingMessages = false;
+    }
+#endif
+
     if (!canSendOutgoingMessages())
         return;
 
+#if USE(UNIX_DOMAIN_SOCKETS)
+    if (m_shouldBatchOutgoingMessages) {
+        sendOutgoingMessageBatches();
+        return;
+    }
+#endif
+
     while (true) {
         std::unique_ptr<Encoder> message;
 
@@ -922,11 +964,16 @@ void Connection::dispatchMessage(std::unique_ptr<Decoder> message)
     bool oldDidReceiveInvalidMessage = m_didReceiveInvalidMessage;
     m_didReceiveInvalidMessage = false;
 
+    MonotonicTime dispatchStartTime = MonotonicTime::now();
+
     if (message->isSyncMessage())
         dispatchSyncMessage(*message);
     else
         dispatchMessage(*message);
 
+    if (!message->isInvalid())
+        m_messageTelemetry.didDispatchMessage(message->messageReceiverName(), message->messageName(), message->length(), MonotonicTime::now() - dispatchStartTime);
+
     m_didReceiveInvalidMessage |= message->isInvalid();
     m_inDispatchMessageCount--;
 
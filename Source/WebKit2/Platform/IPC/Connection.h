@@ -31,6 +31,7 @@
 #include "Encoder.h"
 #include "HandleMessage.h"
 #include "MessageReceiver.h"
+#include "MessageTelemetry.h"
 #include <atomic>
 #include <wtf/Condition.h>
 #include <wtf/Deque.h>
@@ -47,6 +48,10 @@
 #include <wtf/spi/darwin/XPCSPI.h>
 #endif
 
+#if USE(UNIX_DOMAIN_SOCKETS)
+#include "MessageBodyArena.h"
+#endif
+
 #if USE(GLIB)
 #include "GSocketMonitor.h"
 #endif
@@ -206,6 +211,27 @@ public:
 
     void ignoreTimeoutsForTesting() { m_ignoreTimeoutsForTesting = true; }
 
+#if USE(UNIX_DOMAIN_SOCKETS)
+    // Sends the asynchronous messages queued while the connection queue was busy with as few
+    // system calls as possible, several of them sharing a single vectored write.
+    void setShouldBatchOutgoingMessages(bool shouldBatch) { m_shouldBatchOutgoingMessages = shouldBatch; }
+
+    // How long the message body arenas have to go unused before they are released. Must be set
+    // before the first big message is sent or received.
+    void setMessageBodyArenaIdleDelayForTesting(Seconds delay) { m_messageBodyArenaIdleDelay = delay; }
+
+    struct MessageBatchingStatistics {
+        uint64_t messagesSent { 0 };
+        uint64_t sendSystemCalls { 0 };
+        uint64_t messagesReceived { 0 };
+        uint64_t receiveSystemCalls { 0 };
+
+        double messagesPerSendSystemCall() const { return sendSystemCalls ? static_cast<double>(messagesSent) / sendSystemCalls : 0; }
+        double messagesPerReceiveSystemCall() const { return receiveSystemCalls ? static_cast<double>(messagesReceived) / receiveSystemCalls : 0; }
+    };
+    MessageBatchingStatistics messageBatchingStatistics() const;
+#endif
+
 private:
     Connection(Identifier, bool isServer, Client&);
     void platformInitialize(Identifier);
@@ -276,6 +302,8 @@ private:
     // Outgoing messages.
     Lock m_outgoingMessagesMutex;
     Deque<std::unique_ptr<Encoder>> m_outgoingMessages;
+
+    MessageTelemetry m_messageTelemetry;
     
     Condition m_waitForMessageCondition;
     Lock m_waitForMessageMutex;
@@ -310,11 +338,27 @@ private:
     void readyReadHandler();
     bool processMessage();
     bool sendOutputMessage(UnixMessage&);
+    void sendOutgoingMessageBatches();
+    bool sendOutgoingMessageBatch(Vector<std::unique_ptr<Encoder>>&);
+    void waitForSocketToBecomeWritable();
+    void scheduleMessageBodyArenaIdleCheck();
+    void checkMessageBodyArenasIdle();
 
     Vector<uint8_t> m_readBuffer;
     Vector<int> m_fileDescriptors;
     int m_socketDescriptor;
     std::unique_ptr<UnixMessage> m_pendingOutputMessage;
+    MessageBodyArenaWriter m_outgoingMessageBodyArena;
+    MessageBodyArenaReader m_incomingMessageBodyArena;
+    bool m_hasScheduledMessageBodyArenaIdleCheck { false };
+    Seconds m_messageBodyArenaIdleDelay { 10_s };
+    std::atomic<bool> m_shouldBatchOutgoingMessages { false };
+    bool m_hasScheduledOutgoingMessages { false };
+    bool m_isWaitingForWritableSocket { false };
+    std::atomic<uint64_t> m_messagesSent { 0 };
+    std::atomic<uint64_t> m_sendSystemCalls { 0 };
+    std::atomic<uint64_t> m_messagesReceived { 0 };
+    std::atomic<uint64_t> m_receiveSystemCalls { 0 };
 #if USE(GLIB)
     GRefPtr<GSocket> m_socket;
     GSocketMonitor m_readSocketMonitor;
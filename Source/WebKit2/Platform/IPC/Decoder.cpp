@@ -26,6 +26,7 @@
 #include "config.h"
 #include "Decoder.h"
 
+#include "BorrowedDataReference.h"
 #include "DataReference.h"
 #include "MessageFlags.h"
 #include <stdio.h>
@@ -44,6 +45,46 @@ static const uint8_t* copyBuffer(const uint8_t* buffer, size_t bufferSize)
     return bufferCopy;
 }
 
+static void freeBuffer(const uint8_t* buffer, size_t bufferSize, void (*bufferDeallocator)(const uint8_t*, size_t))
+{
+    if (bufferDeallocator)
+        bufferDeallocator(buffer, bufferSize);
+    else
+        fastFree(const_cast<uint8_t*>(buffer));
+}
+
+// Owns the buffer of a Decoder once borrowed data references share it.
+class BufferOwner {
+    WTF_MAKE_NONCOPYABLE(BufferOwner);
+public:
+    BufferOwner(const uint8_t* buffer, size_t bufferSize, void (*bufferDeallocator)(const uint8_t*, size_t))
+        : m_buffer(buffer)
+        , m_bufferSize(bufferSize)
+        , m_bufferDeallocator(bufferDeallocator)
+    {
+    }
+
+    BufferOwner(BufferOwner&& other)
+        : m_buffer(std::exchange(other.m_buffer, nullptr))
+        , m_bufferSize(other.m_bufferSize)
+        , m_bufferDeallocator(other.m_bufferDeallocator)
+    {
+    }
+
+    ~BufferOwner()
+    {
+        if (m_buffer)
+            freeBuffer(m_buffer, m_bufferSize, m_bufferDeallocator);
+    }
+
+    const uint8_t* buffer() const { return m_buffer; }
+
+private:
+    const uint8_t* m_buffer;
+    size_t m_bufferSize;
+    void (*m_bufferDeallocator)(const uint8_t*, size_t);
+};
+
 Decoder::Decoder(const uint8_t* buffer, size_t bufferSize, void (*bufferDeallocator)(const uint8_t*, size_t), Vector<Attachment> attachments)
     : m_buffer { bufferDeallocator ? buffer : copyBuffer(buffer, bufferSize) }
     , m_bufferPos { m_buffer }
@@ -70,10 +111,8 @@ Decoder::~Decoder()
 {
     ASSERT(m_buffer);
 
-    if (m_bufferDeallocator)
-        m_bufferDeallocator(m_buffer, m_bufferEnd - m_buffer);
-    else
-        fastFree(const_cast<uint8_t*>(m_buffer));
+    if (!m_sharedBuffer)
+        freeBuffer(m_buffer, m_bufferEnd - m_buffer, m_bufferDeallocator);
 
     // FIXME: We need to dispose of the mach ports in cases of failure.
 
@@ -181,6 +220,26 @@ bool Decoder::decodeVariableLengthByteArray(DataReference& dataReference)
     return true;
 }
 
+bool Decoder::decodeVariableLengthByteArray(BorrowedDataReference& borrowedDataReference)
+{
+    DataReference dataReference;
+    if (!decodeVariableLengthByteArray(dataReference))
+        return false;
+
+    // The buffer is the Decoder's own copy of the message body (or memory only this process can write to),
+    // so the bytes can't change after they were validated. Share it instead of copying the bytes again.
+    if (!m_sharedBuffer) {
+        size_t bufferSize = m_bufferEnd - m_buffer;
+        m_sharedBuffer = WebCore::SharedBuffer::DataSegment::create(WebCore::SharedBuffer::DataSegment::Provider {
+            [bufferOwner = BufferOwner(m_buffer, bufferSize, m_bufferDeallocator)] { return reinterpret_cast<const char*>(bufferOwner.buffer()); },
+            [bufferSize] { return bufferSize; }
+        });
+    }
+
+    borrowedDataReference = BorrowedDataReference(dataReference, makeRef(*m_sharedBuffer));
+    return true;
+}
+
 template<typename Type>
 static void decodeValueFromBuffer(Type& value, const uint8_t*& bufferPosition)
 {
@@ -28,6 +28,7 @@
 #include "ArgumentCoder.h"
 #include "Attachment.h"
 #include "StringReference.h"
+#include <WebCore/SharedBuffer.h>
 #include <wtf/EnumTraits.h>
 #include <wtf/Vector.h>
 
@@ -37,6 +38,7 @@
 
 namespace IPC {
 
+class BorrowedDataReference;
 class DataReference;
 class ImportanceAssertion;
 
@@ -76,6 +78,8 @@ public:
 
     // The data in the data reference here will only be valid for the lifetime of the ArgumentDecoder object.
     bool decodeVariableLengthByteArray(DataReference&);
+    // The data in the borrowed data reference stays valid after the Decoder is destroyed.
+    bool decodeVariableLengthByteArray(BorrowedDataReference&);
 
     bool decode(bool&);
     bool decode(uint8_t&);
@@ -141,6 +145,8 @@ private:
     const uint8_t* m_bufferPos;
     const uint8_t* m_bufferEnd;
     void (*m_bufferDeallocator)(const uint8_t*, size_t);
+    // Owns the buffer once borrowed data references share it.
+    RefPtr<WebCore::SharedBuffer::DataSegment> m_sharedBuffer;
 
     Vector<Attachment> m_attachments;
 
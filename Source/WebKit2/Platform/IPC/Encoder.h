@@ -82,6 +82,7 @@ public:
 
     void addAttachment(Attachment&&);
     Vector<Attachment> releaseAttachments();
+    bool hasAttachments() const { return !m_attachments.isEmpty(); }
     void reserve(size_t);
 
     static const bool isIPCEncoder = true;
@@ -0,0 +1,293 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "MessageTelemetry.h"
+
+#include <algorithm>
+#include <wtf/HashSet.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/ProcessID.h>
+#include <wtf/text/StringBuilder.h>
+
+namespace IPC {
+
+const size_t MessageTelemetry::maximumMessageTypeCount;
+const size_t MessageTelemetry::maximumMessageNameLength;
+
+static StaticLock processTelemetryLock;
+
+static HashSet<MessageTelemetry*>& liveConnectionTelemetries()
+{
+    static NeverDestroyed<HashSet<MessageTelemetry*>> telemetries;
+    return telemetries;
+}
+
+static MessageTelemetry::MessageStatisticsMap& closedConnectionsStatistics()
+{
+    static NeverDestroyed<MessageTelemetry::MessageStatisticsMap> statistics;
+    return statistics;
+}
+
+MessageTelemetry::MessageTelemetry()
+{
+    std::lock_guard<StaticLock> lock(processTelemetryLock);
+    liveConnectionTelemetries().add(this);
+}
+
+MessageTelemetry::~MessageTelemetry()
+{
+    std::lock_guard<StaticLock> lock(processTelemetryLock);
+    liveConnectionTelemetries().remove(this);
+    closedConnectionsStatistics().add(m_messageStatistics);
+}
+
+Seconds MessageTelemetry::blockedTimeHistogramBucketUpperBound(size_t bucket)
+{
+    ASSERT(bucket < blockedTimeHistogramBucketCount);
+    if (bucket == blockedTimeHistogramBucketCount - 1)
+        return Seconds::infinity();
+
+    // 1ms, 4ms, 16ms, ... 4096ms.
+    return 1_ms * (1 << (2 * bucket));
+}
+
+static size_t blockedTimeHistogramBucket(Seconds blockedTime)
+{
+    for (size_t bucket = 0; bucket < MessageTelemetry::blockedTimeHistogramBucketCount - 1; ++bucket) {
+        if (blockedTime <= MessageTelemetry::blockedTimeHistogramBucketUpperBound(bucket))
+            return bucket;
+    }
+    return MessageTelemetry::blockedTimeHistogramBucketCount - 1;
+}
+
+void MessageTelemetry::MessageStatistics::add(const MessageStatistics& other)
+{
+    sentCount += other.sentCount;
+    sentBytes += other.sentBytes;
+    dispatchedCount += other.dispatchedCount;
+    dispatchedBytes += other.dispatchedBytes;
+    totalDispatchTime += other.totalDispatchTime;
+    maximumDispatchTime = std::max(maximumDispatchTime, other.maximumDispatchTime);
+    workQueueDispatchedCount += other.workQueueDispatchedCount;
+    totalWorkQueueDispatchTime += other.totalWorkQueueDispatchTime;
+    blockedCount += other.blockedCount;
+    totalBlockedTime += other.totalBlockedTime;
+    maximumBlockedTime = std::max(maximumBlockedTime, other.maximumBlockedTime);
+    for (size_t bucket = 0; bucket < blockedTimeHistogramBucketCount; ++bucket)
+        blockedTimeHistogram[bucket] += other.blockedTimeHistogram[bucket];
+}
+
+MessageTelemetry::MessageStatistics& MessageTelemetry::MessageStatisticsMap::statisticsForMessage(StringReference messageReceiverName, StringReference messageName)
+{
+    auto it = m_messageStatistics.find(std::make_pair(messageReceiverName, messageName));
+    if (it != m_messageStatistics.end())
+        return it->value;
+
+    // Keep the last slot for the messages that don't get their own.
+    if (m_messageStatistics.size() >= maximumMessageTypeCount - 1 || messageReceiverName.size() > maximumMessageNameLength || messageName.size() > maximumMessageNameLength) {
+        static const char otherName[] = "Other";
+        auto otherKey = std::make_pair(StringReference(otherName), StringReference(otherName));
+        return m_messageStatistics.add(otherKey, MessageStatistics()).iterator->value;
+    }
+
+    m_messageNames.append(messageReceiverName.toString());
+    StringReference ownedMessageReceiverName(m_messageNames.last().data(), m_messageNames.last().length());
+    m_messageNames.append(messageName.toString());
+    StringReference ownedMessageName(m_messageNames.last().data(), m_messageNames.last().length());
+
+    return m_messageStatistics.add(std::make_pair(ownedMessageReceiverName, ownedMessageName), MessageStatistics()).iterator->value;
+}
+
+void MessageTelemetry::MessageStatisticsMap::add(const MessageStatisticsMap& other)
+{
+    for (auto& keyAndStatistics : other.m_messageStatistics)
+        statisticsForMessage(keyAndStatistics.key.first, keyAndStatistics.key.second).add(keyAndStatistics.value);
+}
+
+void MessageTelemetry::MessageStatisticsMap::clear()
+{
+    m_messageStatistics.clear();
+    m_messageNames.clear();
+}
+
+void MessageTelemetry::didSendMessage(StringReference messageReceiverName, StringReference messageName, size_t bodySize)
+{
+    std::lock_guard<Lock> lock(m_lock);
+
+    auto& statistics = m_messageStatistics.statisticsForMessage(messageReceiverName, messageName);
+    ++statistics.sentCount;
+    statistics.sentBytes += bodySize;
+}
+
+void MessageTelemetry::didDispatchMessage(StringReference messageReceiverName, StringReference messageName, size_t bodySize, Seconds dispatchTime)
+{
+    std::lock_guard<Lock> lock(m_lock);
+
+    auto& statistics = m_messageStatistics.statisticsForMessage(messageReceiverName, messageName);
+    ++statistics.dispatchedCount;
+    statistics.dispatchedBytes += bodySize;
+    statistics.totalDispatchTime += dispatchTime;
+    statistics.maximumDispatchTime = std::max(statistics.maximumDispatchTime, dispatchTime);
+}
+
+void MessageTelemetry::didDispatchMessageOnWorkQueue(StringReference messageReceiverName, StringReference messageName, Seconds dispatchTime)
+{
+    std::lock_guard<Lock> lock(m_lock);
+
+    auto& statistics = m_messageStatistics.statisticsForMessage(messageReceiverName, messageName);
+    ++statistics.workQueueDispatchedCount;
+    statistics.totalWorkQueueDispatchTime += dispatchTime;
+}
+
+void MessageTelemetry::didBlockOnMessage(StringReference messageReceiverName, StringReference messageName, Seconds blockedTime)
+{
+    std::lock_guard<Lock> lock(m_lock);
+
+    auto& statistics = m_messageStatistics.statisticsForMessage(messageReceiverName, messageName);
+    ++statistics.blockedCount;
+    statistics.totalBlockedTime += blockedTime;
+    statistics.maximumBlockedTime = std::max(statistics.maximumBlockedTime, blockedTime);
+    ++statistics.blockedTimeHistogram[blockedTimeHistogramBucket(blockedTime)];
+}
+
+static String blockedTimeHistogramBucketName(size_t bucket)
+{
+    if (bucket == MessageTelemetry::blockedTimeHistogramBucketCount - 1)
+        return makeString("BlockedOver", String::number(MessageTelemetry::blockedTimeHistogramBucketUpperBound(bucket - 1).milliseconds()), "msCount");
+    return makeString("BlockedUpTo", String::number(MessageTelemetry::blockedTimeHistogramBucketUpperBound(bucket).milliseconds()), "msCount");
+}
+
+static uint64_t microseconds(Seconds time)
+{
+    return static_cast<uint64_t>(time.microseconds());
+}
+
+void MessageTelemetry::MessageStatisticsMap::addTo(HashMap<String, HashMap<String, uint64_t>>& result) const
+{
+    for (auto& keyAndStatistics : m_messageStatistics) {
+        auto& key = keyAndStatistics.key;
+        auto& statistics = keyAndStatistics.value;
+
+        HashMap<String, uint64_t> values;
+        values.set(ASCIILiteral("SentCount"), statistics.sentCount);
+        values.set(ASCIILiteral("SentBytes"), statistics.sentBytes);
+        values.set(ASCIILiteral("DispatchedCount"), statistics.dispatchedCount);
+        values.set(ASCIILiteral("DispatchedBytes"), statistics.dispatchedBytes);
+        values.set(ASCIILiteral("DispatchTimeMicroseconds"), microseconds(statistics.totalDispatchTime));
+        values.set(ASCIILiteral("MaximumDispatchTimeMicroseconds"), microseconds(statistics.maximumDispatchTime));
+        if (statistics.workQueueDispatchedCount) {
+            values.set(ASCIILiteral("WorkQueueDispatchedCount"), statistics.workQueueDispatchedCount);
+            values.set(ASCIILiteral("WorkQueueDispatchTimeMicroseconds"), microseconds(statistics.totalWorkQueueDispatchTime));
+        }
+        if (statistics.blockedCount) {
+            values.set(ASCIILiteral("BlockedCount"), statistics.blockedCount);
+            values.set(ASCIILiteral("BlockedTimeMicroseconds"), microseconds(statistics.totalBlockedTime));
+            values.set(ASCIILiteral("MaximumBlockedTimeMicroseconds"), microseconds(statistics.maximumBlockedTime));
+            for (size_t bucket = 0; bucket < blockedTimeHistogramBucketCount; ++bucket)
+                values.set(blockedTimeHistogramBucketName(bucket), statistics.blockedTimeHistogram[bucket]);
+        }
+
+        String messageName = makeString(String(key.first.data(), key.first.size()), '.', String(key.second.data(), key.second.size()));
+        result.add(messageName, WTFMove(values));
+    }
+}
+
+HashMap<String, HashMap<String, uint64_t>> MessageTelemetry::statistics() const
+{
+    HashMap<String, HashMap<String, uint64_t>> result;
+
+    std::lock_guard<Lock> lock(m_lock);
+    m_messageStatistics.addTo(result);
+    return result;
+}
+
+HashMap<String, HashMap<String, uint64_t>> MessageTelemetry::processStatistics()
+{
+    MessageStatisticsMap processStatistics;
+
+    {
+        std::lock_guard<StaticLock> lock(processTelemetryLock);
+        processStatistics.add(closedConnectionsStatistics());
+        for (auto* telemetry : liveConnectionTelemetries()) {
+            std::lock_guard<Lock> connectionLock(telemetry->m_lock);
+            processStatistics.add(telemetry->m_messageStatistics);
+        }
+    }
+
+    HashMap<String, HashMap<String, uint64_t>> result;
+    processStatistics.addTo(result);
+    return result;
+}
+
+void MessageTelemetry::dumpProcessStatistics()
+{
+    auto allStatistics = processStatistics();
+
+    Vector<String> messageNames;
+    copyKeysToVector(allStatistics, messageNames);
+    std::sort(messageNames.begin(), messageNames.end(), WTF::codePointCompareLessThan);
+
+    WTFLogAlways("IPC message telemetry for process %d:", getCurrentProcessID());
+    for (auto& messageName : messageNames) {
+        auto& values = allStatistics.find(messageName)->value;
+
+        StringBuilder builder;
+        builder.append(messageName);
+        builder.append(':');
+
+        Vector<String> valueNames;
+        copyKeysToVector(values, valueNames);
+        std::sort(valueNames.begin(), valueNames.end(), WTF::codePointCompareLessThan);
+        for (auto& valueName : valueNames) {
+            builder.append(' ');
+            builder.append(valueName);
+            builder.append('=');
+            builder.appendNumber(values.get(valueName));
+        }
+
+        WTFLogAlways("    %s", builder.toString().utf8().data());
+    }
+}
+
+void MessageTelemetry::dumpProcessStatisticsIfRequested()
+{
+    if (!getenv("WEBKIT_DUMP_IPC_MESSAGE_STATISTICS"))
+        return;
+
+    dumpProcessStatistics();
+}
+
+void MessageTelemetry::clearProcessStatistics()
+{
+    std::lock_guard<StaticLock> lock(processTelemetryLock);
+    closedConnectionsStatistics().clear();
+    for (auto* telemetry : liveConnectionTelemetries()) {
+        std::lock_guard<Lock> connectionLock(telemetry->m_lock);
+        telemetry->m_messageStatistics.clear();
+    }
+}
+
+} // namespace IPC
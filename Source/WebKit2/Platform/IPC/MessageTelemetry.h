@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "StringReference.h"
+#include <array>
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/Seconds.h>
+#include <wtf/Vector.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/StringHash.h>
+#include <wtf/text/WTFString.h>
+
+namespace IPC {
+
+// Counters for every message type sent or dispatched by a connection, and for the time spent blocked in
+// sendSync() and waitForMessage(). Each connection has its own, so recording a message only takes the lock
+// of that connection; the process totals are only put together when they are requested, and the counters
+// of a connection are added to them when it goes away.
+
+class MessageTelemetry {
+    WTF_MAKE_NONCOPYABLE(MessageTelemetry); WTF_MAKE_FAST_ALLOCATED;
+public:
+    MessageTelemetry();
+    ~MessageTelemetry();
+
+    static const size_t blockedTimeHistogramBucketCount = 8;
+    // The last bucket has no upper bound.
+    static Seconds blockedTimeHistogramBucketUpperBound(size_t bucket);
+
+    // The names of received messages come from the other process. Past this many message types, or for
+    // names longer than maximumMessageNameLength, messages are counted as "Other.Other" so that a process
+    // sending made up names can't make the tables grow without bound.
+    static const size_t maximumMessageTypeCount = 512;
+    static const size_t maximumMessageNameLength = 128;
+
+    struct MessageStatistics {
+        uint64_t sentCount { 0 };
+        uint64_t sentBytes { 0 };
+        uint64_t dispatchedCount { 0 };
+        uint64_t dispatchedBytes { 0 };
+        Seconds totalDispatchTime;
+        Seconds maximumDispatchTime;
+        uint64_t workQueueDispatchedCount { 0 };
+        Seconds totalWorkQueueDispatchTime;
+        uint64_t blockedCount { 0 };
+        Seconds totalBlockedTime;
+        Seconds maximumBlockedTime;
+        std::array<uint64_t, blockedTimeHistogramBucketCount> blockedTimeHistogram { };
+
+        void add(const MessageStatistics&);
+    };
+
+    void didSendMessage(StringReference messageReceiverName, StringReference messageName, size_t bodySize);
+    // Invalid messages are not recorded, their names are not worth keeping.
+    void didDispatchMessage(StringReference messageReceiverName, StringReference messageName, size_t bodySize, Seconds dispatchTime);
+    // Messages for work queue message receivers are counted separately, they do not take time on the client thread.
+    void didDispatchMessageOnWorkQueue(StringReference messageReceiverName, StringReference messageName, Seconds dispatchTime);
+    // Called when sendSync() or waitForMessage() returns, blockedTime is also recorded when waiting timed out.
+    void didBlockOnMessage(StringReference messageReceiverName, StringReference messageName, Seconds blockedTime);
+
+    // Keyed by "MessageReceiverName.MessageName", the values are the statistics of that message.
+    HashMap<String, HashMap<String, uint64_t>> statistics() const;
+
+    // The same for all the connections of this process, including the closed ones.
+    static HashMap<String, HashMap<String, uint64_t>> processStatistics();
+    static void dumpProcessStatistics();
+    // Dumps the process statistics when WEBKIT_DUMP_IPC_MESSAGE_STATISTICS is set in the environment.
+    // Processes call this on their way out.
+    static void dumpProcessStatisticsIfRequested();
+    static void clearProcessStatistics();
+
+    class MessageStatisticsMap {
+    public:
+        MessageStatistics& statisticsForMessage(StringReference messageReceiverName, StringReference messageName);
+        void add(const MessageStatisticsMap&);
+        void addTo(HashMap<String, HashMap<String, uint64_t>>&) const;
+        void clear();
+
+        size_t size() const { return m_messageStatistics.size(); }
+
+    private:
+        using MessageKey = std::pair<StringReference, StringReference>;
+
+        HashMap<MessageKey, MessageStatistics> m_messageStatistics;
+        // Decoded message names point to the message buffer, keys point to these copies instead.
+        Vector<CString> m_messageNames;
+    };
+
+private:
+    mutable Lock m_lock;
+    MessageStatisticsMap m_messageStatistics;
+};
+
+} // namespace IPC
@@ -29,6 +29,7 @@
 #include "Connection.h"
 
 #include "DataReference.h"
+#include "Logging.h"
 #include "SharedMemory.h"
 #include "UnixMessage.h"
 #include <sys/socket.h>
@@ -113,6 +114,17 @@ void Connection::platformInvalidate()
     if (!m_isConnected)
         return;
 
+#if !LOG_DISABLED
+    auto statistics = messageBodyArenaStatistics();
+    LOG(IPC, "Message body arenas: %" PRIu64 " bodies sent, %" PRIu64 " received, %" PRIu64 " sent in their own shared memory; %" PRIu64 " arenas created, %" PRIu64 " mapped, %" PRIu64 " retired",
+        statistics.arenaBodiesSent, statistics.arenaBodiesReceived, statistics.standaloneBodiesSent, statistics.arenasCreated, statistics.arenasMapped, statistics.arenasRetired);
+
+    auto batchingStatistics = messageBatchingStatistics();
+    LOG(IPC, "Connection %p: %" PRIu64 " messages sent in %" PRIu64 " system calls (%.2f per call), %" PRIu64 " received in %" PRIu64 " system calls (%.2f per call)",
+        this, batchingStatistics.messagesSent, batchingStatistics.sendSystemCalls, batchingStatistics.messagesPerSendSystemCall(),
+        batchingStatistics.messagesReceived, batchingStatistics.receiveSystemCalls, batchingStatistics.messagesPerReceiveSystemCall());
+#endif
+
 #if USE(GLIB)
     m_readSocketMonitor.stop();
     m_writeSocketMonitor.stop();
@@ -158,7 +170,7 @@ bool Connection::processMessage()
             }
         }
 
-        if (messageInfo.isBodyOutOfLine())
+        if (messageInfo.hasTrailingAttachment())
             attachmentCount--;
     }
 
@@ -186,7 +198,7 @@ bool Connection::processMessage()
         }
     }
 
-    if (messageInfo.isBodyOutOfLine()) {
+    if (messageInfo.hasTrailingAttachment()) {
         ASSERT(messageInfo.bodySize());
 
         if (attachmentInfo[attachmentCount].isNull()) {
@@ -194,23 +206,43 @@ bool Connection::processMessage()
             return false;
         }
 
-        WebKit::SharedMemory::Handle handle;
-        handle.adoptAttachment(IPC::Attachment(m_fileDescriptors[attachmentFileDescriptorCount - 1], attachmentInfo[attachmentCount].size()));
-
-        oolMessageBody = WebKit::SharedMemory::map(handle, WebKit::SharedMemory::Protection::ReadOnly);
-        if (!oolMessageBody) {
-            ASSERT_NOT_REACHED();
-            return false;
+        IPC::Attachment trailingAttachment(m_fileDescriptors[attachmentFileDescriptorCount - 1], attachmentInfo[attachmentCount].size());
+        if (messageInfo.hasArenaAttachment()) {
+            if (!m_incomingMessageBodyArena.adoptArena(WTFMove(trailingAttachment))) {
+                ASSERT_NOT_REACHED();
+                return false;
+            }
+        } else {
+            WebKit::SharedMemory::Handle handle;
+            handle.adoptAttachment(WTFMove(trailingAttachment));
+
+            oolMessageBody = WebKit::SharedMemory::map(handle, WebKit::SharedMemory::Protection::ReadOnly);
+            if (!oolMessageBody) {
+                ASSERT_NOT_REACHED();
+                return false;
+            }
         }
     }
 
-    ASSERT(attachments.size() == (messageInfo.isBodyOutOfLine() ? messageInfo.attachmentCount() - 1 : messageInfo.attachmentCount()));
-
-    uint8_t* messageBody = messageData;
-    if (messageInfo.isBodyOutOfLine())
-        messageBody = reinterpret_cast<uint8_t*>(oolMessageBody->data());
+    ASSERT(attachments.size() == (messageInfo.hasTrailingAttachment() ? messageInfo.attachmentCount() - 1 : messageInfo.attachmentCount()));
 
-    auto decoder = std::make_unique<Decoder>(messageBody, messageInfo.bodySize(), nullptr, WTFMove(attachments));
+    std::unique_ptr<Decoder> decoder;
+    // Bodies in the arena are out of line too, so check for them first.
+    if (messageInfo.isBodyInArena()) {
+        auto messageBody = m_incomingMessageBodyArena.takeBody(messageInfo.arenaPosition(), messageInfo.bodySize());
+        if (!messageBody) {
+            ASSERT_NOT_REACHED();
+            return false;
+        }
+        decoder = std::make_unique<Decoder>(messageBody.leakPtr(), messageInfo.bodySize(), [](const uint8_t* buffer, size_t) {
+            fastFree(const_cast<uint8_t*>(buffer));
+        }, WTFMove(attachments));
+        scheduleMessageBodyArenaIdleCheck();
+    } else if (messageInfo.isBodyOutOfLine()) {
+        // The sender can still write to the shared memory, so the decoder has to validate its own copy of the body.
+        decoder = std::make_unique<Decoder>(static_cast<const uint8_t*>(oolMessageBody->data()), messageInfo.bodySize(), nullptr, WTFMove(attachments));
+    } else
+        decoder = std::make_unique<Decoder>(messageData, messageInfo.bodySize(), nullptr, WTFMove(attachments));
 
     processIncomingMessage(WTFMove(decoder));
 
@@ -311,10 +343,12 @@ void Connection::readyReadHandler()
             return;
         }
 
-        // Process messages from data received.
+        // Process messages from data received, a single read can contain a batch of messages.
+        ++m_receiveSystemCalls;
         while (true) {
             if (!processMessage())
                 break;
+            ++m_messagesReceived;
         }
     }
 }
@@ -358,7 +392,176 @@ bool Connection::open()
 
 bool Connection::platformCanSendOutgoingMessages() const
 {
-    return !m_pendingOutputMessage;
+    return !m_pendingOutputMessage && !m_isWaitingForWritableSocket;
+}
+
+static bool canBeSentInBatch(const Encoder& encoder)
+{
+    // Sync messages are not delayed behind other messages, and file descriptors can't be attributed
+    // to a message once several of them share a single socket write.
+    if (encoder.isSyncMessage() || encoder.hasAttachments())
+        return false;
+    return sizeof(MessageInfo) + encoder.bufferSize() <= messageMaxSize;
+}
+
+void Connection::sendOutgoingMessageBatches()
+{
+    while (canSendOutgoingMessages()) {
+        Vector<std::unique_ptr<Encoder>> batch;
+        std::unique_ptr<Encoder> messageToSendAlone;
+
+        {
+            std::lock_guard<Lock> lock(m_outgoingMessagesMutex);
+            size_t batchSize = 0;
+            while (!m_outgoingMessages.isEmpty()) {
+                auto& encoder = *m_outgoingMessages.first();
+                if (!canBeSentInBatch(encoder)) {
+                    if (batch.isEmpty())
+                        messageToSendAlone = m_outgoingMessages.takeFirst();
+                    break;
+                }
+
+                size_t messageSize = sizeof(MessageInfo) + encoder.bufferSize();
+                if (batchSize + messageSize > messageMaxSize)
+                    break;
+
+                batchSize += messageSize;
+                batch.append(m_outgoingMessages.takeFirst());
+            }
+        }
+
+        if (messageToSendAlone) {
+            if (!sendOutgoingMessage(WTFMove(messageToSendAlone)))
+                return;
+            continue;
+        }
+
+        if (batch.isEmpty() || !sendOutgoingMessageBatch(batch))
+            return;
+    }
+}
+
+bool Connection::sendOutgoingMessageBatch(Vector<std::unique_ptr<Encoder>>& batch)
+{
+    ASSERT(!batch.isEmpty());
+
+    // The receiver already handles several messages in a single read, each one is written as
+    // its MessageInfo followed by its inline body.
+    Vector<MessageInfo> messageInfos;
+    messageInfos.reserveInitialCapacity(batch.size());
+    Vector<struct iovec> iov;
+    iov.reserveInitialCapacity(batch.size() * 2);
+    for (auto& encoder : batch) {
+        messageInfos.uncheckedAppend(MessageInfo(encoder->bufferSize(), 0));
+        iov.uncheckedAppend({ &messageInfos.last(), sizeof(MessageInfo) });
+        if (encoder->bufferSize())
+            iov.uncheckedAppend({ encoder->buffer(), encoder->bufferSize() });
+    }
+
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = iov.data();
+    message.msg_iovlen = iov.size();
+
+    while (sendmsg(m_socketDescriptor, &message, 0) == -1) {
+        if (errno == EINTR)
+            continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+#if USE(GLIB)
+            {
+                std::lock_guard<Lock> lock(m_outgoingMessagesMutex);
+                for (size_t i = batch.size(); i > 0; --i)
+                    m_outgoingMessages.prepend(WTFMove(batch[i - 1]));
+            }
+            waitForSocketToBecomeWritable();
+            return false;
+#else
+            struct pollfd pollfd;
+
+            pollfd.fd = m_socketDescriptor;
+            pollfd.events = POLLOUT;
+            pollfd.revents = 0;
+            poll(&pollfd, 1, -1);
+            continue;
+#endif
+        }
+
+        if (m_isConnected)
+            WTFLogAlways("Error sending IPC message batch: %s", strerror(errno));
+        return false;
+    }
+
+    m_messagesSent += batch.size();
+    ++m_sendSystemCalls;
+    return true;
+}
+
+void Connection::waitForSocketToBecomeWritable()
+{
+#if USE(GLIB)
+    ASSERT(!m_isWaitingForWritableSocket);
+    m_isWaitingForWritableSocket = true;
+    m_writeSocketMonitor.start(m_socket.get(), G_IO_OUT, m_connectionQueue->runLoop(), [this, protectedThis = makeRef(*this)] (GIOCondition condition) -> gboolean {
+        if (condition & G_IO_OUT) {
+            // We can't stop the monitor from this lambda, because stop destroys the lambda.
+            m_connectionQueue->dispatch([this, protectedThis = makeRef(*this)] {
+                m_writeSocketMonitor.stop();
+                m_isWaitingForWritableSocket = false;
+                if (m_isConnected)
+                    sendOutgoingMessages();
+            });
+        }
+        return G_SOURCE_REMOVE;
+    });
+#else
+    ASSERT_NOT_REACHED();
+#endif
+}
+
+Connection::MessageBatchingStatistics Connection::messageBatchingStatistics() const
+{
+    MessageBatchingStatistics statistics;
+    statistics.messagesSent = m_messagesSent.load();
+    statistics.sendSystemCalls = m_sendSystemCalls.load();
+    statistics.messagesReceived = m_messagesReceived.load();
+    statistics.receiveSystemCalls = m_receiveSystemCalls.load();
+    return statistics;
+}
+
+void Connection::scheduleMessageBodyArenaIdleCheck()
+{
+    if (m_hasScheduledMessageBodyArenaIdleCheck)
+        return;
+
+    m_hasScheduledMessageBodyArenaIdleCheck = true;
+    m_connectionQueue->dispatchAfter(m_messageBodyArenaIdleDelay, [protectedThis = makeRef(*this)] {
+        protectedThis->checkMessageBodyArenasIdle();
+    });
+}
+
+void Connection::checkMessageBodyArenasIdle()
+{
+    m_hasScheduledMessageBodyArenaIdleCheck = false;
+    if (!m_isConnected)
+        return;
+
+    auto now = MonotonicTime::now();
+    bool needsAnotherCheck = false;
+    if (m_outgoingMessageBodyArena.hasArena()) {
+        // The receiver might still be decoding the last bodies, try again later then.
+        if (now - m_outgoingMessageBodyArena.lastWriteTime() < m_messageBodyArenaIdleDelay || !m_outgoingMessageBodyArena.retireIfConsumed())
+            needsAnotherCheck = true;
+    }
+
+    if (m_incomingMessageBodyArena.hasArena() && !m_incomingMessageBodyArena.releaseIfRetired()) {
+        // Give the sender a few chances to retire the ring after its own idle delay. If it doesn't, the
+        // mapping goes away with the next ring or the connection.
+        if (now - m_incomingMessageBodyArena.lastReadTime() < m_messageBodyArenaIdleDelay * 3)
+            needsAnotherCheck = true;
+    }
+
+    if (needsAnotherCheck)
+        scheduleMessageBodyArenaIdleCheck();
 }
 
 bool Connection::sendOutgoingMessage(std::unique_ptr<Encoder> encoder)
@@ -373,6 +576,18 @@ bool Connection::sendOutgoingMessage(std::unique_ptr<Encoder> encoder)
 
     size_t messageSizeWithBodyInline = sizeof(MessageInfo) + (outputMessage.attachments().size() * sizeof(AttachmentInfo)) + outputMessage.bodySize();
     if (messageSizeWithBodyInline > messageMaxSize && outputMessage.bodySize()) {
+        uint64_t arenaPosition;
+        std::optional<Attachment> arenaAttachment;
+        if (m_outgoingMessageBodyArena.write(outputMessage.body(), outputMessage.bodySize(), arenaPosition, arenaAttachment)) {
+            outputMessage.messageInfo().setBodyInArena(arenaPosition);
+            if (arenaAttachment) {
+                outputMessage.messageInfo().setHasArenaAttachment();
+                outputMessage.appendAttachment(WTFMove(*arenaAttachment));
+            }
+            scheduleMessageBodyArenaIdleCheck();
+            return sendOutputMessage(outputMessage);
+        }
+
         RefPtr<WebKit::SharedMemory> oolMessageBody = WebKit::SharedMemory::allocate(encoder->bufferSize());
         if (!oolMessageBody)
             return false;
@@ -386,6 +601,7 @@ bool Connection::sendOutgoingMessage(std::unique_ptr<Encoder> encoder)
         memcpy(oolMessageBody->data(), outputMessage.body(), outputMessage.bodySize());
 
         outputMessage.appendAttachment(handle.releaseAttachment());
+        m_outgoingMessageBodyArena.didSendStandaloneBody();
     }
 
     return sendOutputMessage(outputMessage);
@@ -507,6 +723,9 @@ bool Connection::sendOutputMessage(UnixMessage& outputMessage)
             WTFLogAlways("Error sending IPC message: %s", strerror(errno));
         return false;
     }
+
+    ++m_messagesSent;
+    ++m_sendSystemCalls;
     return true;
 }
 
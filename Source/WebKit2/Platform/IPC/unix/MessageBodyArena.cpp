@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "MessageBodyArena.h"
+
+#if USE(UNIX_DOMAIN_SOCKETS)
+
+#include <atomic>
+#include <wtf/StdLibExtras.h>
+
+namespace IPC {
+
+static const size_t arenaHeaderSize = 64;
+static const size_t bodyAlignment = 16;
+static const size_t initialArenaCapacity = 1024 * 1024;
+static const size_t maximumArenaCapacity = 16 * 1024 * 1024;
+
+struct ArenaHeader {
+    std::atomic<uint64_t> consumedPosition;
+    std::atomic<bool> isRetired;
+};
+static_assert(sizeof(ArenaHeader) <= arenaHeaderSize, "ArenaHeader must fit in the arena header");
+
+static std::atomic<uint64_t> arenaBodiesSent;
+static std::atomic<uint64_t> arenaBodiesReceived;
+static std::atomic<uint64_t> standaloneBodiesSent;
+static std::atomic<uint64_t> arenasCreated;
+static std::atomic<uint64_t> arenasMapped;
+static std::atomic<uint64_t> arenasRetired;
+
+static inline ArenaHeader& arenaHeader(WebKit::SharedMemory& arena)
+{
+    return *static_cast<ArenaHeader*>(arena.data());
+}
+
+static inline uint8_t* arenaData(WebKit::SharedMemory& arena)
+{
+    return static_cast<uint8_t*>(arena.data()) + arenaHeaderSize;
+}
+
+bool MessageBodyArenaWriter::write(const uint8_t* body, size_t bodySize, uint64_t& position, std::optional<Attachment>& newArenaAttachment)
+{
+    size_t size = roundUpToMultipleOf<bodyAlignment>(bodySize);
+    if (!size || size > maximumArenaCapacity / 2)
+        return false;
+
+    if (!m_arena || !reserve(size, position)) {
+        if (!createArena(size * 2, newArenaAttachment))
+            return false;
+        bool reserved = reserve(size, position);
+        ASSERT_UNUSED(reserved, reserved);
+    }
+
+    memcpy(arenaData(*m_arena) + position % m_capacity, body, bodySize);
+    m_lastWriteTime = MonotonicTime::now();
+    ++arenaBodiesSent;
+    return true;
+}
+
+bool MessageBodyArenaWriter::retireIfConsumed()
+{
+    if (!m_arena)
+        return true;
+
+    if (arenaHeader(*m_arena).consumedPosition.load(std::memory_order_acquire) != m_writePosition)
+        return false;
+
+    arenaHeader(*m_arena).isRetired.store(true, std::memory_order_release);
+    m_arena = nullptr;
+    m_capacity = 0;
+    m_writePosition = 0;
+    m_consumedPosition = 0;
+    ++arenasRetired;
+    return true;
+}
+
+void MessageBodyArenaWriter::didSendStandaloneBody()
+{
+    ++standaloneBodiesSent;
+}
+
+bool MessageBodyArenaWriter::reserve(size_t size, uint64_t& position)
+{
+    ASSERT(m_arena);
+
+    // The receiver can write anything to the header, only accept a consumed position between the last one and what we wrote.
+    uint64_t consumedPosition = arenaHeader(*m_arena).consumedPosition.load(std::memory_order_acquire);
+    if (consumedPosition > m_consumedPosition && consumedPosition <= m_writePosition)
+        m_consumedPosition = consumedPosition;
+
+    // Bodies are never split, skip the end of the ring if the body doesn't fit there.
+    uint64_t start = m_writePosition;
+    size_t offset = start % m_capacity;
+    if (offset + size > m_capacity)
+        start += m_capacity - offset;
+
+    uint64_t end = start + size;
+    if (end - m_consumedPosition > m_capacity)
+        return false;
+
+    m_writePosition = end;
+    position = start;
+    return true;
+}
+
+bool MessageBodyArenaWriter::createArena(size_t minimumCapacity, std::optional<Attachment>& newArenaAttachment)
+{
+    // Replace a full ring with a bigger one, the receiver unmaps the old one when it gets the new one.
+    // A retired ring starts over from the initial capacity.
+    size_t capacity = m_arena ? m_capacity * 2 : initialArenaCapacity;
+    while (capacity < minimumCapacity)
+        capacity *= 2;
+    if (capacity > maximumArenaCapacity)
+        return false;
+
+    auto arena = WebKit::SharedMemory::allocate(arenaHeaderSize + capacity);
+    if (!arena)
+        return false;
+
+    WebKit::SharedMemory::Handle handle;
+    if (!arena->createHandle(handle, WebKit::SharedMemory::Protection::ReadWrite))
+        return false;
+
+    m_arena = WTFMove(arena);
+    m_capacity = capacity;
+    m_writePosition = 0;
+    m_consumedPosition = 0;
+    newArenaAttachment = handle.releaseAttachment();
+    ++arenasCreated;
+    return true;
+}
+
+bool MessageBodyArenaReader::adoptArena(Attachment&& attachment)
+{
+    size_t size = attachment.size();
+    WebKit::SharedMemory::Handle handle;
+    handle.adoptAttachment(WTFMove(attachment));
+    if (size <= arenaHeaderSize)
+        return false;
+
+    auto arena = WebKit::SharedMemory::map(handle, WebKit::SharedMemory::Protection::ReadWrite);
+    if (!arena)
+        return false;
+
+    m_arena = WTFMove(arena);
+    m_capacity = size - arenaHeaderSize;
+    ++arenasMapped;
+    return true;
+}
+
+MallocPtr<uint8_t> MessageBodyArenaReader::takeBody(uint64_t position, size_t bodySize)
+{
+    if (!m_arena || !bodySize)
+        return nullptr;
+
+    size_t offset = position % m_capacity;
+    if (bodySize > m_capacity - offset)
+        return nullptr;
+
+    auto body = MallocPtr<uint8_t>::malloc(bodySize);
+    memcpy(body.get(), arenaData(*m_arena) + offset, bodySize);
+
+    arenaHeader(*m_arena).consumedPosition.store(position + roundUpToMultipleOf<bodyAlignment>(bodySize), std::memory_order_release);
+    m_lastReadTime = MonotonicTime::now();
+    ++arenaBodiesReceived;
+    return body;
+}
+
+bool MessageBodyArenaReader::releaseIfRetired()
+{
+    if (!m_arena)
+        return true;
+
+    if (!arenaHeader(*m_arena).isRetired.load(std::memory_order_acquire))
+        return false;
+
+    m_arena = nullptr;
+    m_capacity = 0;
+    return true;
+}
+
+MessageBodyArenaStatistics messageBodyArenaStatistics()
+{
+    MessageBodyArenaStatistics statistics;
+    statistics.arenaBodiesSent = arenaBodiesSent;
+    statistics.arenaBodiesReceived = arenaBodiesReceived;
+    statistics.standaloneBodiesSent = standaloneBodiesSent;
+    statistics.arenasCreated = arenasCreated;
+    statistics.arenasMapped = arenasMapped;
+    statistics.arenasRetired = arenasRetired;
+    return statistics;
+}
+
+} // namespace IPC
+
+#endif // USE(UNIX_DOMAIN_SOCKETS)
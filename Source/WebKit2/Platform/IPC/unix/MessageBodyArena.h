@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#if USE(UNIX_DOMAIN_SOCKETS)
+
+#include "Attachment.h"
+#include "SharedMemory.h"
+#include <wtf/MallocPtr.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/Optional.h>
+#include <wtf/RefPtr.h>
+
+namespace IPC {
+
+// Out-of-line message bodies are written to a ring of shared memory owned by the sending side of
+// the connection instead of each getting its own SharedMemory. The receiver maps the ring once and
+// publishes in the ring header how far it has consumed the bodies, so that the sender can reuse the
+// space. The ring file descriptor is only sent when the ring is created or replaced by a bigger one.
+//
+// Once the connection has been idle for a while, the sender retires the ring if every body written to
+// it has been consumed, and the receiver unmaps it when it sees it retired. The next big body gets a
+// new ring of the initial size, so a burst of big messages doesn't pin the biggest ring for the rest
+// of the connection lifetime.
+
+class MessageBodyArenaWriter {
+    WTF_MAKE_NONCOPYABLE(MessageBodyArenaWriter);
+public:
+    MessageBodyArenaWriter() = default;
+
+    // Returns false if the body doesn't fit, it has to be sent in its own SharedMemory then. When the
+    // ring had to be created, newArenaAttachment is set and must be sent along with the body.
+    bool write(const uint8_t* body, size_t bodySize, uint64_t& position, std::optional<Attachment>& newArenaAttachment);
+    void didSendStandaloneBody();
+
+    bool hasArena() const { return !!m_arena; }
+    size_t capacity() const { return m_capacity; }
+    MonotonicTime lastWriteTime() const { return m_lastWriteTime; }
+
+    // Returns false, keeping the ring, if the receiver hasn't consumed every body written to it yet.
+    bool retireIfConsumed();
+
+private:
+    bool reserve(size_t, uint64_t& position);
+    bool createArena(size_t minimumCapacity, std::optional<Attachment>& newArenaAttachment);
+
+    RefPtr<WebKit::SharedMemory> m_arena;
+    size_t m_capacity { 0 };
+    uint64_t m_writePosition { 0 };
+    uint64_t m_consumedPosition { 0 };
+    MonotonicTime m_lastWriteTime;
+};
+
+class MessageBodyArenaReader {
+    WTF_MAKE_NONCOPYABLE(MessageBodyArenaReader);
+public:
+    MessageBodyArenaReader() = default;
+
+    bool adoptArena(Attachment&&);
+
+    // The sender can still write to the ring, so bodies are copied out of it before anything looks at
+    // them, and their space is handed back to the sender right away. Returns null for a body that is
+    // not within the ring.
+    MallocPtr<uint8_t> takeBody(uint64_t position, size_t bodySize);
+
+    bool hasArena() const { return !!m_arena; }
+    MonotonicTime lastReadTime() const { return m_lastReadTime; }
+
+    // Unmaps the ring if the sender retired it.
+    bool releaseIfRetired();
+
+private:
+    RefPtr<WebKit::SharedMemory> m_arena;
+    size_t m_capacity { 0 };
+    MonotonicTime m_lastReadTime;
+};
+
+struct MessageBodyArenaStatistics {
+    uint64_t arenaBodiesSent { 0 };
+    uint64_t arenaBodiesReceived { 0 };
+    uint64_t standaloneBodiesSent { 0 };
+    uint64_t arenasCreated { 0 };
+    uint64_t arenasMapped { 0 };
+    uint64_t arenasRetired { 0 };
+};
+
+// Totals for all the connections of this process.
+MessageBodyArenaStatistics messageBodyArenaStatistics();
+
+} // namespace IPC
+
+#endif // USE(UNIX_DOMAIN_SOCKETS)
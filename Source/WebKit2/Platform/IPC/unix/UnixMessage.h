@@ -50,14 +50,40 @@ public:
         m_attachmentCount++;
     }
 
+    void setBodyInArena(uint64_t position)
+    {
+        ASSERT(!isBodyOutOfLine());
+
+        m_isBodyOutOfLine = true;
+        m_isBodyInArena = true;
+        m_arenaPosition = position;
+    }
+
+    void setHasArenaAttachment()
+    {
+        ASSERT(isBodyInArena());
+
+        m_hasArenaAttachment = true;
+        m_attachmentCount++;
+    }
+
     bool isBodyOutOfLine() const { return m_isBodyOutOfLine; }
+    bool isBodyInArena() const { return m_isBodyInArena; }
+    bool hasArenaAttachment() const { return m_hasArenaAttachment; }
+    uint64_t arenaPosition() const { return m_arenaPosition; }
     size_t bodySize() const { return m_bodySize; }
     size_t attachmentCount() const { return m_attachmentCount; }
 
+    // The last attachment is either the SharedMemory of an out-of-line body or a new message body arena.
+    bool hasTrailingAttachment() const { return (m_isBodyOutOfLine && !m_isBodyInArena) || m_hasArenaAttachment; }
+
 private:
     size_t m_bodySize { 0 };
     size_t m_attachmentCount { 0 };
+    uint64_t m_arenaPosition { 0 };
     bool m_isBodyOutOfLine { false };
+    bool m_isBodyInArena { false };
+    bool m_hasArenaAttachment { false };
 };
 
 class UnixMessage {
@@ -38,11 +38,13 @@ list(APPEND WebKit2_SOURCES
     NetworkProcess/soup/NetworkProcessMainSoup.cpp
     NetworkProcess/soup/NetworkProcessSoup.cpp
     NetworkProcess/soup/NetworkSessionSoup.cpp
+    NetworkProcess/soup/ReadBufferPool.cpp
     NetworkProcess/soup/RemoteNetworkingContextSoup.cpp
 
     Platform/IPC/glib/GSocketMonitor.cpp
     Platform/IPC/unix/AttachmentUnix.cpp
     Platform/IPC/unix/ConnectionUnix.cpp
+    Platform/IPC/unix/MessageBodyArena.cpp
 
     Platform/classifier/ResourceLoadStatisticsClassifier.cpp
 
@@ -94,6 +96,7 @@ list(APPEND WebKit2_SOURCES
     Shared/soup/WebErrorsSoup.cpp
 
     Shared/unix/ChildProcessMain.cpp
+    Shared/unix/ChildProcessZygote.cpp
 
     UIProcess/AcceleratedDrawingAreaProxy.cpp
     UIProcess/BackingStore.cpp
@@ -1093,6 +1096,7 @@ if (ENABLE_PLUGIN_PROCESS_GTK2)
         Platform/IPC/glib/GSocketMonitor.cpp
         Platform/IPC/unix/AttachmentUnix.cpp
         Platform/IPC/unix/ConnectionUnix.cpp
+        Platform/IPC/unix/MessageBodyArena.cpp
 
         Platform/glib/ModuleGlib.cpp
 
@@ -45,12 +45,14 @@ list(APPEND WebKit2_SOURCES
     NetworkProcess/soup/NetworkProcessMainSoup.cpp
     NetworkProcess/soup/NetworkProcessSoup.cpp
     NetworkProcess/soup/NetworkSessionSoup.cpp
+    NetworkProcess/soup/ReadBufferPool.cpp
     NetworkProcess/soup/RemoteNetworkingContextSoup.cpp
 
     Platform/IPC/glib/GSocketMonitor.cpp
 
     Platform/IPC/unix/AttachmentUnix.cpp
     Platform/IPC/unix/ConnectionUnix.cpp
+    Platform/IPC/unix/MessageBodyArena.cpp
 
     Platform/classifier/ResourceLoadStatisticsClassifier.cpp
 
@@ -88,7 +90,9 @@ list(APPEND WebKit2_SOURCES
     Shared/soup/WebErrorsSoup.cpp
 
     Shared/unix/ChildProcessMain.cpp
+    Shared/unix/ChildProcessZygote.cpp
 
+    Shared/wpe/ChildProcessZygoteWPE.cpp
     Shared/wpe/NativeWebKeyboardEventWPE.cpp
     Shared/wpe/NativeWebMouseEventWPE.cpp
     Shared/wpe/NativeWebTouchEventWPE.cpp
@@ -261,6 +265,7 @@ list(APPEND WebKit2_INCLUDE_DIRECTORIES
     ${BCM_HOST_INCLUDE_DIRS}
     ${CAIRO_INCLUDE_DIRS}
     ${EGL_INCLUDE_DIRS}
+    ${FONTCONFIG_INCLUDE_DIRS}
     ${FREETYPE2_INCLUDE_DIRS}
     ${GLIB_INCLUDE_DIRS}
     ${GSTREAMER_INCLUDE_DIRS}
@@ -273,6 +278,7 @@ list(APPEND WebKit2_LIBRARIES
     WebCorePlatformWPE
     ${BCM_HOST_LIBRARIES}
     ${CAIRO_LIBRARIES}
+    ${FONTCONFIG_LIBRARIES}
     ${FREETYPE2_LIBRARIES}
     ${GLIB_LIBRARIES}
     ${GSTREAMER_LIBRARIES}
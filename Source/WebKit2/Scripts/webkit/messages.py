@@ -28,6 +28,8 @@ from webkit import parser
 
 WANTS_CONNECTION_ATTRIBUTE = 'WantsConnection'
 LEGACY_RECEIVER_ATTRIBUTE = 'LegacyReceiver'
+# The receiver is registered with Connection::addWorkQueueMessageReceiver(), its handlers must be thread-safe.
+DISPATCHED_ON_WORK_QUEUE_ATTRIBUTE = 'DispatchedOnWorkQueue'
 DELAYED_ATTRIBUTE = 'Delayed'
 
 _license_header = """/*
@@ -423,6 +425,9 @@ def generate_message_handler(file):
         '"Decoder.h"': [None],
     }
 
+    if receiver.has_attribute(DISPATCHED_ON_WORK_QUEUE_ATTRIBUTE):
+        header_conditions['<wtf/MainThread.h>'] = [None]
+
     type_conditions = {}
     for parameter in receiver.iterparameters():
         if not parameter.type in type_conditions:
@@ -537,6 +542,8 @@ def generate_message_handler(file):
     if async_messages:
         result.append('void %s::didReceive%sMessage(IPC::Connection& connection, IPC::Decoder& decoder)\n' % (receiver.name, receiver.name if receiver.has_attribute(LEGACY_RECEIVER_ATTRIBUTE) else ''))
         result.append('{\n')
+        if receiver.has_attribute(DISPATCHED_ON_WORK_QUEUE_ATTRIBUTE):
+            result.append('    ASSERT(!isMainThread());\n')
         result += [async_message_statement(receiver, message) for message in async_messages]
         if (receiver.superclass):
             result.append('    %s::didReceiveMessage(connection, decoder);\n' % (receiver.superclass))
@@ -550,6 +557,8 @@ def generate_message_handler(file):
         result.append('\n')
         result.append('void %s::didReceiveSync%sMessage(IPC::Connection& connection, IPC::Decoder& decoder, std::unique_ptr<IPC::Encoder>& replyEncoder)\n' % (receiver.name, receiver.name if receiver.has_attribute(LEGACY_RECEIVER_ATTRIBUTE) else ''))
         result.append('{\n')
+        if receiver.has_attribute(DISPATCHED_ON_WORK_QUEUE_ATTRIBUTE):
+            result.append('    ASSERT(!isMainThread());\n')
         result += [sync_message_statement(receiver, message) for message in sync_messages]
         result.append('    UNUSED_PARAM(connection);\n')
         result.append('    UNUSED_PARAM(decoder);\n')
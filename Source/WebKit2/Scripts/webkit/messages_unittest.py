@@ -41,13 +41,18 @@ with open(os.path.join(script_directory, 'test-legacy-messages.in')) as in_file:
 with open(os.path.join(script_directory, 'test-superclass-messages.in')) as in_file:
     _superclass_messages_file_contents = in_file.read()
 
+with open(os.path.join(script_directory, 'test-work-queue-messages.in')) as in_file:
+    _work_queue_messages_file_contents = in_file.read()
+
 _expected_receiver_header_file_name = 'Messages-expected.h'
 _expected_legacy_receiver_header_file_name = 'LegacyMessages-expected.h'
 _expected_superclass_receiver_header_file_name = 'MessagesSuperclass-expected.h'
+_expected_work_queue_receiver_header_file_name = 'MessagesWorkQueue-expected.h'
 
 _expected_receiver_implementation_file_name = 'MessageReceiver-expected.cpp'
 _expected_legacy_receiver_implementation_file_name = 'LegacyMessageReceiver-expected.cpp'
 _expected_superclass_receiver_implementation_file_name = 'MessageReceiverSuperclass-expected.cpp'
+_expected_work_queue_receiver_implementation_file_name = 'MessageReceiverWorkQueue-expected.cpp'
 
 _expected_results = {
     'name': 'WebPage',
@@ -251,6 +256,7 @@ class MessagesTest(unittest.TestCase):
         self.receiver = parser.parse(StringIO(_messages_file_contents))
         self.legacy_receiver = parser.parse(StringIO(_legacy_messages_file_contents))
         self.superclass_receiver = parser.parse(StringIO(_superclass_messages_file_contents))
+        self.work_queue_receiver = parser.parse(StringIO(_work_queue_messages_file_contents))
 
 
 class ParsingTest(MessagesTest):
@@ -295,6 +301,10 @@ class ParsingTest(MessagesTest):
         for index, message in enumerate(self.superclass_receiver.messages):
             self.check_message(message, _expected_superclass_results['messages'][index])
 
+        self.assertEquals(self.work_queue_receiver.name, 'WebPage')
+        self.assertTrue(self.work_queue_receiver.has_attribute('DispatchedOnWorkQueue'))
+        self.assertFalse(self.receiver.has_attribute('DispatchedOnWorkQueue'))
+
 
 class GeneratedFileContentsTest(unittest.TestCase):
     def assertGeneratedFileContentsEqual(self, actual_file_contents, expected_file_name):
@@ -330,6 +340,8 @@ class HeaderTest(GeneratedFileContentsTest):
                                _expected_legacy_receiver_header_file_name)
         self.assertHeaderEqual(_superclass_messages_file_contents,
                                _expected_superclass_receiver_header_file_name)
+        self.assertHeaderEqual(_work_queue_messages_file_contents,
+                               _expected_work_queue_receiver_header_file_name)
 
 
 class ReceiverImplementationTest(GeneratedFileContentsTest):
@@ -340,6 +352,8 @@ class ReceiverImplementationTest(GeneratedFileContentsTest):
                                        _expected_legacy_receiver_implementation_file_name)
         self.assertImplementationEqual(_superclass_messages_file_contents,
                                        _expected_superclass_receiver_implementation_file_name)
+        self.assertImplementationEqual(_work_queue_messages_file_contents,
+                                       _expected_work_queue_receiver_implementation_file_name)
 
 
 class UnsupportedPrecompilerDirectiveTest(unittest.TestCase):
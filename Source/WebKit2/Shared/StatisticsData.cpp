@@ -36,6 +36,8 @@ void StatisticsData::encode(IPC::Encoder& encoder) const
     encoder << javaScriptProtectedObjectTypeCounts;
     encoder << javaScriptObjectTypeCounts;
     encoder << webCoreCacheStatistics;
+    encoder << ipcMessageStatistics;
+    encoder << javaScriptGarbageCollectionEvents;
 }
 
 bool StatisticsData::decode(IPC::Decoder& decoder, StatisticsData& statisticsData)
@@ -48,6 +50,10 @@ bool StatisticsData::decode(IPC::Decoder& decoder, StatisticsData& statisticsDat
         return false;
     if (!decoder.decode(statisticsData.webCoreCacheStatistics))
         return false;
+    if (!decoder.decode(statisticsData.ipcMessageStatistics))
+        return false;
+    if (!decoder.decode(statisticsData.javaScriptGarbageCollectionEvents))
+        return false;
 
     return true;
 }
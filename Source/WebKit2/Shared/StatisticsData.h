@@ -43,6 +43,8 @@ struct StatisticsData {
     HashMap<String, uint64_t> javaScriptProtectedObjectTypeCounts;
     HashMap<String, uint64_t> javaScriptObjectTypeCounts;    
     Vector<HashMap<String, uint64_t>> webCoreCacheStatistics;
+    HashMap<String, HashMap<String, uint64_t>> ipcMessageStatistics;
+    Vector<HashMap<String, uint64_t>> javaScriptGarbageCollectionEvents;
     
     StatisticsData();
 };
@@ -27,6 +27,7 @@
 #define ChildProcessMain_h
 
 #include "ChildProcess.h"
+#include "MessageTelemetry.h"
 #include "WebKit2Initialize.h"
 #include <wtf/RunLoop.h>
 
@@ -59,6 +60,7 @@ int ChildProcessMain(int argc, char** argv)
 
     ChildProcessType::singleton().initialize(childMain.initializationParameters());
     RunLoop::run();
+    IPC::MessageTelemetry::dumpProcessStatisticsIfRequested();
     childMain.platformFinalize();
 
     return EXIT_SUCCESS;
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "ChildProcessZygote.h"
+
+#include <algorithm>
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <sched.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/UniStdExtras.h>
+
+namespace WebKit {
+
+namespace ChildProcessZygote {
+
+pid_t requestProcess(int controlSocket, int ipcSocket, int wpeSocket, Seconds timeout)
+{
+    Request request { protocolVersion };
+    int fileDescriptors[fileDescriptorsPerRequest] = { ipcSocket, wpeSocket };
+
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+
+    struct iovec iov[1];
+    iov[0].iov_base = &request;
+    iov[0].iov_len = sizeof(request);
+    message.msg_iov = iov;
+    message.msg_iovlen = 1;
+
+    char controlBuffer[CMSG_SPACE(sizeof(fileDescriptors))];
+    memset(controlBuffer, 0, sizeof(controlBuffer));
+    message.msg_control = controlBuffer;
+    message.msg_controllen = sizeof(controlBuffer);
+
+    struct cmsghdr* controlMessage = CMSG_FIRSTHDR(&message);
+    controlMessage->cmsg_level = SOL_SOCKET;
+    controlMessage->cmsg_type = SCM_RIGHTS;
+    controlMessage->cmsg_len = CMSG_LEN(sizeof(fileDescriptors));
+    memcpy(CMSG_DATA(controlMessage), fileDescriptors, sizeof(fileDescriptors));
+
+    // The zygote reads the requests one at a time, there's no point in waiting for room in the socket.
+    while (sendmsg(controlSocket, &message, MSG_NOSIGNAL | MSG_DONTWAIT) == -1) {
+        if (errno != EINTR)
+            return -1;
+    }
+
+    MonotonicTime absoluteTimeout = MonotonicTime::now() + timeout;
+    while (true) {
+        Seconds remainingTime = absoluteTimeout - MonotonicTime::now();
+        if (remainingTime <= 0_s)
+            return -1;
+
+        struct pollfd pollDescriptor = { controlSocket, POLLIN, 0 };
+        int result = poll(&pollDescriptor, 1, std::max<int>(remainingTime.millisecondsAs<int>(), 1));
+        if (result == -1 && errno == EINTR)
+            continue;
+        if (result <= 0)
+            return -1;
+
+        Reply reply;
+        ssize_t bytesRead;
+        do {
+            bytesRead = recv(controlSocket, &reply, sizeof(reply), MSG_DONTWAIT);
+        } while (bytesRead == -1 && errno == EINTR);
+
+        if (bytesRead == -1 && errno == EAGAIN)
+            continue;
+        if (bytesRead != sizeof(reply))
+            return -1;
+
+        return reply.processIdentifier > 0 ? reply.processIdentifier : -1;
+    }
+}
+
+bool receiveRequest(int controlSocket, Vector<int>& fileDescriptors)
+{
+    Request request;
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+
+    struct iovec iov[1];
+    iov[0].iov_base = &request;
+    iov[0].iov_len = sizeof(request);
+    message.msg_iov = iov;
+    message.msg_iovlen = 1;
+
+    char controlBuffer[CMSG_SPACE(sizeof(int) * fileDescriptorsPerRequest)];
+    memset(controlBuffer, 0, sizeof(controlBuffer));
+    message.msg_control = controlBuffer;
+    message.msg_controllen = sizeof(controlBuffer);
+
+    ssize_t bytesRead;
+    do {
+        bytesRead = recvmsg(controlSocket, &message, MSG_CMSG_CLOEXEC);
+    } while (bytesRead == -1 && errno == EINTR);
+
+    if (bytesRead <= 0)
+        return false;
+
+    fileDescriptors.clear();
+    for (struct cmsghdr* controlMessage = CMSG_FIRSTHDR(&message); controlMessage; controlMessage = CMSG_NXTHDR(&message, controlMessage)) {
+        if (controlMessage->cmsg_level != SOL_SOCKET || controlMessage->cmsg_type != SCM_RIGHTS)
+            continue;
+
+        size_t fileDescriptorCount = (controlMessage->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        const int* receivedFileDescriptors = reinterpret_cast<const int*>(CMSG_DATA(controlMessage));
+        fileDescriptors.append(receivedFileDescriptors, fileDescriptorCount);
+    }
+
+    bool isValid = bytesRead == sizeof(request) && !(message.msg_flags & (MSG_TRUNC | MSG_CTRUNC))
+        && request.protocolVersion == protocolVersion && fileDescriptors.size() == fileDescriptorsPerRequest;
+    if (!isValid) {
+        for (int fileDescriptor : fileDescriptors)
+            closeWithRetry(fileDescriptor);
+        fileDescriptors.clear();
+    }
+
+    return true;
+}
+
+bool sendReply(int controlSocket, pid_t processIdentifier)
+{
+    Reply reply { processIdentifier };
+    while (send(controlSocket, &reply, sizeof(reply), MSG_NOSIGNAL) == -1) {
+        if (errno != EINTR)
+            return false;
+    }
+    return true;
+}
+
+static int returnToForkPoint(void* forkPoint)
+{
+    longjmp(*static_cast<jmp_buf*>(forkPoint), 1);
+}
+
+static NEVER_INLINE pid_t cloneReturningToForkPoint(jmp_buf* forkPoint)
+{
+    // The child only runs on this stack until it jumps back to the fork point, it has its own copy of the
+    // rest of the address space, including the stack of the caller.
+    alignas(16) char stack[PTHREAD_STACK_MIN];
+    return clone(returnToForkPoint, stack + sizeof(stack), CLONE_PARENT | SIGCHLD, forkPoint);
+}
+
+pid_t forkAsSibling()
+{
+    // The glibc clone() wrapper is used rather than the raw system call so that the process identifier
+    // glibc caches is right in the child, but it needs a function to run and a stack for it.
+    jmp_buf forkPoint;
+    if (setjmp(forkPoint))
+        return 0;
+    return cloneReturningToForkPoint(&forkPoint);
+}
+
+} // namespace ChildProcessZygote
+
+} // namespace WebKit
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <sys/types.h>
+#include <wtf/Seconds.h>
+#include <wtf/Vector.h>
+
+namespace WebKit {
+
+// The zygote is a web process executable started by the UI process before it is needed. It loads the
+// WebKit library, the ICU data and the font configuration once, and then forks the web processes
+// requested by the UI process, sparing them the exec(), the dynamic linking and the loading of that data.
+namespace ChildProcessZygote {
+
+constexpr const char* commandLineSwitch = "--zygote";
+
+// The zygote is started from the executable on disk, which can be newer than the running UI process.
+// Bump this whenever the requests or the replies change.
+constexpr uint32_t protocolVersion = 1;
+
+// Sent by the UI process with the IPC socket and the WPE renderer socket of the new web process
+// attached as SCM_RIGHTS.
+struct Request {
+    uint32_t protocolVersion;
+};
+
+struct Reply {
+    // -1 if the process could not be forked.
+    pid_t processIdentifier;
+};
+
+constexpr size_t fileDescriptorsPerRequest = 2;
+
+// Returns -1 if the zygote didn't launch the process before the timeout. The zygote might still have
+// received the sockets then, so the caller has to stop using the zygote and make new ones.
+pid_t requestProcess(int controlSocket, int ipcSocket, int wpeSocket, Seconds timeout);
+
+// Returns false when the UI process went away. The file descriptors are only returned for a valid
+// request, the ones that came with any other message are closed.
+bool receiveRequest(int controlSocket, Vector<int>& fileDescriptors);
+bool sendReply(int controlSocket, pid_t processIdentifier);
+
+// Like fork(), but the new process is a child of the parent of the calling process rather than of the
+// calling process. The processes forked by the zygote are children of the UI process, which can then
+// reap them and get their exit status like for the processes it spawns.
+pid_t forkAsSibling();
+
+#if PLATFORM(WPE)
+// Called from the main function of the web process executable. It only returns in the forked processes,
+// once they are done, or when the UI process goes away.
+int run(int argc, char** argv);
+#endif
+
+} // namespace ChildProcessZygote
+
+} // namespace WebKit
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "ChildProcessZygote.h"
+
+#include "WebProcessMainUnix.h"
+#include <fontconfig/fontconfig.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unicode/ucol.h>
+#include <wtf/UniStdExtras.h>
+
+namespace WebKit {
+
+namespace ChildProcessZygote {
+
+static void preloadSharedData()
+{
+    // Every process maps the ICU data to build its collators, and loads the font configuration and
+    // the font cache. Forked processes share the already initialized pages instead.
+    UErrorCode status = U_ZERO_ERROR;
+    if (UCollator* collator = ucol_open("", &status))
+        ucol_close(collator);
+
+    FcInit();
+}
+
+static int runWebProcess(const char* programName, const Vector<int>& fileDescriptors)
+{
+    char ipcSocket[16];
+    snprintf(ipcSocket, sizeof(ipcSocket), "%d", fileDescriptors[0]);
+    char wpeSocket[16];
+    snprintf(wpeSocket, sizeof(wpeSocket), "%d", fileDescriptors[1]);
+
+    char* argv[] = { const_cast<char*>(programName), ipcSocket, wpeSocket, nullptr };
+    return WebProcessMainUnix(3, argv);
+}
+
+int run(int argc, char** argv)
+{
+    ASSERT(argc == 3);
+    if (argc < 3)
+        return EXIT_FAILURE;
+
+    int controlSocket = atoi(argv[2]);
+    preloadSharedData();
+
+    Vector<int> fileDescriptors;
+    while (receiveRequest(controlSocket, fileDescriptors)) {
+        pid_t processIdentifier = -1;
+        if (!fileDescriptors.isEmpty())
+            processIdentifier = forkAsSibling();
+
+        if (!processIdentifier) {
+            closeWithRetry(controlSocket);
+            return runWebProcess(argv[0], fileDescriptors);
+        }
+
+        for (int fileDescriptor : fileDescriptors)
+            closeWithRetry(fileDescriptor);
+
+        if (!sendReply(controlSocket, processIdentifier))
+            break;
+    }
+
+    // The UI process went away.
+    return EXIT_SUCCESS;
+}
+
+} // namespace ChildProcessZygote
+
+} // namespace WebKit
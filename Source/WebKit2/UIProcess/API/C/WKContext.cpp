@@ -299,6 +299,17 @@ void WKContextGetGlobalStatistics(WKContextStatistics* statistics)
     statistics->wkFrameCount = webContextStatistics.wkFrameCount;
 }
 
+void WKContextGetPrewarmedProcessStatistics(WKContextRef contextRef, WKContextPrewarmedProcessStatistics* statistics)
+{
+    auto& processPool = *toImpl(contextRef);
+    auto& prewarmedProcessStatistics = processPool.prewarmedProcessStatistics();
+
+    statistics->prewarmedProcessCount = processPool.prewarmedProcessCount();
+    statistics->hitCount = prewarmedProcessStatistics.hitCount;
+    statistics->missCount = prewarmedProcessStatistics.missCount;
+    statistics->timeSaved = prewarmedProcessStatistics.timeSaved.seconds();
+}
+
 void WKContextAddVisitedLink(WKContextRef contextRef, WKStringRef visitedURL)
 {
     String visitedURLString = toImpl(visitedURL)->string();
@@ -102,7 +102,8 @@ typedef uint32_t WKProcessModel;
 
 enum {
     kWKStatisticsOptionsWebContent = 1 << 0,
-    kWKStatisticsOptionsNetworking = 1 << 1
+    kWKStatisticsOptionsNetworking = 1 << 1,
+    kWKStatisticsOptionsIPC = 1 << 2
 };
 typedef uint32_t WKStatisticsOptions;
 
@@ -150,6 +151,13 @@ WK_EXPORT WKMediaSessionFocusManagerRef WKContextGetMediaSessionFocusManager(WKC
 WK_EXPORT WKNotificationManagerRef WKContextGetNotificationManager(WKContextRef context);
 WK_EXPORT WKResourceCacheManagerRef WKContextGetResourceCacheManager(WKContextRef context);
 
+// With kWKStatisticsOptionsWebContent, the "JavaScriptGarbageCollectionEvents" entry is an array with
+// a dictionary for each recent collection cycle of each web process. "StartTimeMicrosecondsSinceEpoch"
+// is on the wall clock, so it can be compared across processes. The other times, whose keys end in
+// "Microseconds", are durations measured on a monotonic clock.
+// "JavaScriptRegExpInterpreterFallbackMatchCount" counts the RegExp matches run by the interpreter
+// although the RegExp JIT was enabled, and "JavaScriptRegExpJITCodeFailureCount" those of them that
+// JIT code gave up on part way through.
 typedef void (*WKContextGetStatisticsFunction)(WKDictionaryRef statistics, WKErrorRef error, void* functionContext);
 WK_EXPORT void WKContextGetStatistics(WKContextRef context, void* functionContext, WKContextGetStatisticsFunction function);
 WK_EXPORT void WKContextGetStatisticsWithOptions(WKContextRef context, WKStatisticsOptions statisticsMask, void* functionContext, WKContextGetStatisticsFunction function);
@@ -42,6 +42,16 @@ typedef struct WKContextStatistics WKContextStatistics;
 
 WK_EXPORT void WKContextGetGlobalStatistics(WKContextStatistics* statistics);
 
+struct WKContextPrewarmedProcessStatistics {
+    unsigned prewarmedProcessCount;
+    uint64_t hitCount;
+    uint64_t missCount;
+    double timeSaved; // In seconds.
+};
+typedef struct WKContextPrewarmedProcessStatistics WKContextPrewarmedProcessStatistics;
+
+WK_EXPORT void WKContextGetPrewarmedProcessStatistics(WKContextRef context, WKContextPrewarmedProcessStatistics* statistics);
+
 WK_EXPORT void WKContextSetAdditionalPluginsDirectory(WKContextRef context, WKStringRef pluginsDirectory);
 
 WK_EXPORT void WKContextRegisterURLSchemeAsEmptyDocument(WKContextRef context, WKStringRef urlScheme);
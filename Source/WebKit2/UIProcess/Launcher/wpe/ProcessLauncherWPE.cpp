@@ -27,14 +27,18 @@
 #include "config.h"
 #include "ProcessLauncher.h"
 
+#include "ChildProcessZygote.h"
 #include "Connection.h"
 #include "ProcessExecutablePath.h"
 #include <WebCore/FileSystem.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <glib.h>
+#include <sys/socket.h>
 #include <wpe/renderer-host.h>
+#include <wtf/MainThread.h>
 #include <wtf/RunLoop.h>
+#include <wtf/UniStdExtras.h>
 #include <wtf/glib/GLibUtilities.h>
 #include <wtf/glib/GUniquePtr.h>
 #include <wtf/text/CString.h>
@@ -52,6 +56,89 @@ static void childSetupFunction(gpointer userData)
     close(socket);
 }
 
+static int zygoteControlSocket = -1;
+
+// Forking is a matter of milliseconds, the zygote is considered stuck past this.
+static const Seconds zygoteReplyTimeout { 1_s };
+
+static void startZygote()
+{
+    ASSERT(isMainThread());
+    ASSERT(zygoteControlSocket == -1);
+
+    int sockets[2];
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sockets) == -1)
+        return;
+
+    // The zygote end has to survive the exec.
+    while (fcntl(sockets[1], F_SETFD, 0) == -1)
+        RELEASE_ASSERT(errno != EINTR);
+
+    CString executablePath = fileSystemRepresentation(executablePathOfWebProcess());
+    GUniquePtr<gchar> controlSocket(g_strdup_printf("%d", sockets[1]));
+    char* argv[] = { const_cast<char*>(executablePath.data()), const_cast<char*>(ChildProcessZygote::commandLineSwitch), controlSocket.get(), nullptr };
+
+    GPid pid = 0;
+    GUniqueOutPtr<GError> error;
+    bool didSpawn = g_spawn_async(nullptr, argv, nullptr, static_cast<GSpawnFlags>(G_SPAWN_LEAVE_DESCRIPTORS_OPEN | G_SPAWN_DO_NOT_REAP_CHILD), childSetupFunction, GINT_TO_POINTER(sockets[0]), &pid, &error.outPtr());
+    closeWithRetry(sockets[1]);
+    if (!didSpawn) {
+        g_printerr("Unable to spawn the process zygote: %s.\n", error->message);
+        closeWithRetry(sockets[0]);
+        return;
+    }
+
+    g_child_watch_add(pid, [](GPid pid, gint, gpointer) { g_spawn_close_pid(pid); }, nullptr);
+    zygoteControlSocket = sockets[0];
+}
+
+static void stopZygote()
+{
+    // Closing the control socket makes the zygote exit, a new one is started by the next launch.
+    closeWithRetry(zygoteControlSocket);
+    zygoteControlSocket = -1;
+}
+
+static bool canLaunchFromZygote(const ProcessLauncher::LaunchOptions& launchOptions)
+{
+    static bool zygoteDisabled = !!g_getenv("WEBKIT_DISABLE_PROCESS_ZYGOTE");
+    if (zygoteDisabled)
+        return false;
+
+#if ENABLE(DEVELOPER_MODE)
+    // The command prefix has to run the process executable.
+    if (!launchOptions.processCmdPrefix.isNull())
+        return false;
+#endif
+
+    // The zygote is a web process executable, the other processes are spawned from their own.
+    return launchOptions.processType == ProcessLauncher::ProcessType::Web;
+}
+
+// Returns 0 if the process has to be spawned instead, zygoteHasSockets tells whether the sockets might
+// have been handed to the zygote anyway.
+static GPid launchProcessFromZygote(int ipcSocket, int wpeSocket, bool& zygoteHasSockets)
+{
+    ASSERT(isMainThread());
+    zygoteHasSockets = false;
+
+    if (zygoteControlSocket == -1) {
+        // Spawn this process as usual rather than waiting for the zygote to initialize.
+        startZygote();
+        return 0;
+    }
+
+    zygoteHasSockets = true;
+    pid_t pid = ChildProcessZygote::requestProcess(zygoteControlSocket, ipcSocket, wpeSocket, zygoteReplyTimeout);
+    if (pid == -1) {
+        // The zygote is gone or stuck, a process it forks late fails to connect since the sockets are closed.
+        stopZygote();
+        return 0;
+    }
+
+    return pid;
+}
+
 void ProcessLauncher::launchProcess()
 {
     GPid pid = 0;
@@ -77,13 +164,46 @@ void ProcessLauncher::launchProcess()
         return;
     }
 
+    int wpeClientSocket = -1;
+    if (m_launchOptions.processType == ProcessLauncher::ProcessType::Web)
+        wpeClientSocket = wpe_renderer_host_create_client();
+
+    if (canLaunchFromZygote(m_launchOptions)) {
+        bool zygoteHasSockets;
+        pid = launchProcessFromZygote(socketPair.client, wpeClientSocket, zygoteHasSockets);
+        if (!pid && zygoteHasSockets) {
+            // Don't share the sockets with a process the zygote might still fork.
+            close(socketPair.client);
+            close(socketPair.server);
+            close(wpeClientSocket);
+            socketPair = IPC::Connection::createPlatformConnection(IPC::Connection::ConnectionOptions::SetCloexecOnServer);
+            wpeClientSocket = wpe_renderer_host_create_client();
+        }
+    }
+
+    if (pid) {
+        // The zygote has its own copies of the sockets. The process is a child of this one, like the
+        // spawned ones.
+        g_child_watch_add(pid, [](GPid pid, gint, gpointer) { g_spawn_close_pid(pid); }, nullptr);
+        close(socketPair.client);
+        close(wpeClientSocket);
+        m_processIdentifier = pid;
+
+        RefPtr<ProcessLauncher> protectedThis(this);
+        IPC::Connection::Identifier serverSocket = socketPair.server;
+        RunLoop::main().dispatch([protectedThis, pid, serverSocket] {
+            protectedThis->didFinishLaunchingProcess(pid, serverSocket);
+        });
+        return;
+    }
+
     realExecutablePath = fileSystemRepresentation(executablePath);
     GUniquePtr<gchar> wkSocket(g_strdup_printf("%d", socketPair.client));
     GUniquePtr<gchar> wpeSocket;
 
     unsigned nargs = 4; // size of the argv array for g_spawn_async()
     if (m_launchOptions.processType == ProcessLauncher::ProcessType::Web) {
-        wpeSocket = GUniquePtr<gchar>(g_strdup_printf("%d", wpe_renderer_host_create_client()));
+        wpeSocket = GUniquePtr<gchar>(g_strdup_printf("%d", wpeClientSocket));
         nargs = 5;
     }
 
@@ -65,6 +65,22 @@ static Ref<API::Dictionary> createDictionaryFromHashMap(const HashMap<String, ui
     return result;
 }
 
+static void mergeIPCMessageStatistics(HashMap<String, HashMap<String, uint64_t>>& statistics, const HashMap<String, HashMap<String, uint64_t>>& otherStatistics)
+{
+    for (auto& messageAndValues : otherStatistics) {
+        auto& values = statistics.add(messageAndValues.key, HashMap<String, uint64_t>()).iterator->value;
+        for (auto& nameAndValue : messageAndValues.value) {
+            auto result = values.add(nameAndValue.key, nameAndValue.value);
+            if (result.isNewEntry)
+                continue;
+            if (nameAndValue.key.startsWith("Maximum"))
+                result.iterator->value = std::max(result.iterator->value, nameAndValue.value);
+            else
+                result.iterator->value += nameAndValue.value;
+        }
+    }
+}
+
 void StatisticsRequest::completedRequest(uint64_t requestID, const StatisticsData& data)
 {
     ASSERT(m_outstandingRequests.contains(requestID));
@@ -73,10 +89,15 @@ void StatisticsRequest::completedRequest(uint64_t requestID, const StatisticsDat
     if (!m_responseDictionary)
         m_responseDictionary = API::Dictionary::create();
     
-    // FIXME (Multi-WebProcess) <rdar://problem/13200059>: This code overwrites any previous response data received.
-    // When getting responses from multiple WebProcesses we need to combine items instead of clobbering them.
-
-    addToDictionaryFromHashMap(m_responseDictionary.get(), data.statisticsNumbers);
+    // Numbers are summed over the web processes, so that counters cover all of them.
+    // FIXME (Multi-WebProcess) <rdar://problem/13200059>: The object type counts are still those of the
+    // last web process that replied.
+    for (auto& nameAndValue : data.statisticsNumbers) {
+        auto result = m_statisticsNumbers.add(nameAndValue.key, nameAndValue.value);
+        if (!result.isNewEntry)
+            result.iterator->value += nameAndValue.value;
+    }
+    addToDictionaryFromHashMap(m_responseDictionary.get(), m_statisticsNumbers);
 
     if (!data.javaScriptProtectedObjectTypeCounts.isEmpty())
         m_responseDictionary->set("JavaScriptProtectedObjectTypeCounts", createDictionaryFromHashMap(data.javaScriptProtectedObjectTypeCounts));
@@ -93,6 +114,23 @@ void StatisticsRequest::completedRequest(uint64_t requestID, const StatisticsDat
         m_responseDictionary->set("WebCoreCacheStatistics", API::Array::create(WTFMove(cacheStatistics)));
     }
 
+    if (!data.ipcMessageStatistics.isEmpty()) {
+        mergeIPCMessageStatistics(m_ipcMessageStatistics, data.ipcMessageStatistics);
+
+        Ref<API::Dictionary> ipcMessageStatistics = API::Dictionary::create();
+        for (auto& messageAndValues : m_ipcMessageStatistics)
+            ipcMessageStatistics->set(messageAndValues.key, createDictionaryFromHashMap(messageAndValues.value));
+        m_responseDictionary->set("IPCMessageStatistics", WTFMove(ipcMessageStatistics));
+    }
+
+    if (!data.javaScriptGarbageCollectionEvents.isEmpty()) {
+        // Unlike the counts above, events from different web processes are all kept.
+        for (const auto& event : data.javaScriptGarbageCollectionEvents)
+            m_javaScriptGarbageCollectionEvents.append(createDictionaryFromHashMap(event));
+
+        m_responseDictionary->set("JavaScriptGarbageCollectionEvents", API::Array::create(Vector<RefPtr<API::Object>>(m_javaScriptGarbageCollectionEvents)));
+    }
+
     if (m_outstandingRequests.isEmpty()) {
         m_callback->performCallbackWithReturnValue(m_responseDictionary.get());
         m_callback = nullptr;
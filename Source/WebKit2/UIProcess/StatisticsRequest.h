@@ -38,7 +38,8 @@ typedef GenericCallback<API::Dictionary*> DictionaryCallback;
 
 enum StatisticsRequestType {
     StatisticsRequestTypeWebContent = 0x00000001,
-    StatisticsRequestTypeNetworking = 0x00000002
+    StatisticsRequestTypeNetworking = 0x00000002,
+    StatisticsRequestTypeIPC = 0x00000004
 };
 
 class StatisticsRequest : public RefCounted<StatisticsRequest> {
@@ -61,6 +62,10 @@ private:
     RefPtr<DictionaryCallback> m_callback;
 
     RefPtr<API::Dictionary> m_responseDictionary;
+    // Summed over all the processes that replied.
+    HashMap<String, uint64_t> m_statisticsNumbers;
+    HashMap<String, HashMap<String, uint64_t>> m_ipcMessageStatistics;
+    Vector<RefPtr<API::Object>> m_javaScriptGarbageCollectionEvents;
 };
 
 } // namespace WebKit
@@ -40,6 +40,8 @@
 #include "HighPerformanceGraphicsUsageSampler.h"
 #include "LegacyCustomProtocolManagerMessages.h"
 #include "LogInitialization.h"
+#include "Logging.h"
+#include "MessageTelemetry.h"
 #include "NetworkProcessCreationParameters.h"
 #include "NetworkProcessMessages.h"
 #include "NetworkProcessProxy.h"
@@ -216,7 +218,7 @@ static HashSet<String, ASCIICaseInsensitiveHash>& globalURLSchemesWithCustomProt
 
 WebProcessPool::WebProcessPool(API::ProcessPoolConfiguration& configuration)
     : m_configuration(configuration.copy())
-    , m_haveInitialEmptyProcess(false)
+    , m_prewarmedProcessTimer(RunLoop::main(), this, &WebProcessPool::prewarmedProcessTimerFired)
     , m_processWithPageCache(0)
     , m_defaultPageGroup(WebPageGroup::createNonNull())
     , m_automationClient(std::make_unique<API::AutomationClient>())
@@ -314,6 +316,9 @@ WebProcessPool::~WebProcessPool()
 
     platformInvalidateContext();
 
+    if (processPools().isEmpty())
+        IPC::MessageTelemetry::dumpProcessStatisticsIfRequested();
+
 #ifndef NDEBUG
     processPoolCounter.decrement();
 #endif
@@ -789,16 +794,100 @@ WebProcessProxy& WebProcessPool::createNewWebProcess(WebsiteDataStore& websiteDa
 
 void WebProcessPool::warmInitialProcess()  
 {
-    if (m_haveInitialEmptyProcess) {
+    if (!m_prewarmedProcesses.isEmpty()) {
         ASSERT(!m_processes.isEmpty());
         return;
     }
 
-    if (m_processes.size() >= maximumNumberOfProcesses())
+    prewarmProcess();
+}
+
+void WebProcessPool::prewarmProcess()
+{
+    // A page would not get a new process anyway.
+    if (m_processes.size() - m_prewarmedProcesses.size() >= maximumNumberOfProcesses())
+        return;
+
+    auto launchTime = MonotonicTime::now();
+    auto& process = createNewWebProcess(m_websiteDataStore->websiteDataStore());
+    m_prewarmedProcesses.append({ &process, launchTime, std::nullopt });
+}
+
+static const Seconds prewarmedProcessRefillDelay { 1_s };
+
+void WebProcessPool::prewarmedProcessTimerFired()
+{
+    // Launch one process at a time so that refilling the pool does not compete with the page that just took a process.
+    if (m_prewarmedProcesses.size() >= m_configuration->prewarmedProcessCount())
+        return;
+
+    if (m_isUnderMemoryPressure)
+        return;
+
+    size_t prewarmedProcessCount = m_prewarmedProcesses.size();
+    prewarmProcess();
+    if (m_prewarmedProcesses.size() > prewarmedProcessCount && m_prewarmedProcesses.size() < m_configuration->prewarmedProcessCount())
+        m_prewarmedProcessTimer.startOneShot(prewarmedProcessRefillDelay);
+}
+
+RefPtr<WebProcessProxy> WebProcessPool::takePrewarmedProcess(WebsiteDataStore* websiteDataStore)
+{
+    if (m_configuration->prewarmedProcessCount() && !m_prewarmedProcessTimer.isActive())
+        m_prewarmedProcessTimer.startOneShot(prewarmedProcessRefillDelay);
+
+    size_t index = m_prewarmedProcesses.findMatching([websiteDataStore](auto& prewarmedProcess) {
+        return !websiteDataStore || &prewarmedProcess.process->websiteDataStore() == websiteDataStore;
+    });
+    if (index == notFound) {
+        ++m_prewarmedProcessStatistics.missCount;
+        LOG(PerformanceLogging, "WebProcessPool %p: no prewarmed process available for new page (%" PRIu64 " hits, %" PRIu64 " misses)", this, m_prewarmedProcessStatistics.hitCount, m_prewarmedProcessStatistics.missCount);
+        return nullptr;
+    }
+
+    auto prewarmedProcess = WTFMove(m_prewarmedProcesses[index]);
+    m_prewarmedProcesses.remove(index);
+
+    // A process that is still launching only saves the part of its launch that has already elapsed.
+    Seconds timeSaved = prewarmedProcess.launchDuration ? *prewarmedProcess.launchDuration : MonotonicTime::now() - prewarmedProcess.launchTime;
+    ++m_prewarmedProcessStatistics.hitCount;
+    m_prewarmedProcessStatistics.timeSaved += timeSaved;
+    LOG(PerformanceLogging, "WebProcessPool %p: using prewarmed process %p for new page, saved %.1fms (%" PRIu64 " hits, %" PRIu64 " misses, %.1fms saved in total)", this, prewarmedProcess.process.get(), timeSaved.milliseconds(), m_prewarmedProcessStatistics.hitCount, m_prewarmedProcessStatistics.missCount, m_prewarmedProcessStatistics.timeSaved.milliseconds());
+    return WTFMove(prewarmedProcess.process);
+}
+
+bool WebProcessPool::isPrewarmedProcess(WebProcessProxy& process) const
+{
+    return m_prewarmedProcesses.findMatching([&process](auto& prewarmedProcess) { return prewarmedProcess.process == &process; }) != notFound;
+}
+
+void WebProcessPool::terminatePrewarmedProcesses()
+{
+    m_prewarmedProcessTimer.stop();
+
+    // These processes have no pages, so no client is told about the termination. The reason only
+    // says that it isn't a crash.
+    auto prewarmedProcesses = WTFMove(m_prewarmedProcesses);
+    for (auto& prewarmedProcess : prewarmedProcesses)
+        prewarmedProcess.process->requestTermination(ProcessTerminationReason::RequestedByClient);
+}
+
+void WebProcessPool::processMemoryPressureStatusChanged(WebProcessProxy& process, bool isUnderMemoryPressure)
+{
+    // The web processes watch the memory of the whole system, so any of them reporting pressure is enough
+    // to give the memory used by the idle processes back. The pool is refilled once none of them does.
+    bool wasUnderMemoryPressure = m_isUnderMemoryPressure;
+    m_isUnderMemoryPressure = isUnderMemoryPressure || m_processes.findMatching([&process](auto& otherProcess) {
+        return otherProcess.get() != &process && otherProcess->isUnderMemoryPressure();
+    }) != notFound;
+
+    if (m_isUnderMemoryPressure == wasUnderMemoryPressure || !m_configuration->prewarmedProcessCount())
         return;
 
-    createNewWebProcess(m_websiteDataStore->websiteDataStore());
-    m_haveInitialEmptyProcess = true;
+    if (m_isUnderMemoryPressure) {
+        LOG(PerformanceLogging, "WebProcessPool %p: terminating %zu prewarmed processes under memory pressure", this, m_prewarmedProcesses.size());
+        terminatePrewarmedProcesses();
+    } else
+        m_prewarmedProcessTimer.startOneShot(prewarmedProcessRefillDelay);
 }
 
 void WebProcessPool::enableProcessTermination()
@@ -818,6 +907,9 @@ bool WebProcessPool::shouldTerminate(WebProcessProxy* process)
     if (!m_processTerminationEnabled)
         return false;
 
+    if (isPrewarmedProcess(*process))
+        return false;
+
     return true;
 }
 
@@ -825,6 +917,13 @@ void WebProcessPool::processDidFinishLaunching(WebProcessProxy* process)
 {
     ASSERT(m_processes.contains(process));
 
+    for (auto& prewarmedProcess : m_prewarmedProcesses) {
+        if (prewarmedProcess.process == process) {
+            prewarmedProcess.launchDuration = MonotonicTime::now() - prewarmedProcess.launchTime;
+            break;
+        }
+    }
+
     if (!m_visitedLinksPopulated) {
         populateVisitedLinks();
         m_visitedLinksPopulated = true;
@@ -854,8 +953,12 @@ void WebProcessPool::disconnectProcess(WebProcessProxy* process)
 {
     ASSERT(m_processes.contains(process));
 
-    if (m_haveInitialEmptyProcess && process == m_processes.last())
-        m_haveInitialEmptyProcess = false;
+    m_prewarmedProcesses.removeFirstMatching([process](auto& prewarmedProcess) {
+        return prewarmedProcess.process == process;
+    });
+
+    if (process->isUnderMemoryPressure())
+        processMemoryPressureStatusChanged(*process, false);
 
     // FIXME (Multi-WebProcess): <rdar://problem/12239765> Some of the invalidation calls of the other supplements are still necessary in multi-process mode, but they should only affect data structures pertaining to the process being disconnected.
     // Clearing everything causes assertion failures, so it's less trouble to skip that for now.
@@ -884,24 +987,26 @@ WebProcessProxy& WebProcessPool::createNewWebProcessRespectingProcessCountLimit(
     bool mustMatchDataStore = false;
 #endif
 
-    if (m_processes.size() < maximumNumberOfProcesses())
+    // Prewarmed processes don't count toward the limit, they only replace a process that would be launched anyway.
+    if (m_processes.size() - m_prewarmedProcesses.size() < maximumNumberOfProcesses()) {
+        if (auto process = takePrewarmedProcess(mustMatchDataStore ? &websiteDataStore : nullptr))
+            return *process;
         return createNewWebProcess(websiteDataStore);
+    }
 
     Vector<RefPtr<WebProcessProxy>> processesMatchingDataStore;
-    if (mustMatchDataStore) {
-        for (auto& process : m_processes) {
-            if (&process->websiteDataStore() == &websiteDataStore)
-                processesMatchingDataStore.append(process);
-        }
-
-        if (processesMatchingDataStore.isEmpty())
-            return createNewWebProcess(websiteDataStore);
+    for (auto& process : m_processes) {
+        if (isPrewarmedProcess(*process))
+            continue;
+        if (!mustMatchDataStore || &process->websiteDataStore() == &websiteDataStore)
+            processesMatchingDataStore.append(process);
     }
 
+    if (processesMatchingDataStore.isEmpty())
+        return createNewWebProcess(websiteDataStore);
+
     // Choose the process with fewest pages.
-    auto* processes = mustMatchDataStore ? &processesMatchingDataStore : &m_processes;
-    ASSERT(!processes->isEmpty());
-    auto& process = *std::min_element(processes->begin(), processes->end(), [](const RefPtr<WebProcessProxy>& a, const RefPtr<WebProcessProxy>& b) {
+    auto& process = *std::min_element(processesMatchingDataStore.begin(), processesMatchingDataStore.end(), [](const RefPtr<WebProcessProxy>& a, const RefPtr<WebProcessProxy>& b) {
         return a->pageCount() < b->pageCount();
     });
 
@@ -926,10 +1031,7 @@ Ref<WebPageProxy> WebProcessPool::createWebPage(PageClient& pageClient, Ref<API:
     }
 
     RefPtr<WebProcessProxy> process;
-    if (m_haveInitialEmptyProcess) {
-        process = m_processes.last();
-        m_haveInitialEmptyProcess = false;
-    } else if (pageConfiguration->relatedPage()) {
+    if (pageConfiguration->relatedPage()) {
         // Sharing processes, e.g. when creating the page via window.open().
         process = &pageConfiguration->relatedPage()->process();
     } else
@@ -1394,11 +1496,21 @@ void WebProcessPool::getStatistics(uint32_t statisticsMask, Function<void (API::
     
     if (statisticsMask & StatisticsRequestTypeNetworking)
         requestNetworkingStatistics(request.get());
+
+    if (statisticsMask & StatisticsRequestTypeIPC)
+        requestIPCStatistics(request.get());
 }
 
 void WebProcessPool::requestWebContentStatistics(StatisticsRequest* request)
 {
-    // FIXME (Multi-WebProcess) <rdar://problem/13200059>: Make getting statistics from multiple WebProcesses work.
+    for (auto& process : m_processes) {
+        if (!process->canSendMessage())
+            continue;
+
+        uint64_t requestID = request->addOutstandingRequest();
+        m_statisticsRequests.set(requestID, request);
+        process->send(Messages::WebProcess::GetWebCoreStatistics(requestID), 0);
+    }
 }
 
 void WebProcessPool::requestNetworkingStatistics(StatisticsRequest* request)
@@ -1413,6 +1525,29 @@ void WebProcessPool::requestNetworkingStatistics(StatisticsRequest* request)
     m_networkProcess->send(Messages::NetworkProcess::GetNetworkProcessStatistics(requestID), 0);
 }
 
+void WebProcessPool::requestIPCStatistics(StatisticsRequest* request)
+{
+    if (m_networkProcess) {
+        uint64_t requestID = request->addOutstandingRequest();
+        m_statisticsRequests.set(requestID, request);
+        m_networkProcess->send(Messages::NetworkProcess::GetIPCMessageStatistics(requestID), 0);
+    }
+
+    for (auto& process : m_processes) {
+        if (!process->canSendMessage())
+            continue;
+
+        uint64_t requestID = request->addOutstandingRequest();
+        m_statisticsRequests.set(requestID, request);
+        process->send(Messages::WebProcess::GetIPCMessageStatistics(requestID), 0);
+    }
+
+    // Complete the request for the UI process last, so that the callback waits for the other processes.
+    StatisticsData data;
+    data.ipcMessageStatistics = IPC::MessageTelemetry::processStatistics();
+    request->completedRequest(request->addOutstandingRequest(), data);
+}
+
 static WebProcessProxy* webProcessProxyFromConnection(IPC::Connection& connection, const Vector<RefPtr<WebProcessProxy>>& processes)
 {
     for (auto& process : processes) {
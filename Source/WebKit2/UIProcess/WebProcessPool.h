@@ -49,6 +49,7 @@
 #include <wtf/Forward.h>
 #include <wtf/HashMap.h>
 #include <wtf/HashSet.h>
+#include <wtf/MonotonicTime.h>
 #include <wtf/RefCounter.h>
 #include <wtf/RefPtr.h>
 #include <wtf/text/StringHash.h>
@@ -273,6 +274,16 @@ public:
     WebProcessProxy& createNewWebProcessRespectingProcessCountLimit(WebsiteDataStore&); // Will return an existing one if limit is met.
     void warmInitialProcess();
 
+    struct PrewarmedProcessStatistics {
+        uint64_t hitCount { 0 };
+        uint64_t missCount { 0 };
+        Seconds timeSaved;
+    };
+    const PrewarmedProcessStatistics& prewarmedProcessStatistics() const { return m_prewarmedProcessStatistics; }
+    unsigned prewarmedProcessCount() const { return m_prewarmedProcesses.size(); }
+
+    void processMemoryPressureStatusChanged(WebProcessProxy&, bool isUnderMemoryPressure);
+
     bool shouldTerminate(WebProcessProxy*);
 
     void disableProcessTermination() { m_processTerminationEnabled = false; }
@@ -424,6 +435,7 @@ private:
 
     void requestWebContentStatistics(StatisticsRequest*);
     void requestNetworkingStatistics(StatisticsRequest*);
+    void requestIPCStatistics(StatisticsRequest*);
 
     void platformInitializeNetworkProcess(NetworkProcessCreationParameters&);
 
@@ -473,12 +485,28 @@ private:
     void resolvePathsForSandboxExtensions();
     void platformResolvePathsForSandboxExtensions();
 
+    void prewarmProcess();
+    void prewarmedProcessTimerFired();
+    RefPtr<WebProcessProxy> takePrewarmedProcess(WebsiteDataStore*);
+    bool isPrewarmedProcess(WebProcessProxy&) const;
+    void terminatePrewarmedProcesses();
+
     Ref<API::ProcessPoolConfiguration> m_configuration;
 
     IPC::MessageReceiverMap m_messageReceiverMap;
 
     Vector<RefPtr<WebProcessProxy>> m_processes;
-    bool m_haveInitialEmptyProcess;
+
+    // Idle processes that have been launched ahead of time and have not been handed to a page yet.
+    struct PrewarmedProcess {
+        RefPtr<WebProcessProxy> process;
+        MonotonicTime launchTime;
+        std::optional<Seconds> launchDuration;
+    };
+    Vector<PrewarmedProcess> m_prewarmedProcesses;
+    RunLoop::Timer<WebProcessPool> m_prewarmedProcessTimer;
+    PrewarmedProcessStatistics m_prewarmedProcessStatistics;
+    bool m_isUnderMemoryPressure { false };
 
     WebProcessProxy* m_processWithPageCache;
 
@@ -1133,6 +1133,15 @@ void WebProcessProxy::logDiagnosticMessageForResourceLimitTermination(const Stri
         (*pages().begin())->logDiagnosticMessage(DiagnosticLoggingKeys::simulatedPageCrashKey(), limitKey, ShouldSample::No);
 }
 
+void WebProcessProxy::memoryPressureStatusChanged(bool isUnderMemoryPressure)
+{
+    if (m_isUnderMemoryPressure == isUnderMemoryPressure)
+        return;
+
+    m_isUnderMemoryPressure = isUnderMemoryPressure;
+    m_processPool->processMemoryPressureStatusChanged(*this, isUnderMemoryPressure);
+}
+
 void WebProcessProxy::didExceedActiveMemoryLimit()
 {
     RELEASE_LOG_ERROR(PerformanceLogging, "%p - WebProcessProxy::didExceedActiveMemoryLimit() Terminating WebProcess that has exceeded the active memory limit", this);
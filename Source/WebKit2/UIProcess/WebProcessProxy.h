@@ -172,7 +172,7 @@ public:
     void didReceiveMainThreadPing();
     void didReceiveBackgroundResponsivenessPing();
 
-    void memoryPressureStatusChanged(bool isUnderMemoryPressure) { m_isUnderMemoryPressure = isUnderMemoryPressure; }
+    void memoryPressureStatusChanged(bool isUnderMemoryPressure);
     bool isUnderMemoryPressure() const { return m_isUnderMemoryPressure; }
 
     void processTerminated();
@@ -50,7 +50,9 @@ namespace WebKit {
 
 NetworkProcessConnection::NetworkProcessConnection(IPC::Connection::Identifier connectionIdentifier)
     : m_connection(IPC::Connection::createClientConnection(connectionIdentifier, *this))
+    , m_webResourceLoaderDispatcher(WebResourceLoaderDispatcher::create())
 {
+    m_webResourceLoaderDispatcher->initializeConnection(m_connection.get());
     m_connection->open();
 }
 
@@ -61,6 +63,7 @@ NetworkProcessConnection::~NetworkProcessConnection()
 void NetworkProcessConnection::didReceiveMessage(IPC::Connection& connection, IPC::Decoder& decoder)
 {
     if (decoder.messageReceiverName() == Messages::WebResourceLoader::messageReceiverName()) {
+        m_webResourceLoaderDispatcher->dispatchEventsReceivedEarlier();
         if (auto* webResourceLoader = WebProcess::singleton().webLoaderStrategy().webResourceLoaderForIdentifier(decoder.destinationID()))
             webResourceLoader->didReceiveWebResourceLoaderMessage(connection, decoder);
         return;
@@ -128,6 +131,24 @@ void NetworkProcessConnection::didWriteBlobsToTemporaryFiles(uint64_t requestIde
         handler(filenames);
 }
 
+DOMCookieCache& NetworkProcessConnection::domCookieCache(SessionID sessionID)
+{
+    return *m_domCookieCaches.ensure(sessionID, [] {
+        return std::make_unique<DOMCookieCache>();
+    }).iterator->value;
+}
+
+void NetworkProcessConnection::clearDOMCookieCache(SessionID sessionID)
+{
+    if (auto* cache = m_domCookieCaches.get(sessionID))
+        cache->clear();
+}
+
+void NetworkProcessConnection::cookiesDidChange(SessionID sessionID)
+{
+    clearDOMCookieCache(sessionID);
+}
+
 #if ENABLE(SHAREABLE_RESOURCE)
 void NetworkProcessConnection::didCacheResource(const ResourceRequest& request, const ShareableResource::Handle& handle, SessionID sessionID)
 {
@@ -28,6 +28,10 @@
 
 #include "Connection.h"
 #include "ShareableResource.h"
+#include "WebResourceLoaderDispatcher.h"
+#include <WebCore/DOMCookieCache.h>
+#include <WebCore/SessionID.h>
+#include <wtf/HashMap.h>
 #include <wtf/RefCounted.h>
 #include <wtf/text/WTFString.h>
 
@@ -39,7 +43,6 @@ namespace WebCore {
 class ResourceError;
 class ResourceRequest;
 class ResourceResponse;
-class SessionID;
 }
 
 namespace WebKit {
@@ -60,6 +63,10 @@ public:
 
     void writeBlobsToTemporaryFiles(const Vector<String>& blobURLs, Function<void (const Vector<String>& filePaths)>&& completionHandler);
 
+    // Only valid for network sessions whose cookie jar reports its changes.
+    WebCore::DOMCookieCache& domCookieCache(WebCore::SessionID);
+    void clearDOMCookieCache(WebCore::SessionID);
+
 private:
     NetworkProcessConnection(IPC::Connection::Identifier);
 
@@ -70,6 +77,7 @@ private:
     void didReceiveInvalidMessage(IPC::Connection&, IPC::StringReference messageReceiverName, IPC::StringReference messageName) override;
 
     void didWriteBlobsToTemporaryFiles(uint64_t requestIdentifier, const Vector<String>& filenames);
+    void cookiesDidChange(WebCore::SessionID);
 
 #if ENABLE(SHAREABLE_RESOURCE)
     // Message handlers.
@@ -78,8 +86,10 @@ private:
 
     // The connection from the web process to the network process.
     Ref<IPC::Connection> m_connection;
+    Ref<WebResourceLoaderDispatcher> m_webResourceLoaderDispatcher;
 
     HashMap<uint64_t, Function<void (const Vector<String>&)>> m_writeBlobToFileCompletionHandlers;
+    HashMap<WebCore::SessionID, std::unique_ptr<WebCore::DOMCookieCache>> m_domCookieCaches;
 };
 
 } // namespace WebKit
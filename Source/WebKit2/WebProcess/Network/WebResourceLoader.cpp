@@ -26,7 +26,7 @@
 #include "config.h"
 #include "WebResourceLoader.h"
 
-#include "DataReference.h"
+#include "BorrowedDataReference.h"
 #include "Logging.h"
 #include "NetworkProcessConnection.h"
 #include "NetworkResourceLoaderMessages.h"
@@ -123,23 +123,23 @@ void WebResourceLoader::didReceiveResponse(const ResourceResponse& response, boo
         send(Messages::NetworkResourceLoader::ContinueDidReceiveResponse());
 }
 
-void WebResourceLoader::didReceiveData(const IPC::DataReference& data, int64_t encodedDataLength)
+void WebResourceLoader::didReceiveData(Ref<SharedBuffer>&& data, int64_t encodedDataLength)
 {
-    LOG(Network, "(WebProcess) WebResourceLoader::didReceiveData of size %lu for '%s'", data.size(), m_coreLoader->url().string().latin1().data());
+    LOG(Network, "(WebProcess) WebResourceLoader::didReceiveData of size %lu for '%s'", data->size(), m_coreLoader->url().string().latin1().data());
 
     if (!m_numBytesReceived) {
         RELEASE_LOG_IF_ALLOWED("didReceiveData: Started receiving data (pageID = %" PRIu64 ", frameID = %" PRIu64 ", resourceID = %" PRIu64 ")", m_trackingParameters.pageID, m_trackingParameters.frameID, m_trackingParameters.resourceID);
     }
-    m_numBytesReceived += data.size();
+    m_numBytesReceived += data->size();
 
-    m_coreLoader->didReceiveData(reinterpret_cast<const char*>(data.data()), data.size(), encodedDataLength, DataPayloadBytes);
+    m_coreLoader->didReceiveBuffer(WTFMove(data), encodedDataLength, DataPayloadBytes);
 }
 
-void WebResourceLoader::didRetrieveDerivedData(const String& type, const IPC::DataReference& data)
+void WebResourceLoader::didRetrieveDerivedData(const String& type, const IPC::BorrowedDataReference& data)
 {
     LOG(Network, "(WebProcess) WebResourceLoader::didRetrieveDerivedData of size %lu for '%s'", data.size(), m_coreLoader->url().string().latin1().data());
 
-    auto buffer = SharedBuffer::create(data.data(), data.size());
+    auto buffer = data.sharedBuffer();
     m_coreLoader->didRetrieveDerivedDataFromCache(type, buffer.get());
 }
 
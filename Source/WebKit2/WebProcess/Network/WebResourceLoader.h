@@ -32,7 +32,7 @@
 #include <wtf/RefPtr.h>
 
 namespace IPC {
-class DataReference;
+class BorrowedDataReference;
 }
 
 namespace WebCore {
@@ -41,6 +41,7 @@ class ResourceError;
 class ResourceLoader;
 class ResourceRequest;
 class ResourceResponse;
+class SharedBuffer;
 }
 
 namespace WebKit {
@@ -67,6 +68,11 @@ public:
 
     bool isAlwaysOnLoggingAllowed() const;
 
+    // Delivered on the main thread by WebResourceLoaderDispatcher.
+    void didReceiveData(Ref<WebCore::SharedBuffer>&&, int64_t encodedDataLength);
+    void didFinishResourceLoad(const WebCore::NetworkLoadMetrics&);
+    void didFailResourceLoad(const WebCore::ResourceError&);
+
 private:
     WebResourceLoader(Ref<WebCore::ResourceLoader>&&, const TrackingParameters&);
 
@@ -77,10 +83,7 @@ private:
     void willSendRequest(WebCore::ResourceRequest&&, WebCore::ResourceResponse&&);
     void didSendData(uint64_t bytesSent, uint64_t totalBytesToBeSent);
     void didReceiveResponse(const WebCore::ResourceResponse&, bool needsContinueDidReceiveResponseMessage);
-    void didReceiveData(const IPC::DataReference&, int64_t encodedDataLength);
-    void didRetrieveDerivedData(const String& type, const IPC::DataReference&);
-    void didFinishResourceLoad(const WebCore::NetworkLoadMetrics&);
-    void didFailResourceLoad(const WebCore::ResourceError&);
+    void didRetrieveDerivedData(const String& type, const IPC::BorrowedDataReference&);
 #if ENABLE(SHAREABLE_RESOURCE)
     void didReceiveResource(const ShareableResource::Handle&);
 #endif
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+#include "WebResourceLoaderDispatcher.h"
+
+#include "BorrowedDataReference.h"
+#include "WebCoreArgumentCoders.h"
+#include "WebLoaderStrategy.h"
+#include "WebProcess.h"
+#include "WebResourceLoader.h"
+#include "WebResourceLoaderDispatcherMessages.h"
+#include <wtf/NeverDestroyed.h>
+#include <wtf/RunLoop.h>
+#include <wtf/threads/BinarySemaphore.h>
+
+using namespace WebCore;
+
+namespace WebKit {
+
+class WebLoaderStrategyClient final : public WebResourceLoaderDispatcher::Client {
+public:
+    // Each callback can cancel the load, so the loader is looked up for every event.
+    void didReceiveData(uint64_t resourceLoadIdentifier, Ref<SharedBuffer>&& data, int64_t encodedDataLength) override
+    {
+        if (RefPtr<WebResourceLoader> loader = WebProcess::singleton().webLoaderStrategy().webResourceLoaderForIdentifier(resourceLoadIdentifier))
+            loader->didReceiveData(WTFMove(data), encodedDataLength);
+    }
+
+    void didFinishResourceLoad(uint64_t resourceLoadIdentifier, const NetworkLoadMetrics& networkLoadMetrics) override
+    {
+        if (RefPtr<WebResourceLoader> loader = WebProcess::singleton().webLoaderStrategy().webResourceLoaderForIdentifier(resourceLoadIdentifier))
+            loader->didFinishResourceLoad(networkLoadMetrics);
+    }
+
+    void didFailResourceLoad(uint64_t resourceLoadIdentifier, const ResourceError& error) override
+    {
+        if (RefPtr<WebResourceLoader> loader = WebProcess::singleton().webLoaderStrategy().webResourceLoaderForIdentifier(resourceLoadIdentifier))
+            loader->didFailResourceLoad(error);
+    }
+};
+
+Ref<WebResourceLoaderDispatcher> WebResourceLoaderDispatcher::create()
+{
+    static NeverDestroyed<WebLoaderStrategyClient> client;
+    return create(client.get());
+}
+
+Ref<WebResourceLoaderDispatcher> WebResourceLoaderDispatcher::create(Client& client)
+{
+    return adoptRef(*new WebResourceLoaderDispatcher(client));
+}
+
+WebResourceLoaderDispatcher::WebResourceLoaderDispatcher(Client& client)
+    : m_client(client)
+    , m_queue(WorkQueue::create("com.apple.WebKit.WebResourceLoaderDispatcher"))
+{
+}
+
+WebResourceLoaderDispatcher::~WebResourceLoaderDispatcher()
+{
+}
+
+void WebResourceLoaderDispatcher::initializeConnection(IPC::Connection& connection)
+{
+    connection.addWorkQueueMessageReceiver(Messages::WebResourceLoaderDispatcher::messageReceiverName(), m_queue.get(), this);
+}
+
+template<typename Function>
+void WebResourceLoaderDispatcher::addPendingEvent(uint64_t resourceLoadIdentifier, Function&& function)
+{
+    bool pendingEventsWereEmpty;
+    {
+        LockHolder locker(m_pendingEventsLock);
+        pendingEventsWereEmpty = m_pendingEvents.isEmpty();
+        if (pendingEventsWereEmpty || m_pendingEvents.last().resourceLoadIdentifier != resourceLoadIdentifier || m_pendingEvents.last().networkLoadMetrics || m_pendingEvents.last().error)
+            m_pendingEvents.append({ resourceLoadIdentifier });
+        function(m_pendingEvents.last());
+    }
+    if (pendingEventsWereEmpty) {
+        RunLoop::main().dispatch([protectedThis = makeRef(*this)]() mutable {
+            protectedThis->dispatchPendingEvents();
+        });
+    }
+}
+
+void WebResourceLoaderDispatcher::didReceiveData(uint64_t resourceLoadIdentifier, const IPC::BorrowedDataReference& data, int64_t encodedDataLength)
+{
+    addPendingEvent(resourceLoadIdentifier, [&](PendingEvent& event) {
+        if (!event.data)
+            event.data = data.sharedBuffer();
+        else
+            event.data->append(data.sharedBuffer());
+        event.encodedDataLength += encodedDataLength;
+    });
+}
+
+void WebResourceLoaderDispatcher::didFinishResourceLoad(uint64_t resourceLoadIdentifier, const NetworkLoadMetrics& networkLoadMetrics)
+{
+    addPendingEvent(resourceLoadIdentifier, [&](PendingEvent& event) {
+        event.networkLoadMetrics = networkLoadMetrics.isolatedCopy();
+    });
+}
+
+void WebResourceLoaderDispatcher::didFailResourceLoad(uint64_t resourceLoadIdentifier, const ResourceError& error)
+{
+    addPendingEvent(resourceLoadIdentifier, [&](PendingEvent& event) {
+        event.error = error.isolatedCopy();
+    });
+}
+
+void WebResourceLoaderDispatcher::dispatchEventsReceivedEarlier()
+{
+    ASSERT(isMainThread());
+
+    // The connection hands the messages over to the queue in the order they are received, so once the queue
+    // ran this, all the messages received before the one being dispatched on the main thread have been handled.
+    BinarySemaphore semaphore;
+    m_queue->dispatch([&semaphore] {
+        semaphore.signal();
+    });
+    semaphore.wait(WallTime::infinity());
+
+    dispatchPendingEvents();
+}
+
+void WebResourceLoaderDispatcher::dispatchPendingEvents()
+{
+    ASSERT(isMainThread());
+
+    Vector<PendingEvent> pendingEvents;
+    {
+        LockHolder locker(m_pendingEventsLock);
+        pendingEvents = WTFMove(m_pendingEvents);
+    }
+
+    for (auto& event : pendingEvents) {
+        if (event.data)
+            m_client.didReceiveData(event.resourceLoadIdentifier, event.data.releaseNonNull(), event.encodedDataLength);
+        if (event.networkLoadMetrics)
+            m_client.didFinishResourceLoad(event.resourceLoadIdentifier, event.networkLoadMetrics.value());
+        if (event.error)
+            m_client.didFailResourceLoad(event.resourceLoadIdentifier, event.error.value());
+    }
+}
+
+} // namespace WebKit
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "Connection.h"
+#include <WebCore/NetworkLoadMetrics.h>
+#include <WebCore/ResourceError.h>
+#include <WebCore/SharedBuffer.h>
+#include <wtf/Lock.h>
+#include <wtf/Optional.h>
+#include <wtf/Ref.h>
+#include <wtf/Vector.h>
+
+namespace IPC {
+class BorrowedDataReference;
+}
+
+namespace WebKit {
+
+// Decodes the WebResourceLoader data, completion and failure messages on a work queue, coalescing
+// consecutive data chunks of a load, and delivers them on the main thread in the order they were received.
+class WebResourceLoaderDispatcher : public IPC::Connection::WorkQueueMessageReceiver {
+public:
+    class Client {
+    public:
+        virtual ~Client() { }
+        virtual void didReceiveData(uint64_t resourceLoadIdentifier, Ref<WebCore::SharedBuffer>&&, int64_t encodedDataLength) = 0;
+        virtual void didFinishResourceLoad(uint64_t resourceLoadIdentifier, const WebCore::NetworkLoadMetrics&) = 0;
+        virtual void didFailResourceLoad(uint64_t resourceLoadIdentifier, const WebCore::ResourceError&) = 0;
+    };
+
+    // Delivers the events to the WebResourceLoaders of the WebProcess.
+    static Ref<WebResourceLoaderDispatcher> create();
+    static Ref<WebResourceLoaderDispatcher> create(Client&);
+    ~WebResourceLoaderDispatcher();
+
+    void initializeConnection(IPC::Connection&);
+
+    // The other WebResourceLoader messages are dispatched on the main thread. This has to be called before
+    // dispatching one of them, so that the events of the messages received before it are delivered first.
+    void dispatchEventsReceivedEarlier();
+
+    WorkQueue& queue() { return m_queue.get(); }
+
+    // Message handlers, called on the queue.
+    void didReceiveData(uint64_t resourceLoadIdentifier, const IPC::BorrowedDataReference&, int64_t encodedDataLength);
+    void didFinishResourceLoad(uint64_t resourceLoadIdentifier, const WebCore::NetworkLoadMetrics&);
+    void didFailResourceLoad(uint64_t resourceLoadIdentifier, const WebCore::ResourceError&);
+
+private:
+    explicit WebResourceLoaderDispatcher(Client&);
+
+    // IPC::Connection::WorkQueueMessageReceiver.
+    void didReceiveMessage(IPC::Connection&, IPC::Decoder&) override;
+
+    struct PendingEvent {
+        uint64_t resourceLoadIdentifier;
+        RefPtr<WebCore::SharedBuffer> data;
+        int64_t encodedDataLength { 0 };
+        std::optional<WebCore::NetworkLoadMetrics> networkLoadMetrics;
+        std::optional<WebCore::ResourceError> error;
+    };
+
+    template<typename Function> void addPendingEvent(uint64_t resourceLoadIdentifier, Function&&);
+    void dispatchPendingEvents();
+
+    Client& m_client;
+    Ref<WorkQueue> m_queue;
+    Lock m_pendingEventsLock;
+    // In the order the messages were received. Only the last event can still be extended.
+    Vector<PendingEvent> m_pendingEvents;
+};
+
+} // namespace WebKit
@@ -111,14 +111,31 @@ BlobRegistry* WebPlatformStrategies::createBlobRegistry()
 
 String WebPlatformStrategies::cookiesForDOM(const NetworkStorageSession& session, const URL& firstParty, const URL& url)
 {
+    Ref<NetworkProcessConnection> networkConnection = WebProcess::singleton().networkConnection();
+#if USE(SOUP)
+    // The soup cookie jars report their changes, the network process then invalidates the cache.
+    auto& cache = networkConnection->domCookieCache(session.sessionID());
+    if (auto cookies = cache.cookiesForDOM(firstParty, url))
+        return *cookies;
+#endif
+
     String result;
-    if (!WebProcess::singleton().networkConnection().connection().sendSync(Messages::NetworkConnectionToWebProcess::CookiesForDOM(session.sessionID(), firstParty, url), Messages::NetworkConnectionToWebProcess::CookiesForDOM::Reply(result), 0))
+    double timeToLive;
+    if (!networkConnection->connection().sendSync(Messages::NetworkConnectionToWebProcess::CookiesForDOM(session.sessionID(), firstParty, url), Messages::NetworkConnectionToWebProcess::CookiesForDOM::Reply(result, timeToLive), 0))
         return String();
+
+#if USE(SOUP)
+    cache.add(firstParty, url, result, Seconds(timeToLive));
+#else
+    UNUSED_PARAM(timeToLive);
+#endif
     return result;
 }
 
 void WebPlatformStrategies::setCookiesFromDOM(const NetworkStorageSession& session, const URL& firstParty, const URL& url, const String& cookieString)
 {
+    // The next read has to wait for the network process to handle the new cookie.
+    WebProcess::singleton().networkConnection().clearDOMCookieCache(session.sessionID());
     WebProcess::singleton().networkConnection().connection().send(Messages::NetworkConnectionToWebProcess::SetCookiesFromDOM(session.sessionID(), firstParty, url, cookieString), 0);
 }
 
@@ -152,6 +169,7 @@ bool WebPlatformStrategies::getRawCookies(const NetworkStorageSession& session,
 
 void WebPlatformStrategies::deleteCookie(const NetworkStorageSession& session, const URL& url, const String& cookieName)
 {
+    WebProcess::singleton().networkConnection().clearDOMCookieCache(session.sessionID());
     WebProcess::singleton().networkConnection().connection().send(Messages::NetworkConnectionToWebProcess::DeleteCookie(session.sessionID(), url, cookieName), 0);
 }
 
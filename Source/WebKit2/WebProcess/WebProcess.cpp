@@ -36,6 +36,7 @@
 #include "InjectedBundle.h"
 #include "LibWebRTCNetwork.h"
 #include "Logging.h"
+#include "MessageTelemetry.h"
 #include "NetworkConnectionToWebProcessMessages.h"
 #include "NetworkProcessConnection.h"
 #include "NetworkSession.h"
@@ -112,6 +113,7 @@
 #include <unistd.h>
 #include <wtf/CurrentTime.h>
 #include <wtf/HashCountedSet.h>
+#include <wtf/ProcessID.h>
 #include <wtf/RunLoop.h>
 #include <wtf/text/StringHash.h>
 
@@ -1001,6 +1003,32 @@ void WebProcess::getWebCoreStatistics(uint64_t callbackID)
         uint64_t javaScriptHeapSize = commonVM().heap.size();
         data.statisticsNumbers.set(ASCIILiteral("JavaScriptHeapSize"), javaScriptHeapSize);
         data.statisticsNumbers.set(ASCIILiteral("JavaScriptFreeSize"), commonVM().heap.capacity() - javaScriptHeapSize);
+        data.statisticsNumbers.set(ASCIILiteral("JavaScriptRegExpInterpreterFallbackMatchCount"), commonVM().regExpInterpreterFallbackMatchCount);
+        data.statisticsNumbers.set(ASCIILiteral("JavaScriptRegExpJITCodeFailureCount"), commonVM().regExpJITCodeFailureCount);
+
+        // Start times are wall clock times, in microseconds since the epoch, so that they can be
+        // compared across processes. Durations come from the monotonic clock.
+        for (const auto& event : commonVM().heap.gcEventLog().events()) {
+            HashMap<String, uint64_t> eventData;
+            eventData.set(ASCIILiteral("SequenceNumber"), event.sequenceNumber);
+            eventData.set(ASCIILiteral("IsFullCollection"), event.scope == CollectionScope::Full);
+            eventData.set(ASCIILiteral("ProcessIdentifier"), getCurrentProcessID());
+            eventData.set(ASCIILiteral("StartTimeMicrosecondsSinceEpoch"), event.wallClockStartTime.secondsSinceEpoch().microsecondsAs<uint64_t>());
+            eventData.set(ASCIILiteral("DurationMicroseconds"), (event.endTime - event.startTime).microsecondsAs<uint64_t>());
+            eventData.set(ASCIILiteral("BytesBefore"), event.bytesBefore);
+            eventData.set(ASCIILiteral("BytesAfter"), event.bytesAfter);
+            eventData.set(ASCIILiteral("NumberOfPauses"), event.numberOfPauses);
+            eventData.set(ASCIILiteral("TotalPauseMicroseconds"), event.totalPauseTime.microsecondsAs<uint64_t>());
+            eventData.set(ASCIILiteral("MaximumPauseMicroseconds"), event.maxPauseTime.microsecondsAs<uint64_t>());
+            eventData.set(ASCIILiteral("MutatorBlockedMicroseconds"), event.mutatorBlockedTime.microsecondsAs<uint64_t>());
+            eventData.set(ASCIILiteral("ConstraintSolvingMicroseconds"), event.constraintSolvingTime.microsecondsAs<uint64_t>());
+            eventData.set(ASCIILiteral("BeginPhaseMicroseconds"), event.timeInPhase(CollectorPhase::Begin).microsecondsAs<uint64_t>());
+            eventData.set(ASCIILiteral("FixpointPhaseMicroseconds"), event.timeInPhase(CollectorPhase::Fixpoint).microsecondsAs<uint64_t>());
+            eventData.set(ASCIILiteral("ConcurrentPhaseMicroseconds"), event.timeInPhase(CollectorPhase::Concurrent).microsecondsAs<uint64_t>());
+            eventData.set(ASCIILiteral("ReloopPhaseMicroseconds"), event.timeInPhase(CollectorPhase::Reloop).microsecondsAs<uint64_t>());
+            eventData.set(ASCIILiteral("EndPhaseMicroseconds"), event.timeInPhase(CollectorPhase::End).microsecondsAs<uint64_t>());
+            data.javaScriptGarbageCollectionEvents.append(WTFMove(eventData));
+        }
     }
 
     WTF::FastMallocStatistics fastMallocStatistics = WTF::fastMallocStatistics();
@@ -1028,6 +1056,14 @@ void WebProcess::getWebCoreStatistics(uint64_t callbackID)
     parentProcessConnection()->send(Messages::WebProcessPool::DidGetStatistics(data, callbackID), 0);
 }
 
+void WebProcess::getIPCMessageStatistics(uint64_t callbackID)
+{
+    StatisticsData data;
+    data.ipcMessageStatistics = IPC::MessageTelemetry::processStatistics();
+
+    parentProcessConnection()->send(Messages::WebProcessPool::DidGetStatistics(data, callbackID), 0);
+}
+
 void WebProcess::garbageCollectJavaScriptObjects()
 {
     GCController::singleton().garbageCollectNow();
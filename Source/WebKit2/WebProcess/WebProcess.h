@@ -277,6 +277,7 @@ private:
     void stopMemorySampler();
     
     void getWebCoreStatistics(uint64_t callbackID);
+    void getIPCMessageStatistics(uint64_t callbackID);
     void garbageCollectJavaScriptObjects();
     void setJavaScriptGarbageCollectorTimerEnabled(bool flag);
 
@@ -28,11 +28,13 @@
 #include "WebProcessMainUnix.h"
 
 #include "ChildProcessMain.h"
+#include "ChildProcessZygote.h"
 #include "WebProcess.h"
 #include <WebCore/PlatformDisplayWPE.h>
 #include <glib.h>
 #include <iostream>
 #include <libsoup/soup.h>
+#include <string.h>
 
 using namespace WebCore;
 
@@ -71,6 +73,9 @@ public:
 
 int WebProcessMainUnix(int argc, char** argv)
 {
+    if (argc > 1 && !strcmp(argv[1], ChildProcessZygote::commandLineSwitch))
+        return ChildProcessZygote::run(argc, argv);
+
     return ChildProcessMain<WebProcess, WebProcessMain>(argc, argv);
 }
 
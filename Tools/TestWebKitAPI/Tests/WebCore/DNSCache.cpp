@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include "Test.h"
+#include <WebCore/DNSCache.h>
+#include <WebCore/FileSystem.h>
+#include <wtf/MainThread.h>
+#include <wtf/RunLoop.h>
+
+#if USE(SOUP)
+#include <WebCore/WebKitCachingResolver.h>
+#include <wtf/glib/GRefPtr.h>
+#include <wtf/glib/GUniquePtr.h>
+#endif
+
+using namespace WebCore;
+
+namespace TestWebKitAPI {
+
+class DNSCacheTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        WTF::initializeMainThread();
+        RunLoop::initializeMainRunLoop();
+        DNSCache::singleton().clear();
+        DNSCache::singleton().resetStatistics();
+        DNSCache::singleton().setCapacity(256);
+    }
+
+    void TearDown() override
+    {
+        DNSCache::singleton().clear();
+        DNSCache::singleton().setPersistentStoragePath(String());
+    }
+};
+
+TEST_F(DNSCacheTest, LookupHitAndMiss)
+{
+    auto& cache = DNSCache::singleton();
+    EXPECT_FALSE(cache.lookup("webkit.org"));
+
+    cache.store("webkit.org", { "17.254.20.1", "::1" });
+    auto addresses = cache.lookup("webkit.org");
+    ASSERT_TRUE(!!addresses);
+    ASSERT_EQ(2u, addresses->size());
+    EXPECT_EQ(String("17.254.20.1"), addresses->at(0));
+    EXPECT_EQ(String("::1"), addresses->at(1));
+
+    auto statistics = cache.statistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_DOUBLE_EQ(0.5, statistics.hitRate());
+}
+
+TEST_F(DNSCacheTest, ExpiredEntriesAreNotUsed)
+{
+    auto& cache = DNSCache::singleton();
+    cache.store("webkit.org", { "17.254.20.1" }, 0_s);
+    EXPECT_FALSE(cache.hasValidEntry("webkit.org"));
+    EXPECT_FALSE(cache.lookup("webkit.org"));
+    EXPECT_EQ(1u, cache.statistics().expiredEntries);
+}
+
+TEST_F(DNSCacheTest, LeastRecentlyUsedEntriesAreEvicted)
+{
+    auto& cache = DNSCache::singleton();
+    cache.setCapacity(2);
+    // Entries are ordered by the time they were last used, make sure it's different for every step.
+    cache.store("a.example", { "10.0.0.1" });
+    sleep(10_ms);
+    cache.store("b.example", { "10.0.0.2" });
+    sleep(10_ms);
+    EXPECT_TRUE(!!cache.lookup("a.example"));
+    sleep(10_ms);
+    cache.store("c.example", { "10.0.0.3" });
+
+    EXPECT_TRUE(cache.hasValidEntry("a.example"));
+    EXPECT_FALSE(cache.hasValidEntry("b.example"));
+    EXPECT_TRUE(cache.hasValidEntry("c.example"));
+    EXPECT_EQ(1u, cache.statistics().evictedEntries);
+
+    auto hostnames = cache.mostRecentlyUsedHostnames(1);
+    ASSERT_EQ(1u, hostnames.size());
+    EXPECT_EQ(String("c.example"), hostnames[0]);
+}
+
+TEST_F(DNSCacheTest, PersistentStorage)
+{
+    PlatformFileHandle handle;
+    String path = openTemporaryFile("DNSCache", handle);
+    closeFile(handle);
+
+    auto& cache = DNSCache::singleton();
+    cache.setPersistentStoragePath(path);
+    cache.store("webkit.org", { "17.254.20.1" });
+    cache.store("expired.example", { "10.0.0.1" }, 0_s);
+    cache.saveToPersistentStorage();
+
+    cache.setPersistentStoragePath(String());
+    cache.clear();
+    EXPECT_FALSE(cache.hasValidEntry("webkit.org"));
+
+    cache.setPersistentStoragePath(path);
+    EXPECT_TRUE(cache.hasValidEntry("webkit.org"));
+    EXPECT_FALSE(cache.hasValidEntry("expired.example"));
+    // Expired hosts are still remembered so that they can be prefetched.
+    EXPECT_EQ(2u, cache.mostRecentlyUsedHostnames(10).size());
+
+    deleteFile(path);
+}
+
+TEST_F(DNSCacheTest, ExcludedHostnamesAreNotPersisted)
+{
+    PlatformFileHandle handle;
+    String path = openTemporaryFile("DNSCache", handle);
+    closeFile(handle);
+
+    auto& cache = DNSCache::singleton();
+    cache.setPersistentStoragePath(path);
+    cache.store("webkit.org", { "17.254.20.1" });
+    cache.store("private.example", { "10.0.0.1" });
+    cache.excludeFromPersistentStorage("private.example");
+    // Excluded hosts are still answered from memory.
+    EXPECT_TRUE(cache.hasValidEntry("private.example"));
+    cache.saveToPersistentStorage();
+
+    cache.setPersistentStoragePath(String());
+    cache.clear();
+    cache.setPersistentStoragePath(path);
+    EXPECT_TRUE(cache.hasValidEntry("webkit.org"));
+    EXPECT_FALSE(cache.hasValidEntry("private.example"));
+
+    deleteFile(path);
+}
+
+TEST_F(DNSCacheTest, ClearIsPersisted)
+{
+    PlatformFileHandle handle;
+    String path = openTemporaryFile("DNSCache", handle);
+    closeFile(handle);
+
+    auto& cache = DNSCache::singleton();
+    cache.setPersistentStoragePath(path);
+    cache.store("webkit.org", { "17.254.20.1" });
+    cache.saveToPersistentStorage();
+
+    // Clearing must reach the disk even if nothing is stored afterwards.
+    cache.clear();
+    cache.saveToPersistentStorage();
+
+    cache.setPersistentStoragePath(String());
+    cache.setPersistentStoragePath(path);
+    EXPECT_FALSE(cache.hasValidEntry("webkit.org"));
+    EXPECT_TRUE(cache.mostRecentlyUsedHostnames(10).isEmpty());
+
+    deleteFile(path);
+}
+
+#if USE(SOUP)
+typedef struct {
+    GResolver parent;
+    unsigned lookupCount;
+} StubResolver;
+
+typedef struct {
+    GResolverClass parent;
+} StubResolverClass;
+
+G_DEFINE_TYPE(StubResolver, stub_resolver, G_TYPE_RESOLVER)
+
+static GList* stubResolverLookupByName(GResolver* resolver, const char*, GCancellable*, GError**)
+{
+    reinterpret_cast<StubResolver*>(resolver)->lookupCount++;
+    return g_list_prepend(nullptr, g_inet_address_new_from_string("127.0.0.1"));
+}
+
+static void stub_resolver_init(StubResolver* resolver)
+{
+    resolver->lookupCount = 0;
+}
+
+static void stub_resolver_class_init(StubResolverClass* stubResolverClass)
+{
+    G_RESOLVER_CLASS(stubResolverClass)->lookup_by_name = stubResolverLookupByName;
+}
+
+TEST_F(DNSCacheTest, CachingResolverUsesCache)
+{
+    GRefPtr<GResolver> stubResolver = adoptGRef(G_RESOLVER(g_object_new(stub_resolver_get_type(), nullptr)));
+    GRefPtr<GResolver> cachingResolver = adoptGRef(webkitCachingResolverNew(stubResolver.get()));
+
+    for (unsigned i = 0; i < 3; ++i) {
+        GList* addresses = g_resolver_lookup_by_name(cachingResolver.get(), "stub.example", nullptr, nullptr);
+        ASSERT_NOT_NULL(addresses);
+        GUniquePtr<char> address(g_inet_address_to_string(G_INET_ADDRESS(addresses->data)));
+        EXPECT_STREQ("127.0.0.1", address.get());
+        g_resolver_free_addresses(addresses);
+    }
+
+    EXPECT_EQ(1u, reinterpret_cast<StubResolver*>(stubResolver.get())->lookupCount);
+    EXPECT_EQ(2u, DNSCache::singleton().statistics().hits);
+}
+#endif
+
+} // namespace TestWebKitAPI
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include "Test.h"
+#include <WebCore/DOMCookieCache.h>
+#include <WebCore/URL.h>
+
+using namespace WebCore;
+
+namespace TestWebKitAPI {
+
+static URL url(const char* string)
+{
+    return URL(URL(), string);
+}
+
+TEST(DOMCookieCache, HitAndMiss)
+{
+    DOMCookieCache cache;
+    EXPECT_FALSE(cache.cookiesForDOM(url("https://webkit.org/"), url("https://webkit.org/")));
+
+    cache.add(url("https://webkit.org/"), url("https://webkit.org/"), "a=b; c=d", Seconds::infinity());
+    auto cookies = cache.cookiesForDOM(url("https://webkit.org/"), url("https://webkit.org/"));
+    ASSERT_TRUE(!!cookies);
+    EXPECT_EQ(String("a=b; c=d"), *cookies);
+
+    // Empty results are cached too.
+    cache.add(url("https://webkit.org/"), url("https://webkit.org/empty"), emptyString(), Seconds::infinity());
+    cookies = cache.cookiesForDOM(url("https://webkit.org/"), url("https://webkit.org/empty"));
+    ASSERT_TRUE(!!cookies);
+    EXPECT_TRUE(cookies->isEmpty());
+
+    EXPECT_EQ(2u, cache.statistics().hits);
+    EXPECT_EQ(1u, cache.statistics().misses);
+}
+
+TEST(DOMCookieCache, PartitionedByFirstParty)
+{
+    DOMCookieCache cache;
+    cache.add(url("https://first.example/"), url("https://tracker.example/frame.html"), "id=1", Seconds::infinity());
+
+    EXPECT_TRUE(!!cache.cookiesForDOM(url("https://first.example/"), url("https://tracker.example/frame.html")));
+    EXPECT_FALSE(cache.cookiesForDOM(url("https://second.example/"), url("https://tracker.example/frame.html")));
+
+    cache.add(url("https://second.example/"), url("https://tracker.example/frame.html"), "id=2", Seconds::infinity());
+    EXPECT_EQ(String("id=1"), *cache.cookiesForDOM(url("https://first.example/"), url("https://tracker.example/frame.html")));
+    EXPECT_EQ(String("id=2"), *cache.cookiesForDOM(url("https://second.example/"), url("https://tracker.example/frame.html")));
+}
+
+TEST(DOMCookieCache, KeyedByURLExceptFragment)
+{
+    DOMCookieCache cache;
+    cache.add(url("https://webkit.org/"), url("https://webkit.org/path/page.html#top"), "path=1", Seconds::infinity());
+
+    EXPECT_TRUE(!!cache.cookiesForDOM(url("https://webkit.org/"), url("https://webkit.org/path/page.html")));
+    EXPECT_TRUE(!!cache.cookiesForDOM(url("https://webkit.org/"), url("https://webkit.org/path/page.html#bottom")));
+
+    // Secure cookies and path restricted cookies make these different.
+    EXPECT_FALSE(cache.cookiesForDOM(url("https://webkit.org/"), url("http://webkit.org/path/page.html")));
+    EXPECT_FALSE(cache.cookiesForDOM(url("https://webkit.org/"), url("https://webkit.org/other/page.html")));
+}
+
+TEST(DOMCookieCache, ClearRemovesEntries)
+{
+    DOMCookieCache cache;
+    cache.add(url("https://webkit.org/"), url("https://webkit.org/"), "visible=1", Seconds::infinity());
+    cache.add(url("https://webkit.org/"), url("https://webkit.org/other.html"), "visible=1", Seconds::infinity());
+    cache.clear();
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_FALSE(cache.cookiesForDOM(url("https://webkit.org/"), url("https://webkit.org/")));
+}
+
+TEST(DOMCookieCache, EntriesExpire)
+{
+    DOMCookieCache cache;
+    cache.setMaximumAge(0_s);
+    cache.add(url("https://webkit.org/"), url("https://webkit.org/"), "a=b", Seconds::infinity());
+    EXPECT_FALSE(cache.cookiesForDOM(url("https://webkit.org/"), url("https://webkit.org/")));
+    EXPECT_EQ(0u, cache.size());
+}
+
+TEST(DOMCookieCache, EntriesExpireWithTheirCookies)
+{
+    DOMCookieCache cache;
+
+    // A cookie that has already expired is never cached.
+    cache.add(url("https://webkit.org/"), url("https://webkit.org/"), "expired=1", 0_s);
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_FALSE(cache.cookiesForDOM(url("https://webkit.org/"), url("https://webkit.org/")));
+
+    // A cookie expiring before the maximum age of the entries expires the entry.
+    cache.add(url("https://webkit.org/"), url("https://webkit.org/"), "expiring=1", 10_ms);
+    EXPECT_TRUE(!!cache.cookiesForDOM(url("https://webkit.org/"), url("https://webkit.org/")));
+    WTF::sleep(20_ms);
+    EXPECT_FALSE(cache.cookiesForDOM(url("https://webkit.org/"), url("https://webkit.org/")));
+    EXPECT_EQ(0u, cache.size());
+
+    // Cookies living longer than the maximum age don't extend it.
+    cache.setMaximumAge(10_ms);
+    cache.add(url("https://webkit.org/"), url("https://webkit.org/"), "persistent=1", 1_h);
+    WTF::sleep(20_ms);
+    EXPECT_FALSE(cache.cookiesForDOM(url("https://webkit.org/"), url("https://webkit.org/")));
+}
+
+} // namespace TestWebKitAPI
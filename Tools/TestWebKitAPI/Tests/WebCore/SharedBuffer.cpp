@@ -160,4 +160,27 @@ TEST_F(SharedBufferTest, copy)
     ASSERT_EQ(length * 5, clone->size());
 }
 
+TEST_F(SharedBufferTest, createWithProviderSegment)
+{
+    RefPtr<SharedBuffer> file = SharedBuffer::createWithContentsOfFile(tempFilePath());
+    ASSERT_NOT_NULL(file);
+    auto& fileSegment = *file->begin();
+
+    const size_t offset = 6;
+    const size_t length = 5;
+    auto slice = SharedBuffer::create(SharedBuffer::DataSegment::create(SharedBuffer::DataSegment::Provider {
+        [segment = fileSegment.copyRef()] { return segment->data() + offset; },
+        [] { return length; }
+    }));
+    file = nullptr;
+
+    EXPECT_EQ(length, slice->size());
+    EXPECT_TRUE(String(SharedBufferTest::testData() + offset, length) == String(slice->data(), slice->size()));
+
+    slice->append("!", 1);
+    EXPECT_EQ(length + 1, slice->size());
+    EXPECT_EQ(0, memcmp(slice->data(), SharedBufferTest::testData() + offset, length));
+    EXPECT_EQ('!', slice->data()[length]);
+}
+
 }
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <WebKit/BorrowedDataReference.h>
+#include <WebKit/Decoder.h>
+#include <WebKit/Encoder.h>
+#include <wtf/Vector.h>
+
+using namespace IPC;
+
+namespace TestWebKitAPI {
+
+static Vector<uint8_t> makeData(size_t size, uint8_t seed)
+{
+    Vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i)
+        data[i] = static_cast<uint8_t>(seed + i);
+    return data;
+}
+
+static std::unique_ptr<Encoder> encodeData(const Vector<uint8_t>& first, const Vector<uint8_t>& second)
+{
+    auto encoder = std::make_unique<Encoder>("Test", "BorrowedData", 0);
+    *encoder << BorrowedDataReference(DataReference(first));
+    *encoder << BorrowedDataReference(DataReference(second));
+    return encoder;
+}
+
+static bool equals(const BorrowedDataReference& dataReference, const Vector<uint8_t>& expected)
+{
+    return dataReference.size() == expected.size() && !memcmp(dataReference.data(), expected.data(), expected.size());
+}
+
+TEST(WebKit2, BorrowedDataReferenceOutlivesDecoder)
+{
+    auto first = makeData(64 * 1024, 1);
+    auto second = makeData(100, 2);
+    auto encoder = encodeData(first, second);
+
+    BorrowedDataReference firstReference;
+    BorrowedDataReference secondReference;
+    {
+        auto decoder = std::make_unique<Decoder>(encoder->buffer(), encoder->bufferSize(), nullptr, Vector<Attachment> { });
+        ASSERT_TRUE(decoder->decode(firstReference));
+        ASSERT_TRUE(decoder->decode(secondReference));
+    }
+
+    EXPECT_TRUE(equals(firstReference, first));
+    EXPECT_TRUE(equals(secondReference, second));
+
+    auto sharedBuffer = firstReference.sharedBuffer();
+    ASSERT_EQ(first.size(), sharedBuffer->size());
+    EXPECT_FALSE(memcmp(sharedBuffer->data(), first.data(), first.size()));
+
+    // The references share the body of the message instead of copying their bytes.
+    EXPECT_LT(firstReference.data(), secondReference.data());
+    EXPECT_EQ(firstReference.data() + first.size(), secondReference.data() - sizeof(uint64_t));
+}
+
+TEST(WebKit2, BorrowedDataReferenceIgnoresWritesToTheReceivedBody)
+{
+    auto first = makeData(8 * 1024, 3);
+    auto second = makeData(16, 4);
+    auto encoder = encodeData(first, second);
+
+    // The received body may be in memory that the sender can still write to, like the shared memory of out of line
+    // bodies. What was decoded must not change afterwards.
+    auto decoder = std::make_unique<Decoder>(encoder->buffer(), encoder->bufferSize(), nullptr, Vector<Attachment> { });
+    memset(encoder->buffer(), 0xff, encoder->bufferSize());
+
+    BorrowedDataReference firstReference;
+    ASSERT_TRUE(decoder->decode(firstReference));
+    EXPECT_TRUE(equals(firstReference, first));
+    memset(encoder->buffer(), 0, encoder->bufferSize());
+    EXPECT_TRUE(equals(firstReference, first));
+}
+
+TEST(WebKit2, BorrowedDataReferenceFromTemporaryDataReference)
+{
+    auto data = makeData(32, 5);
+
+    // The reference keeps the pointer and the size, not the DataReference it was created from.
+    BorrowedDataReference dataReference = DataReference(data);
+    EXPECT_EQ(data.data(), dataReference.data());
+    EXPECT_EQ(data.size(), dataReference.size());
+
+    auto sharedBuffer = dataReference.sharedBuffer();
+    ASSERT_EQ(data.size(), sharedBuffer->size());
+    EXPECT_FALSE(memcmp(sharedBuffer->data(), data.data(), data.size()));
+}
+
+} // namespace TestWebKitAPI
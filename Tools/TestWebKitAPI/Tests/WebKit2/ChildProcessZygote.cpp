@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <WebKit/ChildProcessZygote.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <wtf/UniStdExtras.h>
+
+using namespace WebKit;
+
+namespace TestWebKitAPI {
+
+static const int forkedProcessExitStatus = 42;
+
+TEST(WebKit2, ChildProcessZygoteForksChildrenOfParent)
+{
+    int pipeDescriptors[2];
+    ASSERT_EQ(0, pipe(pipeDescriptors));
+
+    pid_t parentProcessIdentifier = getpid();
+    pid_t zygoteProcessIdentifier = fork();
+    ASSERT_NE(-1, zygoteProcessIdentifier);
+    if (!zygoteProcessIdentifier) {
+        pid_t processIdentifier = ChildProcessZygote::forkAsSibling();
+        if (!processIdentifier) {
+            // The process identifier cached by glibc has to be the one of the new process.
+            bool isSibling = getppid() == parentProcessIdentifier && getpid() == static_cast<pid_t>(syscall(SYS_getpid));
+            _exit(isSibling ? forkedProcessExitStatus : EXIT_FAILURE);
+        }
+        ssize_t bytesWritten = write(pipeDescriptors[1], &processIdentifier, sizeof(processIdentifier));
+        _exit(bytesWritten == sizeof(processIdentifier) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    closeWithRetry(pipeDescriptors[1]);
+    int status;
+    ASSERT_EQ(zygoteProcessIdentifier, waitpid(zygoteProcessIdentifier, &status, 0));
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(EXIT_SUCCESS, WEXITSTATUS(status));
+
+    pid_t processIdentifier = 0;
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(processIdentifier)), read(pipeDescriptors[0], &processIdentifier, sizeof(processIdentifier)));
+    closeWithRetry(pipeDescriptors[0]);
+
+    // The process forked by the zygote is a child of this one, which can reap it.
+    ASSERT_EQ(processIdentifier, waitpid(processIdentifier, &status, 0));
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(forkedProcessExitStatus, WEXITSTATUS(status));
+}
+
+TEST(WebKit2, ChildProcessZygoteRequestPassesSockets)
+{
+    int controlSockets[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, controlSockets));
+    int ipcSockets[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, ipcSockets));
+    int wpeSockets[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, wpeSockets));
+
+    std::thread zygote([zygoteControlSocket = controlSockets[1]] {
+        Vector<int> fileDescriptors;
+        if (!ChildProcessZygote::receiveRequest(zygoteControlSocket, fileDescriptors) || fileDescriptors.size() != ChildProcessZygote::fileDescriptorsPerRequest)
+            return;
+        for (int fileDescriptor : fileDescriptors) {
+            char byte = 'z';
+            ssize_t bytesWritten = write(fileDescriptor, &byte, 1);
+            ASSERT_UNUSED(bytesWritten, bytesWritten == 1);
+            closeWithRetry(fileDescriptor);
+        }
+        ChildProcessZygote::sendReply(zygoteControlSocket, 1234);
+    });
+
+    EXPECT_EQ(1234, ChildProcessZygote::requestProcess(controlSockets[0], ipcSockets[1], wpeSockets[1], 5_s));
+    zygote.join();
+
+    char byte = 0;
+    EXPECT_EQ(1, read(ipcSockets[0], &byte, 1));
+    EXPECT_EQ('z', byte);
+    byte = 0;
+    EXPECT_EQ(1, read(wpeSockets[0], &byte, 1));
+    EXPECT_EQ('z', byte);
+
+    for (int fileDescriptor : { controlSockets[0], controlSockets[1], ipcSockets[0], ipcSockets[1], wpeSockets[0], wpeSockets[1] })
+        closeWithRetry(fileDescriptor);
+}
+
+TEST(WebKit2, ChildProcessZygoteRequestTimesOut)
+{
+    int controlSockets[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, controlSockets));
+    int ipcSockets[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, ipcSockets));
+
+    // Nothing reads the request.
+    EXPECT_EQ(-1, ChildProcessZygote::requestProcess(controlSockets[0], ipcSockets[0], ipcSockets[1], 50_ms));
+
+    // A zygote that went away.
+    closeWithRetry(controlSockets[1]);
+    EXPECT_EQ(-1, ChildProcessZygote::requestProcess(controlSockets[0], ipcSockets[0], ipcSockets[1], 5_s));
+
+    for (int fileDescriptor : { controlSockets[0], ipcSockets[0], ipcSockets[1] })
+        closeWithRetry(fileDescriptor);
+}
+
+TEST(WebKit2, ChildProcessZygoteRejectsInvalidRequests)
+{
+    int controlSockets[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, controlSockets));
+
+    // A request from a UI process using a different protocol version.
+    ChildProcessZygote::Request request { ChildProcessZygote::protocolVersion + 1 };
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(request)), send(controlSockets[0], &request, sizeof(request), 0));
+
+    Vector<int> fileDescriptors;
+    EXPECT_TRUE(ChildProcessZygote::receiveRequest(controlSockets[1], fileDescriptors));
+    EXPECT_TRUE(fileDescriptors.isEmpty());
+
+    // A request without the sockets.
+    request.protocolVersion = ChildProcessZygote::protocolVersion;
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(request)), send(controlSockets[0], &request, sizeof(request), 0));
+    EXPECT_TRUE(ChildProcessZygote::receiveRequest(controlSockets[1], fileDescriptors));
+    EXPECT_TRUE(fileDescriptors.isEmpty());
+
+    // The UI process went away.
+    closeWithRetry(controlSockets[0]);
+    EXPECT_FALSE(ChildProcessZygote::receiveRequest(controlSockets[1], fileDescriptors));
+    closeWithRetry(controlSockets[1]);
+}
+
+} // namespace TestWebKitAPI
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include "Utilities.h"
+#include <WebKit/ArgumentCoders.h>
+#include <WebKit/Connection.h>
+#include <WebKit/Decoder.h>
+#include <WebKit/Encoder.h>
+#include <WebKit/MessageBodyArena.h>
+#include <wtf/Vector.h>
+
+using namespace IPC;
+
+namespace TestWebKitAPI {
+
+class MessageBodyCollector final : public Connection::Client {
+public:
+    void didReceiveMessage(Connection&, Decoder& decoder) final
+    {
+        Vector<uint8_t> body;
+        if (decoder.decode(body))
+            receivedBodies.append(WTFMove(body));
+        else
+            didReceiveInvalidMessage = true;
+        didReceiveMessageOrError = true;
+    }
+
+    void didClose(Connection&) final
+    {
+        didReceiveMessageOrError = true;
+    }
+
+    void didReceiveInvalidMessage(Connection&, StringReference, StringReference) final
+    {
+        didReceiveInvalidMessage = true;
+        didReceiveMessageOrError = true;
+    }
+
+    Vector<Vector<uint8_t>> receivedBodies;
+    bool didReceiveInvalidMessage { false };
+    bool didReceiveMessageOrError { false };
+};
+
+// The server side sends the messages, the client side receives them.
+class ConnectionPair {
+public:
+    ConnectionPair()
+    {
+        auto socketPair = Connection::createPlatformConnection();
+        m_serverConnection = Connection::createServerConnection(socketPair.server, m_sender);
+        m_clientConnection = Connection::createClientConnection(socketPair.client, m_receiver);
+        m_serverConnection->open();
+        m_clientConnection->open();
+    }
+
+    ~ConnectionPair()
+    {
+        m_serverConnection->invalidate();
+        m_clientConnection->invalidate();
+    }
+
+    MessageBodyCollector& receiver() { return m_receiver; }
+
+    void setMessageBodyArenaIdleDelay(Seconds delay)
+    {
+        m_serverConnection->setMessageBodyArenaIdleDelayForTesting(delay);
+        m_clientConnection->setMessageBodyArenaIdleDelayForTesting(delay);
+    }
+
+    // Waits for each body to arrive before sending the next one.
+    bool sendBody(const Vector<uint8_t>& body)
+    {
+        auto encoder = std::make_unique<Encoder>("TestReceiver", "TestMessage", 0);
+        *encoder << body;
+        m_receiver.didReceiveMessageOrError = false;
+        if (!m_serverConnection->sendMessage(WTFMove(encoder), { }))
+            return false;
+        Util::run(&m_receiver.didReceiveMessageOrError);
+        return !m_receiver.didReceiveInvalidMessage && !m_receiver.receivedBodies.isEmpty() && m_receiver.receivedBodies.last() == body;
+    }
+
+private:
+    MessageBodyCollector m_sender;
+    MessageBodyCollector m_receiver;
+    RefPtr<Connection> m_serverConnection;
+    RefPtr<Connection> m_clientConnection;
+};
+
+static Vector<uint8_t> makeBody(size_t size, uint8_t seed)
+{
+    Vector<uint8_t> body(size);
+    for (size_t i = 0; i < size; ++i)
+        body[i] = static_cast<uint8_t>(seed + i * 7);
+    return body;
+}
+
+TEST(WebKit2, IPCConnectionSendsBodiesLargerThanMessageMaxSize)
+{
+    ConnectionPair connections;
+    auto statisticsBefore = messageBodyArenaStatistics();
+
+    // Inline, in the message body arena, and in its own shared memory for a body too big for the arena.
+    EXPECT_TRUE(connections.sendBody(makeBody(3 * 1024, 1)));
+    EXPECT_TRUE(connections.sendBody(makeBody(5 * 1024, 2)));
+    EXPECT_TRUE(connections.sendBody(makeBody(100 * 1024, 3)));
+    EXPECT_TRUE(connections.sendBody(makeBody(9 * 1024 * 1024, 4)));
+    EXPECT_TRUE(connections.sendBody(makeBody(5 * 1024, 5)));
+
+    auto statisticsAfter = messageBodyArenaStatistics();
+    EXPECT_EQ(5U, connections.receiver().receivedBodies.size());
+    EXPECT_EQ(3U, statisticsAfter.arenaBodiesSent - statisticsBefore.arenaBodiesSent);
+    EXPECT_EQ(3U, statisticsAfter.arenaBodiesReceived - statisticsBefore.arenaBodiesReceived);
+    EXPECT_EQ(1U, statisticsAfter.standaloneBodiesSent - statisticsBefore.standaloneBodiesSent);
+}
+
+TEST(WebKit2, IPCConnectionReusesMessageBodyArena)
+{
+    ConnectionPair connections;
+    auto statisticsBefore = messageBodyArenaStatistics();
+
+    // Ten bodies wrap around the 1 MB ring a few times. Each one is consumed before the next is sent,
+    // so their space is reused and the ring never has to grow.
+    for (unsigned i = 0; i < 10; ++i)
+        EXPECT_TRUE(connections.sendBody(makeBody(300 * 1024, i)));
+
+    auto statisticsAfter = messageBodyArenaStatistics();
+    EXPECT_EQ(10U, statisticsAfter.arenaBodiesReceived - statisticsBefore.arenaBodiesReceived);
+    EXPECT_EQ(1U, statisticsAfter.arenasCreated - statisticsBefore.arenasCreated);
+    EXPECT_EQ(1U, statisticsAfter.arenasMapped - statisticsBefore.arenasMapped);
+    EXPECT_EQ(0U, statisticsAfter.standaloneBodiesSent - statisticsBefore.standaloneBodiesSent);
+}
+
+TEST(WebKit2, IPCConnectionRetiresIdleMessageBodyArena)
+{
+    ConnectionPair connections;
+    connections.setMessageBodyArenaIdleDelay(50_ms);
+    auto statisticsBefore = messageBodyArenaStatistics();
+
+    for (unsigned i = 0; i < 4; ++i)
+        EXPECT_TRUE(connections.sendBody(makeBody(300 * 1024, i)));
+
+    for (unsigned i = 0; i < 100 && messageBodyArenaStatistics().arenasRetired == statisticsBefore.arenasRetired; ++i)
+        Util::sleep(0.05);
+    EXPECT_EQ(1U, messageBodyArenaStatistics().arenasRetired - statisticsBefore.arenasRetired);
+
+    // The next big body is sent in a new ring, which the receiver maps in place of the retired one.
+    EXPECT_TRUE(connections.sendBody(makeBody(300 * 1024, 4)));
+    EXPECT_TRUE(connections.sendBody(makeBody(300 * 1024, 5)));
+
+    auto statisticsAfter = messageBodyArenaStatistics();
+    EXPECT_EQ(6U, statisticsAfter.arenaBodiesReceived - statisticsBefore.arenaBodiesReceived);
+    EXPECT_EQ(2U, statisticsAfter.arenasCreated - statisticsBefore.arenasCreated);
+    EXPECT_EQ(2U, statisticsAfter.arenasMapped - statisticsBefore.arenasMapped);
+}
+
+} // namespace TestWebKitAPI
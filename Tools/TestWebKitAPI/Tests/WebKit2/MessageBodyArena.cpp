@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <WebKit/MessageBodyArena.h>
+#include <wtf/Vector.h>
+
+using namespace IPC;
+
+namespace TestWebKitAPI {
+
+static Vector<uint8_t> makeBody(size_t size, uint8_t seed)
+{
+    Vector<uint8_t> body(size);
+    for (size_t i = 0; i < size; ++i)
+        body[i] = static_cast<uint8_t>(seed + i);
+    return body;
+}
+
+static bool takeBodyAndCompare(MessageBodyArenaReader& reader, uint64_t position, const Vector<uint8_t>& expected)
+{
+    auto body = reader.takeBody(position, expected.size());
+    return body && !memcmp(body.get(), expected.data(), expected.size());
+}
+
+TEST(WebKit2, MessageBodyArenaRoundTrip)
+{
+    MessageBodyArenaWriter writer;
+    MessageBodyArenaReader reader;
+
+    auto body = makeBody(100 * 1024, 1);
+    uint64_t position;
+    std::optional<Attachment> attachment;
+    ASSERT_TRUE(writer.write(body.data(), body.size(), position, attachment));
+    // The ring is only sent along with the first body.
+    ASSERT_TRUE(!!attachment);
+    ASSERT_TRUE(reader.adoptArena(WTFMove(*attachment)));
+    EXPECT_TRUE(takeBodyAndCompare(reader, position, body));
+
+    auto secondBody = makeBody(200 * 1024, 2);
+    std::optional<Attachment> secondAttachment;
+    ASSERT_TRUE(writer.write(secondBody.data(), secondBody.size(), position, secondAttachment));
+    EXPECT_FALSE(!!secondAttachment);
+    EXPECT_TRUE(takeBodyAndCompare(reader, position, secondBody));
+}
+
+TEST(WebKit2, MessageBodyArenaBodiesAreCopiedOut)
+{
+    MessageBodyArenaWriter writer;
+    MessageBodyArenaReader reader;
+
+    auto body = makeBody(64 * 1024, 3);
+    uint64_t position;
+    std::optional<Attachment> attachment;
+    ASSERT_TRUE(writer.write(body.data(), body.size(), position, attachment));
+    ASSERT_TRUE(reader.adoptArena(WTFMove(*attachment)));
+
+    auto takenBody = reader.takeBody(position, body.size());
+    ASSERT_TRUE(!!takenBody);
+
+    // Writing over the consumed space must not change the body the receiver already has.
+    size_t capacity = writer.capacity();
+    auto filler = makeBody(capacity / 2 - 64 * 1024, 4);
+    for (unsigned i = 0; i < 4; ++i) {
+        std::optional<Attachment> newAttachment;
+        ASSERT_TRUE(writer.write(filler.data(), filler.size(), position, newAttachment));
+        EXPECT_FALSE(!!newAttachment);
+        EXPECT_TRUE(takeBodyAndCompare(reader, position, filler));
+    }
+    EXPECT_EQ(capacity, writer.capacity());
+    EXPECT_FALSE(memcmp(takenBody.get(), body.data(), body.size()));
+}
+
+TEST(WebKit2, MessageBodyArenaRejectsBodiesOutsideRing)
+{
+    MessageBodyArenaWriter writer;
+    MessageBodyArenaReader reader;
+    EXPECT_FALSE(!!reader.takeBody(0, 16));
+
+    auto body = makeBody(16 * 1024, 5);
+    uint64_t position;
+    std::optional<Attachment> attachment;
+    ASSERT_TRUE(writer.write(body.data(), body.size(), position, attachment));
+    ASSERT_TRUE(reader.adoptArena(WTFMove(*attachment)));
+
+    // A body can't wrap around the end of the ring.
+    EXPECT_FALSE(!!reader.takeBody(writer.capacity() - 16, 1024));
+    EXPECT_TRUE(takeBodyAndCompare(reader, position, body));
+}
+
+TEST(WebKit2, MessageBodyArenaGrowsWhenFull)
+{
+    MessageBodyArenaWriter writer;
+    MessageBodyArenaReader reader;
+
+    auto body = makeBody(256 * 1024, 6);
+    uint64_t position;
+    std::optional<Attachment> attachment;
+    ASSERT_TRUE(writer.write(body.data(), body.size(), position, attachment));
+    ASSERT_TRUE(reader.adoptArena(WTFMove(*attachment)));
+    size_t initialCapacity = writer.capacity();
+
+    // Nothing is consumed, so the ring eventually has to be replaced by a bigger one.
+    bool didGrow = false;
+    for (unsigned i = 0; i < 8 && !didGrow; ++i) {
+        std::optional<Attachment> newAttachment;
+        ASSERT_TRUE(writer.write(body.data(), body.size(), position, newAttachment));
+        if (newAttachment) {
+            ASSERT_TRUE(reader.adoptArena(WTFMove(*newAttachment)));
+            didGrow = true;
+        }
+    }
+    EXPECT_TRUE(didGrow);
+    EXPECT_EQ(initialCapacity * 2, writer.capacity());
+    EXPECT_TRUE(takeBodyAndCompare(reader, position, body));
+}
+
+TEST(WebKit2, MessageBodyArenaIsRetiredWhenIdle)
+{
+    MessageBodyArenaWriter writer;
+    MessageBodyArenaReader reader;
+
+    auto body = makeBody(512 * 1024, 7);
+    uint64_t position;
+    std::optional<Attachment> attachment;
+    ASSERT_TRUE(writer.write(body.data(), body.size(), position, attachment));
+    ASSERT_TRUE(reader.adoptArena(WTFMove(*attachment)));
+    size_t initialCapacity = writer.capacity();
+
+    // Grow the ring.
+    std::optional<Attachment> newAttachment;
+    while (!newAttachment) {
+        ASSERT_TRUE(writer.write(body.data(), body.size(), position, newAttachment));
+    }
+    ASSERT_TRUE(reader.adoptArena(WTFMove(*newAttachment)));
+    EXPECT_GT(writer.capacity(), initialCapacity);
+
+    // The ring can't be retired while the receiver hasn't consumed everything.
+    EXPECT_FALSE(reader.releaseIfRetired());
+    EXPECT_FALSE(writer.retireIfConsumed());
+    EXPECT_TRUE(writer.hasArena());
+
+    EXPECT_TRUE(takeBodyAndCompare(reader, position, body));
+    EXPECT_TRUE(writer.retireIfConsumed());
+    EXPECT_FALSE(writer.hasArena());
+    EXPECT_TRUE(reader.releaseIfRetired());
+    EXPECT_FALSE(reader.hasArena());
+
+    // The next body gets a new ring of the initial size.
+    std::optional<Attachment> replacementAttachment;
+    ASSERT_TRUE(writer.write(body.data(), body.size(), position, replacementAttachment));
+    ASSERT_TRUE(!!replacementAttachment);
+    EXPECT_EQ(initialCapacity, writer.capacity());
+    ASSERT_TRUE(reader.adoptArena(WTFMove(*replacementAttachment)));
+    EXPECT_TRUE(takeBodyAndCompare(reader, position, body));
+}
+
+} // namespace TestWebKitAPI
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <WebKit/MessageTelemetry.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/StringConcatenate.h>
+
+using namespace IPC;
+
+namespace TestWebKitAPI {
+
+static uint64_t statisticsValue(const HashMap<String, HashMap<String, uint64_t>>& statistics, const char* messageName, const char* valueName)
+{
+    auto it = statistics.find(messageName);
+    if (it == statistics.end())
+        return 0;
+    return it->value.get(valueName);
+}
+
+TEST(WebKit2, MessageTelemetryRecordsMessages)
+{
+    MessageTelemetry telemetry;
+    telemetry.didSendMessage("TestReceiver", "TestMessage", 100);
+    telemetry.didSendMessage("TestReceiver", "TestMessage", 50);
+    telemetry.didDispatchMessage("TestReceiver", "OtherTestMessage", 20, 2_ms);
+    telemetry.didDispatchMessage("TestReceiver", "OtherTestMessage", 20, 5_ms);
+    telemetry.didBlockOnMessage("TestReceiver", "TestMessage", 3_ms);
+
+    auto statistics = telemetry.statistics();
+    EXPECT_EQ(2U, statistics.size());
+    EXPECT_EQ(2U, statisticsValue(statistics, "TestReceiver.TestMessage", "SentCount"));
+    EXPECT_EQ(150U, statisticsValue(statistics, "TestReceiver.TestMessage", "SentBytes"));
+    EXPECT_EQ(1U, statisticsValue(statistics, "TestReceiver.TestMessage", "BlockedCount"));
+    EXPECT_EQ(1U, statisticsValue(statistics, "TestReceiver.TestMessage", "BlockedUpTo4msCount"));
+    EXPECT_EQ(2U, statisticsValue(statistics, "TestReceiver.OtherTestMessage", "DispatchedCount"));
+    EXPECT_EQ(7000U, statisticsValue(statistics, "TestReceiver.OtherTestMessage", "DispatchTimeMicroseconds"));
+    EXPECT_EQ(5000U, statisticsValue(statistics, "TestReceiver.OtherTestMessage", "MaximumDispatchTimeMicroseconds"));
+}
+
+TEST(WebKit2, MessageTelemetryKeepsCopiesOfMessageNames)
+{
+    MessageTelemetry telemetry;
+
+    // Like a decoded message, the names point to a buffer that goes away after the message is dispatched.
+    {
+        CString messageReceiverName("TestReceiver");
+        CString messageName("TestMessage");
+        telemetry.didDispatchMessage(StringReference(messageReceiverName.data(), messageReceiverName.length()), StringReference(messageName.data(), messageName.length()), 10, 1_ms);
+    }
+
+    telemetry.didDispatchMessage("TestReceiver", "TestMessage", 10, 1_ms);
+    EXPECT_EQ(2U, statisticsValue(telemetry.statistics(), "TestReceiver.TestMessage", "DispatchedCount"));
+}
+
+TEST(WebKit2, MessageTelemetryBoundsMessageTypes)
+{
+    MessageTelemetry telemetry;
+
+    size_t messageCount = MessageTelemetry::maximumMessageTypeCount * 2;
+    for (size_t i = 0; i < messageCount; ++i) {
+        CString messageName = makeString("MadeUpMessage", String::number(i)).utf8();
+        telemetry.didDispatchMessage("TestReceiver", StringReference(messageName.data(), messageName.length()), 10, 1_ms);
+    }
+
+    auto statistics = telemetry.statistics();
+    EXPECT_EQ(MessageTelemetry::maximumMessageTypeCount, statistics.size());
+    EXPECT_EQ(1U, statisticsValue(statistics, "TestReceiver.MadeUpMessage0", "DispatchedCount"));
+    EXPECT_EQ(messageCount - (MessageTelemetry::maximumMessageTypeCount - 1), statisticsValue(statistics, "Other.Other", "DispatchedCount"));
+}
+
+TEST(WebKit2, MessageTelemetryCountsLongNamesAsOther)
+{
+    MessageTelemetry telemetry;
+
+    Vector<char> longName(MessageTelemetry::maximumMessageNameLength + 1, 'a');
+    telemetry.didDispatchMessage("TestReceiver", StringReference(longName.data(), longName.size()), 10, 1_ms);
+    telemetry.didDispatchMessage(StringReference(longName.data(), longName.size()), "TestMessage", 10, 1_ms);
+
+    auto statistics = telemetry.statistics();
+    EXPECT_EQ(1U, statistics.size());
+    EXPECT_EQ(2U, statisticsValue(statistics, "Other.Other", "DispatchedCount"));
+}
+
+TEST(WebKit2, MessageTelemetryProcessStatisticsIncludeClosedConnections)
+{
+    MessageTelemetry liveConnectionTelemetry;
+    liveConnectionTelemetry.didSendMessage("ProcessStatisticsTestReceiver", "TestMessage", 10);
+
+    {
+        MessageTelemetry closedConnectionTelemetry;
+        closedConnectionTelemetry.didSendMessage("ProcessStatisticsTestReceiver", "TestMessage", 20);
+    }
+
+    auto statistics = MessageTelemetry::processStatistics();
+    EXPECT_EQ(2U, statisticsValue(statistics, "ProcessStatisticsTestReceiver.TestMessage", "SentCount"));
+    EXPECT_EQ(30U, statisticsValue(statistics, "ProcessStatisticsTestReceiver.TestMessage", "SentBytes"));
+
+    MessageTelemetry::clearProcessStatistics();
+    EXPECT_EQ(0U, statisticsValue(MessageTelemetry::processStatistics(), "ProcessStatisticsTestReceiver.TestMessage", "SentCount"));
+    EXPECT_TRUE(liveConnectionTelemetry.statistics().isEmpty());
+}
+
+} // namespace TestWebKitAPI
@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <WebCore/ResourceRequest.h>
+#include <WebCore/URL.h>
+#include <WebKit/NetworkLoadScheduler.h>
+#include <wtf/Vector.h>
+
+using namespace WebCore;
+using namespace WebKit;
+
+namespace TestWebKitAPI {
+
+class TestLoad final : public NetworkLoadSchedulerClient {
+public:
+    TestLoad(const char* url, ResourceLoadPriority priority = ResourceLoadPriority::Medium, uint64_t pageID = 1, bool isMainResource = false)
+        : m_request(URL(URL(), url))
+        , m_pageID(pageID)
+        , m_isMainResource(isMainResource)
+    {
+        m_request.setPriority(priority);
+    }
+
+    void schedule(NetworkLoadScheduler& scheduler) { scheduler.schedule(*this, m_request, m_pageID, m_isMainResource); }
+    bool isStarted() const { return m_isStarted; }
+
+private:
+    void startScheduledLoad(Seconds) override { m_isStarted = true; }
+
+    ResourceRequest m_request;
+    uint64_t m_pageID;
+    bool m_isMainResource;
+    bool m_isStarted { false };
+};
+
+static void unscheduleAll(NetworkLoadScheduler& scheduler, Vector<std::unique_ptr<TestLoad>>& loads)
+{
+    for (auto& load : loads)
+        scheduler.unschedule(*load);
+    loads.clear();
+}
+
+TEST(WebKit2, NetworkLoadSchedulerPerHostLimit)
+{
+    NetworkLoadScheduler scheduler;
+    Vector<std::unique_ptr<TestLoad>> loads;
+    for (unsigned i = 0; i < NetworkLoadScheduler::maximumActiveLoadsPerHost + 2; ++i) {
+        loads.append(std::make_unique<TestLoad>("http://a.test/"));
+        loads.last()->schedule(scheduler);
+    }
+    EXPECT_EQ(NetworkLoadScheduler::maximumActiveLoadsPerHost, scheduler.activeLoadCount());
+    EXPECT_EQ(2u, scheduler.pendingLoadCount());
+    EXPECT_FALSE(loads.last()->isStarted());
+
+    // Another host is not affected by the first one being busy.
+    TestLoad otherHost("http://b.test/");
+    otherHost.schedule(scheduler);
+    EXPECT_TRUE(otherHost.isStarted());
+    scheduler.unschedule(otherHost);
+
+    // Finishing a load on the busy host starts the next one queued for it.
+    scheduler.unschedule(*loads.first());
+    loads.remove(0);
+    EXPECT_TRUE(loads[NetworkLoadScheduler::maximumActiveLoadsPerHost - 1]->isStarted());
+    EXPECT_EQ(1u, scheduler.pendingLoadCount());
+
+    unscheduleAll(scheduler, loads);
+    EXPECT_EQ(0u, scheduler.activeLoadCount());
+    EXPECT_EQ(0u, scheduler.pendingLoadCount());
+}
+
+TEST(WebKit2, NetworkLoadSchedulerStartsHighestPriorityFirst)
+{
+    NetworkLoadScheduler scheduler;
+    Vector<std::unique_ptr<TestLoad>> loads;
+    for (unsigned i = 0; i < NetworkLoadScheduler::maximumActiveLoads; ++i) {
+        loads.append(std::make_unique<TestLoad>(makeString("http://host", String::number(i % 4), ".test/").utf8().data()));
+        loads.last()->schedule(scheduler);
+    }
+    EXPECT_EQ(NetworkLoadScheduler::maximumActiveLoads, scheduler.activeLoadCount());
+
+    TestLoad low("http://low.test/", ResourceLoadPriority::Low, 2);
+    TestLoad medium("http://medium.test/", ResourceLoadPriority::Medium, 2);
+    TestLoad high("http://high.test/", ResourceLoadPriority::High, 2);
+    low.schedule(scheduler);
+    medium.schedule(scheduler);
+    high.schedule(scheduler);
+    EXPECT_EQ(3u, scheduler.pendingLoadCount());
+
+    scheduler.unschedule(*loads.takeLast());
+    EXPECT_TRUE(high.isStarted());
+    EXPECT_FALSE(medium.isStarted());
+    EXPECT_FALSE(low.isStarted());
+
+    scheduler.unschedule(*loads.takeLast());
+    EXPECT_TRUE(medium.isStarted());
+    EXPECT_FALSE(low.isStarted());
+
+    // A load that is unscheduled while pending is never started.
+    scheduler.unschedule(low);
+    scheduler.unschedule(*loads.takeLast());
+    EXPECT_FALSE(low.isStarted());
+    EXPECT_EQ(0u, scheduler.pendingLoadCount());
+
+    scheduler.unschedule(high);
+    scheduler.unschedule(medium);
+    unscheduleAll(scheduler, loads);
+}
+
+TEST(WebKit2, NetworkLoadSchedulerMainResourceIsNeverHeldBack)
+{
+    NetworkLoadScheduler scheduler;
+    Vector<std::unique_ptr<TestLoad>> loads;
+    for (unsigned i = 0; i < NetworkLoadScheduler::maximumActiveLoadsPerHost; ++i) {
+        loads.append(std::make_unique<TestLoad>("http://a.test/"));
+        loads.last()->schedule(scheduler);
+    }
+
+    TestLoad mainResource("http://a.test/", ResourceLoadPriority::VeryHigh, 2, true);
+    mainResource.schedule(scheduler);
+    EXPECT_TRUE(mainResource.isStarted());
+
+    scheduler.unschedule(mainResource);
+    unscheduleAll(scheduler, loads);
+}
+
+TEST(WebKit2, NetworkLoadSchedulerHoldsBackLowPriorityLoadsUntilMainResourceResponse)
+{
+    NetworkLoadScheduler scheduler;
+
+    TestLoad mainResource("http://a.test/", ResourceLoadPriority::VeryHigh, 1, true);
+    mainResource.schedule(scheduler);
+
+    TestLoad firstImage("http://images.test/1", ResourceLoadPriority::Low);
+    TestLoad secondImage("http://images.test/2", ResourceLoadPriority::Low);
+    TestLoad thirdImage("http://other-images.test/3", ResourceLoadPriority::VeryLow);
+    TestLoad otherPageImage("http://images.test/4", ResourceLoadPriority::Low, 2);
+    firstImage.schedule(scheduler);
+    secondImage.schedule(scheduler);
+    thirdImage.schedule(scheduler);
+    otherPageImage.schedule(scheduler);
+
+    EXPECT_TRUE(firstImage.isStarted());
+    EXPECT_FALSE(secondImage.isStarted());
+    EXPECT_FALSE(thirdImage.isStarted());
+    EXPECT_TRUE(otherPageImage.isStarted());
+
+    // Finishing the one low priority load allowed while critical resources are loading lets the next one in.
+    scheduler.unschedule(firstImage);
+    EXPECT_TRUE(secondImage.isStarted());
+    EXPECT_FALSE(thirdImage.isStarted());
+
+    // The main resource stops holding back the page's loads once its response is in, not when it finishes.
+    scheduler.didReceiveResponse(mainResource);
+    EXPECT_TRUE(thirdImage.isStarted());
+    EXPECT_EQ(0u, scheduler.pendingLoadCount());
+
+    scheduler.unschedule(mainResource);
+    scheduler.unschedule(secondImage);
+    scheduler.unschedule(thirdImage);
+    scheduler.unschedule(otherPageImage);
+}
+
+TEST(WebKit2, NetworkLoadSchedulerUnscheduleHeldBackLoad)
+{
+    NetworkLoadScheduler scheduler;
+
+    TestLoad script("http://a.test/script.js", ResourceLoadPriority::High);
+    script.schedule(scheduler);
+
+    TestLoad firstImage("http://images.test/1", ResourceLoadPriority::Low);
+    TestLoad secondImage("http://images.test/2", ResourceLoadPriority::Low);
+    firstImage.schedule(scheduler);
+    secondImage.schedule(scheduler);
+    EXPECT_FALSE(secondImage.isStarted());
+
+    scheduler.unschedule(secondImage);
+    EXPECT_FALSE(scheduler.isScheduled(secondImage));
+    EXPECT_EQ(0u, scheduler.pendingLoadCount());
+
+    scheduler.unschedule(script);
+    scheduler.unschedule(firstImage);
+    EXPECT_FALSE(secondImage.isStarted());
+    EXPECT_EQ(0u, scheduler.activeLoadCount());
+}
+
+} // namespace TestWebKitAPI
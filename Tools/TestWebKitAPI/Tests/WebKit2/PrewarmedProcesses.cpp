@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#if WK_HAVE_C_SPI
+
+#include "PlatformUtilities.h"
+#include "PlatformWebView.h"
+#include "Test.h"
+#include <WebKit/WKContextConfigurationRef.h>
+#include <WebKit/WKContextPrivate.h>
+#include <WebKit/WKPagePrivate.h>
+#include <WebKit/WKRetainPtr.h>
+#include <wtf/RunLoop.h>
+
+namespace TestWebKitAPI {
+
+static bool didFinishLoad;
+
+static void didFinishLoadForFrame(WKPageRef, WKFrameRef, WKTypeRef, const void*)
+{
+    didFinishLoad = true;
+}
+
+static pid_t loadAboutBlank(PlatformWebView& webView)
+{
+    WKPageLoaderClientV0 loaderClient;
+    memset(&loaderClient, 0, sizeof(loaderClient));
+    loaderClient.base.version = 0;
+    loaderClient.didFinishLoadForFrame = didFinishLoadForFrame;
+    WKPageSetPageLoaderClient(webView.page(), &loaderClient.base);
+
+    didFinishLoad = false;
+    WKPageLoadURL(webView.page(), adoptWK(WKURLCreateWithUTF8CString("about:blank")).get());
+    Util::run(&didFinishLoad);
+    return WKPageGetProcessIdentifier(webView.page());
+}
+
+static WKContextPrewarmedProcessStatistics prewarmedProcessStatistics(WKContextRef context)
+{
+    WKContextPrewarmedProcessStatistics statistics;
+    WKContextGetPrewarmedProcessStatistics(context, &statistics);
+    return statistics;
+}
+
+static void spinRunLoop(Seconds duration)
+{
+    bool done = false;
+    RunLoop::main().dispatchAfter(duration, [&done] {
+        done = true;
+    });
+    Util::run(&done);
+}
+
+static void waitForPrewarmedProcesses(WKContextRef context, unsigned count)
+{
+    while (prewarmedProcessStatistics(context).prewarmedProcessCount < count)
+        spinRunLoop(50_ms);
+}
+
+static WKRetainPtr<WKContextRef> createContext(unsigned prewarmedProcessCount, unsigned maximumProcessCount)
+{
+    auto configuration = adoptWK(WKContextConfigurationCreate());
+    WKContextConfigurationSetPrewarmedProcessCount(configuration.get(), prewarmedProcessCount);
+    auto context = adoptWK(WKContextCreateWithConfiguration(configuration.get()));
+    WKContextSetMaximumNumberOfProcesses(context.get(), maximumProcessCount);
+    return context;
+}
+
+TEST(WebKit2, PrewarmedProcessIsUsedByNextPage)
+{
+    auto context = createContext(1, 4);
+
+    // The pool starts filling when the first page is created.
+    PlatformWebView firstWebView(context.get());
+    pid_t firstProcess = loadAboutBlank(firstWebView);
+    EXPECT_EQ(0u, prewarmedProcessStatistics(context.get()).hitCount);
+    EXPECT_EQ(1u, prewarmedProcessStatistics(context.get()).missCount);
+
+    waitForPrewarmedProcesses(context.get(), 1);
+
+    PlatformWebView secondWebView(context.get());
+    pid_t secondProcess = loadAboutBlank(secondWebView);
+    EXPECT_NE(firstProcess, secondProcess);
+
+    auto statistics = prewarmedProcessStatistics(context.get());
+    EXPECT_EQ(1u, statistics.hitCount);
+    EXPECT_EQ(1u, statistics.missCount);
+    EXPECT_GT(statistics.timeSaved, 0);
+}
+
+TEST(WebKit2, PrewarmedProcessesDoNotCountTowardProcessLimit)
+{
+    auto context = createContext(2, 2);
+
+    PlatformWebView firstWebView(context.get());
+    pid_t firstProcess = loadAboutBlank(firstWebView);
+
+    // Both prewarmed processes are launched, even though there are then more processes than the limit.
+    waitForPrewarmedProcesses(context.get(), 2);
+
+    PlatformWebView secondWebView(context.get());
+    pid_t secondProcess = loadAboutBlank(secondWebView);
+    EXPECT_NE(firstProcess, secondProcess);
+    EXPECT_EQ(1u, prewarmedProcessStatistics(context.get()).prewarmedProcessCount);
+
+    // Pages have reached the limit, so the next one shares a process with them instead of taking the
+    // idle prewarmed process.
+    PlatformWebView thirdWebView(context.get());
+    pid_t thirdProcess = loadAboutBlank(thirdWebView);
+    EXPECT_TRUE(thirdProcess == firstProcess || thirdProcess == secondProcess);
+    EXPECT_EQ(1u, prewarmedProcessStatistics(context.get()).prewarmedProcessCount);
+    EXPECT_EQ(1u, prewarmedProcessStatistics(context.get()).hitCount);
+}
+
+TEST(WebKit2, PrewarmedProcessesAreNotLaunchedAtProcessLimit)
+{
+    auto context = createContext(1, 1);
+
+    PlatformWebView firstWebView(context.get());
+    pid_t firstProcess = loadAboutBlank(firstWebView);
+
+    // Give the pool a chance to refill, it must not since no page could use the process.
+    spinRunLoop(1500_ms);
+    EXPECT_EQ(0u, prewarmedProcessStatistics(context.get()).prewarmedProcessCount);
+
+    PlatformWebView secondWebView(context.get());
+    EXPECT_EQ(firstProcess, loadAboutBlank(secondWebView));
+}
+
+} // namespace TestWebKitAPI
+
+#endif
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#if WK_HAVE_C_SPI
+
+#include "PlatformUtilities.h"
+#include "PlatformWebView.h"
+#include "Test.h"
+#include <WebKit/WKArray.h>
+#include <WebKit/WKDictionary.h>
+#include <WebKit/WKNumber.h>
+#include <WebKit/WKSerializedScriptValue.h>
+
+namespace TestWebKitAPI {
+
+static bool didFinishLoad;
+static bool didRunJavaScript;
+static bool didGetStatistics;
+
+static void didFinishLoadForFrame(WKPageRef, WKFrameRef, WKTypeRef, const void*)
+{
+    didFinishLoad = true;
+}
+
+static void javaScriptCallback(WKSerializedScriptValueRef, WKErrorRef error, void*)
+{
+    EXPECT_NULL(error);
+    didRunJavaScript = true;
+}
+
+static bool getUInt64(WKDictionaryRef dictionary, const char* key, uint64_t& value)
+{
+    WKTypeRef item = WKDictionaryGetItemForKey(dictionary, Util::toWK(key).get());
+    if (!item || WKGetTypeID(item) != WKUInt64GetTypeID())
+        return false;
+    value = WKUInt64GetValue(static_cast<WKUInt64Ref>(item));
+    return true;
+}
+
+static void getStatisticsCallback(WKDictionaryRef statistics, WKErrorRef error, void*)
+{
+    EXPECT_NULL(error);
+    ASSERT_NOT_NULL(statistics);
+
+    WKTypeRef events = WKDictionaryGetItemForKey(statistics, Util::toWK("JavaScriptGarbageCollectionEvents").get());
+    ASSERT_NOT_NULL(events);
+    ASSERT_EQ(WKArrayGetTypeID(), WKGetTypeID(events));
+    size_t eventCount = WKArrayGetSize(static_cast<WKArrayRef>(events));
+    EXPECT_GT(eventCount, 0U);
+    for (size_t i = 0; i < eventCount; ++i) {
+        WKTypeRef event = WKArrayGetItemAtIndex(static_cast<WKArrayRef>(events), i);
+        ASSERT_EQ(WKDictionaryGetTypeID(), WKGetTypeID(event));
+        uint64_t startTime = 0;
+        EXPECT_TRUE(getUInt64(static_cast<WKDictionaryRef>(event), "StartTimeMicrosecondsSinceEpoch", startTime));
+        EXPECT_GT(startTime, 0U);
+        uint64_t duration;
+        EXPECT_TRUE(getUInt64(static_cast<WKDictionaryRef>(event), "DurationMicroseconds", duration));
+    }
+
+    // Whether the script's RegExp fell back to the interpreter depends on what the RegExp JIT supports on
+    // this platform, but both counters are always reported.
+    uint64_t fallbackMatchCount = 0;
+    uint64_t jitCodeFailureCount = 0;
+    EXPECT_TRUE(getUInt64(statistics, "JavaScriptRegExpInterpreterFallbackMatchCount", fallbackMatchCount));
+    EXPECT_TRUE(getUInt64(statistics, "JavaScriptRegExpJITCodeFailureCount", jitCodeFailureCount));
+    EXPECT_GE(fallbackMatchCount, jitCodeFailureCount);
+
+    didGetStatistics = true;
+}
+
+TEST(WebKit2, WebContentStatistics)
+{
+    WKRetainPtr<WKContextRef> context = adoptWK(WKContextCreate());
+    PlatformWebView webView(context.get());
+
+    WKPageLoaderClientV0 loaderClient;
+    memset(&loaderClient, 0, sizeof(loaderClient));
+    loaderClient.base.version = 0;
+    loaderClient.didFinishLoadForFrame = didFinishLoadForFrame;
+    WKPageSetPageLoaderClient(webView.page(), &loaderClient.base);
+
+    WKPageLoadURL(webView.page(), adoptWK(WKURLCreateWithUTF8CString("about:blank")).get());
+    Util::run(&didFinishLoad);
+
+    // Allocate enough to collect, and match a RegExp with generic parentheses on a subject long enough
+    // to exhaust the RegExp JIT parentheses context stack.
+    const char* script =
+        "var objects = [];"
+        "for (var i = 0; i < 100000; ++i) objects.push({ index: i });"
+        "objects = null;"
+        "/(a|b)*c/.test('ab'.repeat(5000) + 'c');";
+    WKPageRunJavaScriptInMainFrame(webView.page(), Util::toWK(script).get(), nullptr, javaScriptCallback);
+    Util::run(&didRunJavaScript);
+
+    // The collection is done before the web process runs the next script.
+    WKContextGarbageCollectJavaScriptObjects(context.get());
+    didRunJavaScript = false;
+    WKPageRunJavaScriptInMainFrame(webView.page(), Util::toWK("0").get(), nullptr, javaScriptCallback);
+    Util::run(&didRunJavaScript);
+
+    WKContextGetStatisticsWithOptions(context.get(), kWKStatisticsOptionsWebContent, nullptr, getStatisticsCallback);
+    Util::run(&didGetStatistics);
+}
+
+} // namespace TestWebKitAPI
+
+#endif
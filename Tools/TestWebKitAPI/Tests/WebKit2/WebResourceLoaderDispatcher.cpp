@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <WebCore/NetworkLoadMetrics.h>
+#include <WebCore/ResourceError.h>
+#include <WebKit/BorrowedDataReference.h>
+#include <WebKit/WebResourceLoaderDispatcher.h>
+#include <wtf/text/StringBuilder.h>
+#include <wtf/threads/BinarySemaphore.h>
+
+using namespace WebCore;
+using namespace WebKit;
+
+namespace TestWebKitAPI {
+
+class RecordingClient final : public WebResourceLoaderDispatcher::Client {
+public:
+    void didReceiveData(uint64_t resourceLoadIdentifier, Ref<SharedBuffer>&& data, int64_t) override
+    {
+        record(resourceLoadIdentifier, "data:");
+        m_events.append(data->data(), data->size());
+    }
+
+    void didFinishResourceLoad(uint64_t resourceLoadIdentifier, const NetworkLoadMetrics&) override
+    {
+        record(resourceLoadIdentifier, "finish");
+    }
+
+    void didFailResourceLoad(uint64_t resourceLoadIdentifier, const ResourceError&) override
+    {
+        record(resourceLoadIdentifier, "fail");
+    }
+
+    String events() const { return m_events.toString(); }
+
+private:
+    void record(uint64_t resourceLoadIdentifier, const char* event)
+    {
+        if (!m_events.isEmpty())
+            m_events.append(' ');
+        m_events.appendNumber(resourceLoadIdentifier);
+        m_events.append(' ');
+        m_events.append(event);
+    }
+
+    StringBuilder m_events;
+};
+
+static void receiveData(WebResourceLoaderDispatcher& dispatcher, uint64_t resourceLoadIdentifier, const char* data)
+{
+    dispatcher.didReceiveData(resourceLoadIdentifier, IPC::DataReference(reinterpret_cast<const uint8_t*>(data), strlen(data)), strlen(data));
+}
+
+TEST(WebKit2, WebResourceLoaderDispatcherKeepsOrderAcrossLoads)
+{
+    RecordingClient client;
+    auto dispatcher = WebResourceLoaderDispatcher::create(client);
+
+    dispatcher->queue().dispatch([dispatcher = dispatcher.copyRef()] {
+        receiveData(dispatcher.get(), 1, "a");
+        receiveData(dispatcher.get(), 1, "b");
+        receiveData(dispatcher.get(), 2, "c");
+        dispatcher->didFinishResourceLoad(2, NetworkLoadMetrics());
+        receiveData(dispatcher.get(), 1, "d");
+        dispatcher->didFailResourceLoad(1, ResourceError());
+        receiveData(dispatcher.get(), 3, "e");
+        dispatcher->didFinishResourceLoad(3, NetworkLoadMetrics());
+    });
+    dispatcher->dispatchEventsReceivedEarlier();
+
+    // Only consecutive chunks of a load are coalesced, so no event overtakes an event of another load.
+    EXPECT_EQ(String("1 data:ab 2 data:c 2 finish 1 data:d 1 fail 3 data:e 3 finish"), client.events());
+}
+
+TEST(WebKit2, WebResourceLoaderDispatcherDeliversEventsBeforeMainThreadMessages)
+{
+    RecordingClient client;
+    auto dispatcher = WebResourceLoaderDispatcher::create(client);
+
+    // Keep the queue busy, so that the messages are still waiting to be handled when the main thread
+    // is about to dispatch the next message of the load.
+    BinarySemaphore queueCanRun;
+    dispatcher->queue().dispatch([&queueCanRun] {
+        queueCanRun.wait(WallTime::infinity());
+    });
+    dispatcher->queue().dispatch([dispatcher = dispatcher.copyRef()] {
+        receiveData(dispatcher.get(), 1, "a");
+        dispatcher->didFinishResourceLoad(1, NetworkLoadMetrics());
+    });
+    EXPECT_TRUE(client.events().isEmpty());
+
+    queueCanRun.signal();
+    dispatcher->dispatchEventsReceivedEarlier();
+    EXPECT_EQ(String("1 data:a 1 finish"), client.events());
+
+    // Nothing is delivered twice when the main thread gets to the events on its own.
+    dispatcher->dispatchEventsReceivedEarlier();
+    EXPECT_EQ(String("1 data:a 1 finish"), client.events());
+}
+
+} // namespace TestWebKitAPI
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <WebKit/ReadBufferPool.h>
+
+using namespace WebKit;
+
+namespace TestWebKitAPI {
+
+TEST(WebKit2, ReadBufferPoolSizeClasses)
+{
+    EXPECT_EQ(8u * 1024, ReadBufferPool::bufferSizeFor(0));
+    EXPECT_EQ(8u * 1024, ReadBufferPool::bufferSizeFor(8 * 1024));
+    EXPECT_EQ(16u * 1024, ReadBufferPool::bufferSizeFor(10000));
+    EXPECT_EQ(64u * 1024, ReadBufferPool::bufferSizeFor(40 * 1024));
+    EXPECT_EQ(256u * 1024, ReadBufferPool::bufferSizeFor(256 * 1024));
+    EXPECT_EQ(256u * 1024, ReadBufferPool::bufferSizeFor(1024 * 1024));
+}
+
+TEST(WebKit2, ReadBufferPoolReusesBuffersWithinSizeClass)
+{
+    ReadBufferPool pool;
+
+    Vector<char> buffer = pool.take(10000);
+    EXPECT_EQ(16u * 1024, buffer.capacity());
+    buffer.resize(10000);
+    const char* data = buffer.data();
+
+    pool.recycle(WTFMove(buffer));
+    EXPECT_EQ(1u, pool.pooledBufferCount());
+
+    // A different read size that rounds up to the same class gets the same buffer back, empty.
+    Vector<char> reused = pool.take(16 * 1024);
+    EXPECT_EQ(data, reused.data());
+    EXPECT_EQ(0u, reused.size());
+    EXPECT_EQ(0u, pool.pooledBufferCount());
+
+    // A read size from another class does not.
+    pool.recycle(WTFMove(reused));
+    Vector<char> other = pool.take(32 * 1024);
+    EXPECT_EQ(32u * 1024, other.capacity());
+    EXPECT_EQ(1u, pool.pooledBufferCount());
+}
+
+TEST(WebKit2, ReadBufferPoolRejectsForeignBuffers)
+{
+    ReadBufferPool pool;
+
+    Vector<char> foreign;
+    foreign.reserveInitialCapacity(10000);
+    pool.recycle(WTFMove(foreign));
+    pool.recycle(Vector<char>());
+    EXPECT_EQ(0u, pool.pooledBufferCount());
+}
+
+TEST(WebKit2, ReadBufferPoolIsBounded)
+{
+    ReadBufferPool pool;
+
+    Vector<Vector<char>> buffers;
+    for (size_t i = 0; i < ReadBufferPool::maximumBuffersPerSizeClass + 2; ++i)
+        buffers.append(pool.take(8 * 1024));
+    for (auto& buffer : buffers)
+        pool.recycle(WTFMove(buffer));
+    EXPECT_EQ(ReadBufferPool::maximumBuffersPerSizeClass, pool.pooledBufferCount());
+
+    pool.clear();
+    EXPECT_EQ(0u, pool.pooledBufferCount());
+}
+
+} // namespace TestWebKitAPI
@@ -351,6 +351,48 @@ static void testCookieManagerEphemeral(CookieManagerTest* test, gconstpointer)
     g_main_loop_run(test->m_mainLoop);
 }
 
+static GUniquePtr<char> documentCookie(CookieManagerTest* test, const char* script)
+{
+    GUniqueOutPtr<GError> error;
+    WebKitJavascriptResult* javascriptResult = test->runJavaScriptAndWaitUntilFinished(script, &error.outPtr());
+    g_assert(javascriptResult);
+    g_assert(!error.get());
+    return GUniquePtr<char>(WebViewTest::javascriptResultToCString(javascriptResult));
+}
+
+static void testCookieManagerDOMCookieCache(CookieManagerTest* test, gconstpointer)
+{
+    test->setAcceptPolicy(WEBKIT_COOKIE_POLICY_ACCEPT_ALWAYS);
+    test->loadURI(kServer->getURIForPath("/dom-cookies.html").data());
+    test->waitUntilLoadFinished();
+
+    // The web process caches the first read.
+    GUniquePtr<char> cookies = documentCookie(test, "document.cookie");
+    g_assert_cmpstr(cookies.get(), ==, "visible=1");
+    cookies = documentCookie(test, "document.cookie");
+    g_assert_cmpstr(cookies.get(), ==, "visible=1");
+
+    // An HttpOnly cookie replacing the cached one is not visible to the document anymore, even
+    // when read right after the synchronous load that set it.
+    cookies = documentCookie(test,
+        "var request = new XMLHttpRequest();"
+        "request.open('GET', '/set-http-only', false);"
+        "request.send();"
+        "document.cookie");
+    g_assert(!g_strstr_len(cookies.get(), -1, "visible"));
+
+    // Cached cookies are not visible after their expiration date.
+    cookies = documentCookie(test,
+        "var request = new XMLHttpRequest();"
+        "request.open('GET', '/set-expiring', false);"
+        "request.send();"
+        "document.cookie");
+    g_assert_cmpstr(cookies.get(), ==, "expiring=1");
+    test->wait(2);
+    cookies = documentCookie(test, "document.cookie");
+    g_assert(!g_strstr_len(cookies.get(), -1, "expiring"));
+}
+
 static void serverCallback(SoupServer* server, SoupMessage* message, const char* path, GHashTable*, SoupClientContext*, gpointer)
 {
     if (message->method != SOUP_METHOD_GET) {
@@ -365,6 +407,14 @@ static void serverCallback(SoupServer* server, SoupMessage* message, const char*
         soup_message_body_append(message->response_body, SOUP_MEMORY_TAKE, indexHtml, strlen(indexHtml));
     } else if (g_str_equal(path, "/image.png"))
         soup_message_headers_replace(message->response_headers, "Set-Cookie", "baz=qux; Max-Age=60");
+    else if (g_str_equal(path, "/dom-cookies.html")) {
+        static const char* domCookiesHtml = "<html><body>DOM cookies</body></html>";
+        soup_message_headers_replace(message->response_headers, "Set-Cookie", "visible=1; Max-Age=60");
+        soup_message_body_append(message->response_body, SOUP_MEMORY_STATIC, domCookiesHtml, strlen(domCookiesHtml));
+    } else if (g_str_equal(path, "/set-http-only"))
+        soup_message_headers_replace(message->response_headers, "Set-Cookie", "visible=2; HttpOnly; Max-Age=60");
+    else if (g_str_equal(path, "/set-expiring"))
+        soup_message_headers_replace(message->response_headers, "Set-Cookie", "expiring=1; Max-Age=1");
     else
         soup_message_set_status(message, SOUP_STATUS_NOT_FOUND);
     soup_message_body_complete(message->response_body);
@@ -380,6 +430,7 @@ void beforeAll()
     CookieManagerTest::add("WebKitCookieManager", "cookies-changed", testCookieManagerCookiesChanged);
     CookieManagerTest::add("WebKitCookieManager", "persistent-storage", testCookieManagerPersistentStorage);
     CookieManagerTest::add("WebKitCookieManager", "ephemeral", testCookieManagerEphemeral);
+    CookieManagerTest::add("WebKitCookieManager", "dom-cookie-cache", testCookieManagerDOMCookieCache);
 }
 
 void afterAll()
@@ -747,6 +747,44 @@ static void addCacheHTTPHeadersToResponse(SoupMessage* message)
     soup_date_free(soupDate);
 }
 
+static void testWebViewBlobRangeRequest(WebViewTest* test, gconstpointer)
+{
+    test->loadHtml("<html><body></body></html>", kServer->getURIForPath("/").data());
+    test->waitUntilLoadFinished();
+
+    GUniqueOutPtr<GError> error;
+    WebKitJavascriptResult* javascriptResult = test->runJavaScriptAndWaitUntilFinished(
+        "function readBlobRange(parts, range) {"
+        "    var xhr = new XMLHttpRequest();"
+        "    xhr.open('GET', URL.createObjectURL(new Blob(parts)), false);"
+        "    xhr.setRequestHeader('Range', 'bytes=' + range);"
+        "    xhr.send();"
+        "    return xhr.status + ' ' + xhr.responseText;"
+        "}", &error.outPtr());
+    g_assert(javascriptResult);
+    g_assert(!error.get());
+
+    // Ranges starting in the middle of a data item, spanning several of them.
+    javascriptResult = test->runJavaScriptAndWaitUntilFinished("readBlobRange(['0123456789', 'abcdefghij', 'ABCDEFGHIJ'], '5-24');", &error.outPtr());
+    g_assert(javascriptResult);
+    g_assert(!error.get());
+    GUniquePtr<char> valueString(WebViewTest::javascriptResultToCString(javascriptResult));
+    g_assert_cmpstr(valueString.get(), ==, "206 56789abcdefghijABCDE");
+
+    javascriptResult = test->runJavaScriptAndWaitUntilFinished("readBlobRange(['0123456789', 'abcdefghij', 'ABCDEFGHIJ'], '25-');", &error.outPtr());
+    g_assert(javascriptResult);
+    g_assert(!error.get());
+    valueString.reset(WebViewTest::javascriptResultToCString(javascriptResult));
+    g_assert_cmpstr(valueString.get(), ==, "206 FGHIJ");
+
+    // Big parts might be read from a memory mapped file, read across the end of one.
+    javascriptResult = test->runJavaScriptAndWaitUntilFinished("readBlobRange(['xyz', 'a'.repeat(2 * 1024 * 1024), 'tail'], '2097152-');", &error.outPtr());
+    g_assert(javascriptResult);
+    g_assert(!error.get());
+    valueString.reset(WebViewTest::javascriptResultToCString(javascriptResult));
+    g_assert_cmpstr(valueString.get(), ==, "206 aaatail");
+}
+
 static void serverCallback(SoupServer* server, SoupMessage* message, const char* path, GHashTable*, SoupClientContext*, gpointer)
 {
     if (message->method != SOUP_METHOD_GET) {
@@ -866,6 +904,7 @@ void beforeAll()
     ResourcesTest::add("WebKitWebResource", "get-data", testWebResourceGetData);
     SingleResourceLoadTest::add("WebKitWebView", "history-cache", testWebViewResourcesHistoryCache);
     SendRequestTest::add("WebKitWebPage", "send-request", testWebResourceSendRequest);
+    WebViewTest::add("WebKitWebView", "blob-range-request", testWebViewBlobRangeRequest);
 #if SOUP_CHECK_VERSION(2, 49, 91)
     SyncRequestOnMaxConnsTest::add("WebKitWebView", "sync-request-on-max-conns", testWebViewSyncRequestOnMaxConns);
 #endif
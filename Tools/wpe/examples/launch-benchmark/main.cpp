@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 WPE WebKit contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY APPLE INC. AND ITS CONTRIBUTORS ``AS IS''
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL APPLE INC. OR ITS CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Measures the time from the creation of a view to the first visually non-empty layout of a simple page,
+// each view in a new web process. Run it with WEBKIT_DISABLE_PROCESS_ZYGOTE=1 in the environment to
+// compare with processes spawned from the executable.
+
+#include <WebKit/WKContext.h>
+#include <WebKit/WKPage.h>
+#include <WebKit/WKPageConfigurationRef.h>
+#include <WebKit/WKPageGroup.h>
+#include <WebKit/WKRetainPtr.h>
+#include <WebKit/WKString.h>
+#include <WebKit/WKView.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <glib.h>
+#include <vector>
+
+struct Benchmark {
+    GMainLoop* loop { nullptr };
+    WKRetainPtr<WKContextRef> context;
+    WKRetainPtr<WKPageConfigurationRef> pageConfiguration;
+    WKRetainPtr<WKViewRef> view;
+    unsigned iterationCount { 20 };
+    gint64 launchStartTime { 0 };
+    std::vector<double> launchTimes;
+};
+
+static void startIteration(Benchmark&);
+
+static void renderingProgressDidChange(WKPageRef, WKPageRenderingProgressEvents progressEvents, WKTypeRef, const void* clientInfo)
+{
+    if (!(progressEvents & WKPageRenderingProgressEventFirstVisuallyNonEmptyLayout))
+        return;
+
+    auto& benchmark = *static_cast<Benchmark*>(const_cast<void*>(clientInfo));
+    benchmark.launchTimes.push_back((g_get_monotonic_time() - benchmark.launchStartTime) / 1000.);
+
+    // Don't destroy the view from one of its callbacks.
+    g_idle_add([](gpointer userData) -> gboolean {
+        auto& benchmark = *static_cast<Benchmark*>(userData);
+        // Closing the page terminates its web process, the next view gets a new one.
+        WKPageClose(WKViewGetPage(benchmark.view.get()));
+        benchmark.view = nullptr;
+        if (benchmark.launchTimes.size() == benchmark.iterationCount)
+            g_main_loop_quit(benchmark.loop);
+        else
+            startIteration(benchmark);
+        return G_SOURCE_REMOVE;
+    }, &benchmark);
+}
+
+static void webProcessDidCrash(WKPageRef, const void*)
+{
+    fprintf(stderr, "The web process crashed.\n");
+    exit(EXIT_FAILURE);
+}
+
+static void startIteration(Benchmark& benchmark)
+{
+    benchmark.launchStartTime = g_get_monotonic_time();
+    benchmark.view = adoptWK(WKViewCreate(benchmark.pageConfiguration.get()));
+    auto page = WKViewGetPage(benchmark.view.get());
+
+    WKPageNavigationClientV0 navigationClient = { };
+    navigationClient.base = { 0, &benchmark };
+    navigationClient.renderingProgressDidChange = renderingProgressDidChange;
+    navigationClient.webProcessDidCrash = webProcessDidCrash;
+    WKPageSetPageNavigationClient(page, &navigationClient.base);
+    WKPageListenForLayoutMilestones(page, kWKDidFirstVisuallyNonEmptyLayout);
+
+    auto html = adoptWK(WKStringCreateWithUTF8CString("<html><body><h1>WPE launch benchmark</h1><p>Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.</p></body></html>"));
+    WKPageLoadHTMLString(page, html.get(), nullptr);
+}
+
+static double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    size_t middle = values.size() / 2;
+    return values.size() % 2 ? values[middle] : (values[middle - 1] + values[middle]) / 2;
+}
+
+int main(int argc, char* argv[])
+{
+    Benchmark benchmark;
+    if (argc > 1)
+        benchmark.iterationCount = std::max(atoi(argv[1]), 2);
+
+    benchmark.loop = g_main_loop_new(g_main_context_default(), FALSE);
+    benchmark.context = adoptWK(WKContextCreate());
+    WKContextSetProcessModel(benchmark.context.get(), kWKProcessModelMultipleSecondaryProcesses);
+    WKContextSetMaximumNumberOfProcesses(benchmark.context.get(), benchmark.iterationCount);
+
+    auto pageGroupIdentifier = adoptWK(WKStringCreateWithUTF8CString("WPELaunchBenchmarkPageGroup"));
+    auto pageGroup = adoptWK(WKPageGroupCreateWithIdentifier(pageGroupIdentifier.get()));
+    benchmark.pageConfiguration = adoptWK(WKPageConfigurationCreate());
+    WKPageConfigurationSetContext(benchmark.pageConfiguration.get(), benchmark.context.get());
+    WKPageConfigurationSetPageGroup(benchmark.pageConfiguration.get(), pageGroup.get());
+
+    startIteration(benchmark);
+    g_main_loop_run(benchmark.loop);
+    g_main_loop_unref(benchmark.loop);
+
+    // The first launch also starts the network process and the zygote, it is reported on its own.
+    std::vector<double> launchTimes(benchmark.launchTimes.begin() + 1, benchmark.launchTimes.end());
+    printf("Process launcher: %s\n", g_getenv("WEBKIT_DISABLE_PROCESS_ZYGOTE") ? "spawn" : "zygote");
+    printf("First launch to first visually non-empty layout: %.2f ms\n", benchmark.launchTimes.front());
+    printf("Following launches (%zu): median %.2f ms, minimum %.2f ms, maximum %.2f ms\n", launchTimes.size(), median(launchTimes),
+        *std::min_element(launchTimes.begin(), launchTimes.end()), *std::max_element(launchTimes.begin(), launchTimes.end()));
+    return EXIT_SUCCESS;
+}